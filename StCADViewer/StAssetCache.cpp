@@ -0,0 +1,691 @@
+/**
+ * This source is a part of sView program.
+ *
+ * Copyright © Kirill Gavrilov, 2026
+ */
+
+#include "StAssetCache.h"
+
+#include <StFile/StFileNode.h>
+#include <StFile/StFolder.h>
+#include <StFile/StRawFile.h>
+#include <StStrings/StLogger.h>
+#include <StThreads/StTimer.h>
+
+#include <gp_Quaternion.hxx>
+
+#include <map>
+
+namespace {
+
+    /**
+     * Cache file format version, should be increased on any change in document structure or importers.
+     */
+    static const uint32_t THE_CACHE_VERSION = 1;
+
+    /**
+     * Value to detect files written on platform with another byte order.
+     */
+    static const uint32_t THE_BYTE_ORDER = 0x01020304;
+
+    static const char THE_CACHE_MAGIC[8] = { 'S', 'T', 'M', 'E', 'S', 'H', '\0', '\0' };
+
+    /**
+     * Alignment of array blobs.
+     */
+    static const uint64_t THE_BLOB_ALIGN = 16;
+
+    /**
+     * Texture kind.
+     */
+    enum StCacheTexture {
+        StCacheTexture_NONE = 0, //!< no texture
+        StCacheTexture_File,     //!< image file
+        StCacheTexture_BinRange, //!< image within binary glTF file
+        StCacheTexture_Buffer,   //!< image data stored within cache
+    };
+
+    /**
+     * Cache file header.
+     */
+    struct StCacheHeader {
+        char     Magic[8];
+        uint32_t Version;
+        uint32_t ByteOrder;
+        uint64_t SourceSize;
+        int64_t  SourceModTime;
+        uint64_t ImportKeyHash;
+        uint64_t FileSize;
+        uint64_t NbNodes;
+        uint64_t NbMaterials;
+        uint64_t NbPrimArrays;
+        uint64_t NodesOffset;
+        uint64_t MaterialsOffset;
+        uint64_t PrimArraysOffset;
+        uint64_t StringsOffset;
+        uint64_t StringsSize;
+    };
+
+    /**
+     * String within string pool.
+     */
+    struct StCacheString {
+        uint64_t Offset;
+        uint64_t Length;
+    };
+
+    /**
+     * Array blob.
+     */
+    struct StCacheBlob {
+        uint64_t Offset;
+        uint64_t Count;
+    };
+
+    /**
+     * Transformation preserving gp_Trsf form.
+     */
+    struct StCacheTrsf {
+        double  Rotation[4];
+        double  Translation[3];
+        double  Scale;
+        int32_t Form;
+        int32_t Padding;
+    };
+
+    /**
+     * Node record, nodes are stored in depth-first order (parent goes before children).
+     */
+    struct StCacheNode {
+        int32_t       Type;
+        int32_t       Parent;
+        int32_t       Instance;      //!< index of the same node met before, or -1
+        int32_t       Padding;
+        StCacheString Name;
+        StCacheTrsf   Trsf;
+        uint64_t      FirstPrimArray;
+        uint64_t      NbPrimArrays;
+    };
+
+    /**
+     * Material record.
+     */
+    struct StCacheMaterial {
+        float         Colors[5][4];
+        StCacheString Name;
+        int32_t       TextureKind;
+        int32_t       TextureLength;
+        int64_t       TextureStart;
+        StCacheString TextureUri;
+        StCacheString TextureMime;
+        StCacheBlob   TextureData;
+    };
+
+    /**
+     * Primitive array record.
+     */
+    struct StCachePrimArray {
+        int32_t     Material;
+        int32_t     Padding;
+        StCacheTrsf Trsf;
+        StCacheBlob Positions;
+        StCacheBlob Normals;
+        StCacheBlob TexCoords0;
+        StCacheBlob Indices;
+    };
+
+    /**
+     * FNV-1a hash of the string.
+     */
+    static uint64_t hashString(const StString& theString,
+                               uint64_t        theHash = 14695981039346656037ULL) {
+        const char* aData = theString.toCString();
+        for(size_t anIter = 0; anIter < theString.getSize(); ++anIter) {
+            theHash ^= (uint8_t )aData[anIter];
+            theHash *= 1099511628211ULL;
+        }
+        return theHash;
+    }
+
+    inline uint64_t alignBlob(const uint64_t theOffset) {
+        return (theOffset + THE_BLOB_ALIGN - 1) & ~(THE_BLOB_ALIGN - 1);
+    }
+
+    static void fillTrsf(StCacheTrsf&   theRec,
+                         const gp_Trsf& theTrsf) {
+        stMemZero(&theRec, sizeof(theRec));
+        const gp_Quaternion aRot = theTrsf.GetRotation();
+        const gp_XYZ&       aLoc = theTrsf.TranslationPart();
+        theRec.Rotation[0]    = aRot.X();
+        theRec.Rotation[1]    = aRot.Y();
+        theRec.Rotation[2]    = aRot.Z();
+        theRec.Rotation[3]    = aRot.W();
+        theRec.Translation[0] = aLoc.X();
+        theRec.Translation[1] = aLoc.Y();
+        theRec.Translation[2] = aLoc.Z();
+        theRec.Scale          = theTrsf.ScaleFactor();
+        theRec.Form           = (int32_t )theTrsf.Form();
+    }
+
+    static gp_Trsf readTrsf(const StCacheTrsf& theRec) {
+        gp_Trsf aTrsf;
+        if(theRec.Form == (int32_t )gp_Identity) {
+            return aTrsf;
+        }
+
+        aTrsf.SetTransformation(gp_Quaternion(theRec.Rotation[0], theRec.Rotation[1], theRec.Rotation[2], theRec.Rotation[3]),
+                                gp_Vec(theRec.Translation[0], theRec.Translation[1], theRec.Translation[2]));
+        if(theRec.Scale != 1.0) {
+            aTrsf.SetScaleFactor(theRec.Scale);
+        }
+        return aTrsf;
+    }
+
+    /**
+     * Layout of the cache file being written.
+     */
+    class StCacheWriter {
+
+            public:
+
+        StCacheWriter() : myBlobsSize(0) {}
+
+        /**
+         * Collect document nodes recursively.
+         */
+        void addNode(const Handle(StDocNode)& theNode,
+                     const int                theParent) {
+            StCacheNode aRec;
+            stMemZero(&aRec, sizeof(aRec));
+            aRec.Type     = (int32_t )theNode->nodeType();
+            aRec.Parent   = theParent;
+            aRec.Instance = -1;
+            aRec.Name     = addString(theNode->nodeName());
+            fillTrsf(aRec.Trsf, theNode->nodeTransformation());
+
+            std::map<const StDocNode*, int>::const_iterator anInstance = myNodeMap.find(theNode.get());
+            if(anInstance != myNodeMap.end()) {
+                aRec.Instance = anInstance->second;
+                Nodes.push_back(aRec);
+                return;
+            }
+
+            const int aNodeIndex = int(Nodes.size());
+            myNodeMap[theNode.get()] = aNodeIndex;
+            Handle(StDocMeshNode) aMeshNode = Handle(StDocMeshNode)::DownCast(theNode);
+            if(!aMeshNode.IsNull()) {
+                aRec.FirstPrimArray = PrimArrays.size();
+                for(NCollection_Sequence<Handle(StPrimArray)>::Iterator aPrimIter(aMeshNode->PrimitiveArrays()); aPrimIter.More(); aPrimIter.Next()) {
+                    addPrimArray(aPrimIter.Value());
+                }
+                aRec.NbPrimArrays = PrimArrays.size() - aRec.FirstPrimArray;
+            }
+            Nodes.push_back(aRec);
+
+            for(NCollection_Sequence<Handle(StDocNode)>::Iterator aChildIter(theNode->Children()); aChildIter.More(); aChildIter.Next()) {
+                addNode(aChildIter.Value(), aNodeIndex);
+            }
+        }
+
+        /**
+         * Compute offsets and write the file.
+         */
+        bool write(const StString& thePath,
+                   StCacheHeader&  theHeader) {
+            theHeader.NbNodes          = Nodes.size();
+            theHeader.NbMaterials      = Materials.size();
+            theHeader.NbPrimArrays     = PrimArrays.size();
+            theHeader.NodesOffset      = sizeof(StCacheHeader);
+            theHeader.MaterialsOffset  = theHeader.NodesOffset     + Nodes.size()      * sizeof(StCacheNode);
+            theHeader.PrimArraysOffset = theHeader.MaterialsOffset + Materials.size()  * sizeof(StCacheMaterial);
+            theHeader.StringsOffset    = theHeader.PrimArraysOffset + PrimArrays.size() * sizeof(StCachePrimArray);
+            theHeader.StringsSize      = myStrings.size();
+            const uint64_t aBlobsOffset = alignBlob(theHeader.StringsOffset + theHeader.StringsSize);
+            theHeader.FileSize         = aBlobsOffset + myBlobsSize;
+
+            // blob offsets have been computed relative to the blobs section
+            for(size_t aMatIter = 0; aMatIter < Materials.size(); ++aMatIter) {
+                if(Materials[aMatIter].TextureData.Count != 0) {
+                    Materials[aMatIter].TextureData.Offset += aBlobsOffset;
+                }
+            }
+            for(size_t aPrimIter = 0; aPrimIter < PrimArrays.size(); ++aPrimIter) {
+                StCachePrimArray& aRec = PrimArrays[aPrimIter];
+                aRec.Positions .Offset += aBlobsOffset;
+                aRec.Normals   .Offset += aBlobsOffset;
+                aRec.TexCoords0.Offset += aBlobsOffset;
+                aRec.Indices   .Offset += aBlobsOffset;
+            }
+
+            // write into temporary file to avoid broken cache on failure
+            const StString aTmpPath = thePath + ".tmp";
+            StRawFile aFile;
+            if(!aFile.openFile(StRawFile::WRITE, aTmpPath)) {
+                return false;
+            }
+
+            bool isOk = writeData(aFile, &theHeader, sizeof(theHeader));
+            isOk = isOk && (Nodes.empty()      || writeData(aFile, &Nodes[0],      Nodes.size()      * sizeof(StCacheNode)));
+            isOk = isOk && (Materials.empty()  || writeData(aFile, &Materials[0],  Materials.size()  * sizeof(StCacheMaterial)));
+            isOk = isOk && (PrimArrays.empty() || writeData(aFile, &PrimArrays[0], PrimArrays.size() * sizeof(StCachePrimArray)));
+            isOk = isOk && (myStrings.empty()  || writeData(aFile, &myStrings[0],  myStrings.size()));
+            uint64_t aWritten = theHeader.StringsOffset + theHeader.StringsSize;
+            for(size_t aBlobIter = 0; isOk && aBlobIter < myBlobs.size(); ++aBlobIter) {
+                const Blob& aBlob = myBlobs[aBlobIter];
+                isOk = writePadding(aFile, aWritten)
+                    && writeData(aFile, aBlob.Data, aBlob.Size);
+                aWritten = alignBlob(aWritten) + aBlob.Size;
+            }
+            isOk = isOk && (myBlobs.empty() ? writePadding(aFile, aWritten) : true);
+            aFile.closeFile();
+
+            if(!isOk) {
+                StFileNode::removeFile(aTmpPath);
+                return false;
+            }
+            StFileNode::removeFile(thePath);
+            if(!StFileNode::moveFile(aTmpPath, thePath)) {
+                StFileNode::removeFile(aTmpPath);
+                return false;
+            }
+            return true;
+        }
+
+            public:
+
+        std::vector<StCacheNode>      Nodes;
+        std::vector<StCacheMaterial>  Materials;
+        std::vector<StCachePrimArray> PrimArrays;
+
+            private:
+
+        /**
+         * Array to be written into the file.
+         */
+        struct Blob {
+            const void* Data;
+            size_t      Size;
+        };
+
+            private:
+
+        StCacheString addString(const StString& theString) {
+            StCacheString aRec;
+            aRec.Offset = myStrings.size();
+            aRec.Length = theString.getSize();
+            myStrings.insert(myStrings.end(), theString.toCString(), theString.toCString() + theString.getSize());
+            myStrings.push_back('\0');
+            return aRec;
+        }
+
+        StCacheBlob addBlob(const void*  theData,
+                            const size_t theCount,
+                            const size_t theItemSize) {
+            StCacheBlob aRec;
+            aRec.Count  = theCount;
+            aRec.Offset = 0;
+            if(theCount == 0) {
+                return aRec;
+            }
+
+            myBlobsSize = alignBlob(myBlobsSize);
+            aRec.Offset = myBlobsSize;
+            Blob aBlob;
+            aBlob.Data = theData;
+            aBlob.Size = theCount * theItemSize;
+            myBlobs.push_back(aBlob);
+            myBlobsSize += aBlob.Size;
+            return aRec;
+        }
+
+        int addMaterial(const Handle(StGLMaterial)& theMat) {
+            if(theMat.IsNull()) {
+                return -1;
+            }
+
+            std::map<const StGLMaterial*, int>::const_iterator aFound = myMaterialMap.find(theMat.get());
+            if(aFound != myMaterialMap.end()) {
+                return aFound->second;
+            }
+
+            StCacheMaterial aRec;
+            stMemZero(&aRec, sizeof(aRec));
+            const StGLVec4* aColors[5] = { &theMat->DiffuseColor, &theMat->AmbientColor, &theMat->SpecularColor, &theMat->EmissiveColor, &theMat->Params };
+            for(int aColorIter = 0; aColorIter < 5; ++aColorIter) {
+                for(int aCompIter = 0; aCompIter < 4; ++aCompIter) {
+                    aRec.Colors[aColorIter][aCompIter] = (*aColors[aColorIter])[aCompIter];
+                }
+            }
+            aRec.Name = addString(theMat->Name);
+            if(!theMat->Texture.IsNull()) {
+                aRec.TextureUri = addString(theMat->Texture->getImageUri());
+                aRec.TextureKind = StCacheTexture_File;
+                Handle(StGltfBinTexture) aBinTex = Handle(StGltfBinTexture)::DownCast(theMat->Texture);
+                if(!aBinTex.IsNull()) {
+                    aRec.TextureMime = addString(aBinTex->getMime());
+                    if(!aBinTex->getBuffer().IsNull()) {
+                        aRec.TextureKind = StCacheTexture_Buffer;
+                        aRec.TextureData = addBlob(aBinTex->getBuffer()->Data(), aBinTex->getBuffer()->Size(), 1);
+                    } else {
+                        aRec.TextureKind   = StCacheTexture_BinRange;
+                        aRec.TextureStart  = aBinTex->getStart();
+                        aRec.TextureLength = aBinTex->getLength();
+                    }
+                }
+            }
+
+            const int anIndex = int(Materials.size());
+            Materials.push_back(aRec);
+            myMaterialMap[theMat.get()] = anIndex;
+            return anIndex;
+        }
+
+        void addPrimArray(const Handle(StPrimArray)& thePrims) {
+            StCachePrimArray aRec;
+            stMemZero(&aRec, sizeof(aRec));
+            aRec.Material   = addMaterial(thePrims->Material);
+            fillTrsf(aRec.Trsf, thePrims->Trsf);
+            aRec.Positions  = addBlob(thePrims->Positions .empty() ? NULL : &thePrims->Positions [0], thePrims->Positions .size(), sizeof(StGLVec3));
+            aRec.Normals    = addBlob(thePrims->Normals   .empty() ? NULL : &thePrims->Normals   [0], thePrims->Normals   .size(), sizeof(StGLVec3));
+            aRec.TexCoords0 = addBlob(thePrims->TexCoords0.empty() ? NULL : &thePrims->TexCoords0[0], thePrims->TexCoords0.size(), sizeof(StGLVec2));
+            aRec.Indices    = addBlob(thePrims->Indices   .empty() ? NULL : &thePrims->Indices   [0], thePrims->Indices   .size(), sizeof(GLuint));
+            PrimArrays.push_back(aRec);
+        }
+
+        static bool writeData(StRawFile&   theFile,
+                              const void*  theData,
+                              const size_t theSize) {
+            return theFile.write((const char* )theData, theSize) == theSize;
+        }
+
+        static bool writePadding(StRawFile&     theFile,
+                                 const uint64_t theWritten) {
+            static const char THE_ZEROS[THE_BLOB_ALIGN] = { 0 };
+            const size_t aPadding = size_t(alignBlob(theWritten) - theWritten);
+            return aPadding == 0
+                || writeData(theFile, THE_ZEROS, aPadding);
+        }
+
+            private:
+
+        std::map<const StDocNode*, int>    myNodeMap;
+        std::map<const StGLMaterial*, int> myMaterialMap;
+        std::vector<char>                  myStrings;
+        std::vector<Blob>                  myBlobs;
+        uint64_t                           myBlobsSize;
+
+    };
+
+    /**
+     * Read-only view of cache file content.
+     */
+    class StCacheReader {
+
+            public:
+
+        StCacheReader(const uint8_t* theData,
+                      const uint64_t theSize)
+        : myData(theData), mySize(theSize) {}
+
+        /**
+         * Return pointer to the table or NULL if it is out of range.
+         */
+        template<typename T>
+        const T* table(const uint64_t theOffset,
+                       const uint64_t theCount) const {
+            if(theCount == 0) {
+                return NULL;
+            }
+            if(theOffset > mySize
+            || theCount > (mySize - theOffset) / sizeof(T)) {
+                return NULL;
+            }
+            return (const T* )(myData + theOffset);
+        }
+
+        /**
+         * Return true if blob is within file.
+         */
+        bool isValid(const StCacheBlob& theBlob,
+                     const size_t       theItemSize) const {
+            return theBlob.Count == 0
+                || (theBlob.Offset <= mySize
+                 && theBlob.Count <= (mySize - theBlob.Offset) / theItemSize);
+        }
+
+        /**
+         * Copy blob into vector.
+         */
+        template<typename T>
+        void readBlob(std::vector<T>&    theVec,
+                      const StCacheBlob& theBlob) const {
+            theVec.resize(size_t(theBlob.Count));
+            if(theBlob.Count != 0) {
+                stMemCpy(&theVec[0], myData + theBlob.Offset, size_t(theBlob.Count) * sizeof(T));
+            }
+        }
+
+        /**
+         * Return string from the pool.
+         */
+        StString string(const StCacheString& theRec,
+                        const StCacheHeader& theHeader) const {
+            if(theRec.Length == 0
+            || theRec.Offset > theHeader.StringsSize
+            || theRec.Length >= theHeader.StringsSize - theRec.Offset) {
+                return StString();
+            }
+
+            // strings within the pool are NULL-terminated
+            const char* aStr = (const char* )myData + theHeader.StringsOffset + theRec.Offset;
+            if(aStr[theRec.Length] != '\0') {
+                return StString();
+            }
+            return StString(aStr);
+        }
+
+            private:
+
+        const uint8_t* myData;
+        uint64_t       mySize;
+
+    };
+
+}
+
+StAssetCache::StAssetCache(const StString& theCacheFolder) {
+    if(!theCacheFolder.isEmpty()) {
+        myFolder = theCacheFolder + "meshes/";
+        StFolder::createFolder(myFolder);
+    }
+}
+
+StString StAssetCache::getCachePath(const StString& theFilePath) const {
+    char aName[64];
+    stsprintf(aName, sizeof(aName), "%016llx.stmesh", (unsigned long long )hashString(theFilePath));
+    return myFolder + aName;
+}
+
+bool StAssetCache::read(const Handle(StAssetDocument)& theDoc,
+                        const StString&                theFilePath,
+                        const StString&                theImportKey) const {
+    int64_t aFileSize = 0, aModTime = 0;
+    if(!isEnabled()
+    || !StFileNode::getFileStats(theFilePath, aFileSize, aModTime)) {
+        return false;
+    }
+
+    const StString aCachePath = getCachePath(theFilePath);
+    if(!StFileNode::isFileExists(aCachePath)) {
+        return false;
+    }
+
+    // check header before reading whole file
+    StRawFile aFile;
+    if(!aFile.readFile(aCachePath, -1, sizeof(StCacheHeader))
+    ||  aFile.getSize() < sizeof(StCacheHeader)) {
+        return false;
+    }
+
+    StCacheHeader aHeader;
+    stMemCpy(&aHeader, aFile.getBuffer(), sizeof(aHeader));
+    if(std::memcmp(aHeader.Magic, THE_CACHE_MAGIC, sizeof(THE_CACHE_MAGIC)) != 0
+    || aHeader.Version       != THE_CACHE_VERSION
+    || aHeader.ByteOrder     != THE_BYTE_ORDER
+    || aHeader.SourceSize    != uint64_t(aFileSize)
+    || aHeader.SourceModTime != aModTime
+    || aHeader.ImportKeyHash != hashString(theImportKey, hashString(theFilePath))) {
+        ST_DEBUG_LOG("StAssetCache, outdated cache for '" + theFilePath + "'");
+        return false;
+    }
+
+    StTimer aTimer(true);
+    if(!aFile.readFile(aCachePath)
+    ||  aFile.getSize() != aHeader.FileSize) {
+        return false;
+    }
+
+    const StCacheReader aReader(aFile.getBuffer(), aFile.getSize());
+    const StCacheNode*      aNodes     = aReader.table<StCacheNode>     (aHeader.NodesOffset,      aHeader.NbNodes);
+    const StCacheMaterial*  aMaterials = aReader.table<StCacheMaterial> (aHeader.MaterialsOffset,  aHeader.NbMaterials);
+    const StCachePrimArray* aPrimRecs  = aReader.table<StCachePrimArray>(aHeader.PrimArraysOffset, aHeader.NbPrimArrays);
+    if(aNodes == NULL
+    || (aMaterials == NULL && aHeader.NbMaterials  != 0)
+    || (aPrimRecs  == NULL && aHeader.NbPrimArrays != 0)
+    || (aReader.table<char>(aHeader.StringsOffset, aHeader.StringsSize) == NULL && aHeader.StringsSize != 0)
+    || aNodes[0].Type != (int32_t )StDocNodeType_Object) {
+        return false;
+    }
+
+    std::vector<Handle(StGLMaterial)> aMatList(size_t(aHeader.NbMaterials));
+    for(size_t aMatIter = 0; aMatIter < aMatList.size(); ++aMatIter) {
+        const StCacheMaterial& aRec = aMaterials[aMatIter];
+        Handle(StGLMaterial) aMat = new StGLMaterial();
+        StGLVec4* aColors[5] = { &aMat->DiffuseColor, &aMat->AmbientColor, &aMat->SpecularColor, &aMat->EmissiveColor, &aMat->Params };
+        for(int aColorIter = 0; aColorIter < 5; ++aColorIter) {
+            *aColors[aColorIter] = StGLVec4(aRec.Colors[aColorIter][0], aRec.Colors[aColorIter][1],
+                                            aRec.Colors[aColorIter][2], aRec.Colors[aColorIter][3]);
+        }
+        aMat->Name = aReader.string(aRec.Name, aHeader);
+
+        const StString anUri = aReader.string(aRec.TextureUri, aHeader);
+        switch(aRec.TextureKind) {
+            case StCacheTexture_File: {
+                aMat->Texture = new StAssetTexture(anUri);
+                break;
+            }
+            case StCacheTexture_BinRange: {
+                aMat->Texture = new StGltfBinTexture(anUri, aReader.string(aRec.TextureMime, aHeader), aRec.TextureStart, aRec.TextureLength);
+                break;
+            }
+            case StCacheTexture_Buffer: {
+                if(!aReader.isValid(aRec.TextureData, 1)) {
+                    return false;
+                }
+                Handle(NCollection_Buffer) aData = new NCollection_Buffer(NCollection_BaseAllocator::CommonBaseAllocator());
+                if(!aData->Allocate(size_t(aRec.TextureData.Count))) {
+                    return false;
+                }
+                stMemCpy(aData->ChangeData(), aFile.getBuffer() + aRec.TextureData.Offset, size_t(aRec.TextureData.Count));
+                aMat->Texture = new StGltfBinTexture(anUri, aReader.string(aRec.TextureMime, aHeader), aData);
+                break;
+            }
+            default: break;
+        }
+        aMatList[aMatIter] = aMat;
+    }
+
+    std::vector<Handle(StPrimArray)> aPrimList(size_t(aHeader.NbPrimArrays));
+    for(size_t aPrimIter = 0; aPrimIter < aPrimList.size(); ++aPrimIter) {
+        const StCachePrimArray& aRec = aPrimRecs[aPrimIter];
+        if(!aReader.isValid(aRec.Positions,  sizeof(StGLVec3))
+        || !aReader.isValid(aRec.Normals,    sizeof(StGLVec3))
+        || !aReader.isValid(aRec.TexCoords0, sizeof(StGLVec2))
+        || !aReader.isValid(aRec.Indices,    sizeof(GLuint))
+        || aRec.Material >= int32_t(aMatList.size())) {
+            return false;
+        }
+
+        Handle(StPrimArray) aPrims = new StPrimArray();
+        aPrims->Trsf = readTrsf(aRec.Trsf);
+        if(aRec.Material >= 0) {
+            aPrims->Material = aMatList[aRec.Material];
+        }
+        aReader.readBlob(aPrims->Positions,  aRec.Positions);
+        aReader.readBlob(aPrims->Normals,    aRec.Normals);
+        aReader.readBlob(aPrims->TexCoords0, aRec.TexCoords0);
+        aReader.readBlob(aPrims->Indices,    aRec.Indices);
+        aPrimList[aPrimIter] = aPrims;
+    }
+
+    std::vector<Handle(StDocNode)> aNodeList(size_t(aHeader.NbNodes));
+    for(size_t aNodeIter = 0; aNodeIter < aNodeList.size(); ++aNodeIter) {
+        const StCacheNode& aRec = aNodes[aNodeIter];
+        if(aNodeIter != 0
+        && (aRec.Parent < 0 || aRec.Parent >= int32_t(aNodeIter))) {
+            return false;
+        }
+
+        Handle(StDocNode) aNode;
+        if(aNodeIter == 0) {
+            aNode = theDoc;
+        } else if(aRec.Instance >= 0) {
+            if(aRec.Instance >= int32_t(aNodeIter)) {
+                return false;
+            }
+            aNode = aNodeList[aRec.Instance];
+        } else if(aRec.Type == (int32_t )StDocNodeType_Mesh) {
+            Handle(StDocMeshNode) aMeshNode = new StDocMeshNode();
+            if(aRec.FirstPrimArray > aPrimList.size()
+            || aRec.NbPrimArrays   > aPrimList.size() - aRec.FirstPrimArray) {
+                return false;
+            }
+            for(size_t aPrimIter = 0; aPrimIter < aRec.NbPrimArrays; ++aPrimIter) {
+                aMeshNode->ChangePrimitiveArrays().Append(aPrimList[size_t(aRec.FirstPrimArray) + aPrimIter]);
+            }
+            aNode = aMeshNode;
+        } else {
+            aNode = new StDocObjectNode();
+        }
+
+        if(aRec.Instance < 0) {
+            aNode->setNodeName(aReader.string(aRec.Name, aHeader));
+            aNode->setNodeTransformation(readTrsf(aRec.Trsf));
+        }
+        aNodeList[aNodeIter] = aNode;
+        if(aNodeIter != 0) {
+            aNodeList[aRec.Parent]->ChangeChildren().Append(aNode);
+        }
+    }
+
+    ST_DEBUG_LOG("StAssetCache, '" + theFilePath + "' has been read from cache in " + StString(aTimer.getElapsedTimeInMilliSec()) + " ms");
+    return true;
+}
+
+bool StAssetCache::write(const Handle(StAssetDocument)& theDoc,
+                         const StString&                theFilePath,
+                         const StString&                theImportKey) const {
+    int64_t aFileSize = 0, aModTime = 0;
+    if(!isEnabled()
+    ||  theDoc.IsNull()
+    || !StFileNode::getFileStats(theFilePath, aFileSize, aModTime)) {
+        return false;
+    }
+
+    StCacheHeader aHeader;
+    stMemZero(&aHeader, sizeof(aHeader));
+    stMemCpy(aHeader.Magic, THE_CACHE_MAGIC, sizeof(THE_CACHE_MAGIC));
+    aHeader.Version       = THE_CACHE_VERSION;
+    aHeader.ByteOrder     = THE_BYTE_ORDER;
+    aHeader.SourceSize    = uint64_t(aFileSize);
+    aHeader.SourceModTime = aModTime;
+    aHeader.ImportKeyHash = hashString(theImportKey, hashString(theFilePath));
+
+    StCacheWriter aWriter;
+    aWriter.addNode(theDoc, -1);
+    if(!aWriter.write(getCachePath(theFilePath), aHeader)) {
+        ST_ERROR_LOG("StAssetCache, unable to write cache for '" + theFilePath + "'");
+        return false;
+    }
+    return true;
+}
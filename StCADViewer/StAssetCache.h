@@ -0,0 +1,71 @@
+/**
+ * This source is a part of sView program.
+ *
+ * Copyright © Kirill Gavrilov, 2026
+ */
+
+#ifndef __StAssetCache_h_
+#define __StAssetCache_h_
+
+#include "StAssetDocument.h"
+
+/**
+ * Binary cache of imported documents.
+ * Each source file has one cache file keyed by file path hash,
+ * which stores the node hierarchy, transformations, materials and primitive arrays.
+ * The cache file remembers size and modification time of the source file and import settings,
+ * so that it is ignored (and overwritten) when any of them changes.
+ *
+ * The file layout is flat: fixed-size tables followed by the string pool and 16-byte aligned array blobs,
+ * all addressed by absolute offsets, so that the file can be read at once (or memory-mapped) without parsing.
+ */
+class StAssetCache {
+
+        public:
+
+    /**
+     * Main constructor.
+     * @param theCacheFolder application cache folder, cache is disabled when empty
+     */
+    ST_LOCAL StAssetCache(const StString& theCacheFolder);
+
+    /**
+     * @return true if cache folder is defined
+     */
+    ST_LOCAL bool isEnabled() const { return !myFolder.isEmpty(); }
+
+    /**
+     * Read document from cache.
+     * @param theDoc       empty document to fill
+     * @param theFilePath  source file path
+     * @param theImportKey string identifying import settings
+     * @return FALSE if cache is missing or outdated
+     */
+    ST_LOCAL bool read(const Handle(StAssetDocument)& theDoc,
+                       const StString&                theFilePath,
+                       const StString&                theImportKey) const;
+
+    /**
+     * Store document into cache.
+     * @param theDoc       imported document
+     * @param theFilePath  source file path
+     * @param theImportKey string identifying import settings
+     */
+    ST_LOCAL bool write(const Handle(StAssetDocument)& theDoc,
+                        const StString&                theFilePath,
+                        const StString&                theImportKey) const;
+
+        private:
+
+    /**
+     * @return path to the cache file for specified source file
+     */
+    ST_LOCAL StString getCachePath(const StString& theFilePath) const;
+
+        private:
+
+    StString myFolder; //!< folder with cache files
+
+};
+
+#endif // __StAssetCache_h_
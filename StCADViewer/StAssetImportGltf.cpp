@@ -10,8 +10,6 @@
 
 #include "StAssetImportGltf.h"
 
-#include "StImageOcct.h"
-
 #include <StStrings/StLogger.h>
 #include <StTemplates/StArrayStreamBuffer.h>
 
@@ -30,6 +28,16 @@ namespace
     const char THE_KHR_materials_common[] = "KHR_materials_common";
     const char THE_KHR_binary_glTF[]      = "KHR_binary_glTF";
 
+    /**
+     * Maximum number of boxes within coarse preview.
+     */
+    static const int THE_PREVIEW_MAX_BOXES = 4096;
+
+    /**
+     * Maximum depth of scene nodes hierarchy within coarse preview.
+     */
+    static const int THE_PREVIEW_MAX_DEPTH = 64;
+
     //! Look-up table for decoding base64 stream.
     static const stUByte_t THE_BASE64_FROM[128] = {
         255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
@@ -106,113 +114,6 @@ namespace
 
 }
 
-/**
- * Image texture embedded into binary glTF file.
- */
-class StGltfBinTexture : public StAssetTexture {
-
-    DEFINE_STANDARD_RTTI_INLINE(StGltfBinTexture, StAssetTexture)
-
-        public:
-
-    /**
-     * Constructor.
-     */
-    StGltfBinTexture(const StString& theUri,
-                     const StString& theMime,
-                     const int64_t theStart,
-                     const int theLen)
-    : StAssetTexture(theUri),
-      myStart(theStart),
-      myLen(theLen),
-      myMime(theMime) {
-        if(!theUri.isEmpty()) {
-            const StString anId = StString("texture://") + theUri + "@offset=" + StString(theStart) + "@len=" + StString(theLen);
-            myTexId = anId.toCString();
-        }
-    }
-
-    /**
-     * Constructor.
-     */
-    StGltfBinTexture(const StString& theUri,
-                     const StString& theMime,
-                     const Handle(NCollection_Buffer)& theBuffer)
-    : StAssetTexture(theUri),
-      myStart(0),
-      myLen(0),
-      myBuffer(theBuffer),
-      myMime(theMime) {
-        if(!theUri.isEmpty()) {
-            const StString anId = StString("texture://") + theUri + "@base64";
-            myTexId = anId.toCString();
-        }
-    }
-
-    /**
-     * Image getter.
-     */
-    virtual Handle(Image_PixMap) GetImage() const Standard_OVERRIDE {
-        Handle(Image_PixMap) anImage;
-        if(!myBuffer.IsNull()) {
-            Handle(StImageOcct) anStImage = new StImageOcct();
-            if(anStImage->Load(myImageUri, StMIME(myMime, StString(), StString()), myBuffer->ChangeData(), (int )myBuffer->Size())) {
-                anImage = anStImage;
-            }
-        } else {
-            std::ifstream aFile;
-            OSD_OpenStream(aFile, myImageUri.toCString(), std::ios::in | std::ios::binary);
-            if(!aFile.is_open() || !aFile.good()) {
-                ST_ERROR_LOG(StString() + "Texture points to non existing file '" + myImageUri.toCString() + "'");
-                return false;
-            }
-
-            aFile.seekg(myStart, std::ios_base::beg);
-            if(!aFile.good()) {
-                aFile.close();
-                ST_ERROR_LOG(StString() + "Texture refers to non-existing location");
-                return false;
-            }
-
-            Handle(NCollection_Buffer) aData = new NCollection_Buffer(NCollection_BaseAllocator::CommonBaseAllocator());
-            if(!aData->Allocate(myLen)) {
-                ST_ERROR_LOG("Fail to allocate memory.");
-                return false;
-            }
-
-            if(!aFile.read((char* )aData->ChangeData(), myLen)) {
-                ST_ERROR_LOG(StString() + "Texture refers to non-existing location");
-                return false;
-            }
-
-            Handle(StImageOcct) anStImage = new StImageOcct();
-            if(anStImage->Load(myImageUri, StMIME(myMime, StString(), StString()), aData->ChangeData(), myLen)) {
-                anImage = anStImage;
-            }
-        }
-
-        if(anImage.IsNull()) {
-            return Handle(Image_PixMap)();
-        }
-        return anImage;
-    }
-
-    /**
-     * Compare with another texture.
-     */
-    virtual bool isEqual(const StAssetTexture& theOther) const {
-        return myTexId == theOther.GetId();
-    }
-
-        private:
-
-    int64_t myStart;
-    int     myLen;
-    Handle(NCollection_Buffer) myBuffer;
-    StString myMime;
-
-};
-
 void StAssetImportGltf::GltfElementMap::init(const TCollection_AsciiString& theRootName,
                                              const GenericValue* theRoot) {
     myRoot = theRoot;
@@ -264,7 +165,8 @@ bool StAssetImportGltf::probeFormatFromExtension(const StString& theExt) {
 StAssetImportGltf::StAssetImportGltf()
 : myBinBodyOffset(0),
   myBinBodyLen(0),
-  myIsBinary(false) {
+  myIsBinary(false),
+  myProgress(NULL) {
     //
 }
 
@@ -346,6 +248,8 @@ bool StAssetImportGltf::load(const Handle(StDocNode)& theParentNode,
             aFile.seekg(aJsonBodyOffset, std::ios_base::beg);
         }
     } else {
+        aFile.seekg(0, std::ios_base::end);
+        aJsonBodyLen = int64_t(aFile.tellg());
         aFile.seekg(0, std::ios_base::beg);
     }
 
@@ -368,6 +272,10 @@ bool StAssetImportGltf::load(const Handle(StDocNode)& theParentNode,
         return false;
     }
 
+    if(myProgress != NULL) {
+        myProgress->addBytesTotal(aJsonBodyLen);
+        myProgress->addBytesRead (aJsonBodyLen);
+    }
     return gltfParse(theParentNode);
 }
 
@@ -416,6 +324,34 @@ void StAssetImportGltf::gltfParseAsset() {
     }
 }
 
+void StAssetImportGltf::gltfParseBuffersLength() {
+    const GenericValue* aBuffers = myGltfRoots[GltfRootElement_Buffers].getRoot();
+    if(myProgress == NULL
+    || aBuffers == NULL) {
+        return;
+    }
+
+    int64_t aLength = 0;
+    if(aBuffers->IsObject()) {
+        // glTF 1.0
+        for(ConstMemberIterator aBufferIter = aBuffers->MemberBegin(); aBufferIter != aBuffers->MemberEnd(); ++aBufferIter) {
+            const GenericValue* aByteLength = aBufferIter->value.IsObject() ? findObjectMember(aBufferIter->value, "byteLength") : NULL;
+            if(aByteLength != NULL && aByteLength->IsNumber()) {
+                aLength += (int64_t )aByteLength->GetDouble();
+            }
+        }
+    } else if(aBuffers->IsArray()) {
+        // glTF 2.0
+        for(rapidjson::Value::ConstValueIterator aBufferIter = aBuffers->Begin(); aBufferIter != aBuffers->End(); ++aBufferIter) {
+            const GenericValue* aByteLength = aBufferIter->IsObject() ? findObjectMember(*aBufferIter, "byteLength") : NULL;
+            if(aByteLength != NULL && aByteLength->IsNumber()) {
+                aLength += (int64_t )aByteLength->GetDouble();
+            }
+        }
+    }
+    myProgress->addBytesTotal(aLength);
+}
+
 void StAssetImportGltf::gltfParseMaterials() {
     const GenericValue* aMatList = myGltfRoots[GltfRootElement_Materials].getRoot();
     if(aMatList == NULL) {
@@ -764,66 +700,142 @@ bool StAssetImportGltf::gltfParseScene(const Handle(StDocNode)& theParentNode) {
         return false;
     }
 
-    return gltfParseSceneNodes(theParentNode, *aSceneNodes);
+    return gltfParseSceneNodes(theParentNode, *aSceneNodes, gp_Trsf());
+}
+
+void StAssetImportGltf::gltfPreviewScene() {
+    const GenericValue* aDefScene = myGltfRoots[GltfRootElement_Scenes].findChild(*myGltfRoots[GltfRootElement_Scene].getRoot());
+    const GenericValue* aSceneNodes = aDefScene != NULL ? findObjectMember(*aDefScene, "nodes") : NULL;
+    if(aSceneNodes == NULL) {
+        return;
+    }
+
+    NCollection_Sequence<Bnd_Box> aBoxes;
+    gltfPreviewSceneNodes(aBoxes, *aSceneNodes, gp_Trsf(), 0);
+    if(!aBoxes.IsEmpty()) {
+        signals.onPreview(aBoxes);
+    }
+}
+
+void StAssetImportGltf::gltfPreviewSceneNodes(NCollection_Sequence<Bnd_Box>& theBoxes,
+                                              const GenericValue& theSceneNodes,
+                                              const gp_Trsf& theParentLoc,
+                                              const int theDepth) {
+    if(!theSceneNodes.IsArray()
+    || theDepth > THE_PREVIEW_MAX_DEPTH) {
+        return;
+    }
+
+    for(rapidjson::Value::ConstValueIterator aSceneNodeIter = theSceneNodes.Begin();
+        aSceneNodeIter != theSceneNodes.End(); ++aSceneNodeIter) {
+        if(theBoxes.Length() >= THE_PREVIEW_MAX_BOXES
+        || isCancelled()) {
+            return;
+        }
+
+        const GenericValue* aSceneNode = myGltfRoots[GltfRootElement_Nodes].findChild(*aSceneNodeIter);
+        gp_Trsf aTrsf;
+        if(aSceneNode == NULL
+        || gltfParseSceneNodeTrsf(aTrsf, *aSceneNode) != NULL) {
+            // errors will be reported by gltfParseScene()
+            continue;
+        }
+
+        const gp_Trsf aNodeLoc = theParentLoc * aTrsf;
+        if(const GenericValue* aChildren = findObjectMember(*aSceneNode, "children")) {
+            gltfPreviewSceneNodes(theBoxes, *aChildren, aNodeLoc, theDepth + 1);
+        }
+
+        const GenericValue* aMeshes = findObjectMember(*aSceneNode, "meshes");
+        if(aMeshes != NULL && aMeshes->IsArray()) {
+            for(rapidjson::Value::ConstValueIterator aMeshIter = aMeshes->Begin(); aMeshIter != aMeshes->End(); ++aMeshIter) {
+                if(const GenericValue* aMeshItem = myGltfRoots[GltfRootElement_Meshes].findChild(*aMeshIter)) {
+                    gltfPreviewMesh(theBoxes, *aMeshItem, aNodeLoc);
+                }
+            }
+        }
+        if(const GenericValue* aMesh = findObjectMember(*aSceneNode, "mesh")) {
+            if(const GenericValue* aMeshItem = myGltfRoots[GltfRootElement_Meshes].findChild(*aMesh)) {
+                gltfPreviewMesh(theBoxes, *aMeshItem, aNodeLoc);
+            }
+        }
+    }
+}
+
+void StAssetImportGltf::gltfPreviewMesh(NCollection_Sequence<Bnd_Box>& theBoxes,
+                                        const GenericValue& theMesh,
+                                        const gp_Trsf& theLoc) {
+    const GenericValue* aPrims = findObjectMember(theMesh, "primitives");
+    if(aPrims == NULL || !aPrims->IsArray()) {
+        return;
+    }
+
+    for(rapidjson::Value::ConstValueIterator aPrimArrIter = aPrims->Begin(); aPrimArrIter != aPrims->End(); ++aPrimArrIter) {
+        const GenericValue* anAttribs  = findObjectMember(*aPrimArrIter, "attributes");
+        const GenericValue* aPosKey    = anAttribs != NULL && anAttribs->IsObject() ? findObjectMember(*anAttribs, "POSITION") : NULL;
+        const GenericValue* anAccessor = aPosKey != NULL ? myGltfRoots[GltfRootElement_Accessors].findChild(*aPosKey) : NULL;
+        if(anAccessor == NULL || !anAccessor->IsObject()) {
+            continue;
+        }
+
+        StGLVec3 aMin, aMax;
+        if(!gltfReadVec3(aMin, findObjectMember(*anAccessor, "min"))
+        || !gltfReadVec3(aMax, findObjectMember(*anAccessor, "max"))) {
+            continue;
+        }
+
+        Bnd_Box aBox;
+        aBox.Update(aMin.x(), aMin.y(), aMin.z(), aMax.x(), aMax.y(), aMax.z());
+        theBoxes.Append(aBox.Transformed(theLoc));
+    }
 }
 
 bool StAssetImportGltf::gltfParseSceneNodes(const Handle(StDocNode)& theParentNode,
-                                            const GenericValue& theSceneNodes) {
+                                            const GenericValue& theSceneNodes,
+                                            const gp_Trsf& theParentLoc) {
     if(!theSceneNodes.IsArray()) {
         signals.onError(formatSyntaxError(myFileName, "Scene nodes is not array."));
         return false;
     }
 
+    if(myProgress != NULL) {
+        myProgress->addNodesTotal(int(theSceneNodes.Size()));
+    }
     for(rapidjson::Value::ConstValueIterator aSceneNodeIter = theSceneNodes.Begin();
         aSceneNodeIter != theSceneNodes.End(); ++aSceneNodeIter) {
+        if(isCancelled()) {
+            return false;
+        }
+
         const GenericValue* aSceneNode = myGltfRoots[GltfRootElement_Nodes].findChild(*aSceneNodeIter);
         if(aSceneNode == NULL) {
             signals.onError(formatSyntaxError(myFileName, StString("Scene refers to non-existing node '") + getKeyString(*aSceneNodeIter).ToCString() + "'."));
             return true;
         }
 
-        if(!gltfParseSceneNode(theParentNode, getKeyString(*aSceneNodeIter), *aSceneNode)) {
+        if(!gltfParseSceneNode(theParentNode, getKeyString(*aSceneNodeIter), *aSceneNode, theParentLoc)) {
             return false;
         }
+        if(myProgress != NULL) {
+            myProgress->addNodesDone(1);
+        }
     }
     return true;
 }
 
-bool StAssetImportGltf::gltfParseSceneNode(const Handle(StDocNode)& theParentNode,
-                                           const TCollection_AsciiString& theSceneNodeName,
-                                           const GenericValue& theSceneNode) {
-    const GenericValue* aName         = findObjectMember(theSceneNode, "name");
-    //const GenericValue* aJointName    = findObjectMember(theSceneNode, "jointName");
-    const GenericValue* aChildren     = findObjectMember(theSceneNode, "children");
-    const GenericValue* aMeshes       = findObjectMember(theSceneNode, "meshes");
-    const GenericValue* aMesh         = findObjectMember(theSceneNode, "mesh");
-    //const GenericValue* aCamera       = findObjectMember(theSceneNode, "camera");
+const char* StAssetImportGltf::gltfParseSceneNodeTrsf(gp_Trsf& theTrsf,
+                                                       const GenericValue& theSceneNode) {
     const GenericValue* aTrsfMatVal   = findObjectMember(theSceneNode, "matrix");
     const GenericValue* aTrsfRotVal   = findObjectMember(theSceneNode, "rotation");
     const GenericValue* aTrsfScaleVal = findObjectMember(theSceneNode, "scale");
     const GenericValue* aTrsfTransVal = findObjectMember(theSceneNode, "translation");
-    Handle(StDocObjectNode) aNewNode;
-    if(mySceneNodeMap.Find(theSceneNodeName, aNewNode)) {
-        theParentNode->ChangeChildren().Append(aNewNode);
-        return true;
-    }
-
-    aNewNode = new StDocObjectNode();
-    theParentNode->ChangeChildren().Append(aNewNode);
-    if(aName != NULL && aName->IsString()) {
-        aNewNode->setNodeName(aName->GetString());
-    }
-    mySceneNodeMap.Bind(theSceneNodeName, aNewNode);
-
     const bool hasTrs = aTrsfRotVal != NULL || aTrsfScaleVal != NULL || aTrsfTransVal != NULL;
     if(aTrsfMatVal != NULL) {
         if(hasTrs) {
-            pushSceneNodeError(theSceneNodeName.ToCString(), "defines ambiguous transformation");
-            return false;
+            return "defines ambiguous transformation";
         }
         else if(!aTrsfMatVal->IsArray() || aTrsfMatVal->Size() != 16) {
-            pushSceneNodeError(theSceneNodeName.ToCString(), "defines invalid transformation matrix array");
-            return false;
+            return "defines invalid transformation matrix array";
         }
 
         Graphic3d_Mat4d aMat4;
@@ -831,36 +843,28 @@ bool StAssetImportGltf::gltfParseSceneNode(const Handle(StDocNode)& theParentNod
             for(int aRowIter = 0; aRowIter < 4; ++aRowIter) {
                 const GenericValue& aGenVal = (*aTrsfMatVal)[aColIter * 4 + aRowIter];
                 if(!aGenVal.IsNumber()) {
-                    pushSceneNodeError(theSceneNodeName.ToCString(), "defines invalid transformation matrix");
-                    return false;
+                    return "defines invalid transformation matrix";
                 }
                 aMat4.SetValue(aRowIter, aColIter, aGenVal.GetDouble());
             }
         }
 
         if(!aMat4.IsIdentity()) {
-            gp_Trsf aTrsf;
-            aTrsf.SetValues(aMat4.GetValue(0, 0), aMat4.GetValue(0, 1), aMat4.GetValue(0, 2), aMat4.GetValue(0, 3),
-                            aMat4.GetValue(1, 0), aMat4.GetValue(1, 1), aMat4.GetValue(1, 2), aMat4.GetValue(1, 3),
-                            aMat4.GetValue(2, 0), aMat4.GetValue(2, 1), aMat4.GetValue(2, 2), aMat4.GetValue(2, 3));
-            if(aTrsf.Form() != gp_Identity) {
-                aNewNode->setNodeTransformation(aTrsf);
-            }
+            theTrsf.SetValues(aMat4.GetValue(0, 0), aMat4.GetValue(0, 1), aMat4.GetValue(0, 2), aMat4.GetValue(0, 3),
+                              aMat4.GetValue(1, 0), aMat4.GetValue(1, 1), aMat4.GetValue(1, 2), aMat4.GetValue(1, 3),
+                              aMat4.GetValue(2, 0), aMat4.GetValue(2, 1), aMat4.GetValue(2, 2), aMat4.GetValue(2, 3));
         }
     } else if(hasTrs) {
-        gp_Trsf aTrsf;
         if(aTrsfRotVal != NULL) {
             if(!aTrsfRotVal->IsArray() || aTrsfRotVal->Size() != 4) {
-                pushSceneNodeError(theSceneNodeName.ToCString(), "defines invalid rotation quaternion");
-                return false;
+                return "defines invalid rotation quaternion";
             }
 
             Graphic3d_Vec4d aRotVec4;
             for(int aCompIter = 0; aCompIter < 4; ++aCompIter) {
                 const GenericValue& aGenVal = (*aTrsfRotVal)[aCompIter];
                 if(!aGenVal.IsNumber()) {
-                    pushSceneNodeError(theSceneNodeName.ToCString(), "defines invalid rotation");
-                    return false;
+                    return "defines invalid rotation";
                 }
                 aRotVec4[aCompIter] = aGenVal.GetDouble();
             }
@@ -869,64 +873,90 @@ bool StAssetImportGltf::gltfParseSceneNode(const Handle(StDocNode)& theParentNod
             && Abs(aQuaternion.Y())       > gp::Resolution()
             && Abs(aQuaternion.Z())       > gp::Resolution()
             && Abs(aQuaternion.W() - 1.0) > gp::Resolution()) {
-                aTrsf.SetRotation(aQuaternion);
+                theTrsf.SetRotation(aQuaternion);
             }
         }
 
         if(aTrsfTransVal != NULL) {
             if(!aTrsfTransVal->IsArray() || aTrsfTransVal->Size() != 3) {
-                pushSceneNodeError(theSceneNodeName.ToCString(), "defines invalid translation vector");
-                return false;
+                return "defines invalid translation vector";
             }
 
             gp_XYZ aTransVec;
             for(int aCompIter = 0; aCompIter < 3; ++aCompIter) {
                 const GenericValue& aGenVal = (*aTrsfTransVal)[aCompIter];
                 if(!aGenVal.IsNumber()) {
-                    pushSceneNodeError(theSceneNodeName.ToCString(), "defines invalid translation");
-                    return false;
+                    return "defines invalid translation";
                 }
                 aTransVec.SetCoord(aCompIter + 1, aGenVal.GetDouble());
             }
-            aTrsf.SetTranslationPart(aTransVec);
+            theTrsf.SetTranslationPart(aTransVec);
         }
 
         if(aTrsfScaleVal != NULL) {
             Graphic3d_Vec3d aScaleVec;
             if(!aTrsfScaleVal->IsArray() || aTrsfScaleVal->Size() != 3) {
-                pushSceneNodeError(theSceneNodeName.ToCString(), "defines invalid scale vector");
-                return false;
+                return "defines invalid scale vector";
             }
             for(int aCompIter = 0; aCompIter < 3; ++aCompIter) {
                 const GenericValue& aGenVal = (*aTrsfScaleVal)[aCompIter];
                 if(!aGenVal.IsNumber()) {
-                    pushSceneNodeError(theSceneNodeName.ToCString(), "defines invalid scale");
-                    return false;
+                    return "defines invalid scale";
                 }
                 aScaleVec[aCompIter] = aGenVal.GetDouble();
                 if(Abs(aScaleVec[aCompIter]) <= gp::Resolution()) {
-                    pushSceneNodeError(theSceneNodeName.ToCString(), "defines invalid scale");
-                    return false;
+                    return "defines invalid scale";
                 }
             }
             if(Abs(aScaleVec.x() - aScaleVec.y()) > Precision::Confusion()
             && Abs(aScaleVec.y() - aScaleVec.z()) > Precision::Confusion()
             && Abs(aScaleVec.x() - aScaleVec.z()) > Precision::Confusion()) {
-                ST_DEBUG_LOG("glTF reader, scene node '"
-                            + theSceneNodeName.ToCString() + "' defines unsupported scaling "
+                ST_DEBUG_LOG("glTF reader, scene node defines unsupported scaling "
                             + aScaleVec.x() + " " + aScaleVec.y() + " " + aScaleVec.z());
             }
             if(Abs (aScaleVec.x() - 1.0) > Precision::Confusion()) {
-                aTrsf.SetScaleFactor(aScaleVec.x());
+                theTrsf.SetScaleFactor(aScaleVec.x());
             }
         }
+    }
+    return NULL;
+}
 
-        if(aTrsf.Form() != gp_Identity) {
-            aNewNode->setNodeTransformation(aTrsf);
-        }
+bool StAssetImportGltf::gltfParseSceneNode(const Handle(StDocNode)& theParentNode,
+                                           const TCollection_AsciiString& theSceneNodeName,
+                                           const GenericValue& theSceneNode,
+                                           const gp_Trsf& theParentLoc) {
+    const GenericValue* aName         = findObjectMember(theSceneNode, "name");
+    //const GenericValue* aJointName    = findObjectMember(theSceneNode, "jointName");
+    const GenericValue* aChildren     = findObjectMember(theSceneNode, "children");
+    const GenericValue* aMeshes       = findObjectMember(theSceneNode, "meshes");
+    const GenericValue* aMesh         = findObjectMember(theSceneNode, "mesh");
+    //const GenericValue* aCamera       = findObjectMember(theSceneNode, "camera");
+    Handle(StDocObjectNode) aNewNode;
+    if(mySceneNodeMap.Find(theSceneNodeName, aNewNode)) {
+        theParentNode->ChangeChildren().Append(aNewNode);
+        emitMeshNodes(aNewNode, theParentLoc * aNewNode->nodeTransformation());
+        return true;
+    }
+
+    aNewNode = new StDocObjectNode();
+    theParentNode->ChangeChildren().Append(aNewNode);
+    if(aName != NULL && aName->IsString()) {
+        aNewNode->setNodeName(aName->GetString());
+    }
+    mySceneNodeMap.Bind(theSceneNodeName, aNewNode);
+
+    gp_Trsf aTrsf;
+    if(const char* aTrsfError = gltfParseSceneNodeTrsf(aTrsf, theSceneNode)) {
+        pushSceneNodeError(theSceneNodeName.ToCString(), aTrsfError);
+        return false;
+    }
+    if(aTrsf.Form() != gp_Identity) {
+        aNewNode->setNodeTransformation(aTrsf);
     }
 
-    if(aChildren != NULL && !gltfParseSceneNodes(aNewNode, *aChildren)) {
+    const gp_Trsf aNodeLoc = theParentLoc * aNewNode->nodeTransformation();
+    if(aChildren != NULL && !gltfParseSceneNodes(aNewNode, *aChildren, aNodeLoc)) {
         return false;
     }
 
@@ -938,7 +968,7 @@ bool StAssetImportGltf::gltfParseSceneNode(const Handle(StDocNode)& theParentNod
                 return false;
             }
 
-            if(!gltfParseMesh(aNewNode, getKeyString(*aMeshIter), *aMeshItem)) {
+            if(!gltfParseMesh(aNewNode, getKeyString(*aMeshIter), *aMeshItem, aNodeLoc)) {
                 return false;
             }
         }
@@ -951,7 +981,7 @@ bool StAssetImportGltf::gltfParseSceneNode(const Handle(StDocNode)& theParentNod
             return false;
         }
 
-        if(!gltfParseMesh(aNewNode, getKeyString(*aMesh), *aMeshItem)) {
+        if(!gltfParseMesh(aNewNode, getKeyString(*aMesh), *aMeshItem, aNodeLoc)) {
             return false;
         }
     }
@@ -959,9 +989,21 @@ bool StAssetImportGltf::gltfParseSceneNode(const Handle(StDocNode)& theParentNod
     return true;
 }
 
+void StAssetImportGltf::emitMeshNodes(const Handle(StDocNode)& theNode,
+                                      const gp_Trsf& theLoc) {
+    if(theNode->nodeType() == StDocNodeType_Mesh) {
+        signals.onMeshNode(Handle(StDocMeshNode)::DownCast(theNode), theLoc);
+    }
+    for(NCollection_Sequence<Handle(StDocNode)>::Iterator aChildIter(theNode->Children()); aChildIter.More(); aChildIter.Next()) {
+        const Handle(StDocNode)& aChild = aChildIter.Value();
+        emitMeshNodes(aChild, theLoc * aChild->nodeTransformation());
+    }
+}
+
 bool StAssetImportGltf::gltfParseMesh(const Handle(StDocNode)& theParentNode,
                                       const TCollection_AsciiString& theMeshName,
-                                      const GenericValue& theMesh) {
+                                      const GenericValue& theMesh,
+                                      const gp_Trsf& theLoc) {
     const GenericValue* aName  = findObjectMember(theMesh, "name");
     const GenericValue* aPrims = findObjectMember(theMesh, "primitives");
     if(!aPrims->IsArray()) {
@@ -973,6 +1015,7 @@ bool StAssetImportGltf::gltfParseMesh(const Handle(StDocNode)& theParentNode,
     Handle(StDocMeshNode) aMeshNode;
     if(myMeshMap.Find(theMeshName, aMeshNode)) {
         theParentNode->ChangeChildren().Append(aMeshNode);
+        signals.onMeshNode(aMeshNode, theLoc);
         return true;
     }
 
@@ -987,6 +1030,7 @@ bool StAssetImportGltf::gltfParseMesh(const Handle(StDocNode)& theParentNode,
             return false;
         }
     }
+    signals.onMeshNode(aMeshNode, theLoc);
     return true;
 }
 
@@ -1018,6 +1062,8 @@ bool StAssetImportGltf::gltfParsePrimArray(const Handle(StDocMeshNode)& theMeshN
     if(aMode != GltfPrimitiveMode_Triangles) {
         ST_DEBUG_LOG("Primitive array within Mesh '" + theMeshName.ToCString() + "' skipped due to unsupported mode.");
         return true;
+    } else if(isCancelled()) {
+        return false;
     }
 
     Handle(StPrimArray) aPrimArray = new StPrimArray();
@@ -1292,8 +1338,11 @@ bool StAssetImportGltf::gltfReadBuffer(const Handle(StPrimArray)& thePrimArray,
     if(theMode != GltfPrimitiveMode_Triangles) {
         ST_DEBUG_LOG("Buffer '" + theName.ToCString() + "' skipped unsupported primitive array.");
         return true;
+    } else if(isCancelled()) {
+        return false;
     }
 
+    const std::streamoff aStartPos = myProgress != NULL ? std::streamoff(theStream.tellg()) : 0;
     switch(theType) {
         case GltfArrayType_Indices: {
             if(theAccessor.Type != GltfAccessorLayout_Scalar
@@ -1461,5 +1510,12 @@ bool StAssetImportGltf::gltfReadBuffer(const Handle(StPrimArray)& thePrimArray,
             return false;
         }
     }
+
+    if(myProgress != NULL) {
+        const std::streamoff anEndPos = theStream.tellg();
+        if(aStartPos >= 0 && anEndPos > aStartPos) {
+            myProgress->addBytesRead(int64_t(anEndPos - aStartPos));
+        }
+    }
     return true;
 }
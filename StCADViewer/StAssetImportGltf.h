@@ -17,10 +17,12 @@
 #include <StFile/StFileNode.h>
 #include <StSlots/StSignal.h>
 
+#include <Bnd_Box.hxx>
 #include <NCollection_DataMap.hxx>
 #include <TCollection_AsciiString.hxx>
 
 #include "StAssetDocument.h"
+#include "StAssetImportProgress.h"
 
 /**
  * Root elements within glTF JSON document.
@@ -177,6 +179,11 @@ class StAssetImportGltf : public rapidjson::Document {
      */
     ST_LOCAL StAssetImportGltf();
 
+    /**
+     * Set progress indicator and cancellation token (NULL by default).
+     */
+    ST_LOCAL void setProgress(StAssetImportProgress* theProgress) { myProgress = theProgress; }
+
     /**
      * Perform the import.
      */
@@ -192,7 +199,9 @@ class StAssetImportGltf : public rapidjson::Document {
         }
 
         gltfParseAsset();
+        gltfParseBuffersLength();
         gltfParseMaterials();
+        gltfPreviewScene();
         return gltfParseScene(theParentNode);
     }
 
@@ -213,6 +222,19 @@ class StAssetImportGltf : public rapidjson::Document {
      */
     void gltfParseAsset();
 
+    /**
+     * Add length of buffers to progress indicator.
+     */
+    void gltfParseBuffersLength();
+
+    /**
+     * Return TRUE if import has been cancelled.
+     */
+    bool isCancelled() const {
+        return myProgress != NULL
+            && myProgress->isCancelled();
+    }
+
         protected:
 
     /**
@@ -256,21 +278,60 @@ class StAssetImportGltf : public rapidjson::Document {
      * Parse scene array of nodes recursively.
      */
     bool gltfParseSceneNodes(const Handle(StDocNode)& theParentNode,
-                             const GenericValue& theSceneNodes);
+                             const GenericValue& theSceneNodes,
+                             const gp_Trsf& theParentLoc);
 
     /**
      * Parse scene node recursively.
      */
     bool gltfParseSceneNode(const Handle(StDocNode)& theParentNode,
                             const TCollection_AsciiString& theSceneNodeName,
-                            const GenericValue& theSceneNode);
+                            const GenericValue& theSceneNode,
+                            const gp_Trsf& theParentLoc);
+
+    /**
+     * Parse scene node transformation.
+     * @return NULL on success or error description
+     */
+    static const char* gltfParseSceneNodeTrsf(gp_Trsf& theTrsf,
+                                              const GenericValue& theSceneNode);
 
     /**
      * Parse mesh element.
      */
     bool gltfParseMesh(const Handle(StDocNode)& theParentNode,
                        const TCollection_AsciiString& theMeshName,
-                       const GenericValue& theMesh);
+                       const GenericValue& theMesh,
+                       const gp_Trsf& theLoc);
+
+    /**
+     * Emit onMeshNode signal for all meshes within already loaded sub-tree.
+     */
+    void emitMeshNodes(const Handle(StDocNode)& theNode,
+                       const gp_Trsf& theLoc);
+
+        protected: //! @name coarse preview
+
+    /**
+     * Collect bounding boxes of primitive arrays within default scene
+     * from accessors min/max values (without reading buffers) and emit onPreview signal.
+     */
+    void gltfPreviewScene();
+
+    /**
+     * Collect bounding boxes of scene nodes recursively.
+     */
+    void gltfPreviewSceneNodes(NCollection_Sequence<Bnd_Box>& theBoxes,
+                               const GenericValue& theSceneNodes,
+                               const gp_Trsf& theParentLoc,
+                               const int theDepth);
+
+    /**
+     * Collect bounding boxes of mesh primitive arrays.
+     */
+    void gltfPreviewMesh(NCollection_Sequence<Bnd_Box>& theBoxes,
+                         const GenericValue& theMesh,
+                         const gp_Trsf& theLoc);
 
     /**
      * Parse GltfArrayType from string.
@@ -533,6 +594,20 @@ protected:
          * @param theUserData (const StString& ) - error description.
          */
         StSignal<void (const StCString& )> onError;
+
+        /**
+         * Emit callback Slot when mesh node has been loaded (within working thread).
+         * Shared mesh node is reported once per instance.
+         * @param theMeshNode (const Handle(StDocMeshNode)& ) - loaded mesh node
+         * @param theLoc      (const gp_Trsf& ) - cumulative transformation of the node
+         */
+        StSignal<void (const Handle(StDocMeshNode)& , const gp_Trsf& )> onMeshNode;
+
+        /**
+         * Emit callback Slot with coarse preview of the document (within working thread).
+         * @param theBoxes (const NCollection_Sequence<Bnd_Box>& ) - bounding boxes of document parts
+         */
+        StSignal<void (const NCollection_Sequence<Bnd_Box>& )> onPreview;
     } signals;
 
         protected:
@@ -548,6 +623,7 @@ protected:
     GltfElementMap myGltfRoots[GltfRootElement_NB]; //!< glTF format root elements
     StString myFileName;
     StString myFolder;
+    StAssetImportProgress* myProgress; //!< progress indicator and cancellation token
 
 };
 
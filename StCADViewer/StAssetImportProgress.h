@@ -0,0 +1,141 @@
+/**
+ * This source is a part of sView program.
+ *
+ * Copyright © Kirill Gavrilov, 2026
+ */
+
+#ifndef __StAssetImportProgress_h_
+#define __StAssetImportProgress_h_
+
+#include <stTypes.h>
+
+/**
+ * Progress of document import shared between loading thread and GUI.
+ * Holds cancellation flag checked by importers and counters of processed bytes and document nodes.
+ * Counters are modified only by loading thread and read by GUI without locks (values are used for display only).
+ */
+class StAssetImportProgress {
+
+        public:
+
+    /**
+     * Empty constructor.
+     */
+    StAssetImportProgress()
+    : myBytesTotal(0),
+      myBytesRead(0),
+      myNodesTotal(0),
+      myNodesDone(0),
+      myIsActive(false),
+      myToCancel(false) {}
+
+    /**
+     * Reset counters and cancellation flag for the new import.
+     * Should be called before import is started; cancellation requested afterwards is preserved.
+     */
+    void reset() {
+        myToCancel   = false;
+        myBytesTotal = 0;
+        myBytesRead  = 0;
+        myNodesTotal = 0;
+        myNodesDone  = 0;
+    }
+
+    /**
+     * Return TRUE if import is in progress.
+     */
+    bool isActive() const { return myIsActive; }
+
+    /**
+     * Set import state.
+     */
+    void setActive(const bool theIsActive) { myIsActive = theIsActive; }
+
+    /**
+     * Request import to be cancelled.
+     */
+    void cancel() { myToCancel = true; }
+
+    /**
+     * Return TRUE if import should be stopped.
+     */
+    bool isCancelled() const { return myToCancel; }
+
+        public: //! @name counters
+
+    /**
+     * Return the number of bytes to be read.
+     */
+    int64_t getBytesTotal() const { return myBytesTotal; }
+
+    /**
+     * Return the number of bytes already read.
+     */
+    int64_t getBytesRead() const { return myBytesRead; }
+
+    /**
+     * Define the number of bytes to be read.
+     */
+    void setBytesTotal(const int64_t theNbBytes) { myBytesTotal = theNbBytes; }
+
+    /**
+     * Increment the number of bytes to be read.
+     */
+    void addBytesTotal(const int64_t theNbBytes) { myBytesTotal = myBytesTotal + theNbBytes; }
+
+    /**
+     * Increment the number of bytes already read.
+     */
+    void addBytesRead(const int64_t theNbBytes) {
+        myBytesRead = stMin(myBytesRead + theNbBytes, myBytesTotal);
+    }
+
+    /**
+     * Return the number of discovered document nodes.
+     */
+    int getNodesTotal() const { return myNodesTotal; }
+
+    /**
+     * Return the number of processed document nodes.
+     */
+    int getNodesDone() const { return myNodesDone; }
+
+    /**
+     * Increment the number of discovered document nodes.
+     */
+    void addNodesTotal(const int theNbNodes) { myNodesTotal = myNodesTotal + theNbNodes; }
+
+    /**
+     * Increment the number of processed document nodes.
+     */
+    void addNodesDone(const int theNbNodes) {
+        myNodesDone = stMin(myNodesDone + theNbNodes, int(myNodesTotal));
+    }
+
+    /**
+     * Return progress within [0, 100] range estimated from bytes (or nodes when size is unknown).
+     */
+    int getPercents() const {
+        const int64_t aBytesTotal = myBytesTotal;
+        if(aBytesTotal > 0) {
+            return int(stMin(int64_t(100), myBytesRead * 100 / aBytesTotal));
+        }
+
+        const int aNodesTotal = myNodesTotal;
+        return aNodesTotal > 0
+             ? stMin(100, myNodesDone * 100 / aNodesTotal)
+             : 0;
+    }
+
+        private:
+
+    volatile int64_t myBytesTotal; //!< number of bytes to read
+    volatile int64_t myBytesRead;  //!< number of bytes already read
+    volatile int     myNodesTotal; //!< number of discovered nodes
+    volatile int     myNodesDone;  //!< number of processed nodes
+    volatile bool    myIsActive;   //!< import is in progress
+    volatile bool    myToCancel;   //!< cancellation request
+
+};
+
+#endif // __StAssetImportProgress_h_
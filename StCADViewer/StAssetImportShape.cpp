@@ -9,6 +9,7 @@
 #include <StStrings/StLogger.h>
 
 #include <BRep_Builder.hxx>
+#include <BRepBndLib.hxx>
 #include <BRepLProp_SLProps.hxx>
 #include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepTools.hxx>
@@ -20,6 +21,7 @@
 #include <Prs3d.hxx>
 #include <STEPCAFControl_Reader.hxx>
 #include <STEPControl_Controller.hxx>
+#include <Standard_Version.hxx>
 #include <StdPrs_ShadedShape.hxx>
 #include <TDF_Tool.hxx>
 #include <TDF_ChildIterator.hxx>
@@ -37,7 +39,48 @@
 #include <XSControl_TransferReader.hxx>
 #include <XSControl_WorkSession.hxx>
 
+#if(OCC_VERSION_HEX < 0x070500)
+    #include <Message_ProgressIndicator.hxx>
+#endif
+
 namespace {
+
+    /**
+     * Maximum number of boxes within coarse preview.
+     */
+    static const int THE_PREVIEW_MAX_BOXES = 4096;
+
+    /**
+     * Maximum depth of assembly hierarchy within coarse preview.
+     */
+    static const int THE_PREVIEW_MAX_DEPTH = 64;
+
+#if(OCC_VERSION_HEX < 0x070500)
+    /**
+     * Progress indicator redirecting user break requests of data exchange translators.
+     */
+    class StShapeProgressIndicator : public Message_ProgressIndicator {
+
+        DEFINE_STANDARD_RTTI_INLINE(StShapeProgressIndicator, Message_ProgressIndicator)
+
+            public:
+
+        StShapeProgressIndicator(StAssetImportProgress* theProgress) : myProgress(theProgress) {}
+
+        virtual Standard_Boolean Show(const Standard_Boolean ) Standard_OVERRIDE { return Standard_True; }
+
+        virtual Standard_Boolean UserBreak() Standard_OVERRIDE {
+            return myProgress != NULL
+                && myProgress->isCancelled();
+        }
+
+            private:
+
+        StAssetImportProgress* myProgress;
+
+    };
+#endif
+
     static StString formatError(const StString& theFilePath,
                                 const StString& theLibDescr) {
         StString aFileName, aFolderName;
@@ -117,7 +160,10 @@ StAssetImportShape::FileFormat StAssetImportShape::probeFormatFromExtension(cons
 }
 
 StAssetImportShape::StAssetImportShape()
-: myXCAFApp(new TDocStd_Application()) {
+: myXCAFApp(new TDocStd_Application()),
+  myProgress(NULL),
+  myDeflection(0.0),
+  myAngle(0.0) {
     BinXCAFDrivers::DefineFormat(myXCAFApp);
     //StdLDrivers::DefineFormat(myXCAFApp);
     //BinLDrivers::DefineFormat(myXCAFApp);
@@ -169,6 +215,12 @@ void StAssetImportShape::clearSession(const Handle(XSControl_WorkSession)& theWo
 bool StAssetImportShape::load(const Handle(StDocNode)& theParentNode,
                               const StString& theFile,
                               const FileFormat theFormat) {
+    int64_t aFileSize = 0, aModTime = 0;
+    if(myProgress != NULL
+    && StFileNode::getFileStats(theFile, aFileSize, aModTime)) {
+        myProgress->addBytesTotal(aFileSize);
+    }
+
     switch(theFormat) {
         case FileFormat_STEP: {
             if(!loadSTEP(theFile)) {
@@ -216,6 +268,11 @@ bool StAssetImportShape::load(const Handle(StDocNode)& theParentNode,
             return false;
         }
     }
+    if(isCancelled()) {
+        return false;
+    } else if(myProgress != NULL) {
+        myProgress->addBytesRead(aFileSize);
+    }
 
     TDF_LabelSequence aLabels;
     Handle(XCAFDoc_ShapeTool) aShapeTool = XCAFDoc_DocumentTool::ShapeTool (myXCAFDoc->Main());
@@ -226,7 +283,7 @@ bool StAssetImportShape::load(const Handle(StDocNode)& theParentNode,
         return false;
     }
 
-    // perform meshing explicitly
+    // define meshing parameters for the whole document, parts are meshed on demand
     TopoDS_Compound aCompound;
     BRep_Builder    aBuildTool;
     aBuildTool.MakeCompound(aCompound);
@@ -239,32 +296,82 @@ bool StAssetImportShape::load(const Handle(StDocNode)& theParentNode,
     }
 
     Handle(Prs3d_Drawer) aDrawer = new Prs3d_Drawer();
-    Standard_Real aDeflection = Prs3d::GetDeflection(aCompound, aDrawer);
-    if(!BRepTools::Triangulation(aCompound, aDeflection)) {
-        BRepMesh_IncrementalMesh anAlgo;
-        anAlgo.ChangeParameters().Deflection = aDeflection;
-        anAlgo.ChangeParameters().Angle      = aDrawer->HLRAngle();
-        anAlgo.ChangeParameters().InParallel = true;
-        anAlgo.SetShape(aCompound);
-        anAlgo.Perform();
+    myDeflection = Prs3d::GetDeflection(aCompound, aDrawer);
+    myAngle      = aDrawer->HLRAngle();
+
+    // show bounding boxes of parts while meshing
+    {
+        NCollection_Sequence<Bnd_Box> aBoxes;
+        for(TDF_LabelSequence::Iterator aLabIter(aLabels); aLabIter.More(); aLabIter.Next()) {
+            const TDF_Label& aLabel = aLabIter.Value();
+            collectBoxes(aBoxes, aLabel, XCAFDoc_ShapeTool::GetLocation(aLabel).Transformation(), 0);
+        }
+        if(!aBoxes.IsEmpty()) {
+            signals.onPreview(aBoxes);
+        }
     }
 
     XCAFPrs_Style aDefStyle;
     aDefStyle.SetColorSurf(Quantity_NOC_GRAY65);
     aDefStyle.SetColorCurv(Quantity_NOC_GRAY65);
+    if(myProgress != NULL) {
+        myProgress->addNodesTotal(aLabels.Length());
+    }
     for(TDF_LabelSequence::Iterator aLabIter(aLabels); aLabIter.More(); aLabIter.Next()) {
         const TDF_Label& aLabel = aLabIter.Value();
         TopLoc_Location aTrsf = XCAFDoc_ShapeTool::GetLocation(aLabel);
-        addNodeRecursive(theParentNode, *aColorTool, aLabel, aTrsf, aDefStyle);
+        addNodeRecursive(theParentNode, *aColorTool, aLabel, aTrsf, aDefStyle, gp_Trsf());
+    }
+    return !isCancelled();
+}
+
+void StAssetImportShape::collectBoxes(NCollection_Sequence<Bnd_Box>& theBoxes,
+                                      const TDF_Label&               theLabel,
+                                      const gp_Trsf&                 theLoc,
+                                      const int                      theDepth) {
+    if(theBoxes.Length() >= THE_PREVIEW_MAX_BOXES
+    || theDepth > THE_PREVIEW_MAX_DEPTH
+    || isCancelled()) {
+        return;
+    }
+
+    TDF_Label aRefLabel = theLabel;
+    if(XCAFDoc_ShapeTool::IsReference(theLabel)) {
+        XCAFDoc_ShapeTool::GetReferredShape(theLabel, aRefLabel);
+    }
+
+    if(!XCAFDoc_ShapeTool::IsAssembly(aRefLabel)) {
+        TopoDS_Shape aShape;
+        if(XCAFDoc_ShapeTool::GetShape(aRefLabel, aShape)
+        && !aShape.IsNull()) {
+            Bnd_Box aBox;
+            BRepBndLib::Add(aShape, aBox);
+            if(!aBox.IsVoid()) {
+                theBoxes.Append(aBox.Transformed(theLoc));
+            }
+        }
+        return;
+    }
+
+    for(TDF_ChildIterator aChildIter(aRefLabel); aChildIter.More(); aChildIter.Next()) {
+        TDF_Label aLabel = aChildIter.Value();
+        if(!aLabel.IsNull()
+        && (aLabel.HasAttribute() || aLabel.HasChild())) {
+            collectBoxes(theBoxes, aLabel, theLoc * XCAFDoc_ShapeTool::GetLocation(aLabel).Transformation(), theDepth + 1);
+        }
     }
-    return true;
 }
 
 void StAssetImportShape::addNodeRecursive(const Handle(StDocNode)& theParentTreeItem,
                                           XCAFDoc_ColorTool&       theColorTool,
                                           const TDF_Label&         theLabel,
                                           const TopLoc_Location&   theParentTrsf,
-                                          const XCAFPrs_Style&     theParentStyle) {
+                                          const XCAFPrs_Style&     theParentStyle,
+                                          const gp_Trsf&           theParentLoc) {
+    if(isCancelled()) {
+        return;
+    }
+
     TDF_Label aRefLabel = theLabel;
     if(XCAFDoc_ShapeTool::IsReference(theLabel)) {
         XCAFDoc_ShapeTool::GetReferredShape(theLabel, aRefLabel);
@@ -293,24 +400,40 @@ void StAssetImportShape::addNodeRecursive(const Handle(StDocNode)& theParentTree
     aChildTreeItem->setNodeName(aName.ToCString());
     aChildTreeItem->setNodeTransformation(theParentTrsf.Transformation());
     theParentTreeItem->ChangeChildren().Append(aChildTreeItem);
+    const gp_Trsf aNodeLoc = theParentLoc * aChildTreeItem->nodeTransformation();
     if(!XCAFDoc_ShapeTool::IsAssembly(aRefLabel)) {
-        addMeshNode(aChildTreeItem, aRefLabel, aDefStyle);
+        addMeshNode(aChildTreeItem, aRefLabel, aDefStyle, aNodeLoc);
+        if(myProgress != NULL) {
+            myProgress->addNodesDone(1);
+        }
         return;
     }
 
+    TDF_LabelSequence aChildren;
     for(TDF_ChildIterator aChildIter(aRefLabel); aChildIter.More(); aChildIter.Next()) {
         TDF_Label aLabel = aChildIter.Value();
         if(!aLabel.IsNull()
         && (aLabel.HasAttribute() || aLabel.HasChild())) {
-            const TopLoc_Location aTrsf = XCAFDoc_ShapeTool::GetLocation(aLabel);
-            addNodeRecursive(aChildTreeItem, theColorTool, aLabel, aTrsf, aDefStyle);
+            aChildren.Append(aLabel);
         }
     }
+    if(myProgress != NULL) {
+        myProgress->addNodesTotal(aChildren.Length());
+    }
+    for(TDF_LabelSequence::Iterator aChildIter(aChildren); aChildIter.More(); aChildIter.Next()) {
+        const TDF_Label& aLabel = aChildIter.Value();
+        const TopLoc_Location aTrsf = XCAFDoc_ShapeTool::GetLocation(aLabel);
+        addNodeRecursive(aChildTreeItem, theColorTool, aLabel, aTrsf, aDefStyle, aNodeLoc);
+    }
+    if(myProgress != NULL) {
+        myProgress->addNodesDone(1);
+    }
 }
 
 bool StAssetImportShape::addMeshNode(const Handle(StDocNode)& theParentTreeItem,
                                      const TDF_Label&         theShapeLabel,
-                                     const XCAFPrs_Style&     theParentStyle) {
+                                     const XCAFPrs_Style&     theParentStyle,
+                                     const gp_Trsf&           theLoc) {
     if(theShapeLabel.IsNull()) {
         return false;
     }
@@ -321,6 +444,19 @@ bool StAssetImportShape::addMeshNode(const Handle(StDocNode)& theParentTreeItem,
         return false;
     }
 
+    // perform meshing explicitly (shared parts are meshed only once)
+    if(!BRepTools::Triangulation(aShape, myDeflection)) {
+        BRepMesh_IncrementalMesh anAlgo;
+        anAlgo.ChangeParameters().Deflection = myDeflection;
+        anAlgo.ChangeParameters().Angle      = myAngle;
+        anAlgo.ChangeParameters().InParallel = true;
+        anAlgo.SetShape(aShape);
+        anAlgo.Perform();
+    }
+    if(isCancelled()) {
+        return false;
+    }
+
     XCAFPrs_DataMapOfShapeStyle aStyles1, aStyles2;
     {
         TopLoc_Location aDummyLoc;
@@ -475,6 +611,7 @@ bool StAssetImportShape::addMeshNode(const Handle(StDocNode)& theParentTreeItem,
         }
     }
 
+    signals.onMeshNode(aMeshNode, theLoc);
     return true;
 }
 
@@ -486,9 +623,11 @@ bool StAssetImportShape::loadIGES(const StString& theFileToLoadPath) {
         {
             {
                 Handle(Transfer_TransientProcess) aMapReader = aWS->TransferReader()->TransientProcess();
+#if(OCC_VERSION_HEX < 0x070500)
                 if(!aMapReader.IsNull()) {
-                    //aMapReader->SetProgress(theProgress);
+                    aMapReader->SetProgress(new StShapeProgressIndicator(myProgress));
                 }
+#endif
             }
 
             if(!aReader.ReadFile(theFileToLoadPath.toCString())) {
@@ -501,13 +640,17 @@ bool StAssetImportShape::loadIGES(const StString& theFileToLoadPath) {
         {
           if(!aWS.IsNull()) {
               Handle(Transfer_TransientProcess) aMapReader = aWS->TransferReader()->TransientProcess();
+#if(OCC_VERSION_HEX < 0x070500)
               if(!aMapReader.IsNull()) {
-                  //aMapReader->SetProgress(theProgress);
+                  aMapReader->SetProgress(new StShapeProgressIndicator(myProgress));
               }
+#endif
           }
           {
               if(!aReader.Transfer(myXCAFDoc)) {
-                  signals.onError(formatError(theFileToLoadPath, "IGES reader, shape translation failed"));
+                  if(!isCancelled()) {
+                      signals.onError(formatError(theFileToLoadPath, "IGES reader, shape translation failed"));
+                  }
                   clearSession(aWS);
                   return false;
               }
@@ -529,9 +672,11 @@ bool StAssetImportShape::loadSTEP(const StString& theFileToLoadPath) {
         {
             {
                 Handle(Transfer_TransientProcess) aMapReader = aWS->TransferReader()->TransientProcess();
+#if(OCC_VERSION_HEX < 0x070500)
                 if(!aMapReader.IsNull()) {
-                    //aMapReader->SetProgress(theProgress);
+                    aMapReader->SetProgress(new StShapeProgressIndicator(myProgress));
                 }
+#endif
             }
 
             if(!aReader.ReadFile(theFileToLoadPath.toCString())) {
@@ -545,14 +690,18 @@ bool StAssetImportShape::loadSTEP(const StString& theFileToLoadPath) {
         {
             {
               Handle(Transfer_TransientProcess) aMapReader = aWS->TransferReader()->TransientProcess();
+#if(OCC_VERSION_HEX < 0x070500)
               if(!aMapReader.IsNull()) {
-                  //aMapReader->SetProgress(theProgress);
+                  aMapReader->SetProgress(new StShapeProgressIndicator(myProgress));
               }
+#endif
             }
 
             {
               if(!aReader.Transfer(myXCAFDoc)) {
-                  signals.onError(formatError(theFileToLoadPath, "STEP reader, shape translation failed"));
+                  if(!isCancelled()) {
+                      signals.onError(formatError(theFileToLoadPath, "STEP reader, shape translation failed"));
+                  }
                   clearSession(aWS);
                   return false;
               }
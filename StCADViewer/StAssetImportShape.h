@@ -11,9 +11,11 @@
 #include <StFile/StFileNode.h>
 #include <StSlots/StSignal.h>
 
+#include <Bnd_Box.hxx>
 #include <Standard_Type.hxx>
 
 #include "StAssetDocument.h"
+#include "StAssetImportProgress.h"
 
 class TDF_Label;
 class TDocStd_Document;
@@ -68,6 +70,11 @@ class StAssetImportShape {
      */
     ST_LOCAL StAssetImportShape();
 
+    /**
+     * Set progress indicator and cancellation token (NULL by default).
+     */
+    ST_LOCAL void setProgress(StAssetImportProgress* theProgress) { myProgress = theProgress; }
+
     /**
      * Perform the import.
      */
@@ -94,14 +101,34 @@ class StAssetImportShape {
                                    XCAFDoc_ColorTool&       theColorTool,
                                    const TDF_Label&         theLabel,
                                    const TopLoc_Location&   theParentTrsf,
-                                   const XCAFPrs_Style&     theParentStyle);
+                                   const XCAFPrs_Style&     theParentStyle,
+                                   const gp_Trsf&           theParentLoc);
 
     /**
      * Add the BRep shape into Asset document.
+     * The shape is meshed on demand, so that parts become available one by one.
+     * @param theLoc cumulative transformation of the parent node
      */
     ST_LOCAL bool addMeshNode(const Handle(StDocNode)& theParentTreeItem,
                               const TDF_Label&         theShapeLabel,
-                              const XCAFPrs_Style&     theParentStyle);
+                              const XCAFPrs_Style&     theParentStyle,
+                              const gp_Trsf&           theLoc);
+
+    /**
+     * Collect bounding boxes of parts (without meshing) recursively.
+     */
+    ST_LOCAL void collectBoxes(NCollection_Sequence<Bnd_Box>& theBoxes,
+                               const TDF_Label&               theLabel,
+                               const gp_Trsf&                 theLoc,
+                               const int                      theDepth);
+
+    /**
+     * Return TRUE if import has been cancelled.
+     */
+    ST_LOCAL bool isCancelled() const {
+        return myProgress != NULL
+            && myProgress->isCancelled();
+    }
 
     /**
      * Reset XDE document.
@@ -121,12 +148,28 @@ class StAssetImportShape {
          * @param theUserData (const StString& ) - error description.
          */
         StSignal<void (const StCString& )> onError;
+
+        /**
+         * Emit callback Slot when mesh node has been loaded (within working thread).
+         * @param theMeshNode (const Handle(StDocMeshNode)& ) - loaded mesh node
+         * @param theLoc      (const gp_Trsf& ) - cumulative transformation of the node
+         */
+        StSignal<void (const Handle(StDocMeshNode)& , const gp_Trsf& )> onMeshNode;
+
+        /**
+         * Emit callback Slot with coarse preview of the document (within working thread).
+         * @param theBoxes (const NCollection_Sequence<Bnd_Box>& ) - bounding boxes of document parts
+         */
+        StSignal<void (const NCollection_Sequence<Bnd_Box>& )> onPreview;
     } signals;
 
         protected:
 
     Handle(TDocStd_Application) myXCAFApp;
     Handle(TDocStd_Document)    myXCAFDoc;
+    StAssetImportProgress*      myProgress;   //!< progress indicator and cancellation token
+    double                      myDeflection; //!< linear deflection for meshing parts
+    double                      myAngle;      //!< angular deflection for meshing parts
 
 };
 
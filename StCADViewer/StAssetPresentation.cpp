@@ -6,8 +6,21 @@
 
 #include "StAssetPresentation.h"
 
+#include <Graphic3d_ArrayOfSegments.hxx>
 #include <Graphic3d_ArrayOfTriangles.hxx>
 #include <NCollection_IndexedDataMap.hxx>
+#include <NCollection_Vector.hxx>
+
+#include <StThreads/StThreadPool.h>
+
+namespace {
+
+    /**
+     * Number of nodes or indices filled by one task.
+     */
+    static const size_t THE_TASK_SIZE = 65536;
+
+}
 
 /**
  * Auxiliary structure for grouping primitive arrays by common material.
@@ -15,17 +28,42 @@
 struct StLocatedPrimArray {
     Handle(StPrimArray) PrimArray;
     gp_Trsf             NodeTrsf;
+    size_t              FirstNode;   //!< offset of the first node within merged array
+    size_t              FirstIndex;  //!< offset of the first index within merged array
+    float               PosMat[12];  //!< 3x4 row-major matrix transforming positions
+    float               NormMat[9];  //!< 3x3 row-major matrix transforming normals
+    bool                IsIdentity;  //!< flag indicating identity transformation
 
-    StLocatedPrimArray() {}
+    StLocatedPrimArray() : FirstNode(0), FirstIndex(0), IsIdentity(true) {}
     StLocatedPrimArray(const Handle(StPrimArray)& thePrimArray,
-                       const gp_Trsf& theNodeTrsf) : PrimArray(thePrimArray), NodeTrsf(theNodeTrsf) {}
+                       const gp_Trsf& theNodeTrsf) : PrimArray(thePrimArray), NodeTrsf(theNodeTrsf), FirstNode(0), FirstIndex(0), IsIdentity(true) {}
+
+    /**
+     * Convert cumulative transformation into single precision matrices.
+     */
+    void initMatrices() {
+        const gp_Trsf aTrsf = NodeTrsf * PrimArray->Trsf;
+        IsIdentity = aTrsf.Form() == gp_Identity;
+
+        // gp_Dir::Transform() applies only the rotation part and reverses direction for negative scale
+        const gp_Mat& aRot  = aTrsf.HVectorialPart();
+        const double  aSign = aTrsf.ScaleFactor() < 0.0 ? -1.0 : 1.0;
+        for(int aRow = 0; aRow < 3; ++aRow) {
+            for(int aCol = 0; aCol < 3; ++aCol) {
+                PosMat [aRow * 4 + aCol] = (float )aTrsf.Value(aRow + 1, aCol + 1);
+                NormMat[aRow * 3 + aCol] = (float )(aRot.Value(aRow + 1, aCol + 1) * aSign);
+            }
+            PosMat[aRow * 4 + 3] = (float )aTrsf.Value(aRow + 1, 4);
+        }
+    }
 };
 
 /**
  * Auxiliary structure for grouping primitive arrays by common material.
  */
 struct StPrsPart {
-    NCollection_Sequence<StLocatedPrimArray> PrimArrays;
+    NCollection_Vector<StLocatedPrimArray> PrimArrays;
+    Handle(Graphic3d_ArrayOfTriangles)     Triangles;
     size_t NbNodes;
     size_t NbTris;
     bool   HasTexCoord0;
@@ -33,6 +71,114 @@ struct StPrsPart {
     StPrsPart() : NbNodes(0), NbTris(0), HasTexCoord0(false) {}
 };
 
+/**
+ * Range of nodes or indices of one primitive array to be copied into merged array.
+ */
+struct StPrsFillTask {
+    const StLocatedPrimArray* Prim;
+    Graphic3d_ArrayOfTriangles* Triangles;
+    size_t From;
+    size_t To;
+    bool   ToFillIndices;
+};
+
+/**
+ * Fill merged arrays by multiple threads - each task writes into own range of output buffers.
+ */
+struct StPrsFillJob {
+    const StPrsFillTask* Tasks;
+
+    static void perform(void* theJob, const size_t theFrom, const size_t theTo) {
+        const StPrsFillJob& aJob = *(const StPrsFillJob* )theJob;
+        for(size_t aTaskIter = theFrom; aTaskIter < theTo; ++aTaskIter) {
+            const StPrsFillTask& aTask = aJob.Tasks[aTaskIter];
+            if(aTask.ToFillIndices) {
+                fillIndices(aTask);
+            } else {
+                fillNodes(aTask);
+            }
+        }
+    }
+
+    /**
+     * Copy indices shifted by the first node of primitive array.
+     */
+    static void fillIndices(const StPrsFillTask& theTask) {
+        const std::vector<GLuint>& anIndices = theTask.Prim->PrimArray->Indices;
+        const Handle(Graphic3d_IndexBuffer)& anIndexBuffer = theTask.Triangles->Indices();
+        const GLuint aShift = GLuint(theTask.Prim->FirstNode);
+        if(anIndexBuffer->Stride == sizeof(unsigned short)) {
+            unsigned short* aDst = (unsigned short* )anIndexBuffer->ChangeData() + theTask.Prim->FirstIndex;
+            for(size_t anIndexIter = theTask.From; anIndexIter < theTask.To; ++anIndexIter) {
+                aDst[anIndexIter] = (unsigned short )(anIndices[anIndexIter] + aShift);
+            }
+        } else {
+            unsigned int* aDst = (unsigned int* )anIndexBuffer->ChangeData() + theTask.Prim->FirstIndex;
+            for(size_t anIndexIter = theTask.From; anIndexIter < theTask.To; ++anIndexIter) {
+                aDst[anIndexIter] = anIndices[anIndexIter] + aShift;
+            }
+        }
+    }
+
+    /**
+     * Copy transformed positions, normals and texture coordinates.
+     */
+    static void fillNodes(const StPrsFillTask& theTask) {
+        const StLocatedPrimArray& aPrim  = *theTask.Prim;
+        const StPrimArray&        aPrims = *aPrim.PrimArray;
+        const Handle(Graphic3d_Buffer)& anAttribs = theTask.Triangles->Attributes();
+        int anOffsetPos = -1, anOffsetNorm = -1, anOffsetUV = -1;
+        for(int anAttribIter = 0; anAttribIter < anAttribs->NbAttributes; ++anAttribIter) {
+            switch(anAttribs->Attribute(anAttribIter).Id) {
+                case Graphic3d_TOA_POS:  anOffsetPos  = anAttribs->AttributeOffset(anAttribIter); break;
+                case Graphic3d_TOA_NORM: anOffsetNorm = anAttribs->AttributeOffset(anAttribIter); break;
+                case Graphic3d_TOA_UV:   anOffsetUV   = anAttribs->AttributeOffset(anAttribIter); break;
+                default: break;
+            }
+        }
+
+        const size_t aStride = size_t(anAttribs->Stride);
+        uint8_t* aDstBase = (uint8_t* )anAttribs->ChangeData() + (aPrim.FirstNode + theTask.From) * aStride;
+        const StGLVec3* aPositions = &aPrims.Positions[0];
+        const StGLVec3* aNormals   = aPrims.Normals.size() == aPrims.Positions.size() ? &aPrims.Normals[0] : NULL;
+        const float*    aM = aPrim.PosMat;
+        const float*    aN = aPrim.NormMat;
+        uint8_t* aDst = aDstBase;
+        for(size_t aNodeIter = theTask.From; aNodeIter < theTask.To; ++aNodeIter, aDst += aStride) {
+            const StGLVec3& aPos  = aPositions[aNodeIter];
+            StGLVec3*       aDstPos  = (StGLVec3* )(aDst + anOffsetPos);
+            StGLVec3*       aDstNorm = (StGLVec3* )(aDst + anOffsetNorm);
+            const StGLVec3  aNorm = aNormals != NULL ? aNormals[aNodeIter] : StGLVec3(0.0f, 0.0f, 0.0f);
+            if(aPrim.IsIdentity) {
+                *aDstPos  = aPos;
+                *aDstNorm = aNorm;
+                continue;
+            }
+
+            *aDstPos = StGLVec3(aM[0] * aPos.x() + aM[1] * aPos.y() + aM[2]  * aPos.z() + aM[3],
+                                aM[4] * aPos.x() + aM[5] * aPos.y() + aM[6]  * aPos.z() + aM[7],
+                                aM[8] * aPos.x() + aM[9] * aPos.y() + aM[10] * aPos.z() + aM[11]);
+            StGLVec3 aNormTrsf(aN[0] * aNorm.x() + aN[1] * aNorm.y() + aN[2] * aNorm.z(),
+                               aN[3] * aNorm.x() + aN[4] * aNorm.y() + aN[5] * aNorm.z(),
+                               aN[6] * aNorm.x() + aN[7] * aNorm.y() + aN[8] * aNorm.z());
+            if(aNorm.modulus() != 0.0f) {
+                aNormTrsf.normalize();
+            }
+            *aDstNorm = aNormTrsf;
+        }
+
+        if(anOffsetUV < 0) {
+            return;
+        }
+
+        const bool hasTexCoords = aPrims.TexCoords0.size() == aPrims.Positions.size();
+        aDst = aDstBase;
+        for(size_t aNodeIter = theTask.From; aNodeIter < theTask.To; ++aNodeIter, aDst += aStride) {
+            *(StGLVec2* )(aDst + anOffsetUV) = hasTexCoords ? aPrims.TexCoords0[aNodeIter] : StGLVec2(0.0f, 0.0f);
+        }
+    }
+};
+
 void StAssetPresentation::Compute (const Handle(PrsMgr_PresentationManager3d)& thePrsMgr,
                                    const Handle(Prs3d_Presentation)& thePrs,
                                    const int theMode) {
@@ -51,64 +197,60 @@ void StAssetPresentation::Compute (const Handle(PrsMgr_PresentationManager3d)& t
             const Handle(StPrimArray)& aPrims = aPrimIter.Value();
             const int anIndex = aStyleMap.Add(aPrims->Material, anEmptyPart);
             StPrsPart& aPrsPart = aStyleMap.ChangeFromIndex(anIndex);
+
+            // offsets within merged array (prefix sum)
+            StLocatedPrimArray& aLocPrims = aPrsPart.PrimArrays.Append(StLocatedPrimArray(aPrims, aMeshTrsf));
+            aLocPrims.FirstNode  = aPrsPart.NbNodes;
+            aLocPrims.FirstIndex = aPrsPart.NbTris * 3;
+            aLocPrims.initMatrices();
             aPrsPart.NbNodes += aPrims->Positions.size();
             aPrsPart.NbTris  += aPrims->Indices.size() / 3;
             aPrsPart.HasTexCoord0 = aPrsPart.HasTexCoord0 || !aPrims->TexCoords0.empty();
-            aPrsPart.PrimArrays.Append(StLocatedPrimArray(aPrims, aMeshTrsf));
         }
     }
 
+    // allocate merged arrays and split filling into tasks
+    std::vector<StPrsFillTask> aTasks;
     for(NCollection_IndexedDataMap<Handle(StGLMaterial), StPrsPart, StGLMaterial>::Iterator aStyleIter(aStyleMap); aStyleIter.More(); aStyleIter.Next()) {
-        const StPrsPart& aPrsPart = aStyleIter.Value();
-        Handle(Graphic3d_ArrayOfTriangles) aTris = new Graphic3d_ArrayOfTriangles(int(aPrsPart.NbNodes), int(aPrsPart.NbTris * 3), true, false, aPrsPart.HasTexCoord0);
-        for(NCollection_Sequence<StLocatedPrimArray>::Iterator aPrimIter(aPrsPart.PrimArrays); aPrimIter.More(); aPrimIter.Next()) {
-            const Handle(StPrimArray)& aPrims = aPrimIter.Value().PrimArray;
-            const gp_Trsf& aMeshTrsf = aPrimIter.Value().NodeTrsf;
-
-            const int aLowerVertex = aTris->VertexNumber() + 1;
-
-            const size_t aNbPrimNodes = aPrims->Positions.size();
-            const gp_Trsf aTrsf = aMeshTrsf * aPrims->Trsf;
-            if(aTrsf.Form() != gp_Identity) {
-                for(size_t aNodeIter = 0; aNodeIter < aNbPrimNodes; ++aNodeIter) {
-                    const StGLVec3& aPos = aPrims->Positions[aNodeIter];
-                    StGLVec3 aNorm = aPrims->Normals[aNodeIter];
-                    if(aNorm.modulus() != 0.0f) {
-                        gp_Dir aNormTrsf(aNorm.x(), aNorm.y(), aNorm.z());
-                        aNormTrsf.Transform(aTrsf);
-                        aNorm.x() = (float )aNormTrsf.X();
-                        aNorm.y() = (float )aNormTrsf.Y();
-                        aNorm.z() = (float )aNormTrsf.Z();
-                    }
-
-                    gp_Pnt aPosTrsf(aPos.x(),  aPos.y(),  aPos.z());
-                    aPosTrsf.Transform(aTrsf);
-                    aTris->AddVertex((float )aPosTrsf.X(), (float )aPosTrsf.Y(), (float )aPosTrsf.Z(),
-                                     aNorm.x(), aNorm.y(), aNorm.z());
-                }
-            } else {
-                for(size_t aNodeIter = 0; aNodeIter < aNbPrimNodes; ++aNodeIter) {
-                    const StGLVec3& aPos  = aPrims->Positions[aNodeIter];
-                    const StGLVec3& aNorm = aPrims->Normals  [aNodeIter];
-                    aTris->AddVertex(aPos.x(),  aPos.y(),  aPos.z(),
-                                     aNorm.x(), aNorm.y(), aNorm.z());
-                }
-            }
+        StPrsPart& aPrsPart = aStyleIter.ChangeValue();
+        aPrsPart.Triangles = new Graphic3d_ArrayOfTriangles(int(aPrsPart.NbNodes), int(aPrsPart.NbTris * 3), true, false, aPrsPart.HasTexCoord0);
+        aPrsPart.Triangles->Attributes()->NbElements = int(aPrsPart.NbNodes);
+        if(!aPrsPart.Triangles->Indices().IsNull()) {
+            aPrsPart.Triangles->Indices()->NbElements = int(aPrsPart.NbTris * 3);
+        }
+        for(NCollection_Vector<StLocatedPrimArray>::Iterator aPrimIter(aPrsPart.PrimArrays); aPrimIter.More(); aPrimIter.Next()) {
+            const StLocatedPrimArray& aLocPrims = aPrimIter.Value();
+            StPrsFillTask aTask;
+            aTask.Prim      = &aLocPrims;
+            aTask.Triangles = aPrsPart.Triangles.get();
 
-            if(aPrsPart.HasTexCoord0
-            && aPrims->TexCoords0.size() == aPrims->Positions.size()) {
-                for(size_t aNodeIter = 0; aNodeIter < aNbPrimNodes; ++aNodeIter) {
-                    const StGLVec2& aTexCoord = aPrims->TexCoords0[aNodeIter];
-                    aTris->SetVertexTexel(aLowerVertex + int(aNodeIter), aTexCoord.x(), aTexCoord.y());
-                }
+            aTask.ToFillIndices = false;
+            const size_t aNbPrimNodes = aLocPrims.PrimArray->Positions.size();
+            for(size_t aNodeIter = 0; aNodeIter < aNbPrimNodes; aNodeIter += THE_TASK_SIZE) {
+                aTask.From = aNodeIter;
+                aTask.To   = stMin(aNodeIter + THE_TASK_SIZE, aNbPrimNodes);
+                aTasks.push_back(aTask);
             }
 
-            const size_t aNbPrimIndices = aPrims->Indices.size();
-            for(size_t anIndexIter = 0; anIndexIter < aNbPrimIndices; ++anIndexIter) {
-                aTris->AddEdge(aLowerVertex + aPrims->Indices[anIndexIter]);
+            aTask.ToFillIndices = true;
+            const size_t aNbPrimIndices = (aLocPrims.PrimArray->Indices.size() / 3) * 3;
+            for(size_t anIndexIter = 0; anIndexIter < aNbPrimIndices; anIndexIter += THE_TASK_SIZE) {
+                aTask.From = anIndexIter;
+                aTask.To   = stMin(anIndexIter + THE_TASK_SIZE, aNbPrimIndices);
+                aTasks.push_back(aTask);
             }
         }
+    }
+
+    if(!aTasks.empty()) {
+        StPrsFillJob aJob;
+        aJob.Tasks = &aTasks[0];
+        StThreadPool::GetDefault().perform(StPrsFillJob::perform, &aJob, aTasks.size());
+    }
 
+    for(NCollection_IndexedDataMap<Handle(StGLMaterial), StPrsPart, StGLMaterial>::Iterator aStyleIter(aStyleMap); aStyleIter.More(); aStyleIter.Next()) {
+        const StPrsPart& aPrsPart = aStyleIter.Value();
+        const Handle(Graphic3d_ArrayOfTriangles)& aTris = aPrsPart.Triangles;
         const Handle(Graphic3d_Group) aGroup = thePrs->NewGroup();
         Graphic3d_MaterialAspect aMat(Graphic3d_NOM_SILVER);
         const Handle(StGLMaterial)& anStMat = aStyleIter.Key();
@@ -150,3 +292,38 @@ void StAssetPresentation::Compute (const Handle(PrsMgr_PresentationManager3d)& t
 
 void StAssetPresentation::ComputeSelection (const Handle(SelectMgr_Selection)& ,
                                             const int ) {}
+
+void StAssetBndPresentation::Compute(const Handle(PrsMgr_PresentationManager3d)& ,
+                                     const Handle(Prs3d_Presentation)& thePrs,
+                                     const int theMode) {
+    if(theMode != 0
+    || myBoxes.IsEmpty()) {
+        return;
+    }
+
+    // pairs of box corners forming 12 edges
+    static const int THE_BOX_EDGES[24] = {
+        0, 1,  1, 3,  3, 2,  2, 0,
+        4, 5,  5, 7,  7, 6,  6, 4,
+        0, 4,  1, 5,  2, 6,  3, 7,
+    };
+
+    Handle(Graphic3d_ArrayOfSegments) aSegments = new Graphic3d_ArrayOfSegments(myBoxes.Length() * 8, myBoxes.Length() * 24);
+    for(NCollection_Sequence<Bnd_Box>::Iterator aBoxIter(myBoxes); aBoxIter.More(); aBoxIter.Next()) {
+        double aMin[3], aMax[3];
+        aBoxIter.Value().Get(aMin[0], aMin[1], aMin[2], aMax[0], aMax[1], aMax[2]);
+        const int aLower = aSegments->VertexNumber();
+        for(int aCornerIter = 0; aCornerIter < 8; ++aCornerIter) {
+            aSegments->AddVertex((aCornerIter & 1) != 0 ? aMax[0] : aMin[0],
+                                 (aCornerIter & 2) != 0 ? aMax[1] : aMin[1],
+                                 (aCornerIter & 4) != 0 ? aMax[2] : aMin[2]);
+        }
+        for(int anEdgeIter = 0; anEdgeIter < 24; ++anEdgeIter) {
+            aSegments->AddEdge(aLower + 1 + THE_BOX_EDGES[anEdgeIter]);
+        }
+    }
+
+    const Handle(Graphic3d_Group) aGroup = thePrs->NewGroup();
+    aGroup->SetGroupPrimitivesAspect(new Graphic3d_AspectLine3d(Quantity_NOC_GRAY70, Aspect_TOL_SOLID, 1.0));
+    aGroup->AddPrimitiveArray(aSegments);
+}
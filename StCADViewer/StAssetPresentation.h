@@ -10,6 +10,7 @@
 #include "StAssetDocument.h"
 
 #include <AIS_InteractiveObject.hxx>
+#include <Bnd_Box.hxx>
 
 /**
  * Document node with cumulative transformation (including parent nodes).
@@ -55,4 +56,44 @@ class StAssetPresentation : public AIS_InteractiveObject {
 
 };
 
+/**
+ * Interactive object displaying bounding boxes of document parts - coarse preview of the model being loaded.
+ */
+class StAssetBndPresentation : public AIS_InteractiveObject {
+
+    DEFINE_STANDARD_RTTI_INLINE(StAssetBndPresentation, AIS_InteractiveObject)
+
+        public:
+
+    StAssetBndPresentation() {
+        SetDisplayMode(0);
+    }
+
+    virtual bool AcceptDisplayMode(const int theMode) const Standard_OVERRIDE { return theMode == 0; }
+
+    //! Redefined method to compute presentation.
+    ST_LOCAL virtual void Compute(const Handle(PrsMgr_PresentationManager3d)& thePrsMgr,
+                                  const Handle(Prs3d_Presentation)& thePrs,
+                                  const int theMode) Standard_OVERRIDE;
+
+    //! Compute selection.
+    virtual void ComputeSelection(const Handle(SelectMgr_Selection)& ,
+                                  const int ) Standard_OVERRIDE {}
+
+    //! Return the number of boxes.
+    int NbBoxes() const { return myBoxes.Length(); }
+
+    //! Add the box (in world coordinates).
+    void AddBox(const Bnd_Box& theBox) {
+        if(!theBox.IsVoid()) {
+            myBoxes.Append(theBox);
+        }
+    }
+
+        protected:
+
+    NCollection_Sequence<Bnd_Box> myBoxes;
+
+};
+
 #endif // __StAssetPresentation_h_
@@ -9,6 +9,11 @@
 #include "StAssetTexture.h"
 
 #include <StFile/StMIME.h>
+#include <StStrings/StLogger.h>
+
+#include <OSD_OpenFile.hxx>
+
+#include <fstream>
 
 Handle(Image_PixMap) StAssetTexture::GetImage() const {
     Handle(Image_PixMap) anImage;
@@ -25,3 +30,48 @@ Handle(Image_PixMap) StAssetTexture::GetImage() const {
     }
     return anImage;
 }
+
+Handle(Image_PixMap) StGltfBinTexture::GetImage() const {
+    Handle(Image_PixMap) anImage;
+    if(!myBuffer.IsNull()) {
+        Handle(StImageOcct) anStImage = new StImageOcct();
+        if(anStImage->Load(myImageUri, StMIME(myMime, StString(), StString()), myBuffer->ChangeData(), (int )myBuffer->Size())) {
+            anImage = anStImage;
+        }
+    } else {
+        std::ifstream aFile;
+        OSD_OpenStream(aFile, myImageUri.toCString(), std::ios::in | std::ios::binary);
+        if(!aFile.is_open() || !aFile.good()) {
+            ST_ERROR_LOG(StString() + "Texture points to non existing file '" + myImageUri.toCString() + "'");
+            return false;
+        }
+
+        aFile.seekg(myStart, std::ios_base::beg);
+        if(!aFile.good()) {
+            aFile.close();
+            ST_ERROR_LOG(StString() + "Texture refers to non-existing location");
+            return false;
+        }
+
+        Handle(NCollection_Buffer) aData = new NCollection_Buffer(NCollection_BaseAllocator::CommonBaseAllocator());
+        if(!aData->Allocate(myLen)) {
+            ST_ERROR_LOG("Fail to allocate memory.");
+            return false;
+        }
+
+        if(!aFile.read((char* )aData->ChangeData(), myLen)) {
+            ST_ERROR_LOG(StString() + "Texture refers to non-existing location");
+            return false;
+        }
+
+        Handle(StImageOcct) anStImage = new StImageOcct();
+        if(anStImage->Load(myImageUri, StMIME(myMime, StString(), StString()), aData->ChangeData(), myLen)) {
+            anImage = anStImage;
+        }
+    }
+
+    if(anImage.IsNull()) {
+        return Handle(Image_PixMap)();
+    }
+    return anImage;
+}
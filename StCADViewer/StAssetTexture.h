@@ -8,6 +8,7 @@
 #define __StAssetTexture_h_
 
 #include <Graphic3d_Texture2Dmanual.hxx>
+#include <NCollection_Buffer.hxx>
 
 #include <StStrings/StString.h>
 
@@ -36,6 +37,11 @@ class StAssetTexture : public Graphic3d_Texture2Dmanual {
      */
     ST_LOCAL virtual Handle(Image_PixMap) GetImage() const Standard_OVERRIDE;
 
+    /**
+     * Return image URI.
+     */
+    const StString& getImageUri() const { return myImageUri; }
+
     /**
      * Compare with another texture.
      */
@@ -65,4 +71,88 @@ class StAssetTexture : public Graphic3d_Texture2Dmanual {
 
 };
 
+/**
+ * Image texture embedded into binary glTF file.
+ */
+class StGltfBinTexture : public StAssetTexture {
+
+    DEFINE_STANDARD_RTTI_INLINE(StGltfBinTexture, StAssetTexture)
+
+        public:
+
+    /**
+     * Constructor.
+     */
+    StGltfBinTexture(const StString& theUri,
+                     const StString& theMime,
+                     const int64_t theStart,
+                     const int theLen)
+    : StAssetTexture(theUri),
+      myStart(theStart),
+      myLen(theLen),
+      myMime(theMime) {
+        if(!theUri.isEmpty()) {
+            const StString anId = StString("texture://") + theUri + "@offset=" + StString(theStart) + "@len=" + StString(theLen);
+            myTexId = anId.toCString();
+        }
+    }
+
+    /**
+     * Constructor.
+     */
+    StGltfBinTexture(const StString& theUri,
+                     const StString& theMime,
+                     const Handle(NCollection_Buffer)& theBuffer)
+    : StAssetTexture(theUri),
+      myStart(0),
+      myLen(0),
+      myBuffer(theBuffer),
+      myMime(theMime) {
+        if(!theUri.isEmpty()) {
+            const StString anId = StString("texture://") + theUri + "@base64";
+            myTexId = anId.toCString();
+        }
+    }
+
+    /**
+     * Image getter.
+     */
+    ST_LOCAL virtual Handle(Image_PixMap) GetImage() const Standard_OVERRIDE;
+
+    /**
+     * Return MIME type of the image.
+     */
+    const StString& getMime() const { return myMime; }
+
+    /**
+     * Return offset of the image within the file (when data is not embedded into buffer).
+     */
+    int64_t getStart() const { return myStart; }
+
+    /**
+     * Return length of the image within the file (when data is not embedded into buffer).
+     */
+    int getLength() const { return myLen; }
+
+    /**
+     * Return image data decoded from base64 (or NULL).
+     */
+    const Handle(NCollection_Buffer)& getBuffer() const { return myBuffer; }
+
+    /**
+     * Compare with another texture.
+     */
+    virtual bool isEqual(const StAssetTexture& theOther) const {
+        return myTexId == theOther.GetId();
+    }
+
+        private:
+
+    int64_t myStart;
+    int     myLen;
+    Handle(NCollection_Buffer) myBuffer;
+    StString myMime;
+
+};
+
 #endif // __StAssetTexture_h_
@@ -23,14 +23,30 @@ const StString StCADLoader::ST_CAD_MIME_STRING(ST_CAD_PLUGIN_MIME_CHAR);
 const StMIMEList StCADLoader::ST_CAD_MIME_LIST(StCADLoader::ST_CAD_MIME_STRING);
 const StArrayList<StString> StCADLoader::ST_CAD_EXTENSIONS_LIST(StCADLoader::ST_CAD_MIME_LIST.getExtensionsList());
 
+namespace {
+
+    /**
+     * Number of triangles within presentation published as a single batch.
+     */
+    static const size_t THE_BATCH_NB_TRIANGLES = 250000;
+
+    /**
+     * Maximum delay before pending presentation is published (in seconds).
+     */
+    static const double THE_BATCH_DELAY = 0.25;
+
+}
+
 StCADLoader::StCADLoader(const StHandle<StLangMap>&  theLangMap,
                          const StHandle<StPlayList>& thePlayList,
+                         const StString&             theCacheFolder,
                          const bool                  theToStartThread)
 : myLangMap(theLangMap),
   myPlayList(thePlayList),
   myEvLoadNext(false),
+  myCache(theCacheFolder),
+  myPendingNbTris(0),
   myDefaultMat(Graphic3d_NOM_SILVER),
-  myIsLoaded(false),
   myToQuit(false) {
     myPlayList->setExtensions(ST_CAD_EXTENSIONS_LIST);
     if(theToStartThread) {
@@ -40,6 +56,7 @@ StCADLoader::StCADLoader(const StHandle<StLangMap>&  theLangMap,
 
 StCADLoader::~StCADLoader() {
     myToQuit = true;
+    myProgress.cancel();
     myEvLoadNext.set(); // stop the thread
     myThread->wait();
     myThread.nullify();
@@ -47,6 +64,11 @@ StCADLoader::~StCADLoader() {
 }
 
 bool StCADLoader::loadModel(const StHandle<StFileNode>& theSource) {
+    if(myProgress.isCancelled()) {
+        // cancelled before import has been started - keep previous model
+        return false;
+    }
+
     const StMIME stMIMEType = theSource->getMIME();
     const StString aFileToLoadPath = theSource->getPath();
     const StString anExt = !stMIMEType.isEmpty() ? stMIMEType.getExtension() : StFileNode::getExtension(aFileToLoadPath);
@@ -60,55 +82,126 @@ bool StCADLoader::loadModel(const StHandle<StFileNode>& theSource) {
       isGltf = StAssetImportGltf::probeFormatFromHeader((const char* )aRawFile.getBuffer(), anExt);
     }
 
-    myDoc = new StAssetDocument();
-    bool isRead = false;
-    if(isGltf) {
-        StAssetImportGltf aReader;
-        aReader.signals.onError.connect(this, &StCADLoader::doOnErrorRedirect);
-        isRead = aReader.load(myDoc, aFileToLoadPath);
+    // import settings affecting the result
+    const StString anImportKey = isGltf
+                               ? StString("gltf")
+                               : StString("shape:") + StString(int(aShapeFormat));
+
+    myPendingPrs.Nullify();
+    myPendingNbTris = 0;
+    myPendingTimer.restart();
+
+    // remove previous model
+    myResultLock.lock();
+        myBatch.clear();
+        myBatch.ToClear = true;
+    myResultLock.unlock();
+
+    Handle(StAssetDocument) aDoc = new StAssetDocument();
+    const bool isFromCache = myCache.read(aDoc, aFileToLoadPath, anImportKey);
+    bool isRead = isFromCache;
+    if(isFromCache) {
+        for(StAssetNodeIterator aMeshNodeIter(aDoc, StDocNodeType_Mesh); aMeshNodeIter.more(); aMeshNodeIter.next()) {
+            doOnMeshNode(Handle(StDocMeshNode)::DownCast(aMeshNodeIter.value()), aMeshNodeIter.location());
+        }
     } else {
-        StAssetImportShape aReader;
-        aReader.signals.onError.connect(this, &StCADLoader::doOnErrorRedirect);
-        isRead = aReader.load(myDoc, aFileToLoadPath, aShapeFormat);
+        aDoc = new StAssetDocument(); // discard partially read cache
+        if(isGltf) {
+            StAssetImportGltf aReader;
+            aReader.setProgress(&myProgress);
+            aReader.signals.onError   .connect(this, &StCADLoader::doOnErrorRedirect);
+            aReader.signals.onMeshNode.connect(this, &StCADLoader::doOnMeshNode);
+            aReader.signals.onPreview .connect(this, &StCADLoader::doOnPreview);
+            isRead = aReader.load(aDoc, aFileToLoadPath);
+        } else {
+            StAssetImportShape aReader;
+            aReader.setProgress(&myProgress);
+            aReader.signals.onError   .connect(this, &StCADLoader::doOnErrorRedirect);
+            aReader.signals.onMeshNode.connect(this, &StCADLoader::doOnMeshNode);
+            aReader.signals.onPreview .connect(this, &StCADLoader::doOnPreview);
+            isRead = aReader.load(aDoc, aFileToLoadPath, aShapeFormat);
+        }
     }
 
-    NCollection_Sequence<Handle(AIS_InteractiveObject)> aPrsList;
-    if(isRead) {
-        Handle(StAssetPresentation) aShapePrs = new StAssetPresentation();
-        for(StAssetNodeIterator aMeshNodeIter(myDoc, StDocNodeType_Mesh); aMeshNodeIter.more(); aMeshNodeIter.next()) {
-            Handle(StDocMeshNode) aMeshNode = Handle(StDocMeshNode)::DownCast(aMeshNodeIter.value());
-            aShapePrs->AddMeshNode(aMeshNode, aMeshNodeIter.location());
-        }
-        aPrsList.Append(aShapePrs);
+    // publish the rest of the model
+    flushPending();
+    const bool isCancelled = myProgress.isCancelled();
+    myProgress.setActive(false);
+    myResultLock.lock();
+        myBatch.Document    = aDoc;
+        myBatch.IsFinished  = true;
+        myBatch.IsCancelled = isCancelled;
+    myResultLock.unlock();
+
+    // store imported document for faster loading next time
+    if(isRead
+    && !isFromCache
+    && !isCancelled) {
+        myCache.write(aDoc, aFileToLoadPath, anImportKey);
+    }
+    return isRead;
+}
+
+void StCADLoader::doOnMeshNode(const Handle(StDocMeshNode)& theNode,
+                               const gp_Trsf&               theLoc) {
+    if(theNode.IsNull()) {
+        return;
+    }
+
+    if(myPendingPrs.IsNull()) {
+        myPendingPrs = new StAssetPresentation();
+    }
+    myPendingPrs->AddMeshNode(theNode, theLoc);
+    for(NCollection_Sequence<Handle(StPrimArray)>::Iterator aPrimIter(theNode->PrimitiveArrays()); aPrimIter.More(); aPrimIter.Next()) {
+        myPendingNbTris += aPrimIter.Value()->Indices.size() / 3;
+    }
+
+    if(myPendingNbTris >= THE_BATCH_NB_TRIANGLES
+    || myPendingTimer.getElapsedTimeInSec() >= THE_BATCH_DELAY) {
+        flushPending();
+    }
+}
+
+void StCADLoader::doOnPreview(const NCollection_Sequence<Bnd_Box>& theBoxes) {
+    Handle(StAssetBndPresentation) aPreview = new StAssetBndPresentation();
+    for(NCollection_Sequence<Bnd_Box>::Iterator aBoxIter(theBoxes); aBoxIter.More(); aBoxIter.Next()) {
+        aPreview->AddBox(aBoxIter.Value());
+    }
+    if(aPreview->NbBoxes() == 0) {
+        return;
+    }
+
+    myResultLock.lock();
+        myBatch.Preview = aPreview;
+    myResultLock.unlock();
+}
+
+void StCADLoader::flushPending() {
+    myPendingTimer.restart();
+    if(myPendingPrs.IsNull()) {
+        return;
     }
 
-    // setup new output shape
     myResultLock.lock();
-        const bool isEmpty = aPrsList.IsEmpty();
-        myPrsList.Assign(aPrsList);
-        aPrsList.Clear();
-        myIsLoaded = true;
+        myBatch.PrsList.Append(myPendingPrs);
     myResultLock.unlock();
-    return !isEmpty;
+    myPendingPrs.Nullify();
+    myPendingNbTris = 0;
 }
 
-bool StCADLoader::getNextDoc(NCollection_Sequence<Handle(AIS_InteractiveObject)>& thePrsList,
-                             Handle(StAssetDocument)& theDoc) {
+bool StCADLoader::getNextDoc(StCADLoaderBatch& theBatch) {
+    theBatch.clear();
     if(!myResultLock.tryLock()) {
         return false;
     }
 
-    bool hasNewShape = false;
-    if(myIsLoaded) {
-        thePrsList.Append(myPrsList);
-        theDoc = myDoc;
-        myPrsList.Clear();
-        myDoc.Nullify();
-        hasNewShape = true;
-        myIsLoaded = false;
+    const bool hasNewData = !myBatch.isEmpty();
+    if(hasNewData) {
+        theBatch = myBatch;
+        myBatch.clear();
     }
     myResultLock.unlock();
-    return hasNewShape;
+    return hasNewData;
 }
 
 void StCADLoader::mainLoop() {
@@ -124,10 +217,14 @@ void StCADLoader::mainLoop() {
             return;
         } else {
             // load next model (set as current in playlist)
+            // reset the state before starting, so that cancellation requested since this point is not lost
             myEvLoadNext.reset();
+            myProgress.reset();
+            myProgress.setActive(true);
             if(myPlayList->getCurrentFile(aFileToLoad, aFileParams)) {
                 loadModel(aFileToLoad);
             }
+            myProgress.setActive(false);
         }
     }
 }
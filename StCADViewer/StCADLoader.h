@@ -20,12 +20,57 @@
 #include <StGLMesh/StGLMesh.h>
 #include <StSlots/StSignal.h>
 #include <StThreads/StThread.h>
+#include <StThreads/StTimer.h>
 
+#include "StAssetCache.h"
 #include "StAssetDocument.h"
+#include "StAssetImportProgress.h"
+#include "StAssetPresentation.h"
 
 class StLangMap;
 class StThread;
 
+/**
+ * Portion of loading results passed from loader thread to GUI.
+ */
+struct StCADLoaderBatch {
+
+    NCollection_Sequence<Handle(AIS_InteractiveObject)> PrsList; //!< new presentations to display
+    Handle(StAssetBndPresentation) Preview;     //!< coarse preview (bounding boxes) to display until loading is finished
+    Handle(StAssetDocument)        Document;    //!< loaded document, defined only by the last batch
+    bool                           ToClear;     //!< previously displayed objects should be removed
+    bool                           IsFinished;  //!< loading has been finished (successfully or not)
+    bool                           IsCancelled; //!< loading has been cancelled
+
+    /**
+     * Empty constructor.
+     */
+    StCADLoaderBatch() : ToClear(false), IsFinished(false), IsCancelled(false) {}
+
+    /**
+     * @return true if batch contains nothing
+     */
+    bool isEmpty() const {
+        return PrsList.IsEmpty()
+            && Preview.IsNull()
+            && !ToClear
+            && !IsFinished;
+    }
+
+    /**
+     * Reset batch content.
+     */
+    void clear() {
+        PrsList.Clear();
+        Preview.Nullify();
+        Document.Nullify();
+        ToClear     = false;
+        IsFinished  = false;
+        IsCancelled = false;
+    }
+
+};
+
 class StCADLoader {
 
         public:
@@ -36,17 +81,39 @@ class StCADLoader {
 
     ST_LOCAL StCADLoader(const StHandle<StLangMap>&  theLangMap,
                          const StHandle<StPlayList>& thePlayList,
+                         const StString&             theCacheFolder,
                          const bool                  theToStartThread = true);
     ST_LOCAL virtual ~StCADLoader();
 
     ST_LOCAL void mainLoop();
 
+    /**
+     * Start loading of the current playlist item (cancels loading of previous one).
+     */
     ST_LOCAL void doLoadNext() {
+        myProgress.cancel();
         myEvLoadNext.set();
     }
 
-    ST_LOCAL virtual bool getNextDoc(NCollection_Sequence<Handle(AIS_InteractiveObject)>& thePrsList,
-                                     Handle(StAssetDocument)& theDoc);
+    /**
+     * Cancel loading in progress (already loaded part of the model remains displayed).
+     */
+    ST_LOCAL void doCancel() {
+        myProgress.cancel();
+    }
+
+    /**
+     * @return progress of the current loading
+     */
+    ST_LOCAL const StAssetImportProgress& getProgress() const { return myProgress; }
+
+    /**
+     * Retrieve new portion of loading results.
+     * Loader publishes presentations incrementally, so that this method should be called periodically.
+     * @param theBatch batch to fill (previous content is replaced)
+     * @return FALSE if there is nothing new
+     */
+    ST_LOCAL virtual bool getNextDoc(StCADLoaderBatch& theBatch);
 
         public:  //!< Signals
 
@@ -62,6 +129,22 @@ class StCADLoader {
 
     ST_LOCAL virtual bool loadModel(const StHandle<StFileNode>& theSource);
 
+    /**
+     * Append mesh node to the pending presentation.
+     */
+    ST_LOCAL void doOnMeshNode(const Handle(StDocMeshNode)& theNode,
+                               const gp_Trsf&               theLoc);
+
+    /**
+     * Publish coarse preview.
+     */
+    ST_LOCAL void doOnPreview(const NCollection_Sequence<Bnd_Box>& theBoxes);
+
+    /**
+     * Publish pending presentation.
+     */
+    ST_LOCAL void flushPending();
+
     /**
      * Just redirect callback slot.
      */
@@ -81,11 +164,14 @@ class StCADLoader {
     StHandle<StLangMap>  myLangMap;
     StHandle<StPlayList> myPlayList;
     StCondition          myEvLoadNext;
-    Handle(StAssetDocument) myDoc;
-    NCollection_Sequence<Handle(AIS_InteractiveObject)> myPrsList;
+    StAssetCache         myCache;
+    StAssetImportProgress myProgress;     //!< progress and cancellation flag of the current loading
+    StCADLoaderBatch     myBatch;         //!< results not yet retrieved by GUI, protected by myResultLock
+    Handle(StAssetPresentation) myPendingPrs; //!< presentation being filled by loader thread
+    size_t               myPendingNbTris; //!< number of triangles within myPendingPrs
+    StTimer              myPendingTimer;  //!< timer since last published presentation
     Graphic3d_MaterialAspect myDefaultMat;
     StMutex              myResultLock;
-    volatile bool        myIsLoaded;
     volatile bool        myToQuit;
 
 };
@@ -65,7 +65,11 @@ StCADViewer::StCADViewer(const StHandle<StResourceManager>& theResMgr,
   myIsLeftHold(false),
   myIsRightHold(false),
   myIsMiddleHold(false),
-  myIsCtrlPressed(false) {
+  myIsCtrlPressed(false),
+  myToFitBatch(false),
+  myHasModel(false),
+  myLoadPercents(-1),
+  myLoadNodes(-1) {
     mySettings = new StSettings(myResMgr, ST_DRAWER_PLUGIN_NAME);
     myLangMap  = new StTranslations(myResMgr, ST_DRAWER_PLUGIN_NAME);
     StCADViewerStrings::loadDefaults(*myLangMap);
@@ -432,7 +436,7 @@ bool StCADViewer::init() {
 
     // create working threads
     if(!isReset) {
-        myCADLoader = new StCADLoader(myLangMap, myPlayList);
+        myCADLoader = new StCADLoader(myLangMap, myPlayList, myResMgr->getCacheFolder());
         myCADLoader->signals.onError = stSlot(myMsgQueue.access(), &StMsgQueue::doPushError);
     }
 
@@ -652,6 +656,12 @@ void StCADViewer::doKeyDown(const StKeyEvent& theEvent) {
     StApplication::doKeyDown(theEvent);
     switch(theEvent.VKey) {
         case ST_VK_ESCAPE:
+            if(!myCADLoader.isNull()
+            && myCADLoader->getProgress().isActive()) {
+                // keep already loaded part of the model
+                myCADLoader->doCancel();
+                return;
+            }
             StApplication::exit(0);
             return;
 
@@ -778,15 +788,62 @@ void StCADViewer::beforeDraw() {
     }
 
     if(!myAisContext.IsNull()) {
-        NCollection_Sequence<Handle(AIS_InteractiveObject)> aNewPrsList;
-        if(myCADLoader->getNextDoc(aNewPrsList, myDoc)) {
-            myAisContext->RemoveAll(false);
-            for(NCollection_Sequence<Handle(AIS_InteractiveObject)>::Iterator aPrsIter(aNewPrsList); aPrsIter.More(); aPrsIter.Next()) {
+        StCADLoaderBatch aBatch;
+        if(myCADLoader->getNextDoc(aBatch)) {
+            if(aBatch.ToClear) {
+                myAisContext->RemoveAll(false);
+                myPreviewPrs.Nullify();
+                myDoc.Nullify();
+                myToFitBatch   = true;
+                myHasModel     = false;
+                myLoadPercents = -1;
+                myLoadNodes    = -1;
+            }
+            if(!aBatch.Preview.IsNull()) {
+                if(!myPreviewPrs.IsNull()) {
+                    myAisContext->Remove(myPreviewPrs, false);
+                }
+                myPreviewPrs = aBatch.Preview;
+                myAisContext->Display(myPreviewPrs, myPreviewPrs->DisplayMode(), -1, false);
+                doFitAll();
+                myToFitBatch = false;
+            }
+
+            // each batch is a separate presentation, so that displaying it takes bounded time
+            for(NCollection_Sequence<Handle(AIS_InteractiveObject)>::Iterator aPrsIter(aBatch.PrsList); aPrsIter.More(); aPrsIter.Next()) {
                 myAisContext->Display(aPrsIter.Value(), aPrsIter.Value()->DisplayMode(), -1, false);
+                myHasModel = true;
+            }
+            if(myToFitBatch
+            && !aBatch.PrsList.IsEmpty()) {
+                doFitAll();
+                myToFitBatch = false;
             }
 
-            doFitAll();
-            doUpdateStateLoaded(!aNewPrsList.IsEmpty());
+            if(aBatch.IsFinished) {
+                const bool hasPreview = !myPreviewPrs.IsNull();
+                if(hasPreview) {
+                    myAisContext->Remove(myPreviewPrs, false);
+                    myPreviewPrs.Nullify();
+                }
+                myDoc = aBatch.Document;
+                if(hasPreview && !aBatch.IsCancelled) {
+                    doFitAll();
+                }
+                doUpdateStateLoaded(myHasModel, aBatch.IsCancelled);
+            }
+        }
+
+        const StAssetImportProgress& aProgress = myCADLoader->getProgress();
+        if(aProgress.isActive()) {
+            const int aPercents = aProgress.getPercents();
+            const int aNbNodes  = aProgress.getNodesDone();
+            if(aPercents != myLoadPercents
+            || aNbNodes  != myLoadNodes) {
+                myLoadPercents = aPercents;
+                myLoadNodes    = aNbNodes;
+                doUpdateStateLoading();
+            }
         }
     }
 
@@ -857,6 +914,7 @@ void StCADViewer::stglDraw(unsigned int theView) {
         myView->Camera()->SetIOD   (Graphic3d_Camera::IODType_Relative,   params.StereoIOD->getValue());
 
         myView->Redraw();
+        myContext->resetStateCache(); // OCCT modifies OpenGL state on its own
 
         myContext->stglResizeViewport(aVPort);
         if(toSetScissorRect) {
@@ -872,7 +930,7 @@ void StCADViewer::stglDraw(unsigned int theView) {
     myProjection.setView(theView);
 
     // draw GUI
-    myContext->core11fwd->glDisable(GL_DEPTH_TEST);
+    myContext->stglSetDepthTest(false);
     myGUI->stglDraw(theView);
 }
 
@@ -880,15 +938,27 @@ void StCADViewer::doUpdateStateLoading() {
     const StString aFileToLoad = myPlayList->getCurrentTitle();
     if(aFileToLoad.isEmpty()) {
         myWindow->setTitle("sView - CAD Viewer");
-    } else {
-        myWindow->setTitle(aFileToLoad + " Loading... - sView");
+        return;
+    }
+
+    StString aProgress;
+    if(myLoadPercents >= 0) {
+        const StAssetImportProgress& aLoadProgress = myCADLoader->getProgress();
+        aProgress = StString(" ") + StString(myLoadPercents) + "%";
+        if(aLoadProgress.getNodesTotal() > 0) {
+            aProgress = aProgress + " (" + StString(aLoadProgress.getNodesDone()) + "/" + StString(aLoadProgress.getNodesTotal()) + ")";
+        }
     }
+    myWindow->setTitle(aFileToLoad + " Loading..." + aProgress + " - sView");
 }
 
-void StCADViewer::doUpdateStateLoaded(bool isSuccess) {
+void StCADViewer::doUpdateStateLoaded(bool isSuccess,
+                                      bool isCancelled) {
     const StString aFileLoaded = myPlayList->getCurrentTitle();
     if(aFileLoaded.isEmpty()) {
         myWindow->setTitle("sView - CAD Viewer");
+    } else if(isCancelled) {
+        myWindow->setTitle(aFileLoaded + " (cancelled) - sView");
     } else {
         myWindow->setTitle(aFileLoaded + (isSuccess ? StString() : StString(" FAIL to open")) + " - sView");
     }
@@ -106,8 +106,11 @@ class StCADViewer : public StApplication {
 
     /**
      * Should be called when file was loaded.
+     * @param isSuccess   model has been loaded
+     * @param isCancelled loading has been interrupted by user
      */
-    ST_LOCAL void doUpdateStateLoaded(bool isSuccess);
+    ST_LOCAL void doUpdateStateLoaded(bool isSuccess,
+                                      bool isCancelled = false);
 
     /**
      * Load FIRST file in the playlist.
@@ -244,6 +247,11 @@ class StCADViewer : public StApplication {
     Handle(AIS_InteractiveContext) myAisContext; //!< interactive context containing displayed objects
 
     Handle(StAssetDocument)        myDoc;
+    Handle(AIS_InteractiveObject)  myPreviewPrs;   //!< coarse preview displayed while model is being loaded
+    bool                           myToFitBatch;   //!< fit view to the next batch of loaded model
+    bool                           myHasModel;     //!< some part of the model has been displayed
+    int                            myLoadPercents; //!< last displayed loading progress
+    int                            myLoadNodes;    //!< last displayed number of loaded nodes
 
         private:
 
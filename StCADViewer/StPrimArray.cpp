@@ -0,0 +1,112 @@
+/**
+ * This source is a part of sView program.
+ *
+ * Copyright © Kirill Gavrilov, 2026
+ */
+
+#include "StPrimArray.h"
+
+#include <StThreads/StThreadPool.h>
+
+namespace {
+
+    /**
+     * Minimal number of elements processed by one thread at once.
+     */
+    static const size_t THE_MIN_ITEMS = 16384;
+
+    /**
+     * Compute normals of triangles.
+     */
+    struct StTriNormalsJob {
+        const StPrimArray* Prims;
+        StGLVec3*          TriNormals;
+
+        static void perform(void* theJob, const size_t theFrom, const size_t theTo) {
+            const StTriNormalsJob& aJob = *(const StTriNormalsJob* )theJob;
+            const std::vector<StGLVec3>& aPositions = aJob.Prims->Positions;
+            const std::vector<GLuint>&   anIndices  = aJob.Prims->Indices;
+            const size_t aNbNodes = aPositions.size();
+            for(size_t aTriIter = theFrom; aTriIter < theTo; ++aTriIter) {
+                const GLuint anElem[3] = { anIndices[aTriIter * 3 + 0],
+                                           anIndices[aTriIter * 3 + 1],
+                                           anIndices[aTriIter * 3 + 2] };
+                if(anElem[0] >= aNbNodes
+                || anElem[1] >= aNbNodes
+                || anElem[2] >= aNbNodes) {
+                    aJob.TriNormals[aTriIter] = StGLVec3(0.0f, 0.0f, 0.0f);
+                    continue;
+                }
+
+                const StGLVec3& aNode0 = aPositions[anElem[0]];
+                const StGLVec3& aNode1 = aPositions[anElem[1]];
+                const StGLVec3& aNode2 = aPositions[anElem[2]];
+                aJob.TriNormals[aTriIter] = StGLVec3::cross(aNode1 - aNode0, aNode2 - aNode0);
+            }
+        }
+    };
+
+    /**
+     * Accumulate normals of adjacent triangles per node (no write conflicts between threads).
+     */
+    struct StNodeNormalsJob {
+        StPrimArray*    Prims;
+        const StGLVec3* TriNormals;
+        const size_t*   NodeFirstTri;
+        const size_t*   NodeTris;
+
+        static void perform(void* theJob, const size_t theFrom, const size_t theTo) {
+            const StNodeNormalsJob& aJob = *(const StNodeNormalsJob* )theJob;
+            for(size_t aNodeIter = theFrom; aNodeIter < theTo; ++aNodeIter) {
+                StGLVec3& aNorm = aJob.Prims->Normals[aNodeIter];
+                for(size_t aTriIter = aJob.NodeFirstTri[aNodeIter]; aTriIter < aJob.NodeFirstTri[aNodeIter + 1]; ++aTriIter) {
+                    aNorm += aJob.TriNormals[aJob.NodeTris[aTriIter]];
+                }
+                aNorm.normalize();
+            }
+        }
+    };
+
+}
+
+void StPrimArray::reconstructNormals() {
+    const size_t aNbNodes = Positions.size();
+    if(Normals.size() != Positions.size()) {
+        Normals.resize(aNbNodes);
+    }
+
+    const size_t aNbTris = Indices.size() / 3;
+    std::vector<StGLVec3> aTriNormals(aNbTris);
+    StTriNormalsJob aTriJob;
+    aTriJob.Prims      = this;
+    aTriJob.TriNormals = aTriNormals.empty() ? NULL : &aTriNormals[0];
+    StThreadPool::GetDefault().perform(StTriNormalsJob::perform, &aTriJob, aNbTris, THE_MIN_ITEMS);
+
+    // list of adjacent triangles per node, with offsets computed by prefix sum
+    std::vector<size_t> aNodeFirstTri(aNbNodes + 1, 0);
+    for(size_t anIndexIter = 0; anIndexIter < aNbTris * 3; ++anIndexIter) {
+        const GLuint aNodeIndex = Indices[anIndexIter];
+        if(aNodeIndex < aNbNodes) {
+            ++aNodeFirstTri[aNodeIndex + 1];
+        }
+    }
+    for(size_t aNodeIter = 0; aNodeIter < aNbNodes; ++aNodeIter) {
+        aNodeFirstTri[aNodeIter + 1] += aNodeFirstTri[aNodeIter];
+    }
+
+    std::vector<size_t> aNodeTris(aNodeFirstTri[aNbNodes] + 1);
+    std::vector<size_t> aNodeFilled(aNodeFirstTri.begin(), aNodeFirstTri.end() - 1);
+    for(size_t anIndexIter = 0; anIndexIter < aNbTris * 3; ++anIndexIter) {
+        const GLuint aNodeIndex = Indices[anIndexIter];
+        if(aNodeIndex < aNbNodes) {
+            aNodeTris[aNodeFilled[aNodeIndex]++] = anIndexIter / 3;
+        }
+    }
+
+    StNodeNormalsJob aNodeJob;
+    aNodeJob.Prims        = this;
+    aNodeJob.TriNormals   = aTriNormals.empty() ? NULL : &aTriNormals[0];
+    aNodeJob.NodeFirstTri = &aNodeFirstTri[0];
+    aNodeJob.NodeTris     = &aNodeTris[0];
+    StThreadPool::GetDefault().perform(StNodeNormalsJob::perform, &aNodeJob, aNbNodes, THE_MIN_ITEMS);
+}
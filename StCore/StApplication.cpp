@@ -14,6 +14,8 @@
 #include <StGL/StGLContext.h>
 #include <StGLStereo/StFormatEnum.h>
 #include <StFile/StFileNode.h>
+#include <StFT/StFTFontRegistry.h>
+#include <StThreads/StStartupTimeline.h>
 #include <StVersion.h>
 
 #include "StEventsBuffer.h"
@@ -100,6 +102,10 @@ StApplication::StApplication(const StHandle<StResourceManager>& theResMgr,
 }
 
 void StApplication::stApplicationInit(const StHandle<StOpenInfo>& theOpenInfo) {
+    // start the timeline and scanning of system fonts as early as possible -
+    // fonts registry is not needed before GUI creation
+    StStartupTimeline::GetDefault();
+    StFTFontRegistry::PrefetchDefault();
     if(myResMgr.isNull()) {
         myResMgr = new StResourceManager();
     }
@@ -175,6 +181,8 @@ bool StApplication::open() {
         return true;
     }
 
+    ST_STARTUP_PHASE("StApplication::open");
+
     StSettings aGlobalSettings(myResMgr, "sview");
     if(!mySwitchTo.isNull()) {
         myRendId = mySwitchTo->getRendererId();
@@ -252,7 +260,10 @@ bool StApplication::open() {
     };
     myWindow->setAttributes(anAttribs);
 
-    myIsOpened = myWindow->create();
+    {
+        ST_STARTUP_PHASE("StWindow::create");
+        myIsOpened = myWindow->create();
+    }
     if(myIsOpened) {
         // connect slots
         myWindow->signals.onRedraw    = stSlot(this, &StApplication::doDrawProxy);
@@ -502,6 +513,7 @@ void StApplication::processEvents() {
     // draw iteration
     beforeDraw();
     myWindow->stglDraw();
+    StStartupTimeline::GetDefault().finish();
 
     const StString aDevice = myWindow->getDeviceId();
     const int32_t  aDevNum = params.ActiveDevice->getValue();
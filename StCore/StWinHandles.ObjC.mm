@@ -36,6 +36,10 @@ bool StWinHandles::glMakeCurrent() {
     return false;
 }
 
+void StWinHandles::glReleaseCurrent() {
+    [NSOpenGLContext clearCurrentContext];
+}
+
 int StWinHandles::glCreateContext(StWinHandles*    theSlave,
                                   const StRectI_t& theRect,
                                   const int        theColorSize,
@@ -412,6 +412,21 @@ bool StWinHandles::glMakeCurrent() {
     return false;
 }
 
+void StWinHandles::glReleaseCurrent() {
+#if defined(ST_HAVE_EGL) || defined(__ANDROID__)
+    if(!hRC.isNull()) {
+        hRC->makeCurrent(EGL_NO_SURFACE);
+    }
+#elif defined(_WIN32)
+    wglMakeCurrent(NULL, NULL);
+#elif defined(__linux__)
+    if(!stXDisplay.isNull()
+    && !glXMakeCurrent(stXDisplay->hDisplay, None, NULL)) {
+        ST_DEBUG_LOG("X, FAILED to release OpenGL context");
+    }
+#endif
+}
+
 /**
  * Auxiliary macros.
  */
@@ -162,6 +162,11 @@ class StWinHandles {
      */
     ST_LOCAL bool glMakeCurrent();
 
+    /**
+     * Release GL rendering context active in the calling thread (if any).
+     */
+    ST_LOCAL void glReleaseCurrent();
+
     /**
      * Create 1 or 2 GL rendering contexts (and share them)
      * for opened windows handles.
@@ -7,6 +7,7 @@
 
 #include <StGLCore/StGLCore11Fwd.h>
 #include <StGL/StGLContext.h>
+#include <StThreads/StProfiler.h>
 
 #include "StWindowImpl.h"
 
@@ -234,11 +235,16 @@ bool StWindow::create() {
 }
 
 void StWindow::stglSwap() {
-     myWin->stglSwap(ST_WIN_ALL);
+     stglSwap(ST_WIN_ALL);
 }
 
 void StWindow::stglSwap(const int theWinEnum) {
+     ST_PROFILER_ZONE("StWindow::stglSwap");
      myWin->stglSwap(theWinEnum);
+     if(theWinEnum != ST_WIN_SLAVE
+     && !myWin->myGlContext.isNull()) {
+         myWin->myGlContext->resetStateCounters();
+     }
 }
 
 bool StWindow::stglMakeCurrent() {
@@ -257,6 +263,18 @@ bool StWindow::stglMakeCurrent(const int theWinEnum) {
     return isBound;
 }
 
+bool StWindow::hasSlaveGlContext() const {
+    return myWin->hasSlaveGlContext();
+}
+
+bool StWindow::stglMakeCurrentDetached(const int theWinEnum) {
+    return myWin->stglMakeCurrentDetached(theWinEnum);
+}
+
+void StWindow::stglReleaseCurrent() {
+    myWin->stglReleaseCurrent();
+}
+
 void StWindow::stglDraw() {
     if(myWin->myGlContext.isNull()) {
         return;
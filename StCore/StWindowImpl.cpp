@@ -1063,12 +1063,17 @@ bool StWindowImpl::stglMakeCurrent(const int winNum){
             if(myMaster.glMakeCurrent()) {
                 if(!myGlContext.isNull()) {
                     myGlContext->stglResetErrors();
+                    myGlContext->resetStateCache();
                 }
                 return true;
             }
             return false;
         } case ST_WIN_SLAVE: {
             if(myTiledCfg == TiledCfg_Separate) {
+                // slave window might use dedicated GL context with its own state
+                if(!myGlContext.isNull()) {
+                    myGlContext->resetStateCache();
+                }
                 return mySlave.glMakeCurrent();
             } else {
                 return myMaster.glMakeCurrent();
@@ -1078,6 +1083,33 @@ bool StWindowImpl::stglMakeCurrent(const int winNum){
     return false;
 }
 
+bool StWindowImpl::stglMakeCurrentDetached(const int theWinId) {
+    // shared StGLContext is left untouched - it belongs to the thread rendering master window
+    switch(theWinId) {
+        case ST_WIN_MASTER: return myMaster.glMakeCurrent();
+        case ST_WIN_SLAVE:  return myTiledCfg == TiledCfg_Separate
+                                 ? mySlave .glMakeCurrent()
+                                 : myMaster.glMakeCurrent();
+    }
+    return false;
+}
+
+void StWindowImpl::stglReleaseCurrent() {
+    myMaster.glReleaseCurrent();
+}
+
+bool StWindowImpl::hasSlaveGlContext() const {
+#if defined(__linux__) && !defined(__ANDROID__) && !defined(ST_HAVE_EGL)
+    // GLX slave window is created with its own context sharing resources with master one
+    return myTiledCfg == TiledCfg_Separate
+        && !mySlave.hRC.isNull()
+        &&  mySlave.hRC.access() != myMaster.hRC.access();
+#else
+    // slave window shares the same rendering context with master one
+    return false;
+#endif
+}
+
 // Swap Buffers (Double Buffering)
 void StWindowImpl::stglSwap(const int& theWinId) {
     if(!myIsActive) {
@@ -69,6 +69,9 @@ class StWindowImpl {
     ST_LOCAL bool create();
     ST_LOCAL void stglSwap(const int& theWinId);
     ST_LOCAL bool stglMakeCurrent(const int theWinId);
+    ST_LOCAL bool stglMakeCurrentDetached(const int theWinId);
+    ST_LOCAL void stglReleaseCurrent();
+    ST_LOCAL bool hasSlaveGlContext() const;
     ST_LOCAL StGLBoxPx stglViewport(const int& theWinId) const;
     ST_LOCAL void processEvents();
     ST_LOCAL void post(StEvent& theEvent);
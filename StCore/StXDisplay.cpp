@@ -1,6 +1,6 @@
 /**
  * StCore, window system independent C++ toolkit for writing OpenGL applications.
- * Copyright © 2007-2015 Kirill Gavrilov <kirill@sview.ru>
+ * Copyright © 2007-2026 Kirill Gavrilov <kirill@sview.ru>
  *
  * This code is licensed under MIT license (see docs/license-mit.txt for details).
  */
@@ -10,6 +10,29 @@
 #include "StXDisplay.h"
 #include <StStrings/StLogger.h>
 
+namespace {
+
+    /**
+     * Window might be rendered from several threads (e.g. slave window of dual output),
+     * so that Xlib should be initialized with locking enabled.
+     * XInitThreads() should be the first Xlib call within the process,
+     * hence it is called on StCore library load - before any XOpenDisplay()
+     * (including StSearchMonitors and output plugins probing the display).
+     */
+    class StXlibThreadsInit {
+
+            public:
+
+        StXlibThreadsInit() {
+            XInitThreads();
+        }
+
+    };
+
+    static const StXlibThreadsInit THE_XLIB_THREADS_INIT;
+
+}
+
 StXDisplay::StXDisplay()
 : hDisplay(NULL),
   hVisInfo(NULL),
@@ -234,7 +234,7 @@ void StGeometryTest::stglDraw(unsigned int ) {
                       1.0f, 1.0f);
 
     aCtx.core20fwd->glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    aCtx.core20fwd->glEnable(GL_BLEND);
+    aCtx.stglSetBlend(true);
     stProgram.use(aCtx);
     stProgram.setScaleTranslate(aCtx, scaleVec, transVec);
 
@@ -246,5 +246,5 @@ void StGeometryTest::stglDraw(unsigned int ) {
     myBrightness.draw(aCtx, stProgram);
 
     stProgram.unuse(aCtx);
-    aCtx.core20fwd->glDisable(GL_BLEND);
+    aCtx.stglSetBlend(false);
 }
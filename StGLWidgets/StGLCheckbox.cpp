@@ -49,6 +49,8 @@ StGLCheckbox::StGLCheckbox(StGLWidget* theParent,
             myTextures = new StGLTextureArray(2);
             myTextures->changeValue(0).setName(anIcon0);
             myTextures->changeValue(1).setName(anIcon1);
+            myRoot->prefetchIcon(anIcon0);
+            myRoot->prefetchIcon(anIcon1);
             myRoot->getCheckboxIcon() = myTextures;
         }
     }
@@ -127,7 +129,7 @@ void StGLCheckbox::stglDraw(unsigned int theView) {
     }
 
     aCtx.core20fwd->glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    aCtx.core20fwd->glEnable(GL_BLEND);
+    aCtx.stglSetBlend(true);
     aProgram.use(aCtx, getRoot()->getScreenDispX());
     myVertBuf.bindVertexAttrib  (aCtx, aProgram.getVVertexLoc());
 
@@ -139,7 +141,7 @@ void StGLCheckbox::stglDraw(unsigned int theView) {
 
     myVertBuf.unBindVertexAttrib(aCtx, aProgram.getVVertexLoc());
     aProgram.unuse(aCtx);
-    aCtx.core20fwd->glDisable(GL_BLEND);
+    aCtx.stglSetBlend(false);
 }
 
 void StGLCheckbox::reverseValue() {
@@ -1,11 +1,12 @@
 /**
  * StGLWidgets, small C++ toolkit for writing GUI using OpenGL.
- * Copyright © 2013-2015 Kirill Gavrilov <kirill@sview.ru
+ * Copyright © 2013-2026 Kirill Gavrilov <kirill@sview.ru
  *
  * This code is licensed under MIT license (see docs/license-mit.txt for details).
  */
 
 #include <StGLWidgets/StGLFpsLabel.h>
+#include <StGLWidgets/StGLProfilerGraph.h>
 #include <StGLWidgets/StGLRootWidget.h>
 
 #include <StGL/StGLContext.h>
@@ -22,7 +23,8 @@ StGLFpsLabel::StGLFpsLabel(StGLWidget* theParent)
   myPlayQueued(0),
   myPlayQueueLen(0),
   myTimer(true),
-  myCounter(0) {
+  myCounter(0),
+  myProfilerGraph(NULL) {
     StGLWidget::signals.onMouseUnclick.connect(this, &StGLFpsLabel::doMouseUnclick);
 
     setupAlignment(StGLTextFormatter::ST_ALIGN_X_CENTER,
@@ -33,7 +35,7 @@ StGLFpsLabel::StGLFpsLabel(StGLWidget* theParent)
 }
 
 StGLFpsLabel::~StGLFpsLabel() {
-    //
+    // profiler graph is destroyed as a child widget
 }
 
 void StGLFpsLabel::doMouseUnclick(const int ) {
@@ -43,6 +45,19 @@ void StGLFpsLabel::doMouseUnclick(const int ) {
 void StGLFpsLabel::update(const bool      theIsStereo,
                           const double    theTargetFps,
                           const StString& theExtraInfo) {
+    if(StProfiler::GetDefault().isEnabled()) {
+        if(myProfilerGraph == NULL) {
+            // child widget placed below the label
+            myProfilerGraph = new StGLProfilerGraph(this, 0, getRectPx().height() + myRoot->scale(8),
+                                                    StGLCorner(ST_VCORNER_TOP, ST_HCORNER_RIGHT));
+            myProfilerGraph->stglInit();
+        }
+        myProfilerGraph->update(theTargetFps);
+    } else if(myProfilerGraph != NULL) {
+        delete myProfilerGraph;
+        myProfilerGraph = NULL;
+    }
+
     char aBuffer[128];
     const double aTime = myTimer.getElapsedTimeInSec();
     if(aTime < 1.0) {
@@ -61,6 +76,12 @@ void StGLFpsLabel::update(const bool      theIsStereo,
                   myPlayQueued, myPlayQueueLen, myPlayFps);
     }
     StString aText(aBuffer);
+    if(myProfilerGraph != NULL) {
+        // state-changing calls of the last frame
+        const StGLContext::StateCounters& aCounters = getContext().getStateCounters();
+        stsprintf(aBuffer, 128, "\nGL state calls: %u (%u skipped)", aCounters.NbIssued, aCounters.NbSkipped);
+        aText += aBuffer;
+    }
     if(!theExtraInfo.isEmpty()) {
         aText += "\n";
         aText += theExtraInfo;
@@ -16,6 +16,7 @@
 
 #include <StCore/StEvent.h>
 #include <StSlots/StAction.h>
+#include <StThreads/StProfiler.h>
 
 namespace {
 
@@ -212,6 +213,7 @@ StGLImageRegion::StGLImageRegion(StGLWidget* theParent,
   myDragDelayTmpMs(0.0),
   mySampleRatio(1.0f),
   myRotAngle(0.0f),
+  myHasViewTiles(false),
   myIsClickAborted(false),
 #ifdef ST_EXTRA_CONTROLS
   myToRightRotate(true),
@@ -224,6 +226,7 @@ StGLImageRegion::StGLImageRegion(StGLWidget* theParent,
     myIconPrev->setOpacity(0.0f, false);
     myIconNext = new StGLIcon(this, -getRoot()->scale(48), 0, StGLCorner(ST_VCORNER_CENTER, ST_HCORNER_RIGHT), 1);
     myIconNext->setOpacity(0.0f, false);
+    stMemZero(myViewTiles, sizeof(myViewTiles));
 
     params.DisplayMode = new StEnumParam(MODE_STEREO, stCString("viewStereoMode"), stCString("Stereo Output"));
     params.DisplayMode->defineOption(MODE_STEREO,     stCString("Stereo"));
@@ -470,6 +473,13 @@ void StGLImageRegion::stglUpdate(const StPointD_t& thePointZo,
                                  bool theIsPreciseInput) {
     StGLWidget::stglUpdate(thePointZo, theIsPreciseInput);
     if(myIsInitialized) {
+        // pass tiles visible within previous frame for view-dependent uploading of the next one
+        StGLTextureUploadParams& anUploadParams = myTextureQueue->getUploadParams();
+        anUploadParams.HasViewTiles = myHasViewTiles;
+        stMemCpy(anUploadParams.ViewTiles, myViewTiles, sizeof(myViewTiles));
+        stMemZero(myViewTiles, sizeof(myViewTiles));
+        myHasViewTiles = false;
+
         myHasVideoStream = myTextureQueue->stglUpdateStTextures(getContext()) || myTextureQueue->hasConnectedStream();
         StHandle<StStereoParams> aFileParams = myTextureQueue->getQTexture().getFront(StGLQuadTexture::LEFT_TEXTURE).getSource();
         if(params.stereoFile != aFileParams) {
@@ -741,6 +751,7 @@ bool StGLImageRegion::getHeadOrientation(StGLQuaternion& theOrient,
 }
 
 void StGLImageRegion::stglDraw(unsigned int theView) {
+    ST_PROFILER_ZONE("StGLImageRegion::stglDraw");
     myIconPrev->setOpacity(0.0f, false);
     myIconNext->setOpacity(0.0f, false);
     StHandle<StStereoParams> aParams = getSource();
@@ -834,7 +845,7 @@ void StGLImageRegion::stglDrawView(unsigned int theView) {
     myProjCam.resize(aCameraAspect);
     myProjCam.setFOVy(85.0f);
 
-    aCtx.core20fwd->glDisable(GL_BLEND);
+    aCtx.stglSetBlend(false);
 
     StGLFrameTextures& aTextures = myTextureQueue->getQTexture().getFront(aLeftOrRight);
 
@@ -1322,6 +1333,11 @@ void StGLImageRegion::stglDrawView(unsigned int theView) {
             } else {
                 myProgram.getActiveProgram()->setProjMat (aCtx, myProjCam.getProjMatrixMono());
             }
+            if(aViewMode == StViewSurface_Sphere
+            && aTextures.getPlane().getTarget() == GL_TEXTURE_2D) {
+                updateViewTiles(StGLMatrix::multiply(myProjCam.isCustomProjection() ? myProjCam.getProjMatrix() : myProjCam.getProjMatrixMono(),
+                                                     aModelMat));
+            }
 
             aMesh->draw(aCtx, *myProgram.getActiveProgram());
 
@@ -1336,6 +1352,59 @@ void StGLImageRegion::stglDrawView(unsigned int theView) {
     aCtx.stglResizeViewport(aViewportBack);
 }
 
+void StGLImageRegion::updateViewTiles(const StGLMatrix& theProjModelMat) {
+    const int NB_TILES_X = StGLTextureUploadParams::VIEW_TILES_X;
+    const int NB_TILES_Y = StGLTextureUploadParams::VIEW_TILES_Y;
+    myHasViewTiles = true;
+
+    StGLMatrix anInvMat;
+    if(!theProjModelMat.inverted(anInvMat)) {
+        stMemSet(myViewTiles, 0xFF, sizeof(myViewTiles));
+        return;
+    }
+
+    // un-project a grid of points covering the viewport with margin onto the unit sphere,
+    // the grid is dense enough to hit every tile near equator (neighbors are marked to fill gaps at higher latitudes)
+    const int   NB_SAMPLES   = 25;
+    const float VIEW_MARGIN  = 1.25f;
+    const float POLAR_LAT    = stToRadians(60.0f);
+    for(int aSampleY = 0; aSampleY < NB_SAMPLES; ++aSampleY) {
+        const float aNdcY = VIEW_MARGIN * (2.0f * float(aSampleY) / float(NB_SAMPLES - 1) - 1.0f);
+        for(int aSampleX = 0; aSampleX < NB_SAMPLES; ++aSampleX) {
+            const float aNdcX = VIEW_MARGIN * (2.0f * float(aSampleX) / float(NB_SAMPLES - 1) - 1.0f);
+            StGLVec4 aPnt = anInvMat * StGLVec4(aNdcX, aNdcY, 0.0f, 1.0f);
+            if(aPnt.w() == 0.0f) {
+                continue;
+            }
+
+            // the camera is located at sphere center
+            StGLVec3 aDir = aPnt.xyz() / aPnt.w();
+            const float aLen = aDir.modulus();
+            if(aLen <= 0.0f) {
+                continue;
+            }
+            aDir /= aLen;
+
+            // same mapping as StGLUVSphere texture coordinates
+            const float aLat = std::asin(stMin(stMax(aDir.y(), -1.0f), 1.0f));
+            float aLon = std::atan2(aDir.z(), aDir.x());
+            if(aLon < 0.0f) {
+                aLon += float(2.0 * M_PI);
+            }
+            const int aBand = stMin(int((aLat / float(M_PI) + 0.5f) * float(NB_TILES_Y)), NB_TILES_Y - 1);
+            const int aTile = stMin(int(aLon / float(2.0 * M_PI) * float(NB_TILES_X)), NB_TILES_X - 1);
+            if(std::abs(aLat) > POLAR_LAT) {
+                myViewTiles[aBand] = 0xFFFFFFFF;
+                continue;
+            }
+
+            myViewTiles[aBand] |= (uint32_t(1) << aTile)
+                               |  (uint32_t(1) << ((aTile + 1) % NB_TILES_X))
+                               |  (uint32_t(1) << ((aTile + NB_TILES_X - 1) % NB_TILES_X));
+        }
+    }
+}
+
 void StGLImageRegion::doRightUnclick(const StPointD_t& theCursorZo) {
     StHandle<StStereoParams> aParams = getSource();
     if(!myIsInitialized || aParams.isNull()
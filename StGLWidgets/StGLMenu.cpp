@@ -191,7 +191,7 @@ void StGLMenu::stglDraw(unsigned int theView) {
 
     StGLContext& aCtx = getContext();
     aCtx.core20fwd->glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    aCtx.core20fwd->glEnable(GL_BLEND);
+    aCtx.stglSetBlend(true);
 
     StGLMenuProgram& aProgram = myRoot->getMenuProgram();
     if(myVertexBndBuf.isValid()) {
@@ -208,7 +208,7 @@ void StGLMenu::stglDraw(unsigned int theView) {
     myVertexBuf.unBindVertexAttrib(aCtx, aProgram.getVVertexLoc());
 
     aProgram.unuse(aCtx);
-    aCtx.core20fwd->glDisable(GL_BLEND);
+    aCtx.stglSetBlend(false);
 
     StGLWidget::stglDraw(theView);
 }
@@ -197,7 +197,7 @@ void StGLMenuItem::stglDrawArea(const StGLMenuItem::State theState,
                                 const bool                theIsOnlyArrow) {
     StGLContext& aCtx = getContext();
     aCtx.core20fwd->glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    aCtx.core20fwd->glEnable(GL_BLEND);
+    aCtx.stglSetBlend(true);
 
     StGLMenuProgram& aProgram = myRoot->getMenuProgram();
     aProgram.use(aCtx, myBackColor[theState], myOpacity, getRoot()->getScreenDispX());
@@ -213,7 +213,7 @@ void StGLMenuItem::stglDrawArea(const StGLMenuItem::State theState,
     myBackVertexBuf.unBindVertexAttrib(aCtx, aProgram.getVVertexLoc());
 
     aProgram.unuse(aCtx);
-    aCtx.core20fwd->glDisable(GL_BLEND);
+    aCtx.stglSetBlend(false);
 }
 
 void StGLMenuItem::stglDraw(unsigned int theView) {
@@ -149,6 +149,7 @@ void StGLMessageBox::create(const StString& theTitle,
 }
 
 StGLMessageBox::~StGLMessageBox() {
+    signals.onDestroy(this);
     if(myRoot->getModalDialog() == this) {
         myRoot->setModalDialog(NULL, false);
     }
@@ -353,7 +354,7 @@ void StGLMessageBox::stglDraw(unsigned int theView) {
     StGLMenuProgram& aProgram = myRoot->getMenuProgram();
     if(aProgram.isValid()) {
         aCtx.core20fwd->glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-        aCtx.core20fwd->glEnable(GL_BLEND);
+        aCtx.stglSetBlend(true);
 
         aProgram.use(aCtx, getRoot()->getScreenDispX());
         aProgram.setColor(aCtx, getRoot()->getColorForElement(StGLRootWidget::Color_MessageBox), myOpacity * 0.8f);
@@ -364,7 +365,7 @@ void StGLMessageBox::stglDraw(unsigned int theView) {
 
         aProgram.unuse(aCtx);
 
-        aCtx.core20fwd->glDisable(GL_BLEND);
+        aCtx.stglSetBlend(false);
     }
 
     StGLBoxPx aScissorRect;
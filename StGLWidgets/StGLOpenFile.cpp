@@ -13,8 +13,14 @@
 #include <StGLWidgets/StGLCheckbox.h>
 #include <StGLWidgets/StGLScrollArea.h>
 #include <StGLWidgets/StGLTextureButton.h>
+#include <StGLWidgets/StGLThumbnailGrid.h>
 
+#include <StFile/StFolder.h>
 #include <StThreads/StThread.h>
+#include <StThreads/StTimer.h>
+
+#include <algorithm>
+#include <vector>
 
 #if defined(__ANDROID__)
 #include <fstream>
@@ -22,6 +28,7 @@
 
 #if !defined(_WIN32)
     #include <unistd.h>
+    #include <dirent.h>
 #endif
 
 #ifdef _WIN32
@@ -222,6 +229,217 @@ public:
 };
 #endif
 
+/**
+ * Auxiliary tool listing folder content in background thread.
+ * Entries are matched against extensions filter one by one as they are read,
+ * and published in sorted batches merged into already listed content.
+ */
+struct StGLOpenFileLister {
+
+    /**
+     * Folder entry.
+     */
+    struct Entry {
+        StString Name;
+        bool     IsFolder;
+    };
+
+    /**
+     * Folders first, then by name - the same order as StFolder::init().
+     */
+    struct EntryLess {
+        bool operator()(const Entry& theLeft, const Entry& theRight) const {
+            if(theLeft.IsFolder != theRight.IsFolder) {
+                return theLeft.IsFolder;
+            }
+            return theLeft.Name < theRight.Name;
+        }
+    };
+
+    StMutex               Mutex;
+    std::vector<Entry>    Entries;    //!< listed entries in order of arrival
+    std::vector<int>      Order;      //!< indexes of listed entries in sorted order
+    StString              FolderPath; //!< folder to list
+    StArrayList<StString> Extensions; //!< extensions filter
+    volatile int          Generation; //!< incremented on each published batch
+    volatile bool         ToAbort;
+
+public:
+    /**
+     * Main constructor.
+     */
+    StGLOpenFileLister(const StString&              theFolderPath,
+                       const StArrayList<StString>& theExtensions)
+    : FolderPath(theFolderPath), Extensions(theExtensions), Generation(0), ToAbort(false) {}
+
+    /**
+     * @return number of listed entries
+     */
+    size_t size() {
+        StMutexAuto aLock(Mutex);
+        return Order.size();
+    }
+
+    /**
+     * Copy listed entries within specified range in sorted order.
+     */
+    void getRange(const size_t        theFrom,
+                  const size_t        theNb,
+                  std::vector<Entry>& theEntries) {
+        theEntries.clear();
+        StMutexAuto aLock(Mutex);
+        for(size_t anIter = theFrom; anIter < theFrom + theNb && anIter < Order.size(); ++anIter) {
+            theEntries.push_back(Entries[Order[anIter]]);
+        }
+    }
+
+    /**
+     * @return full path to the entry within listed folder
+     */
+    StString getEntryPath(const StString& theName) const {
+        return FolderPath.isEndsWith(SYS_FS_SPLITTER)
+             ? FolderPath + theName
+             : FolderPath + StString(SYS_FS_SPLITTER) + theName;
+    }
+
+    /**
+     * Working thread callback.
+     */
+    void list() {
+        std::vector<Entry> aBatch;
+        StTimer aBatchTimer(true);
+    #ifdef _WIN32
+        WIN32_FIND_DATAW aFindFile;
+        const StString aSearchMask = getEntryPath(StString('*'));
+        HANDLE aFindHandle = FindFirstFileW(aSearchMask.toUtfWide().toCString(), &aFindFile);
+        for(BOOL hasFile = (aFindHandle != INVALID_HANDLE_VALUE); hasFile == TRUE && !ToAbort;
+            hasFile = FindNextFileW(aFindHandle, &aFindFile)) {
+            addEntry(aBatch, StString(aFindFile.cFileName),
+                     (aFindFile.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0);
+            publish(aBatch, aBatchTimer, false);
+        }
+        if(aFindHandle != INVALID_HANDLE_VALUE) {
+            FindClose(aFindHandle);
+        }
+    #else
+        DIR* aFolder = opendir(FolderPath.toCString());
+        if(aFolder == NULL) {
+            return;
+        }
+        for(dirent* aDirItem = readdir(aFolder); aDirItem != NULL && !ToAbort;
+            aDirItem = readdir(aFolder)) {
+        #if defined(__APPLE__)
+            // automatically convert filenames from decomposed form used by Mac OS X file systems
+            const StString aName = stFromUtf8Mac(aDirItem->d_name);
+        #else
+            const StString aName(aDirItem->d_name);
+        #endif
+            // avoid stat() call per entry when file system reports entry type
+            bool isFolder = false;
+        #if defined(DT_DIR)
+            if(aDirItem->d_type == DT_DIR) {
+                isFolder = true;
+            } else if(aDirItem->d_type == DT_UNKNOWN
+                   || aDirItem->d_type == DT_LNK) {
+                isFolder = StFolder::isFolder(getEntryPath(aName));
+            }
+        #else
+            isFolder = StFolder::isFolder(getEntryPath(aName));
+        #endif
+            addEntry(aBatch, aName, isFolder);
+            publish(aBatch, aBatchTimer, false);
+        }
+        closedir(aFolder);
+    #endif
+        publish(aBatch, aBatchTimer, true);
+    }
+
+    /**
+     * Working thread callback.
+     */
+    static SV_THREAD_FUNCTION listThread(void* thePtr) {
+        StHandle<StGLOpenFileLister>* aHandle = static_cast<StHandle<StGLOpenFileLister>* >(thePtr);
+        StHandle<StGLOpenFileLister> aThis = *aHandle;
+        delete aHandle;
+        aThis->list();
+        return SV_THREAD_RETURN 0;
+    }
+
+        private:
+
+    /**
+     * Append entry to the batch if it passes extensions filter.
+     */
+    void addEntry(std::vector<Entry>& theBatch,
+                  const StString&     theName,
+                  const bool          theIsFolder) {
+        if(theName == stCString(".")
+        || theName == stCString("..")) {
+            return;
+        }
+
+        if(!theIsFolder) {
+            const StString anExtension = StFileNode::getExtension(theName);
+            bool isMatched = false;
+            for(size_t anExtIter = 0; anExtIter < Extensions.size(); ++anExtIter) {
+                if(anExtension.isEqualsIgnoreCase(Extensions[anExtIter])) {
+                    isMatched = true;
+                    break;
+                }
+            }
+            if(!isMatched) {
+                return;
+            }
+        }
+
+        theBatch.push_back(Entry());
+        theBatch.back().Name     = theName;
+        theBatch.back().IsFolder = theIsFolder;
+    }
+
+    /**
+     * Merge the batch into listed entries.
+     * Batches are published by size or by time to keep GUI responsive on slow (network) file systems.
+     */
+    void publish(std::vector<Entry>& theBatch,
+                 StTimer&            theTimer,
+                 const bool          theToForce) {
+        if(theBatch.empty()
+        || (!theToForce
+         && theBatch.size() < 512
+         && theTimer.getElapsedTimeInSec() < 0.1)) {
+            return;
+        }
+
+        std::sort(theBatch.begin(), theBatch.end(), EntryLess());
+        {
+            StMutexAuto aLock(Mutex);
+            const size_t aNbOld = Entries.size();
+            Entries.insert(Entries.end(), theBatch.begin(), theBatch.end());
+            Order.reserve(Entries.size());
+            for(size_t anIter = aNbOld; anIter < Entries.size(); ++anIter) {
+                Order.push_back(int(anIter));
+            }
+            std::inplace_merge(Order.begin(), Order.begin() + aNbOld, Order.end(), OrderLess(Entries));
+        }
+        StAtomicOp::Increment(Generation);
+        theBatch.clear();
+        theTimer.restart();
+    }
+
+    /**
+     * Comparator for indexes of listed entries.
+     */
+    struct OrderLess {
+        const std::vector<Entry>& Entries;
+        OrderLess(const std::vector<Entry>& theEntries) : Entries(theEntries) {}
+        bool operator()(const int theLeft, const int theRight) const {
+            return EntryLess()(Entries[theLeft], Entries[theRight]);
+        }
+    };
+
+};
+
 /**
  * Dummy sub-class overriding scrollable behavior.
  */
@@ -251,10 +469,16 @@ StGLOpenFile::StGLOpenFile(StGLWidget*     theParent,
   myHotListContent(NULL),
   myHotList(NULL),
   myList(NULL),
+  myGrid(NULL),
   myMainFilterCheck(NULL),
   myExtraFilterCheck(NULL),
   myToShowMainFilter(new StBoolParam(true)),
   myToShowExtraFilter(new StBoolParam(false)),
+  myToShowThumbs(new StBoolParam(false)),
+  myListFromRow(-1),
+  myListGeneration(-1),
+  myGridFromItem(-1),
+  myHasFolderUp(false),
   myHighlightColor(0.5f, 0.5f, 0.5f, 1.0f),
   myItemColor     (1.0f, 1.0f, 1.0f, 1.0f),
   myFileColor     (0.7f, 0.7f, 0.7f, 1.0f),
@@ -266,6 +490,7 @@ StGLOpenFile::StGLOpenFile(StGLWidget*     theParent,
 
     myToShowMainFilter ->signals.onChanged = stSlot(this, &StGLOpenFile::doFilterCheck);
     myToShowExtraFilter->signals.onChanged = stSlot(this, &StGLOpenFile::doFilterCheck);
+    myToShowThumbs     ->signals.onChanged = stSlot(this, &StGLOpenFile::doThumbnailsCheck);
 
     int aMarginTop = myMarginTop + myRoot->scale(30);
     myCurrentPath = new StGLTextArea(this, myMarginLeft, myMarginTop, StGLCorner(ST_VCORNER_TOP, ST_HCORNER_LEFT),
@@ -291,11 +516,18 @@ StGLOpenFile::StGLOpenFile(StGLWidget*     theParent,
     myList->setColor(StGLVec4(0.0f, 0.0f, 0.0f, 0.0f));
     myList->setItemWidthMin(myContent->getRectPx().width());
 
+    myGrid = new StGLThumbnailGrid(this, myContent->getRectPx().left(), myContent->getRectPx().top(),
+                                   StGLCorner(ST_VCORNER_TOP, ST_HCORNER_LEFT),
+                                   myContent->getRectPx().width(), myContent->getRectPx().height());
+    myGrid->setOpacity(0.0f, true);
+    myGrid->signals.onItemClick = stSlot(this, &StGLOpenFile::doFileItemClick);
+
     //if(!myRoot->isMobile()) {
         addButton(theCloseText);
     //}
 
     addSystemDrives();
+    addHotCheckbox(myToShowThumbs, "Thumbnails");
 }
 
 void StGLOpenFile::addSystemDrives() {
@@ -379,6 +611,11 @@ void StGLOpenFile::addSystemDrives() {
 }
 
 StGLOpenFile::~StGLOpenFile() {
+    if(!myLister.isNull()) {
+        // listing thread keeps its own reference
+        myLister->ToAbort = true;
+    }
+
     StGLContext& aCtx = getContext();
     if(!myTextureFolder.isNull()) {
         for(size_t aTexIter = 0; aTexIter < myTextureFolder->size(); ++aTexIter) {
@@ -452,20 +689,37 @@ void StGLOpenFile::doHotItemClick(const size_t theItemId) {
 
 void StGLOpenFile::doFilterCheck(const bool ) {
     initExtensions();
-    if(!myFolder.isNull()) {
-        StString aPath = myFolder->getPath();
+    if(!myLister.isNull()) {
+        const StString aPath = myFolderPath;
         openFolder(aPath);
     }
 }
 
+void StGLOpenFile::doThumbnailsCheck(const bool theIsChecked) {
+    myContent->setOpacity(theIsChecked ? 0.0f : 1.0f, false);
+    myGrid   ->setOpacity(theIsChecked ? 1.0f : 0.0f, true);
+    myListFromRow  = -1;
+    myGridFromItem = -1;
+}
+
 void StGLOpenFile::doFileItemClick(const size_t theItemId) {
-    const StFileNode* aNode = myFolder->getValue(theItemId);
-    myItemToLoad = aNode->getPath();
+    if(myLister.isNull()) {
+        return;
+    } else if(myHasFolderUp
+           && theItemId == 0) {
+        doFolderUpClick(0);
+        return;
+    }
+
+    // lister might have merged new entries since the row has been bound
+    std::map<size_t, StString>::const_iterator aPathIter = myBoundPaths.find(theItemId);
+    if(aPathIter != myBoundPaths.end()) {
+        myItemToLoad = aPathIter->second;
+    }
 }
 
 void StGLOpenFile::doFolderUpClick(const size_t ) {
-    StString aPath   = myFolder->getPath();
-    StString aPathUp = StFileNode::getFolderUp(aPath);
+    StString aPathUp = StFileNode::getFolderUp(myFolderPath);
     if(!aPathUp.isEmpty()) {
         myItemToLoad = aPathUp;
     }
@@ -561,9 +815,148 @@ void StGLOpenFile::setItemIcon(StGLMenuItem*   theItem,
     theItem->setIcon(anIcon);
 }
 
+void StGLOpenFile::initListRows() {
+    const int anItemSizeY = stMax(myList->getItemHeight(), 1);
+    const int aNbRows     = myContent->getRectPx().height() / anItemSizeY + 2;
+    int aNbRowsOld = 0;
+    for(StGLWidget* aChild = myList->getChildren()->getStart(); aChild != NULL; aChild = aChild->getNext()) {
+        ++aNbRowsOld;
+    }
+
+    for(int aRowIter = aNbRowsOld; aRowIter < aNbRows; ++aRowIter) {
+        StGLMenuItem* anItem = new StGLPassiveMenuItem(myList);
+        setItemIcon(anItem, myFileColor, false);
+        anItem->setTextColor(myItemColor);
+        anItem->setHilightColor(myHighlightColor);
+        anItem->signals.onItemClick = stSlot(this, &StGLOpenFile::doFileItemClick);
+    }
+}
+
+void StGLOpenFile::updateList() {
+    if(myLister.isNull()) {
+        return;
+    }
+
+    const int aGeneration = myLister->Generation;
+    const int anItemSizeY = stMax(myList->getItemHeight(), 1);
+    const int aNbRows     = int(myLister->size()) + (myHasFolderUp ? 1 : 0);
+    const int aSizeY      = aNbRows * anItemSizeY;
+    if(myList->getRectPx().height() != aSizeY) {
+        // scroll area computes scroll bar from content size
+        myList->changeRectPx().bottom() = myList->getRectPx().top() + aSizeY;
+        myContent->changeRectPx();
+    }
+
+    if(myToShowThumbs->getValue()) {
+        updateGrid(aNbRows, aGeneration);
+        return;
+    }
+
+    const int aFromRow = stMax(-myList->getRectPx().top() / anItemSizeY, 0);
+    if(aFromRow    == myListFromRow
+    && aGeneration == myListGeneration) {
+        return;
+    }
+    myListFromRow    = aFromRow;
+    myListGeneration = aGeneration;
+    myBoundPaths.clear();
+
+    int aNbItems = 0;
+    for(StGLWidget* aChild = myList->getChildren()->getStart(); aChild != NULL; aChild = aChild->getNext()) {
+        ++aNbItems;
+    }
+
+    const int anEntryFrom = stMax(aFromRow - (myHasFolderUp ? 1 : 0), 0);
+    std::vector<StGLOpenFileLister::Entry> anEntries;
+    myLister->getRange(size_t(anEntryFrom), size_t(aNbItems), anEntries);
+
+    int aRow = aFromRow;
+    for(StGLWidget* aChild = myList->getChildren()->getStart(); aChild != NULL; aChild = aChild->getNext(), ++aRow) {
+        StGLMenuItem* anItem = (StGLMenuItem* )aChild;
+        anItem->setClicked(ST_MOUSE_LEFT, false);
+        anItem->setUserData(size_t(aRow));
+        anItem->changeRectPx().moveTopTo(aRow * anItemSizeY);
+
+        const int anEntryIndex = aRow - (myHasFolderUp ? 1 : 0) - anEntryFrom;
+        StGLIcon* anIcon = anItem->getIcon();
+        if(aRow >= aNbRows
+        || anEntryIndex >= int(anEntries.size())) {
+            anItem->setText("");
+            anItem->setOpacity(0.0f, true);
+        } else if(anEntryIndex < 0) {
+            anItem->setText("..");
+            anItem->setOpacity(1.0f, false);
+            if(anIcon != NULL) {
+                anIcon->setOpacity(0.0f, false);
+            }
+        } else {
+            const StGLOpenFileLister::Entry& anEntry = anEntries[anEntryIndex];
+            anItem->setText(anEntry.Name);
+            myBoundPaths[size_t(aRow)] = myLister->getEntryPath(anEntry.Name);
+            anItem->setOpacity(1.0f, false);
+            if(anIcon != NULL) {
+                anIcon->setOpacity(1.0f, false);
+                anIcon->setColor(anEntry.IsFolder ? myItemColor : myFileColor);
+                anIcon->setExternalTextures(anEntry.IsFolder ? myTextureFolder : myTextureFile);
+            }
+        }
+    }
+}
+
+void StGLOpenFile::updateGrid(const int theNbRows,
+                              const int theGeneration) {
+    if(myGrid->getRectPx() != myContent->getRectPx()) {
+        // content area is shifted by hot-list
+        myGrid->changeRectPx() = myContent->getRectPx();
+    }
+
+    myGrid->setNbItems(size_t(theNbRows), false);
+    const int aFromItem = int(myGrid->getFirstVisible());
+    if(aFromItem     == myGridFromItem
+    && theGeneration == myListGeneration) {
+        return;
+    }
+    myGridFromItem   = aFromItem;
+    myListGeneration = theGeneration;
+    myBoundPaths.clear();
+
+    const int anEntryFrom = stMax(aFromItem - (myHasFolderUp ? 1 : 0), 0);
+    std::vector<StGLOpenFileLister::Entry> anEntries;
+    myLister->getRange(size_t(anEntryFrom), myGrid->getNbVisible(), anEntries);
+    for(int anItem = aFromItem; anItem < theNbRows && anItem < aFromItem + int(myGrid->getNbVisible()); ++anItem) {
+        const int anEntryIndex = anItem - (myHasFolderUp ? 1 : 0) - anEntryFrom;
+        if(anEntryIndex < 0) {
+            myGrid->setItem(size_t(anItem), "..", "");
+        } else if(anEntryIndex < int(anEntries.size())) {
+            // thumbnails are generated only for files
+            const StGLOpenFileLister::Entry& anEntry = anEntries[anEntryIndex];
+            const StString anEntryPath = myLister->getEntryPath(anEntry.Name);
+            myBoundPaths[size_t(anItem)] = anEntryPath;
+            myGrid->setItem(size_t(anItem),
+                            anEntry.IsFolder ? anEntry.Name + ST_FILE_SPLITTER : anEntry.Name,
+                            anEntry.IsFolder ? StString() : anEntryPath);
+        }
+    }
+}
+
+bool StGLOpenFile::stglInit() {
+    // menu layout resets rows position
+    myListFromRow = -1;
+    return StGLMessageBox::stglInit();
+}
+
+void StGLOpenFile::stglUpdate(const StPointD_t& theCursorZo,
+                              bool theIsPreciseInput) {
+    updateList();
+    StGLMessageBox::stglUpdate(theCursorZo, theIsPreciseInput);
+}
+
 void StGLOpenFile::openFolder(const StString& theFolder) {
     myItemToLoad.clear();
-    myList->destroyChildren();
+    if(!myLister.isNull()) {
+        myLister->ToAbort = true;
+        myLister.nullify();
+    }
 
     StString aFolder = theFolder;
     if(aFolder.isEmpty()) {
@@ -574,34 +967,22 @@ void StGLOpenFile::openFolder(const StString& theFolder) {
     #endif
     }
 
-    myFolder = new StFolder(aFolder);
-    myFolder->init(myExtensions, 1, true);
-    StString aPath = myFolder->getPath();
+    myFolderPath = aFolder;
+    const StString& aPath = myFolderPath;
     myCurrentPath->setText(StString("<b>Location:*</b>") + aPath
                          + (!aPath.isEmpty() && !aPath.isEndsWith(SYS_FS_SPLITTER) ? ST_FILE_SPLITTER : ""));
-
-    StString aPathUp = StFileNode::getFolderUp(aPath);
-    if(!aPathUp.isEmpty()) {
-        StGLMenuItem* anUpItem = new StGLPassiveMenuItem(myList);
-        anUpItem->setText("..");
-        anUpItem->setTextColor(myItemColor);
-        anUpItem->setHilightColor(myHighlightColor);
-        anUpItem->changeMargins().left = myMarginX + myIconSizeX + myMarginX;
-        anUpItem->signals.onItemClick = stSlot(this, &StGLOpenFile::doFolderUpClick);
-    }
-
-    const size_t aNbItems = myFolder->size();
-    for(size_t anItemIter = 0; anItemIter < aNbItems; ++anItemIter) {
-        const StFileNode* aNode = myFolder->getValue(anItemIter);
-        StString aName = aNode->getSubPath();
-        StGLMenuItem* anItem = new StGLPassiveMenuItem(myList);
-        setItemIcon(anItem, aNode->isFolder() ? myItemColor : myFileColor, aNode->isFolder());
-        anItem->setText(aName);
-        anItem->setTextColor(myItemColor);
-        anItem->setHilightColor(myHighlightColor);
-        anItem->setUserData(anItemIter);
-        anItem->signals.onItemClick = stSlot(this, &StGLOpenFile::doFileItemClick);
-    }
+    myHasFolderUp = !StFileNode::getFolderUp(aPath).isEmpty();
+
+    // rows are bound to folder content by updateList() as entries are being listed
+    myLister = new StGLOpenFileLister(aFolder, myExtensions);
+    StThread aThread(StGLOpenFileLister::listThread, new StHandle<StGLOpenFileLister>(myLister), "StGLOpenFile");
+
+    myList->changeRectPx().moveTopTo(0);
+    myListGeneration = -1;
+    myGridFromItem   = -1;
+    myBoundPaths.clear();
+    myGrid->setNbItems(0, true);
+    initListRows();
     myList->stglInit();
     stglInit();
 }
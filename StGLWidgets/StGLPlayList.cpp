@@ -264,7 +264,7 @@ void StGLPlayList::stglDrawScrollBar(unsigned int theView) {
     }
 
     aCtx.core20fwd->glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    aCtx.core20fwd->glEnable(GL_BLEND);
+    aCtx.stglSetBlend(true);
     aProgram.use(aCtx, myRoot->getScreenDispX());
     myBarVertBuf.bindVertexAttrib  (aCtx, aProgram.getVVertexLoc());
 
@@ -273,7 +273,7 @@ void StGLPlayList::stglDrawScrollBar(unsigned int theView) {
 
     myBarVertBuf.unBindVertexAttrib(aCtx, aProgram.getVVertexLoc());
     aProgram.unuse(aCtx);
-    aCtx.core20fwd->glDisable(GL_BLEND);
+    aCtx.stglSetBlend(false);
 }
 
 void StGLPlayList::stglUpdate(const StPointD_t& theCursorZo,
@@ -0,0 +1,296 @@
+/**
+ * StGLWidgets, small C++ toolkit for writing GUI using OpenGL.
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * This code is licensed under MIT license (see docs/license-mit.txt for details).
+ */
+
+#include <StGLWidgets/StGLProfilerGraph.h>
+#include <StGLWidgets/StGLMenuProgram.h>
+#include <StGLWidgets/StGLRootWidget.h>
+#include <StGLWidgets/StGLTextArea.h>
+
+#include <StGL/StGLContext.h>
+#include <StGLCore/StGLCore20.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+    static const StGLVec4 THE_BACK_COLOR  (0.0f, 0.0f, 0.0f, 0.5f);
+    static const StGLVec4 THE_TARGET_COLOR(1.0f, 1.0f, 1.0f, 0.5f);
+    static const StGLVec4 THE_ZONE_COLORS[StGLProfilerGraph::ZONES_MAX] = {
+        StGLVec4(0.90f, 0.30f, 0.30f, 1.0f),
+        StGLVec4(0.30f, 0.80f, 0.30f, 1.0f),
+        StGLVec4(0.35f, 0.55f, 1.00f, 1.0f),
+        StGLVec4(0.95f, 0.80f, 0.20f, 1.0f),
+        StGLVec4(0.80f, 0.40f, 0.90f, 1.0f),
+        StGLVec4(0.25f, 0.85f, 0.85f, 1.0f),
+        StGLVec4(1.00f, 0.55f, 0.15f, 1.0f),
+        StGLVec4(0.75f, 0.75f, 0.75f, 1.0f)
+    };
+
+    /**
+     * Sort zones by thread, then by start time with outer zones first.
+     */
+    inline bool compareZones(const StProfiler::Zone& theLeft,
+                             const StProfiler::Zone& theRight) {
+        if(theLeft.ThreadSlot != theRight.ThreadSlot) {
+            return theLeft.ThreadSlot < theRight.ThreadSlot;
+        } else if(theLeft.StartUSec != theRight.StartUSec) {
+            return theLeft.StartUSec < theRight.StartUSec;
+        }
+        return theLeft.EndUSec > theRight.EndUSec;
+    }
+
+    /**
+     * Compare names of zones or threads (NULL for unnamed thread).
+     */
+    inline bool isSameName(const char* theLeft,
+                           const char* theRight) {
+        return theLeft == theRight
+            || (theLeft  != NULL
+             && theRight != NULL
+             && std::strcmp(theLeft, theRight) == 0);
+    }
+
+    /**
+     * Append rectangle as two triangles.
+     */
+    inline void addRect(std::vector<StGLVec2>& theVerts,
+                        const float theLeft,  const float theRight,
+                        const float theBottom, const float theTop) {
+        theVerts.push_back(StGLVec2(theLeft,  theBottom));
+        theVerts.push_back(StGLVec2(theRight, theBottom));
+        theVerts.push_back(StGLVec2(theLeft,  theTop));
+        theVerts.push_back(StGLVec2(theRight, theBottom));
+        theVerts.push_back(StGLVec2(theRight, theTop));
+        theVerts.push_back(StGLVec2(theLeft,  theTop));
+    }
+
+}
+
+StGLProfilerGraph::StGLProfilerGraph(StGLWidget* theParent,
+                                     const int theLeft, const int theTop,
+                                     const StGLCorner theCorner)
+: StGLWidget(theParent, theLeft, theTop, theCorner,
+             theParent->getRoot()->scale(256),
+             theParent->getRoot()->scale(96 + 16 * ZONES_MAX)),
+  myFrameMSec(1000.0f / 60.0f),
+  myNbThreads(0),
+  myNbNames(0),
+  myHead(0),
+  myNbColumns(0),
+  myLastUSec(StProfiler::GetDefault().getTimeMicroSec()),
+  myLegendTimer(true),
+  myToRebuild(true) {
+    stMemZero(myHistory, sizeof(myHistory));
+    stMemZero(mySlotFirst, sizeof(mySlotFirst));
+    stMemZero(mySlotCount, sizeof(mySlotCount));
+    const int aRowHeight = myRoot->scale(16);
+    for(int aBarIter = 0; aBarIter < THREADS_MAX; ++aBarIter) {
+        myThreadNames[aBarIter] = NULL;
+    }
+    for(int aSlotIter = 0; aSlotIter < ZONES_MAX; ++aSlotIter) {
+        myNames[aSlotIter]    = NULL;
+        mySlotBars[aSlotIter] = 0;
+        myLegend[aSlotIter] = new StGLTextArea(this, 0, myRoot->scale(96) + aSlotIter * aRowHeight,
+                                               StGLCorner(ST_VCORNER_TOP, ST_HCORNER_LEFT),
+                                               getRectPx().width(), aRowHeight,
+                                               StGLTextArea::SIZE_SMALL);
+        myLegend[aSlotIter]->setupAlignment(StGLTextFormatter::ST_ALIGN_X_LEFT,
+                                            StGLTextFormatter::ST_ALIGN_Y_CENTER);
+        myLegend[aSlotIter]->setTextColor(THE_ZONE_COLORS[aSlotIter]);
+        myLegend[aSlotIter]->setText("");
+    }
+}
+
+StGLProfilerGraph::~StGLProfilerGraph() {
+    myVertBuf.release(getContext());
+}
+
+bool StGLProfilerGraph::stglInit() {
+    if(!StGLWidget::stglInit()) {
+        return false;
+    }
+    return myVertBuf.isValid()
+        || myVertBuf.init(getContext());
+}
+
+int StGLProfilerGraph::getThreadBar(const char* theThreadName) {
+    for(int aBarIter = 0; aBarIter < myNbThreads; ++aBarIter) {
+        if(isSameName(myThreadNames[aBarIter], theThreadName)) {
+            return aBarIter;
+        }
+    }
+    if(myNbThreads >= THREADS_MAX) {
+        return -1;
+    }
+    myThreadNames[myNbThreads] = theThreadName;
+    myToRebuild = true;
+    return myNbThreads++;
+}
+
+int StGLProfilerGraph::getZoneSlot(const char* theName,
+                                   const int   theThreadBar) {
+    for(int aSlotIter = 0; aSlotIter < myNbNames; ++aSlotIter) {
+        if(mySlotBars[aSlotIter] == theThreadBar
+        && isSameName(myNames[aSlotIter], theName)) {
+            return aSlotIter;
+        }
+    }
+    if(myNbNames >= ZONES_MAX) {
+        return -1;
+    }
+    myNames   [myNbNames] = theName;
+    mySlotBars[myNbNames] = theThreadBar;
+    return myNbNames++;
+}
+
+void StGLProfilerGraph::update(const double theTargetFps) {
+    StProfiler& aProfiler = StProfiler::GetDefault();
+    const double aTimeUSec = aProfiler.getTimeMicroSec();
+    myFrameMSec = theTargetFps > 1.0 ? float(1000.0 / theTargetFps) : 1000.0f / 60.0f;
+
+    myZones.clear();
+    aProfiler.getZones(myLastUSec, myZones);
+    myLastUSec = aTimeUSec;
+
+    // compute self-time of each zone by subtracting nested zones of the same thread
+    std::sort(myZones.begin(), myZones.end(), compareZones);
+    mySelfTimes.resize(myZones.size());
+    myStack.clear();
+    for(size_t aZoneIter = 0; aZoneIter < myZones.size(); ++aZoneIter) {
+        const StProfiler::Zone& aZone = myZones[aZoneIter];
+        mySelfTimes[aZoneIter] = aZone.EndUSec - aZone.StartUSec;
+        while(!myStack.empty()) {
+            const StProfiler::Zone& aParent = myZones[myStack.back()];
+            if(aParent.ThreadSlot == aZone.ThreadSlot
+            && aParent.EndUSec    >  aZone.StartUSec) {
+                mySelfTimes[myStack.back()] -= mySelfTimes[aZoneIter];
+                break;
+            }
+            myStack.pop_back();
+        }
+        myStack.push_back(aZoneIter);
+    }
+
+    myHead = (myHead + 1) % HISTORY_LENGTH;
+    myNbColumns = stMin(myNbColumns + 1, int(HISTORY_LENGTH));
+    float* aColumn = myHistory[myHead];
+    for(int aSlotIter = 0; aSlotIter < ZONES_MAX; ++aSlotIter) {
+        aColumn[aSlotIter] = 0.0f;
+    }
+    for(size_t aZoneIter = 0; aZoneIter < myZones.size(); ++aZoneIter) {
+        const StProfiler::Zone& aZone = myZones[aZoneIter];
+        const int aBar  = getThreadBar(aProfiler.getThreadName(aZone.ThreadSlot));
+        const int aSlot = aBar >= 0 ? getZoneSlot(aZone.Name, aBar) : -1;
+        if(aSlot >= 0) {
+            aColumn[aSlot] += float(mySelfTimes[aZoneIter] * 0.001);
+        }
+    }
+    myToRebuild = true;
+
+    if(myLegendTimer.getElapsedTimeInSec() >= 0.5) {
+        myLegendTimer.restart();
+        updateLegend();
+    }
+}
+
+void StGLProfilerGraph::updateLegend() {
+    if(myNbColumns < 1) {
+        return;
+    }
+
+    char aBuffer[128];
+    for(int aSlotIter = 0; aSlotIter < myNbNames; ++aSlotIter) {
+        float aSum = 0.0f;
+        for(int aColIter = 0; aColIter < myNbColumns; ++aColIter) {
+            aSum += myHistory[(myHead - aColIter + HISTORY_LENGTH) % HISTORY_LENGTH][aSlotIter];
+        }
+        const char* aThreadName = myThreadNames[mySlotBars[aSlotIter]];
+        stsprintf(aBuffer, 128, "%s: %s %.2f ms", aThreadName != NULL ? aThreadName : "Thread",
+                  myNames[aSlotIter], aSum / float(myNbColumns));
+        myLegend[aSlotIter]->setText(aBuffer);
+    }
+}
+
+void StGLProfilerGraph::stglDraw(unsigned int theView) {
+    if(!isVisible()
+    || !myVertBuf.isValid()) {
+        return;
+    }
+
+    StGLContext&     aCtx     = getContext();
+    StGLMenuProgram& aProgram = myRoot->getMenuProgram();
+    if(myToRebuild
+    || myIsResized) {
+        StRectI_t aRectPx = getRectPxAbsolute();
+        aRectPx.bottom() = aRectPx.top() + myRoot->scale(96);
+        const StRectD_t aRectGl = getRoot()->getRectGl(aRectPx);
+        const float aLeft   = float(aRectGl.left());
+        const float aBottom = float(aRectGl.bottom());
+        const float aSizeX  = float(aRectGl.width());
+        const float aSizeY  = float(aRectGl.top() - aRectGl.bottom());
+        const float aColX   = aSizeX / float(HISTORY_LENGTH);
+        const float aBarX   = aColX / float(stMax(myNbThreads, 1));
+        const float aScaleY = aSizeY / (2.0f * myFrameMSec);
+
+        myVertices.clear();
+        addRect(myVertices, aLeft, aLeft + aSizeX, aBottom, aBottom + aSizeY);
+        const float aTargetY = aBottom + aSizeY * 0.5f;
+        addRect(myVertices, aLeft, aLeft + aSizeX, aTargetY, aTargetY + float(myRoot->getRootScaleY()));
+
+        // vertices of all columns are grouped by zone to draw each color with single call;
+        // zones of each thread are stacked within dedicated bar of the column
+        float aBarBottoms[THREADS_MAX][HISTORY_LENGTH];
+        for(int aBarIter = 0; aBarIter < THREADS_MAX; ++aBarIter) {
+            for(int aColIter = 0; aColIter < HISTORY_LENGTH; ++aColIter) {
+                aBarBottoms[aBarIter][aColIter] = aBottom;
+            }
+        }
+        for(int aSlotIter = 0; aSlotIter < myNbNames; ++aSlotIter) {
+            const int aBar = mySlotBars[aSlotIter];
+            mySlotFirst[aSlotIter] = GLint(myVertices.size());
+            for(int aColIter = 0; aColIter < myNbColumns; ++aColIter) {
+                const float aValue = myHistory[(myHead - aColIter + HISTORY_LENGTH) % HISTORY_LENGTH][aSlotIter];
+                if(aValue <= 0.0f) {
+                    continue;
+                }
+
+                float&      aBarBottom = aBarBottoms[aBar][aColIter];
+                const float aBarLeft   = aLeft + aSizeX - aColX * float(aColIter + 1) + aBarX * float(aBar);
+                const float aBarTop    = stMin(aBarBottom + aValue * aScaleY, aBottom + aSizeY);
+                addRect(myVertices, aBarLeft, aBarLeft + aBarX, aBarBottom, aBarTop);
+                aBarBottom = aBarTop;
+            }
+            mySlotCount[aSlotIter] = GLsizei(myVertices.size()) - mySlotFirst[aSlotIter];
+        }
+        myVertBuf.init(aCtx, myVertices);
+        myToRebuild = false;
+        myIsResized = false;
+    }
+
+    aCtx.core20fwd->glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    aCtx.stglSetBlend(true);
+    aProgram.use(aCtx, getRoot()->getScreenDispX());
+    myVertBuf.bindVertexAttrib(aCtx, aProgram.getVVertexLoc());
+
+    aProgram.setColor(aCtx, THE_BACK_COLOR, myOpacity);
+    aCtx.core20fwd->glDrawArrays(GL_TRIANGLES, 0, 6);
+    for(int aSlotIter = 0; aSlotIter < myNbNames; ++aSlotIter) {
+        if(mySlotCount[aSlotIter] > 0) {
+            aProgram.setColor(aCtx, THE_ZONE_COLORS[aSlotIter], myOpacity);
+            aCtx.core20fwd->glDrawArrays(GL_TRIANGLES, mySlotFirst[aSlotIter], mySlotCount[aSlotIter]);
+        }
+    }
+    aProgram.setColor(aCtx, THE_TARGET_COLOR, myOpacity);
+    aCtx.core20fwd->glDrawArrays(GL_TRIANGLES, 6, 6);
+
+    myVertBuf.unBindVertexAttrib(aCtx, aProgram.getVVertexLoc());
+    aProgram.unuse(aCtx);
+    aCtx.stglSetBlend(false);
+
+    StGLWidget::stglDraw(theView); // draw legend
+}
@@ -52,6 +52,8 @@ StGLRadioButton::StGLRadioButton(StGLWidget* theParent,
             myTextures = new StGLTextureArray(2);
             myTextures->changeValue(0).setName(anIcon0);
             myTextures->changeValue(1).setName(anIcon1);
+            myRoot->prefetchIcon(anIcon0);
+            myRoot->prefetchIcon(anIcon1);
             myRoot->getRadioIcon() = myTextures;
         }
     }
@@ -130,7 +132,7 @@ void StGLRadioButton::stglDraw(unsigned int theView) {
     }
 
     aCtx.core20fwd->glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    aCtx.core20fwd->glEnable(GL_BLEND);
+    aCtx.stglSetBlend(true);
     aProgram.use(aCtx, getRoot()->getScreenDispX());
     myVertBuf.bindVertexAttrib  (aCtx, aProgram.getVVertexLoc());
 
@@ -142,7 +144,7 @@ void StGLRadioButton::stglDraw(unsigned int theView) {
 
     myVertBuf.unBindVertexAttrib(aCtx, aProgram.getVVertexLoc());
     aProgram.unuse(aCtx);
-    aCtx.core20fwd->glDisable(GL_BLEND);
+    aCtx.stglSetBlend(false);
 }
 
 void StGLRadioButton::setValue() {
@@ -12,10 +12,15 @@
 #include <StGLWidgets/StGLTextProgram.h>
 #include <StGLWidgets/StGLTextBorderProgram.h>
 
+#include <StAV/StAVImage.h>
 #include <StCore/StEvent.h>
 #include <StGL/StGLContext.h>
 #include <StGLCore/StGLCore20.h>
 #include <StFile/StFileNode.h>
+#include <StThreads/StStartupTimeline.h>
+#include <StThreads/StThreadPool.h>
+
+#include <vector>
 
 namespace {
 
@@ -37,6 +42,22 @@ namespace {
         0
     };
 
+    /**
+     * Parallel decoding of icons.
+     */
+    struct StIconsDecodeJob {
+        const StHandle<StResourceManager>* ResMgr; //!< resources manager
+        const StString*                    Names;  //!< icons to decode
+        StHandle<StImageFile>*             Images; //!< decoded icons
+
+        static void perform(void* theJob, const size_t theFrom, const size_t theTo) {
+            StIconsDecodeJob* aJob = (StIconsDecodeJob* )theJob;
+            for(size_t anIter = theFrom; anIter < theTo; ++anIter) {
+                aJob->Images[anIter] = StGLRootWidget::loadIcon(*aJob->ResMgr, aJob->Names[anIter]);
+            }
+        }
+    };
+
 }
 
 size_t StGLRootWidget::generateShareId() {
@@ -63,6 +84,7 @@ StGLRootWidget::StGLRootWidget(const StHandle<StResourceManager>& theResMgr)
   myFocusWidget(NULL),
   myModalDialog(NULL),
   myIsMenuPressed(false),
+  myToPrefetchIcons(true),
   myMenuIconSize(IconSize_16),
   myClickThreshold(3) {
     myRectPxFull = getRectPx();
@@ -254,7 +276,84 @@ bool StGLRootWidget::stglInit() {
         return false;
     }
 
-    return StGLWidget::stglInit();
+    if(!myToPrefetchIcons) {
+        return StGLWidget::stglInit();
+    }
+
+    // decode icons of all widgets at once, widgets created later load icons on their own
+    myToPrefetchIcons = false;
+    decodePrefetchedIcons();
+    bool isInit = false;
+    {
+        ST_STARTUP_PHASE("StGLRootWidget, upload textures");
+        isInit = StGLWidget::stglInit();
+    }
+    myIconsPrefetched.clear();
+    return isInit;
+}
+
+void StGLRootWidget::prefetchIcon(const StString& theName) {
+    if(myToPrefetchIcons
+    && !theName.isEmpty()) {
+        myIconsPrefetched[theName]; // decoded by stglInit()
+    }
+}
+
+StHandle<StImageFile> StGLRootWidget::getPrefetchedIcon(const StString& theName) const {
+    std::map< StString, StHandle<StImageFile> >::const_iterator anIter = myIconsPrefetched.find(theName);
+    return anIter != myIconsPrefetched.end() ? anIter->second : StHandle<StImageFile>();
+}
+
+StHandle<StImageFile> StGLRootWidget::loadIcon(const StHandle<StResourceManager>& theResMgr,
+                                               const StString&                    theName) {
+    StHandle<StResource> aRes = theResMgr->getResource(theName);
+    if(aRes.isNull()) {
+        ST_DEBUG_LOG("StGLRootWidget, texture '" + theName + "' not found");
+        return StHandle<StImageFile>();
+    }
+
+    uint8_t* aData     = NULL;
+    int      aDataSize = 0;
+    if(!aRes->isFile()
+     && aRes->read()) {
+        aData     = (uint8_t* )aRes->getData();
+        aDataSize = aRes->getSize();
+    }
+
+    StHandle<StImageFile> anImage = new StAVImage();
+    if(!anImage->load(aRes->getPath(), StImageFile::ST_TYPE_PNG, aData, aDataSize)) {
+        ST_DEBUG_LOG(anImage->getState());
+        return StHandle<StImageFile>();
+    }
+    return anImage;
+}
+
+void StGLRootWidget::decodePrefetchedIcons() {
+    if(myIconsPrefetched.empty()) {
+        return;
+    }
+
+    ST_STARTUP_PHASE("StGLRootWidget, decode icons");
+    const size_t aNbIcons = myIconsPrefetched.size();
+    std::vector<StString>              aNames;
+    std::vector< StHandle<StImageFile> > anImages(aNbIcons);
+    aNames.reserve(aNbIcons);
+    for(std::map< StString, StHandle<StImageFile> >::const_iterator anIter = myIconsPrefetched.begin();
+        anIter != myIconsPrefetched.end(); ++anIter) {
+        aNames.push_back(anIter->first);
+    }
+
+    StIconsDecodeJob aJob;
+    aJob.ResMgr = &myResMgr;
+    aJob.Names  = &aNames.front();
+    aJob.Images = &anImages.front();
+    StThreadPool::GetDefault().perform(StIconsDecodeJob::perform, &aJob, aNbIcons);
+
+    size_t anIconIter = 0;
+    for(std::map< StString, StHandle<StImageFile> >::iterator anIter = myIconsPrefetched.begin();
+        anIter != myIconsPrefetched.end(); ++anIter, ++anIconIter) {
+        anIter->second = anImages[anIconIter];
+    }
 }
 
 void StGLRootWidget::stglDraw(unsigned int theView) {
@@ -179,7 +179,7 @@ void StGLScrollArea::stglDraw(unsigned int theView) {
         return;
     }
     aCtx.core20fwd->glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    aCtx.core20fwd->glEnable(GL_BLEND);
+    aCtx.stglSetBlend(true);
     aProgram.use(aCtx, myRoot->getScreenDispX());
     myBarVertBuf.bindVertexAttrib(aCtx, aProgram.getVVertexLoc());
 
@@ -188,7 +188,7 @@ void StGLScrollArea::stglDraw(unsigned int theView) {
 
     myBarVertBuf.unBindVertexAttrib(aCtx, aProgram.getVVertexLoc());
     aProgram.unuse(aCtx);
-    aCtx.core20fwd->glDisable(GL_BLEND);
+    aCtx.stglSetBlend(false);
 }
 
 bool StGLScrollArea::doScroll(const int  theDelta,
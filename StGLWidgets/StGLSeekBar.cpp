@@ -93,6 +93,92 @@ class StGLSeekBar::StProgramSB : public StGLProgram {
 
 };
 
+class StGLSeekBar::StProgramThumb : public StGLProgram {
+
+        public:
+
+    StProgramThumb() : StGLProgram("StGLSeekBarThumb"), myDispX(0.0f) {}
+
+    StGLVarLocation getVVertexLoc()   const { return StGLVarLocation(0); }
+    StGLVarLocation getVTexCoordLoc() const { return StGLVarLocation(1); }
+
+    void setProjMat(StGLContext&      theCtx,
+                    const StGLMatrix& theProjMat) {
+        theCtx.core20fwd->glUniformMatrix4fv(uniProjMatLoc, 1, GL_FALSE, theProjMat);
+    }
+
+    using StGLProgram::use;
+    void use(StGLContext&  theCtx,
+             const GLfloat theOpacityValue,
+             const GLfloat theDispX) {
+        StGLProgram::use(theCtx);
+        theCtx.core20fwd->glUniform1f(uniOpacityLoc, theOpacityValue);
+        if(!stAreEqual(myDispX, theDispX, 0.0001f)) {
+            myDispX = theDispX;
+            theCtx.core20fwd->glUniform4fv(uniDispLoc,  1, StGLVec4(theDispX, 0.0f, 0.0f, 0.0f));
+        }
+    }
+
+    virtual bool init(StGLContext& theCtx) ST_ATTR_OVERRIDE {
+        const char VERTEX_SHADER[] =
+           "uniform mat4 uProjMat;\n"
+           "uniform vec4 uDisp;\n"
+           "attribute vec4 vVertex;\n"
+           "attribute vec2 vTexCoord;\n"
+           "varying   vec2 fTexCoord;\n"
+           "void main(void) {\n"
+           "    fTexCoord = vTexCoord;\n"
+           "    gl_Position = uProjMat * (vVertex + uDisp);\n"
+           "}\n";
+
+        const char FRAGMENT_SHADER[] =
+           "uniform sampler2D uTexture;\n"
+           "uniform float     uOpacity;\n"
+           "varying vec2      fTexCoord;\n"
+           "void main(void) {\n"
+           "    gl_FragColor = vec4(texture2D(uTexture, fTexCoord).rgb, uOpacity);\n"
+           "}\n";
+
+        StGLVertexShader aVertexShader(StGLProgram::getTitle());
+        StGLAutoRelease aTmp1(theCtx, aVertexShader);
+        aVertexShader.init(theCtx, VERTEX_SHADER);
+
+        StGLFragmentShader aFragmentShader(StGLProgram::getTitle());
+        StGLAutoRelease aTmp2(theCtx, aFragmentShader);
+        aFragmentShader.init(theCtx, FRAGMENT_SHADER);
+        if(!StGLProgram::create(theCtx)
+           .attachShader(theCtx, aVertexShader)
+           .attachShader(theCtx, aFragmentShader)
+           .bindAttribLocation(theCtx, "vVertex",   getVVertexLoc())
+           .bindAttribLocation(theCtx, "vTexCoord", getVTexCoordLoc())
+           .link(theCtx)) {
+            return false;
+        }
+
+        StGLVarLocation uniTextureLoc = StGLProgram::getUniformLocation(theCtx, "uTexture");
+        if(uniTextureLoc.isValid()) {
+            StGLProgram::use(theCtx);
+            theCtx.core20fwd->glUniform1i(uniTextureLoc, StGLProgram::TEXTURE_SAMPLE_0);
+            StGLProgram::unuse(theCtx);
+        }
+
+        uniProjMatLoc = StGLProgram::getUniformLocation(theCtx, "uProjMat");
+        uniDispLoc    = StGLProgram::getUniformLocation(theCtx, "uDisp");
+        uniOpacityLoc = StGLProgram::getUniformLocation(theCtx, "uOpacity");
+        return uniProjMatLoc.isValid()
+            && uniTextureLoc.isValid()
+            && uniOpacityLoc.isValid();
+    }
+
+        private:
+
+    GLfloat         myDispX;
+    StGLVarLocation uniProjMatLoc;
+    StGLVarLocation uniDispLoc;
+    StGLVarLocation uniOpacityLoc;
+
+};
+
 StGLSeekBar::StGLSeekBar(StGLWidget* theParent,
                          int theTop,
                          int theMargin,
@@ -101,10 +187,17 @@ StGLSeekBar::StGLSeekBar(StGLWidget* theParent,
              theParent->getRoot()->scale(512),
              theParent->getRoot()->scale(12) + theMargin * 2),
   myProgram(new StProgramSB()),
+  myThumbProgram(new StProgramThumb()),
   myProgress(0.0f),
   myProgressPx(0),
   myClickPos(-1),
-  myMoveTolerPx(0) {
+  myMoveTolerPx(0),
+  myThumbsNb(0),
+  myThumbSizeX(0),
+  myThumbSizeY(0),
+  myThumbId(-1),
+  myHoverPos(-1.0),
+  myToUpdateThumbs(false) {
     StGLWidget::signals.onMouseClick  .connect(this, &StGLSeekBar::doMouseClick);
     StGLWidget::signals.onMouseUnclick.connect(this, &StGLSeekBar::doMouseUnclick);
     myMargins.top    = theMargin;
@@ -116,8 +209,29 @@ StGLSeekBar::~StGLSeekBar() {
     if(!myProgram.isNull()) {
         myProgram->release(aCtx);
     }
+    if(!myThumbProgram.isNull()) {
+        myThumbProgram->release(aCtx);
+    }
     myVertices.release(aCtx);
     myColors.release(aCtx);
+    myThumbTexture.release(aCtx);
+    myThumbVerts.release(aCtx);
+    myThumbTCrds.release(aCtx);
+}
+
+void StGLSeekBar::setThumbnails(const StHandle<StImagePlane>& theAtlas,
+                                const int theNbThumbs,
+                                const int theThumbSizeX,
+                                const int theThumbSizeY) {
+    if(myThumbAtlas == theAtlas) {
+        return;
+    }
+
+    myThumbAtlas     = theAtlas;
+    myThumbsNb       = theNbThumbs;
+    myThumbSizeX     = theThumbSizeX;
+    myThumbSizeY     = theThumbSizeY;
+    myToUpdateThumbs = true;
 }
 
 void StGLSeekBar::stglResize() {
@@ -125,6 +239,7 @@ void StGLSeekBar::stglResize() {
     StGLContext& aCtx = getContext();
 
     stglUpdateVertices();
+    myThumbId = -1; // preview vertices depend on root size
 
     // update projection matrix
     if(!myProgram.isNull()) {
@@ -132,6 +247,12 @@ void StGLSeekBar::stglResize() {
         myProgram->setProjMat(aCtx, getRoot()->getScreenProjection());
         myProgram->unuse(aCtx);
     }
+    if(!myThumbProgram.isNull()
+    &&  myThumbProgram->isValid()) {
+        myThumbProgram->use(aCtx);
+        myThumbProgram->setProjMat(aCtx, getRoot()->getScreenProjection());
+        myThumbProgram->unuse(aCtx);
+    }
 }
 
 void StGLSeekBar::stglUpdateVertices() {
@@ -185,9 +306,20 @@ bool StGLSeekBar::stglInit() {
 
     myVertices.init(aCtx); // just generate buffer
     myColors.init(aCtx, 4, 12, COLORS);
+    myThumbVerts.init(aCtx);
+    myThumbTCrds.init(aCtx);
 
     stglUpdateVertices();
 
+    // thumbnail preview is optional
+    if(myThumbProgram->init(aCtx)) {
+        myThumbProgram->use(aCtx);
+        myThumbProgram->setProjMat(aCtx, getRoot()->getScreenProjection());
+        myThumbProgram->unuse(aCtx);
+    } else {
+        myThumbProgram->release(aCtx);
+    }
+
     return myProgram->init(aCtx)
         && StGLWidget::stglInit();
 }
@@ -202,7 +334,7 @@ void StGLSeekBar::stglDraw(unsigned int theView) {
     }
 
     aCtx.core20fwd->glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    aCtx.core20fwd->glEnable(GL_BLEND);
+    aCtx.stglSetBlend(true);
     myProgram->use(aCtx, myOpacity, myRoot->getScreenDispX());
 
     myVertices.bindVertexAttrib(aCtx, myProgram->getVVertexLoc());
@@ -219,14 +351,98 @@ void StGLSeekBar::stglDraw(unsigned int theView) {
     myVertices.unBindVertexAttrib(aCtx, myProgram->getVVertexLoc());
 
     myProgram->unuse(aCtx);
-    aCtx.core20fwd->glDisable(GL_BLEND);
+    aCtx.stglSetBlend(false);
+
+    stglDrawThumbnail();
 
     StGLWidget::stglDraw(theView);
 }
 
+void StGLSeekBar::stglDrawThumbnail() {
+    StGLContext& aCtx = getContext();
+    if(myToUpdateThumbs) {
+        myToUpdateThumbs = false;
+        myThumbId = -1;
+        if(!myThumbAtlas.isNull()
+        && !myThumbAtlas->isNull()) {
+            myThumbTexture.init(aCtx, *myThumbAtlas);
+        } else {
+            myThumbTexture.release(aCtx);
+        }
+    }
+
+    if(myHoverPos < 0.0
+    || myThumbsNb   < 1
+    || myThumbSizeX < 1
+    || myThumbSizeY < 1
+    || !myThumbTexture.isValid()
+    || !myThumbProgram->isValid()) {
+        return;
+    }
+
+    // place preview above the hovered position, within root widget
+    const int aSizeX = myRoot->scale(myThumbSizeX);
+    const int aSizeY = myRoot->scale(myThumbSizeY);
+    const StRectI_t aBarRect = getRectPxAbsolute();
+    const int aBarLeft  = aBarRect.left() + myMargins.left;
+    const int aBarWidth = aBarRect.width() - myMargins.left - myMargins.right;
+    StRectI_t aRect;
+    aRect.left()   = stClamp(aBarLeft + int(myHoverPos * double(aBarWidth)) - aSizeX / 2,
+                             0, stMax(myRoot->getRectPx().width() - aSizeX, 0));
+    aRect.right()  = aRect.left() + aSizeX;
+    aRect.bottom() = aBarRect.top() + myMargins.top - myRoot->scale(4);
+    aRect.top()    = aRect.bottom() - aSizeY;
+
+    // VBOs are filled only when preview is moved or another thumbnail is hovered
+    const int aThumbId = stClamp(int(myHoverPos * double(myThumbsNb)), 0, myThumbsNb - 1);
+    if(myThumbId != aThumbId) {
+        const int aNbCols = stMax(myThumbTexture.getSizeX() / myThumbSizeX, 1);
+        const int aCol    = aThumbId % aNbCols;
+        const int aRow    = aThumbId / aNbCols;
+        const GLfloat aTexX = GLfloat(myThumbSizeX) / GLfloat(myThumbTexture.getSizeX());
+        const GLfloat aTexY = GLfloat(myThumbSizeY) / GLfloat(myThumbTexture.getSizeY());
+        StArray<StGLVec2> aTexCoords(4);
+        aTexCoords[0] = StGLVec2(aTexX * GLfloat(aCol + 1), aTexY * GLfloat(aRow));
+        aTexCoords[1] = StGLVec2(aTexX * GLfloat(aCol + 1), aTexY * GLfloat(aRow + 1));
+        aTexCoords[2] = StGLVec2(aTexX * GLfloat(aCol),     aTexY * GLfloat(aRow));
+        aTexCoords[3] = StGLVec2(aTexX * GLfloat(aCol),     aTexY * GLfloat(aRow + 1));
+        myThumbTCrds.init(aCtx, aTexCoords);
+    }
+    if(myThumbId != aThumbId
+    || myThumbRect != aRect) {
+        StArray<StGLVec2> aVertices(4);
+        myRoot->getRectGl(aRect, aVertices);
+        myThumbVerts.init(aCtx, aVertices);
+        myThumbRect = aRect;
+    }
+    myThumbId = aThumbId;
+
+    aCtx.core20fwd->glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    aCtx.stglSetBlend(true);
+    myThumbTexture.bind(aCtx);
+    myThumbProgram->use(aCtx, myOpacity, myRoot->getScreenDispX());
+
+    myThumbVerts.bindVertexAttrib(aCtx, myThumbProgram->getVVertexLoc());
+    myThumbTCrds.bindVertexAttrib(aCtx, myThumbProgram->getVTexCoordLoc());
+
+    aCtx.core20fwd->glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+
+    myThumbTCrds.unBindVertexAttrib(aCtx, myThumbProgram->getVTexCoordLoc());
+    myThumbVerts.unBindVertexAttrib(aCtx, myThumbProgram->getVVertexLoc());
+
+    myThumbProgram->unuse(aCtx);
+    myThumbTexture.unbind(aCtx);
+    aCtx.stglSetBlend(false);
+}
+
 void StGLSeekBar::stglUpdate(const StPointD_t& theCursor,
                              bool theIsPreciseInput) {
     StGLWidget::stglUpdate(theCursor, theIsPreciseInput);
+    myHoverPos = -1.0;
+    if(isVisibleAndPointIn(theCursor)
+    || isClicked(ST_MOUSE_LEFT)) {
+        myHoverPos = stMin(stMax(getPointInEx(theCursor), 0.0), 1.0);
+    }
     if(!isClicked(ST_MOUSE_LEFT)) {
         return;
     }
@@ -1,6 +1,6 @@
 /**
  * StGLWidgets, small C++ toolkit for writing GUI using OpenGL.
- * Copyright © 2010-2025 Kirill Gavrilov <kirill@sview.ru>
+ * Copyright © 2010-2026 Kirill Gavrilov <kirill@sview.ru>
  *
  * This code is licensed under MIT license (see docs/license-mit.txt for details).
  */
@@ -13,7 +13,8 @@
 #include <StGLWidgets/StGLRootWidget.h>
 
 namespace {
-    static const size_t SHARE_IMAGE_PROGRAM_ID = StGLRootWidget::generateShareId();
+    static const size_t SHARE_IMAGE_PROGRAM_ID   = StGLRootWidget::generateShareId();
+    static const size_t SHARE_PALETTE_PROGRAM_ID = StGLRootWidget::generateShareId();
     static StGLVCorner parseCorner(int theVal) { return (StGLVCorner )theVal; }
 }
 
@@ -21,7 +22,9 @@ class StGLSubtitles::StImgProgram : public StGLProgram {
 
         public:
 
-    StImgProgram() : StGLProgram("StGLSubtitles") {}
+    StImgProgram(const bool theIsPalette)
+    : StGLProgram("StGLSubtitles"),
+      myIsPalette(theIsPalette) {}
 
     StGLVarLocation getVVertexLoc()   const { return StGLVarLocation(0); }
     StGLVarLocation getVTexCoordLoc() const { return StGLVarLocation(1); }
@@ -31,6 +34,11 @@ class StGLSubtitles::StImgProgram : public StGLProgram {
         theCtx.core20fwd->glUniformMatrix4fv(uniProjMatLoc, 1, GL_FALSE, theProjMat);
     }
 
+    void setTexSize(StGLContext&    theCtx,
+                    const StGLVec2& theSize) {
+        theCtx.core20fwd->glUniform2fv(uniTexSizeLoc, 1, theSize);
+    }
+
     virtual bool init(StGLContext& theCtx) {
         const char VERTEX_SHADER[] =
            "uniform mat4 uProjMat;\n"
@@ -50,12 +58,45 @@ class StGLSubtitles::StImgProgram : public StGLProgram {
            "    gl_FragColor = texture2D(uTexture, fTexCoord);\n"
            "}\n";
 
+        // palette indices are fetched with nearest filter and colors are interpolated manually
+        const char FRAGMENT_SHADER_PALETTE[] =
+           "uniform sampler2D uTexture;\n"
+           "uniform sampler2D uPalette;\n"
+           "uniform vec2      uTexSize;\n"
+           "varying vec2      fTexCoord;\n"
+           "float getIndex(vec2 theTexCoord);\n"
+           "vec4 getColor(vec2 theTexel) {\n"
+           "    float anIndex = floor(getIndex((theTexel + vec2(0.5)) / uTexSize) * 255.0 + 0.5);\n"
+           "    vec2  aPalCoord = (vec2(mod(anIndex, 16.0), floor(anIndex / 16.0)) + vec2(0.5)) / 16.0;\n"
+           "    vec4  aColor = texture2D(uPalette, aPalCoord);\n"
+           "    return vec4(aColor.rgb * aColor.a, aColor.a);\n"
+           "}\n"
+           "void main(void) {\n"
+           "    vec2 aTexel = fTexCoord * uTexSize - vec2(0.5);\n"
+           "    vec2 aBase  = floor(aTexel);\n"
+           "    vec2 aFrac  = aTexel - aBase;\n"
+           "    vec4 aColor = mix(mix(getColor(aBase),                  getColor(aBase + vec2(1.0, 0.0)), aFrac.x),\n"
+           "                      mix(getColor(aBase + vec2(0.0, 1.0)), getColor(aBase + vec2(1.0, 1.0)), aFrac.x), aFrac.y);\n"
+           "    gl_FragColor = aColor.a > 0.0 ? vec4(aColor.rgb / aColor.a, aColor.a) : vec4(0.0);\n"
+           "}\n";
+
+        const char FRAGMENT_GET_RED[] =
+           "float getIndex(vec2 theTexCoord) { return texture2D(uTexture, theTexCoord).r; }\n";
+
+        const char FRAGMENT_GET_ALPHA[] =
+           "float getIndex(vec2 theTexCoord) { return texture2D(uTexture, theTexCoord).a; }\n";
+
         StGLVertexShader aVertexShader(StGLProgram::getTitle());
         aVertexShader.init(theCtx, VERTEX_SHADER);
         StGLAutoRelease aTmp1(theCtx, aVertexShader);
 
         StGLFragmentShader aFragmentShader(StGLProgram::getTitle());
-        aFragmentShader.init(theCtx, FRAGMENT_SHADER);
+        if(myIsPalette) {
+            aFragmentShader.init(theCtx, FRAGMENT_SHADER_PALETTE,
+                                 theCtx.arbTexRG ? FRAGMENT_GET_RED : FRAGMENT_GET_ALPHA);
+        } else {
+            aFragmentShader.init(theCtx, FRAGMENT_SHADER);
+        }
         StGLAutoRelease aTmp2(theCtx, aFragmentShader);
         if(!StGLProgram::create(theCtx)
            .attachShader(theCtx, aVertexShader)
@@ -67,27 +108,71 @@ class StGLSubtitles::StImgProgram : public StGLProgram {
         }
 
         StGLVarLocation uniTextureLoc = StGLProgram::getUniformLocation(theCtx, "uTexture");
+        StGLVarLocation uniPaletteLoc = StGLProgram::getUniformLocation(theCtx, "uPalette");
         if(uniTextureLoc.isValid()) {
             StGLProgram::use(theCtx);
             theCtx.core20fwd->glUniform1i(uniTextureLoc, StGLProgram::TEXTURE_SAMPLE_0);
+            if(uniPaletteLoc.isValid()) {
+                theCtx.core20fwd->glUniform1i(uniPaletteLoc, StGLProgram::TEXTURE_SAMPLE_1); // GL_TEXTURE1
+            }
             StGLProgram::unuse(theCtx);
         }
 
         uniProjMatLoc = StGLProgram::getUniformLocation(theCtx, "uProjMat");
         uniDispLoc    = StGLProgram::getUniformLocation(theCtx, "uDisp");
+        uniTexSizeLoc = StGLProgram::getUniformLocation(theCtx, "uTexSize");
         return uniProjMatLoc.isValid()
-            && uniTextureLoc.isValid();
+            && uniTextureLoc.isValid()
+            && (!myIsPalette || (uniPaletteLoc.isValid() && uniTexSizeLoc.isValid()));
     }
 
         private:
 
     StGLVarLocation uniProjMatLoc;
     StGLVarLocation uniDispLoc;
+    StGLVarLocation uniTexSizeLoc;
+    bool            myIsPalette;
 
 };
 
+bool StGLSubtitles::StSubImage::init(StGLContext&               theCtx,
+                                     const StHandle<StSubItem>& theItem) {
+    Item = theItem;
+    GLint anInternalFormat = GL_RGBA8;
+    if(!StGLTexture::getInternalFormat(theCtx, theItem->Image.getFormat(), anInternalFormat)) {
+        release(theCtx);
+        return false;
+    }
+
+    if(theItem->Palette.isNull()) {
+        Palette.release(theCtx);
+        Texture.setMinMagFilter(theCtx, GL_LINEAR, GL_LINEAR);
+    } else {
+        // palette lookup should not be interpolated
+        Palette.setMinMagFilter(theCtx, GL_NEAREST, GL_NEAREST);
+        Texture.setMinMagFilter(theCtx, GL_NEAREST, GL_NEAREST);
+        if(!Palette.init(theCtx, theItem->Palette)) {
+            release(theCtx);
+            return false;
+        }
+    }
+
+    Texture.setTextureFormat(anInternalFormat);
+    if(!Texture.init(theCtx, theItem->Image)) {
+        release(theCtx);
+        return false;
+    }
+    return true;
+}
+
+void StGLSubtitles::StSubImage::release(StGLContext& theCtx) {
+    Texture.release(theCtx);
+    Palette.release(theCtx);
+    Item.nullify();
+}
+
 StGLSubtitles::StSubShowItems::StSubShowItems()
-: StArrayList<StHandle <StSubItem> >(8), Scale (1.0f) {
+: StArrayList<StHandle <StSubItem> >(8) {
     //
 }
 
@@ -105,7 +190,7 @@ bool StGLSubtitles::StSubShowItems::pop(const double thePTS) {
         return false;
     } else if(isEmpty()) {
         Text.clear();
-        Image.nullify();
+        ImageItem.nullify();
         return true;
     }
 
@@ -118,13 +203,9 @@ bool StGLSubtitles::StSubShowItems::pop(const double thePTS) {
     }
 
     // update active image
-    const StImagePlane& anImage = getFirst()->Image;
-    if(!anImage.isNull()) {
-        Image.initCopy(anImage, false);
-        Scale = getFirst()->Scale;
-    } else {
-        Image.nullify();
-        Scale = 1.0f;
+    ImageItem.nullify();
+    if(!getFirst()->Image.isNull()) {
+        ImageItem = getFirst();
     }
 
     return isChanged;
@@ -136,15 +217,48 @@ void StGLSubtitles::StSubShowItems::add(const StHandle<StSubItem>& theItem) {
     }
     Text += theItem->Text;
 
-    const StImagePlane& anImage = theItem->Image;
-    if(!anImage.isNull()) {
-        Image.initCopy(anImage, false);
-        Scale = theItem->Scale;
+    if(!theItem->Image.isNull()) {
+        ImageItem = theItem;
     }
 
     StArrayList<StHandle <StSubItem> >::add(theItem);
 }
 
+StString StGLSubtitles::StSubShowItems::predictText(const StSubItem& theItem) const {
+    // repeat pop() + add() logic for the moment of item activation
+    bool hasOutdated = false;
+    for(size_t anId = 0; anId < size(); ++anId) {
+        if(getValue(anId)->TimeEnd < theItem.TimeStart) {
+            hasOutdated = true;
+            break;
+        }
+    }
+
+    StString aText;
+    if(!hasOutdated) {
+        aText = Text;
+    } else {
+        bool isFirst = true;
+        for(size_t anId = 0; anId < size(); ++anId) {
+            const StHandle<StSubItem>& anItem = getValue(anId);
+            if(anItem->TimeEnd < theItem.TimeStart) {
+                continue;
+            }
+            if(!isFirst) {
+                aText += StString('\n');
+            }
+            aText += anItem->Text;
+            isFirst = false;
+        }
+    }
+
+    if(!aText.isEmpty()) {
+        aText += StString('\n');
+    }
+    aText += theItem.Text;
+    return aText;
+}
+
 StGLSubtitles::StGLSubtitles(StGLImageRegion* theParent,
                              const StHandle<StSubQueue>&     theSubQueue,
                              const StHandle<StInt32Param>&   thePlace,
@@ -154,8 +268,11 @@ StGLSubtitles::StGLSubtitles(StGLImageRegion* theParent,
                StGLCorner(parseCorner(thePlace->getValue()), ST_HCORNER_CENTER),
                theParent->getRoot()->scale(800), theParent->getRoot()->scale(160)),
   myQueue(theSubQueue),
+  myImage(new StSubImage()),
+  myImageNext(new StSubImage()),
   myPTS(0.0),
-  myImgProgram(getRoot()->getShare(SHARE_IMAGE_PROGRAM_ID)) {
+  myImgProgram(getRoot()->getShare(SHARE_IMAGE_PROGRAM_ID)),
+  myPalProgram(getRoot()->getShare(SHARE_PALETTE_PROGRAM_ID)) {
     params.Place    = thePlace;
     params.FontSize = theFontSize;
     params.TopDY    = new StFloat32Param(100.0f);
@@ -208,7 +325,8 @@ StGLSubtitles::~StGLSubtitles() {
     StGLContext& aCtx = getContext();
     myFont->release(aCtx);
     myFont.nullify();
-    myTexture.release(aCtx);
+    myImage->release(aCtx);
+    myImageNext->release(aCtx);
     myVertBuf.release(aCtx);
     myTCrdBuf.release(aCtx);
 }
@@ -222,9 +340,13 @@ bool StGLSubtitles::stglInit() {
         myTCrdBuf.init(aCtx, aDummyVert);
 
         if(myImgProgram.isNull()) {
-            myImgProgram.create(getRoot()->getContextHandle(), new StImgProgram());
+            myImgProgram.create(getRoot()->getContextHandle(), new StImgProgram(false));
             myImgProgram->init(aCtx);
         }
+        if(myPalProgram.isNull()) {
+            myPalProgram.create(getRoot()->getContextHandle(), new StImgProgram(true));
+            myPalProgram->init(aCtx);
+        }
     }
     return StGLTextArea::stglInit();
 }
@@ -239,6 +361,9 @@ void StGLSubtitles::stglUpdate(const StPointD_t& ,
 
     const StGLVCorner aCorner = parseCorner(params.Place->getValue());
     bool toResize = myCorner.v != aCorner;
+    if(toResize) {
+        resetPreparedText(); // alignment is changed
+    }
     myCorner.v = aCorner;
     switch(myCorner.v) {
         case ST_VCORNER_TOP: {
@@ -279,10 +404,16 @@ void StGLSubtitles::stglUpdate(const StPointD_t& ,
     if(isChanged) {
         setText(myShowItems.Text);
 
-        if(!myShowItems.Image.isNull()) {
-            myTexture.init(aCtx, myShowItems.Image);
-        } else {
-            myTexture.release(aCtx);
+        if(myShowItems.ImageItem.isNull()) {
+            myImage->release(aCtx);
+        } else if(myShowItems.ImageItem == myImageNext->Item) {
+            // image has been uploaded ahead of time
+            const StHandle<StSubImage> anImage = myImage;
+            myImage     = myImageNext;
+            myImageNext = anImage;
+            myImageNext->Item.nullify();
+        } else if(myShowItems.ImageItem != myImage->Item) {
+            myImage->init(aCtx, myShowItems.ImageItem);
         }
 
         StString aLog;
@@ -300,6 +431,39 @@ void StGLSubtitles::stglUpdate(const StPointD_t& ,
 
         myFont->stglInit(aCtx, getFontSize(), myRoot->getResolution());
     }
+
+    if(!isChanged) {
+        // do not overload the frame which already activates new items
+        stglPrepareNext(aCtx);
+    }
+}
+
+void StGLSubtitles::stglPrepareNext(StGLContext& theCtx) {
+    const StHandle<StSubItem> aNextItem = myQueue->peek(myPTS);
+    if(aNextItem.isNull()) {
+        return;
+    }
+
+    if(!aNextItem->Image.isNull()
+    && myImageNext->Item != aNextItem
+    && myImage->Item     != aNextItem) {
+        myImageNext->init(theCtx, aNextItem);
+    }
+
+    if(!myIsInitialized
+    || !isVisible()) {
+        return;
+    }
+
+    if(myFormatter.getParser() != (StGLTextFormatter::Parser )params.Parser->getValue()) {
+        return; // parser will be changed by stglDraw()
+    }
+
+    const StString aText = myShowItems.predictText(*aNextItem);
+    if(!aText.isEmpty()
+    && !isPreparedText(aText)) {
+        prepareText(theCtx, aText);
+    }
 }
 
 void StGLSubtitles::stglDraw(unsigned int theView) {
@@ -311,6 +475,7 @@ void StGLSubtitles::stglDraw(unsigned int theView) {
     if(myFormatter.getParser() != (StGLTextFormatter::Parser )params.Parser->getValue()) {
         myFormatter.setupParser((StGLTextFormatter::Parser )params.Parser->getValue());
         myToRecompute = true;
+        resetPreparedText();
     }
     if(!myText.isEmpty()) {
         formatText(aCtx);
@@ -330,8 +495,9 @@ void StGLSubtitles::stglDraw(unsigned int theView) {
         StGLTextArea::stglDraw(theView);
     }
 
-    if(!myTexture.isValid()
-    || !myImgProgram->isValid()) {
+    StImgProgram& aProgram = myImage->isPalettized() ? *myPalProgram : *myImgProgram;
+    if(!myImage->Texture.isValid()
+    || !aProgram.isValid()) {
         return;
     }
 
@@ -383,7 +549,7 @@ void StGLSubtitles::stglDraw(unsigned int theView) {
     }
 
     // update vertices
-    StVec2<int> anImgSize (myTexture.getSizeX(), myTexture.getSizeY()), anOffset (0, 0);
+    StVec2<int> anImgSize (myImage->Texture.getSizeX(), myImage->Texture.getSizeY()), anOffset (0, 0);
     StArray<StGLVec2> aVertices(4), aTexCoords(4);
     aTexCoords[0] = StGLVec2(1.0f, 0.0f);
     aTexCoords[1] = StGLVec2(1.0f, 1.0f);
@@ -394,14 +560,14 @@ void StGLSubtitles::stglDraw(unsigned int theView) {
     } else {
         anImgSize.y() = int(double(anImgSize.y()) / aSampleRatio);
     }
-    const double aFontScale = double(getRoot()->getScale()) * myShowItems.Scale * params.FontSize->getValue() / params.FontSize->getDefValue();
+    const double aFontScale = double(getRoot()->getScale()) * myImage->Item->Scale * params.FontSize->getValue() / params.FontSize->getDefValue();
     anImgSize.x() = int(double(anImgSize.x()) * aFontScale);
     anImgSize.y() = int(double(anImgSize.y()) * aFontScale);
 
     switch(aStFormat) {
         case StFormat_SideBySide_LR: {
             anImgSize.x() /= 2;
-            const int anOffsetX = int(aFontScale * ((aFrameDims.x() * 2 - myTexture.getSizeX()) / 2));
+            const int anOffsetX = int(aFontScale * ((aFrameDims.x() * 2 - myImage->Texture.getSizeX()) / 2));
             if(aView == ST_DRAW_LEFT) {
                 aTexCoords[0].x() = aTexCoords[1].x() = 0.5f;
                 aTexCoords[2].x() = aTexCoords[3].x() = 0.0f;
@@ -415,7 +581,7 @@ void StGLSubtitles::stglDraw(unsigned int theView) {
         }
         case StFormat_TopBottom_LR: {
             anImgSize.y() /= 2;
-            const int anOffsetY = int(aFontScale * ((aFrameDims.y() * 2 - myTexture.getSizeY()) / 2));
+            const int anOffsetY = int(aFontScale * ((aFrameDims.y() * 2 - myImage->Texture.getSizeY()) / 2));
             if(aView == ST_DRAW_LEFT) {
                 aTexCoords[0].y() = aTexCoords[2].y() = 0.0f;
                 aTexCoords[1].y() = aTexCoords[3].y() = 0.5f;
@@ -447,21 +613,30 @@ void StGLSubtitles::stglDraw(unsigned int theView) {
     myTCrdBuf.init(aCtx, aTexCoords);
 
     aCtx.core20fwd->glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    aCtx.core20fwd->glEnable(GL_BLEND);
-    myTexture.bind(aCtx);
-    myImgProgram->use(aCtx);
+    aCtx.stglSetBlend(true);
+    myImage->Texture.bind(aCtx);
+    if(myImage->isPalettized()) {
+        myImage->Palette.bind(aCtx, GL_TEXTURE1);
+    }
+    aProgram.use(aCtx);
+    if(myImage->isPalettized()) {
+        aProgram.setTexSize(aCtx, StGLVec2(GLfloat(myImage->Texture.getSizeX()), GLfloat(myImage->Texture.getSizeY())));
+    }
 
-    myVertBuf.bindVertexAttrib(aCtx, myImgProgram->getVVertexLoc());
-    myTCrdBuf.bindVertexAttrib(aCtx, myImgProgram->getVTexCoordLoc());
+    myVertBuf.bindVertexAttrib(aCtx, aProgram.getVVertexLoc());
+    myTCrdBuf.bindVertexAttrib(aCtx, aProgram.getVTexCoordLoc());
 
     aCtx.core20fwd->glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
 
-    myTCrdBuf.unBindVertexAttrib(aCtx, myImgProgram->getVTexCoordLoc());
-    myVertBuf.unBindVertexAttrib(aCtx, myImgProgram->getVVertexLoc());
+    myTCrdBuf.unBindVertexAttrib(aCtx, aProgram.getVTexCoordLoc());
+    myVertBuf.unBindVertexAttrib(aCtx, aProgram.getVVertexLoc());
 
-    myImgProgram->unuse(aCtx);
-    myTexture.unbind(aCtx);
-    aCtx.core20fwd->glDisable(GL_BLEND);
+    aProgram.unuse(aCtx);
+    if(myImage->isPalettized()) {
+        myImage->Palette.unbind(aCtx);
+    }
+    myImage->Texture.unbind(aCtx);
+    aCtx.stglSetBlend(false);
 }
 
 void StGLSubtitles::stglResize() {
@@ -471,12 +646,17 @@ void StGLSubtitles::stglResize() {
     StGLTextArea::stglResize();
 
     // update projection matrix
+    StGLContext& aCtx = getContext();
     if(!myImgProgram.isNull()) {
-        StGLContext& aCtx = getContext();
         myImgProgram->use(aCtx);
         myImgProgram->setProjMat(aCtx, getRoot()->getScreenProjection());
         myImgProgram->unuse(aCtx);
     }
+    if(!myPalProgram.isNull()) {
+        myPalProgram->use(aCtx);
+        myPalProgram->setProjMat(aCtx, getRoot()->getScreenProjection());
+        myPalProgram->unuse(aCtx);
+    }
 }
 
 const StHandle<StSubQueue>& StGLSubtitles::getQueue() const {
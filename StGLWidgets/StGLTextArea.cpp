@@ -45,6 +45,10 @@ StGLTextArea::~StGLTextArea() {
         myTextVertBuf[anIter]->release(aCtx);
         myTextTCrdBuf[anIter]->release(aCtx);
     }
+    for(size_t anIter = 0; anIter < myPrepared.VertBufs.size(); ++anIter) {
+        myPrepared.VertBufs[anIter]->release(aCtx);
+        myPrepared.TCrdBufs[anIter]->release(aCtx);
+    }
 
     myBorderIVertBuf.release(aCtx);
     myBorderOVertBuf.release(aCtx);
@@ -217,29 +221,68 @@ void StGLTextArea::recomputeBorder(StGLContext& theCtx) {
     myBorderOVertBuf.init(theCtx, 4, 4, quadVerticesOuter);
 }
 
+void StGLTextArea::prepareText(StGLContext&    theCtx,
+                               const StString& theText) {
+    myPrepared.IsValid    = false;
+    myPrepared.Text       = theText;
+    myPrepared.TextWidth  = myTextWidth;
+    myPrepared.RectHeight = getRectPx().height();
+    myPrepared.Size       = mySize;
+
+    myFormatter.reset();
+    myFormatter.append(theCtx, theText, *myFont);
+    myFormatter.format(myTextWidth, GLfloat(getRectPx().height()));
+    myFormatter.getResult(theCtx, myPrepared.Textures, myPrepared.VertBufs, myPrepared.TCrdBufs);
+    myFormatter.getBndBox(myPrepared.BndBox);
+    myPrepared.IsValid = true;
+}
+
 void StGLTextArea::formatText(StGLContext& theCtx) {
-    if(myToRecompute) {
-        myFormatter.reset();
-        myFormatter.append(theCtx, myText, *myFont);
-        myFormatter.format(myTextWidth, GLfloat(getRectPx().height()));
-        myFormatter.getResult(theCtx, myTexturesList, myTextVertBuf, myTextTCrdBuf);
-        myFormatter.getBndBox(myTextBndBox);
+    if(!myToRecompute) {
+        return;
+    }
+
+    if(myPrepared.IsValid
+    && myPrepared.Text       == myText
+    && myPrepared.TextWidth  == myTextWidth
+    && myPrepared.RectHeight == getRectPx().height()
+    && myPrepared.Size       == mySize) {
+        // swap with the text formatted ahead of time, previous VBOs will be reused by the next prepareText()
+        myTexturesList.swap(myPrepared.Textures);
+        const StArrayList< StHandle<StGLVertexBuffer> > aVertBufs = myTextVertBuf;
+        const StArrayList< StHandle<StGLVertexBuffer> > aTCrdBufs = myTextTCrdBuf;
+        myTextVertBuf = myPrepared.VertBufs;
+        myTextTCrdBuf = myPrepared.TCrdBufs;
+        myPrepared.VertBufs = aVertBufs;
+        myPrepared.TCrdBufs = aTCrdBufs;
+        myTextBndBox = myPrepared.BndBox;
+        myPrepared.IsValid = false;
         if(myToShowBorder) {
             recomputeBorder(theCtx);
         }
         myToRecompute = false;
+        return;
+    }
+
+    myFormatter.reset();
+    myFormatter.append(theCtx, myText, *myFont);
+    myFormatter.format(myTextWidth, GLfloat(getRectPx().height()));
+    myFormatter.getResult(theCtx, myTexturesList, myTextVertBuf, myTextTCrdBuf);
+    myFormatter.getBndBox(myTextBndBox);
+    if(myToShowBorder) {
+        recomputeBorder(theCtx);
     }
+    myToRecompute = false;
 }
 
 void StGLTextArea::drawText(StGLContext& theCtx) {
-    theCtx.core20fwd->glActiveTexture(GL_TEXTURE0);
     StGLTextProgram& aProgram = myRoot->getTextProgram();
     for(size_t aTextureIter = 0; aTextureIter < myTexturesList.size(); ++aTextureIter) {
         if(!myTextVertBuf[aTextureIter]->isValid() || myTextVertBuf[aTextureIter]->getElemsCount() < 1) {
             continue;
         }
 
-        theCtx.core20fwd->glBindTexture(GL_TEXTURE_2D, myTexturesList[aTextureIter]);
+        theCtx.stglBindTexture(GL_TEXTURE0, GL_TEXTURE_2D, myTexturesList[aTextureIter]);
 
         myTextVertBuf[aTextureIter]->bindVertexAttrib(theCtx, aProgram.getVVertexLoc());
         myTextTCrdBuf[aTextureIter]->bindVertexAttrib(theCtx, aProgram.getVTexCoordLoc());
@@ -249,7 +292,7 @@ void StGLTextArea::drawText(StGLContext& theCtx) {
         myTextTCrdBuf[aTextureIter]->unBindVertexAttrib(theCtx, aProgram.getVTexCoordLoc());
         myTextVertBuf[aTextureIter]->unBindVertexAttrib(theCtx, aProgram.getVVertexLoc());
     }
-    theCtx.core20fwd->glBindTexture(GL_TEXTURE_2D, 0);
+    theCtx.stglBindTexture(GL_TEXTURE0, GL_TEXTURE_2D, 0);
 }
 
 void StGLTextArea::stglDraw(unsigned int theView) {
@@ -275,7 +318,7 @@ void StGLTextArea::stglDraw(unsigned int theView) {
     const GLfloat aSizeOut = 2.0f * GLfloat(aZParams.top()) / GLfloat(getRoot()->getRootFullSizeY());
 
     aCtx.core20fwd->glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    aCtx.core20fwd->glEnable(GL_BLEND);
+    aCtx.stglSetBlend(true);
 
     // draw borders
     if(myToShowBorder) {
@@ -303,7 +346,7 @@ void StGLTextArea::stglDraw(unsigned int theView) {
     }
 
     // draw text
-    aCtx.core20fwd->glActiveTexture(GL_TEXTURE0); // our shader is bound to first texture unit
+    aCtx.stglActiveTexture(GL_TEXTURE0); // our shader is bound to first texture unit
     StGLTextProgram& aTextProgram = myRoot->getTextProgram();
     aTextProgram.use(aCtx);
         aTextProgram.setDisplacement(aCtx,
@@ -329,7 +372,7 @@ void StGLTextArea::stglDraw(unsigned int theView) {
 
     aTextProgram.unuse(aCtx);
 
-    aCtx.core20fwd->glDisable(GL_BLEND);
+    aCtx.stglSetBlend(false);
 
     StGLWidget::stglDraw(theView);
 }
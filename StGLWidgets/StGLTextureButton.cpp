@@ -13,7 +13,6 @@
 #include <StGL/StGLContext.h>
 #include <StGLCore/StGLCore20.h>
 
-#include <StAV/StAVImage.h>
 #include <StSlots/StAction.h>
 #include <StThreads/StProcess.h>
 
@@ -321,6 +320,7 @@ void StGLTextureButton::setTexturePath(const StString* theTexturesPaths,
 #endif
     for(size_t aTexIter = 0; aTexIter < aNbTextures; ++aTexIter) {
         myTextures->changeValue(aTexIter).setName(theTexturesPaths[aTexIter]);
+        getRoot()->prefetchIcon(theTexturesPaths[aTexIter]);
     }
 }
 
@@ -388,34 +388,22 @@ bool StGLTextureButton::stglInit() {
             continue;
         }
 
-        StHandle<StResource> aRes = aResMgr->getResource(aTexture.getName());
-        if(aRes.isNull()) {
-            ST_DEBUG_LOG("StGLTextureButton, texture '" + aTexture.getName() + "' not found");
-            continue;
-        }
-
-        uint8_t* aData     = NULL;
-        int      aDataSize = 0;
-        if(!aRes->isFile()
-         && aRes->read()) {
-            aData     = (uint8_t* )aRes->getData();
-            aDataSize = aRes->getSize();
-        }
-
-        StAVImage anImage;
-        if(!anImage.load(aRes->getPath(), StImageFile::ST_TYPE_PNG, aData, aDataSize)) {
-            ST_DEBUG_LOG(anImage.getState());
-            continue;
+        StHandle<StImageFile> anImage = getRoot()->getPrefetchedIcon(aTexture.getName());
+        if(anImage.isNull()) {
+            anImage = StGLRootWidget::loadIcon(aResMgr, aTexture.getName());
+            if(anImage.isNull()) {
+                continue;
+            }
         }
 
         GLint anInternalFormat = GL_RGB;
-        if(!StGLTexture::getInternalFormat(aCtx, anImage.getPlane().getFormat(), anInternalFormat)) {
+        if(!StGLTexture::getInternalFormat(aCtx, anImage->getPlane().getFormat(), anInternalFormat)) {
             ST_ERROR_LOG("StGLTextureButton, texture '" + aTexture.getName() + "' has unsupported format!");
             continue;
         }
 
         aTexture.setTextureFormat(anInternalFormat);
-        aTexture.init(aCtx, anImage.getPlane());
+        aTexture.init(aCtx, anImage->getPlane());
     }
 
     const StGLNamedTexture& aTexture = myTextures->getValue(myFaceId);
@@ -505,7 +493,7 @@ void StGLTextureButton::stglDraw(unsigned int ) {
 
     StGLContext& aCtx = getContext();
     aCtx.core20fwd->glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    aCtx.core20fwd->glEnable(GL_BLEND);
+    aCtx.stglSetBlend(true);
     aTexture.bind(aCtx);
 
     const StRectD_t  aRectGl  = getRectGl();
@@ -534,7 +522,7 @@ void StGLTextureButton::stglDraw(unsigned int ) {
 
     aProgram->unuse(aCtx);
     aTexture.unbind(aCtx);
-    aCtx.core20fwd->glDisable(GL_BLEND);
+    aCtx.stglSetBlend(false);
 }
 
 bool StGLTextureButton::tryClick(const StClickEvent& theEvent,
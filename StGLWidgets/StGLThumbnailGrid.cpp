@@ -0,0 +1,452 @@
+/**
+ * StGLWidgets, small C++ toolkit for writing GUI using OpenGL.
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * This code is licensed under MIT license (see docs/license-mit.txt for details).
+ */
+
+#include <StGLWidgets/StGLThumbnailGrid.h>
+
+#include <StGLWidgets/StGLRootWidget.h>
+#include <StGLWidgets/StGLTextArea.h>
+#include <StGL/StGLProgram.h>
+#include <StGL/StGLContext.h>
+#include <StGLCore/StGLCore20.h>
+#include <StCore/StEvent.h>
+#include <StThreads/StResourceManager.h>
+
+class StGLThumbnailGrid::StProgramGrid : public StGLProgram {
+
+        public:
+
+    StProgramGrid() : StGLProgram("StGLThumbnailGrid"), myDispX(0.0f) {}
+
+    StGLVarLocation getVVertexLoc()   const { return StGLVarLocation(0); }
+    StGLVarLocation getVTexCoordLoc() const { return StGLVarLocation(1); }
+
+    void setProjMat(StGLContext&      theCtx,
+                    const StGLMatrix& theProjMat) {
+        theCtx.core20fwd->glUniformMatrix4fv(uniProjMatLoc, 1, GL_FALSE, theProjMat);
+    }
+
+    using StGLProgram::use;
+    void use(StGLContext&  theCtx,
+             const GLfloat theOpacityValue,
+             const GLfloat theDispX) {
+        StGLProgram::use(theCtx);
+        theCtx.core20fwd->glUniform1f(uniOpacityLoc, theOpacityValue);
+        if(!stAreEqual(myDispX, theDispX, 0.0001f)) {
+            myDispX = theDispX;
+            theCtx.core20fwd->glUniform4fv(uniDispLoc,  1, StGLVec4(theDispX, 0.0f, 0.0f, 0.0f));
+        }
+    }
+
+    virtual bool init(StGLContext& theCtx) ST_ATTR_OVERRIDE {
+        const char VERTEX_SHADER[] =
+           "uniform mat4 uProjMat;\n"
+           "uniform vec4 uDisp;\n"
+           "attribute vec4 vVertex;\n"
+           "attribute vec2 vTexCoord;\n"
+           "varying   vec2 fTexCoord;\n"
+           "void main(void) {\n"
+           "    fTexCoord = vTexCoord;\n"
+           "    gl_Position = uProjMat * (vVertex + uDisp);\n"
+           "}\n";
+
+        const char FRAGMENT_SHADER[] =
+           "uniform sampler2D uTexture;\n"
+           "uniform float     uOpacity;\n"
+           "varying vec2      fTexCoord;\n"
+           "void main(void) {\n"
+           "    gl_FragColor = vec4(texture2D(uTexture, fTexCoord).rgb, uOpacity);\n"
+           "}\n";
+
+        StGLVertexShader aVertexShader(StGLProgram::getTitle());
+        StGLAutoRelease aTmp1(theCtx, aVertexShader);
+        aVertexShader.init(theCtx, VERTEX_SHADER);
+
+        StGLFragmentShader aFragmentShader(StGLProgram::getTitle());
+        StGLAutoRelease aTmp2(theCtx, aFragmentShader);
+        aFragmentShader.init(theCtx, FRAGMENT_SHADER);
+        if(!StGLProgram::create(theCtx)
+           .attachShader(theCtx, aVertexShader)
+           .attachShader(theCtx, aFragmentShader)
+           .bindAttribLocation(theCtx, "vVertex",   getVVertexLoc())
+           .bindAttribLocation(theCtx, "vTexCoord", getVTexCoordLoc())
+           .link(theCtx)) {
+            return false;
+        }
+
+        StGLVarLocation uniTextureLoc = StGLProgram::getUniformLocation(theCtx, "uTexture");
+        if(uniTextureLoc.isValid()) {
+            StGLProgram::use(theCtx);
+            theCtx.core20fwd->glUniform1i(uniTextureLoc, StGLProgram::TEXTURE_SAMPLE_0);
+            StGLProgram::unuse(theCtx);
+        }
+
+        uniProjMatLoc = StGLProgram::getUniformLocation(theCtx, "uProjMat");
+        uniDispLoc    = StGLProgram::getUniformLocation(theCtx, "uDisp");
+        uniOpacityLoc = StGLProgram::getUniformLocation(theCtx, "uOpacity");
+        return uniProjMatLoc.isValid()
+            && uniTextureLoc.isValid()
+            && uniOpacityLoc.isValid();
+    }
+
+        private:
+
+    GLfloat         myDispX;
+    StGLVarLocation uniProjMatLoc;
+    StGLVarLocation uniDispLoc;
+    StGLVarLocation uniOpacityLoc;
+
+};
+
+StGLThumbnailGrid::StGLThumbnailGrid(StGLWidget*      theParent,
+                                     const int        theLeft,  const int theTop,
+                                     const StGLCorner theCorner,
+                                     const int        theWidth, const int theHeight)
+: StGLWidget(theParent, theLeft, theTop, theCorner, theWidth, theHeight),
+  myProgram(new StProgramGrid()),
+  myAtlas(GL_RGB8),
+  myNbItems(0),
+  myFirstItem(0),
+  myScrollY(0),
+  myScrollYAccum(0.0f),
+  myCellSizeX(myRoot->scale(THUMB_SIZE + 8)),
+  myCellSizeY(myRoot->scale(THUMB_SIZE + 28)),
+  myNbColumns(1),
+  myFrame(0) {
+    StGLWidget::signals.onMouseUnclick.connect(this, &StGLThumbnailGrid::doMouseUnclick);
+}
+
+StGLThumbnailGrid::~StGLThumbnailGrid() {
+    // stop generation before releasing GL resources
+    myCache.nullify();
+
+    StGLContext& aCtx = getContext();
+    if(!myProgram.isNull()) {
+        myProgram->release(aCtx);
+    }
+    myAtlas.release(aCtx);
+    myVertBuf.release(aCtx);
+    myTCrdBuf.release(aCtx);
+}
+
+void StGLThumbnailGrid::setNbItems(const size_t theNbItems,
+                                   const bool   theToReset) {
+    myNbItems = theNbItems;
+    if(theToReset) {
+        myScrollY = 0;
+        if(!myCache.isNull()) {
+            myCache->cancelPending();
+        }
+        for(size_t aCellIter = 0; aCellIter < myCells.size(); ++aCellIter) {
+            myCells[aCellIter].IsBound = false;
+        }
+    }
+    updateLayout();
+}
+
+void StGLThumbnailGrid::setItem(const size_t    theIndex,
+                                const StString& theLabel,
+                                const StString& theFilePath) {
+    if(theIndex <  myFirstItem
+    || theIndex >= myFirstItem + myCells.size()) {
+        return;
+    }
+
+    Cell& aCell = myCells[theIndex - myFirstItem];
+    aCell.FilePath = theFilePath;
+    aCell.IsBound  = true;
+    aCell.Label->setText(theLabel);
+    if(!theFilePath.isEmpty()
+    && !myCache.isNull()
+    && mySlotsMap.find(theFilePath) == mySlotsMap.end()) {
+        myCache->request(theFilePath);
+    }
+}
+
+void StGLThumbnailGrid::updateLayout() {
+    const int aSizeY = stMax(getRectPx().height(), 1);
+    myNbColumns = stMax(getRectPx().width() / myCellSizeX, 1);
+
+    const size_t aNbRowsAll = (myNbItems + size_t(myNbColumns) - 1) / size_t(myNbColumns);
+    const int    aScrollMax = stMax(int(aNbRowsAll) * myCellSizeY - aSizeY, 0);
+    myScrollY = stClamp(myScrollY, 0, aScrollMax);
+
+    // cells are recycled, only visible rows (plus partially visible) are allocated
+    const size_t aNbCells = size_t(aSizeY / myCellSizeY + 2) * size_t(myNbColumns);
+    while(myCells.size() > aNbCells) {
+        delete myCells.back().Label;
+        myCells.pop_back();
+    }
+    while(myCells.size() < aNbCells) {
+        Cell aCell;
+        aCell.IsBound = false;
+        aCell.Label   = new StGLTextArea(this, 0, 0, StGLCorner(ST_VCORNER_TOP, ST_HCORNER_LEFT),
+                                         myCellSizeX, myCellSizeY - myRoot->scale(THUMB_SIZE));
+        aCell.Label->setupAlignment(StGLTextFormatter::ST_ALIGN_X_CENTER,
+                                    StGLTextFormatter::ST_ALIGN_Y_TOP);
+        aCell.Label->setTextColor(StGLVec4(1.0f, 1.0f, 1.0f, 1.0f));
+        aCell.Label->setTextWidth(myCellSizeX);
+        if(myAtlas.isValid()) {
+            // grid has been already initialized
+            aCell.Label->stglInit();
+        }
+        myCells.push_back(aCell);
+    }
+
+    const size_t aFirstItem = size_t(myScrollY / myCellSizeY) * size_t(myNbColumns);
+    if(aFirstItem != myFirstItem) {
+        myFirstItem = aFirstItem;
+        for(size_t aCellIter = 0; aCellIter < myCells.size(); ++aCellIter) {
+            myCells[aCellIter].IsBound = false;
+        }
+    }
+
+    for(size_t aCellIter = 0; aCellIter < myCells.size(); ++aCellIter) {
+        Cell& aCell = myCells[aCellIter];
+        const size_t anIndex = myFirstItem + aCellIter;
+        if(!aCell.IsBound
+        || anIndex >= myNbItems) {
+            aCell.FilePath.clear();
+            aCell.Label->setText("");
+        }
+
+        const int aCol = int(anIndex % size_t(myNbColumns));
+        const int aRow = int(anIndex / size_t(myNbColumns));
+        aCell.Label->changeRectPx().moveTopLeftTo(aCol * myCellSizeX,
+                                                  aRow * myCellSizeY - myScrollY + myRoot->scale(THUMB_SIZE));
+    }
+}
+
+bool StGLThumbnailGrid::stglInit() {
+    if(myCache.isNull()) {
+        const StHandle<StResourceManager>& aResMgr = myRoot->getResourceManager();
+        myCache = new StThumbnailCache(!aResMgr.isNull() ? aResMgr->getCacheFolder() : StString(),
+                                       THUMB_SIZE, THUMB_SIZE);
+    }
+
+    updateLayout(); // labels are initialized by StGLWidget::stglInit()
+    StGLContext& aCtx = getContext();
+    if(!myAtlas.isValid()) {
+        myAtlas.initTrash(aCtx, ATLAS_SIZE, ATLAS_SIZE);
+        myAtlas.setMinMagFilter(aCtx, GL_LINEAR);
+    }
+    if(!myProgram->isValid()
+    && !myProgram->init(aCtx)) {
+        return false;
+    }
+
+    if(!StGLWidget::stglInit()) {
+        return false;
+    }
+    stglResize();
+    return true;
+}
+
+void StGLThumbnailGrid::stglResize() {
+    StGLWidget::stglResize();
+    updateLayout();
+
+    StGLContext& aCtx = getContext();
+    if(myProgram->isValid()) {
+        myProgram->use(aCtx);
+        myProgram->setProjMat(aCtx, getRoot()->getScreenProjection());
+        myProgram->unuse(aCtx);
+    }
+}
+
+int StGLThumbnailGrid::allocateSlot() {
+    const int aNbSlots = (ATLAS_SIZE / THUMB_SIZE) * (ATLAS_SIZE / THUMB_SIZE);
+    if(int(mySlots.size()) < aNbSlots) {
+        mySlots.push_back(Slot());
+        return int(mySlots.size()) - 1;
+    }
+
+    // reuse least recently drawn slot
+    int aSlotId = 0;
+    for(int aSlotIter = 1; aSlotIter < aNbSlots; ++aSlotIter) {
+        if(mySlots[aSlotIter].LastUse < mySlots[aSlotId].LastUse) {
+            aSlotId = aSlotIter;
+        }
+    }
+    mySlotsMap.erase(mySlots[aSlotId].FilePath);
+    return aSlotId;
+}
+
+void StGLThumbnailGrid::stglUploadThumbnails() {
+    if(myCache.isNull()
+    || !myAtlas.isValid()) {
+        return;
+    }
+
+    StGLContext& aCtx = getContext();
+    StString aFilePath;
+    StHandle<StImagePlane> aThumb;
+    for(int aNbUploads = 0; aNbUploads < UPLOADS_MAX && myCache->popReady(aFilePath, aThumb);) {
+        if(aThumb.isNull()
+        || aThumb->getFormat() != StImagePlane::ImgRGB
+        || mySlotsMap.find(aFilePath) != mySlotsMap.end()) {
+            continue;
+        }
+
+        // thumbnails of items scrolled away are dropped (they will be read from disk cache when needed)
+        bool isVisible = false;
+        for(size_t aCellIter = 0; aCellIter < myCells.size(); ++aCellIter) {
+            if(myCells[aCellIter].FilePath == aFilePath) {
+                isVisible = true;
+                break;
+            }
+        }
+        if(!isVisible) {
+            continue;
+        }
+
+        const int aSlotId = allocateSlot();
+        Slot& aSlot = mySlots[aSlotId];
+        aSlot.FilePath = aFilePath;
+        aSlot.SizeX    = stMin((int )aThumb->getSizeX(), (int )THUMB_SIZE);
+        aSlot.SizeY    = stMin((int )aThumb->getSizeY(), (int )THUMB_SIZE);
+        aSlot.LastUse  = myFrame;
+        mySlotsMap[aFilePath] = aSlotId;
+
+        const int aNbSlotsX = ATLAS_SIZE / THUMB_SIZE;
+        myAtlas.bind(aCtx);
+        aCtx.core20fwd->glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        aCtx.core20fwd->glTexSubImage2D(GL_TEXTURE_2D, 0,
+                                        (aSlotId % aNbSlotsX) * THUMB_SIZE, (aSlotId / aNbSlotsX) * THUMB_SIZE,
+                                        aSlot.SizeX, aSlot.SizeY,
+                                        GL_RGB, GL_UNSIGNED_BYTE, aThumb->getData());
+        myAtlas.unbind(aCtx);
+        ++aNbUploads;
+    }
+}
+
+void StGLThumbnailGrid::stglDraw(unsigned int theView) {
+    if(!isVisible()) {
+        return;
+    }
+
+    StGLContext& aCtx = getContext();
+    if(myIsResized) {
+        stglResize();
+    }
+    if(theView != ST_DRAW_RIGHT) {
+        ++myFrame;
+        stglUploadThumbnails();
+    }
+
+    const StRectI_t aRectPx   = getRectPxAbsolute();
+    const int       aThumbPx  = myRoot->scale(THUMB_SIZE);
+    const int       aNbSlotsX = ATLAS_SIZE / THUMB_SIZE;
+    const GLfloat   aTexScale = 1.0f / GLfloat(ATLAS_SIZE);
+    StArray<StGLVec2> aVertices(myCells.size() * 6), aTexCoords(myCells.size() * 6), aQuad(4);
+    size_t aNbVerts = 0;
+    for(size_t aCellIter = 0; aCellIter < myCells.size(); ++aCellIter) {
+        const Cell& aCell = myCells[aCellIter];
+        std::map<StString, int>::const_iterator aSlotIter = !aCell.FilePath.isEmpty()
+                                                          ? mySlotsMap.find(aCell.FilePath)
+                                                          : mySlotsMap.end();
+        if(aSlotIter == mySlotsMap.end()) {
+            continue;
+        }
+
+        Slot& aSlot = mySlots[aSlotIter->second];
+        aSlot.LastUse = myFrame;
+
+        // fit the thumbnail into the cell
+        const size_t anIndex = myFirstItem + aCellIter;
+        const int aSizeX = myRoot->scale(aSlot.SizeX);
+        const int aSizeY = myRoot->scale(aSlot.SizeY);
+        StRectI_t aRect;
+        aRect.left()   = aRectPx.left() + int(anIndex % size_t(myNbColumns)) * myCellSizeX + (myCellSizeX - aSizeX) / 2;
+        aRect.top()    = aRectPx.top()  + int(anIndex / size_t(myNbColumns)) * myCellSizeY - myScrollY + (aThumbPx - aSizeY) / 2;
+        aRect.right()  = aRect.left() + aSizeX;
+        aRect.bottom() = aRect.top()  + aSizeY;
+        myRoot->getRectGl(aRect, aQuad);
+
+        const GLfloat aTexLeft   = GLfloat((aSlotIter->second % aNbSlotsX) * THUMB_SIZE) * aTexScale;
+        const GLfloat aTexTop    = GLfloat((aSlotIter->second / aNbSlotsX) * THUMB_SIZE) * aTexScale;
+        const GLfloat aTexRight  = aTexLeft + GLfloat(aSlot.SizeX) * aTexScale;
+        const GLfloat aTexBottom = aTexTop  + GLfloat(aSlot.SizeY) * aTexScale;
+
+        // two triangles from strip order (top-right, bottom-right, top-left, bottom-left)
+        const StGLVec2 aTexQuad[4] = {
+            StGLVec2(aTexRight, aTexTop), StGLVec2(aTexRight, aTexBottom),
+            StGLVec2(aTexLeft,  aTexTop), StGLVec2(aTexLeft,  aTexBottom)
+        };
+        static const int THE_TRIS[6] = { 0, 1, 2, 2, 1, 3 };
+        for(int aVertIter = 0; aVertIter < 6; ++aVertIter, ++aNbVerts) {
+            aVertices .changeValue(aNbVerts) = aQuad[THE_TRIS[aVertIter]];
+            aTexCoords.changeValue(aNbVerts) = aTexQuad[THE_TRIS[aVertIter]];
+        }
+    }
+
+    StGLBoxPx aScissorRect;
+    stglScissorRect2d(aScissorRect);
+    aCtx.stglSetScissorRect(aScissorRect, true);
+
+    if(aNbVerts > 0
+    && myProgram->isValid()) {
+        myVertBuf.init(aCtx, 2, GLsizei(aNbVerts), aVertices.getFirst().getData());
+        myTCrdBuf.init(aCtx, 2, GLsizei(aNbVerts), aTexCoords.getFirst().getData());
+
+        aCtx.core20fwd->glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        aCtx.stglSetBlend(true);
+        myAtlas.bind(aCtx);
+        myProgram->use(aCtx, myOpacity, myRoot->getScreenDispX());
+
+        myVertBuf.bindVertexAttrib(aCtx, myProgram->getVVertexLoc());
+        myTCrdBuf.bindVertexAttrib(aCtx, myProgram->getVTexCoordLoc());
+
+        aCtx.core20fwd->glDrawArrays(GL_TRIANGLES, 0, GLsizei(aNbVerts));
+
+        myTCrdBuf.unBindVertexAttrib(aCtx, myProgram->getVTexCoordLoc());
+        myVertBuf.unBindVertexAttrib(aCtx, myProgram->getVVertexLoc());
+
+        myProgram->unuse(aCtx);
+        myAtlas.unbind(aCtx);
+        aCtx.stglSetBlend(false);
+    }
+
+    StGLWidget::stglDraw(theView); // draw labels
+    aCtx.stglResetScissorRect();
+}
+
+bool StGLThumbnailGrid::doScroll(const StScrollEvent& theEvent) {
+    if(!isVisibleAndPointIn(StPointD_t(theEvent.PointX, theEvent.PointY))) {
+        return false;
+    }
+
+    myScrollYAccum += theEvent.DeltaY * 20.0f;
+    const int aDeltaY = (int )myScrollYAccum;
+    if(aDeltaY != 0) {
+        myScrollYAccum -= float(aDeltaY);
+        const int aDeltaScaled = myRoot->scale(std::abs(aDeltaY));
+        myScrollY -= aDeltaY > 0 ? aDeltaScaled : -aDeltaScaled;
+        updateLayout();
+    }
+    return true;
+}
+
+void StGLThumbnailGrid::doMouseUnclick(const int theBtnId) {
+    if(theBtnId != ST_MOUSE_LEFT) {
+        return;
+    }
+
+    const StPointD_t aCursor = myRoot->getCursorZo();
+    const StRectI_t  aRectPx = getRectPxAbsolute();
+    const int aPntX = int(aCursor.x() * double(myRoot->getRectPx().width()))  + myRoot->getRectPx().left() - aRectPx.left();
+    const int aPntY = int(aCursor.y() * double(myRoot->getRectPx().height())) + myRoot->getRectPx().top()  - aRectPx.top() + myScrollY;
+    if(aPntX < 0
+    || aPntY < 0
+    || aPntX >= myNbColumns * myCellSizeX) {
+        return;
+    }
+
+    const size_t anIndex = size_t(aPntY / myCellSizeY) * size_t(myNbColumns) + size_t(aPntX / myCellSizeX);
+    if(anIndex < myNbItems) {
+        signals.onItemClick(anIndex);
+    }
+}
@@ -1,6 +1,6 @@
 /**
  * StGLWidgets, small C++ toolkit for writing GUI using OpenGL.
- * Copyright © 2010-2014 Kirill Gavrilov <kirill@sview.ru>
+ * Copyright © 2010-2026 Kirill Gavrilov <kirill@sview.ru>
  *
  * This code is licensed under MIT license (see docs/license-mit.txt for details).
  */
@@ -62,6 +62,19 @@ StHandle<StSubItem> StSubQueue::pop(const double thePTS) {
     return StHandle<StSubItem>();
 }
 
+StHandle<StSubItem> StSubQueue::peek(const double thePTS) {
+    myMutex.lock();
+    for(QueueItem* anItem = myFront; anItem != NULL; anItem = anItem->myNext) {
+        if(anItem->myItem->TimeEnd >= thePTS) {
+            StHandle<StSubItem> aSubItem = anItem->myItem;
+            myMutex.unlock();
+            return aSubItem;
+        }
+    }
+    myMutex.unlock();
+    return StHandle<StSubItem>();
+}
+
 void StSubQueue::push(const StHandle<StSubItem>& theSubItem) {
     myMutex.lock();
     QueueItem* anItem = new QueueItem(theSubItem);
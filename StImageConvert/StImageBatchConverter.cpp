@@ -0,0 +1,590 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StImageConvert program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StImageConvert program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StImageBatchConverter.h"
+
+#include <StAV/StAVImage.h>
+#include <StFile/StFileNode.h>
+#include <StFile/StMIME.h>
+#include <StGL/StGLDeviceCaps.h>
+#include <StGL/StParams.h>
+#include <StGLStereo/StGLTextureData.h>
+#include <StGLStereo/StGLTextureUploadParams.h>
+#include <StImage/StImageKernels.h>
+#include <StImage/StJpegParser.h>
+#include <StThreads/StProfiler.h>
+#include <StThreads/StTimer.h>
+
+#include <vector>
+
+namespace {
+
+    /**
+     * Emulate device supporting all image formats and row unpacking,
+     * so that StGLTextureData splits stereo pair without copying.
+     */
+    static StGLDeviceCaps headlessDeviceCaps() {
+        StGLDeviceCaps aDevCaps;
+        for(int aFormatIter = 0; aFormatIter < StImagePlane::ImgNB; ++aFormatIter) {
+            aDevCaps.setSupportedFormat(StImagePlane::ImgFormat(aFormatIter), true);
+        }
+        aDevCaps.hasUnpack = true;
+        return aDevCaps;
+    }
+
+    /**
+     * Return true if both views have the same dimensions.
+     */
+    static bool isSameSize(const StImage& theImageL,
+                           const StImage& theImageR) {
+        return theImageL.getSizeX() == theImageR.getSizeX()
+            && theImageL.getSizeY() == theImageR.getSizeY();
+    }
+
+    /**
+     * Compose over/under image - left view at the top.
+     */
+    static bool composeOverUnder(const StImage& theImageL,
+                                 const StImage& theImageR,
+                                 StImage&       theImageOut) {
+        for(size_t aPlaneId = 0; aPlaneId < 4; ++aPlaneId) {
+            const StImagePlane& aPlaneL = theImageL.getPlane(aPlaneId);
+            const StImagePlane& aPlaneR = theImageR.getPlane(aPlaneId);
+            if(aPlaneL.isNull()) {
+                continue;
+            } else if(aPlaneR.getFormat() != aPlaneL.getFormat()
+                   || aPlaneR.getSizeX()  != aPlaneL.getSizeX()
+                   || aPlaneR.getSizeY()  != aPlaneL.getSizeY()) {
+                return false;
+            }
+
+            const size_t  aRowBytes = aPlaneL.getSizeX() * aPlaneL.getSizePixelBytes();
+            const size_t  aSizeY    = aPlaneL.getSizeY();
+            StImagePlane& aPlaneOut = theImageOut.changePlane(aPlaneId);
+            if(!aPlaneOut.initTrash(aPlaneL.getFormat(), aPlaneL.getSizeX(), aSizeY * 2, aRowBytes)) {
+                return false;
+            }
+
+            const StImagePlane* aPlanes[2] = { &aPlaneL, &aPlaneR };
+            for(size_t aViewIter = 0; aViewIter < 2; ++aViewIter) {
+                // output is top-down, so that bottom-up source is copied from the last row
+                const StImagePlane& aPlane  = *aPlanes[aViewIter];
+                const ptrdiff_t     aStride = aPlane.isTopDown()
+                                            ?  ptrdiff_t(aPlane.getSizeRowBytes())
+                                            : -ptrdiff_t(aPlane.getSizeRowBytes());
+                StImageKernels::copyRows(aPlaneOut.changeData(aSizeY * aViewIter, 0), ptrdiff_t(aRowBytes),
+                                         aPlane.getData(aPlane.isTopDown() ? 0 : aSizeY - 1, 0), aStride,
+                                         aRowBytes, aSizeY);
+            }
+        }
+        theImageOut.setColorModel(theImageL.getColorModel());
+        theImageOut.setColorScale(theImageL.getColorScale());
+        return true;
+    }
+
+    /**
+     * Convert the image into packed RGB.
+     */
+    static bool convertToRgb(const StImage& theImageFrom,
+                             StImage&       theImageTo) {
+        theImageTo.setColorModelPacked(StImagePlane::ImgRGB);
+        theImageTo.setColorScale(StImage::ImgScale_Full);
+        return theImageTo.changePlane(0).initTrash(StImagePlane::ImgRGB, theImageFrom.getSizeX(), theImageFrom.getSizeY())
+            && StAVImage::resize(theImageFrom, theImageTo);
+    }
+
+    /**
+     * Compose red-cyan anaglyph - red channel from left view, green and blue channels from right view.
+     */
+    static bool composeAnaglyph(const StImage& theImageL,
+                                const StImage& theImageR,
+                                StImage&       theImageOut) {
+        StImage aRgbR;
+        if(!convertToRgb(theImageL, theImageOut)
+        || !convertToRgb(theImageR, aRgbR)) {
+            return false;
+        }
+
+        StImagePlane&       aPlaneOut = theImageOut.changePlane(0);
+        const StImagePlane& aPlaneR   = aRgbR.getPlane(0);
+        const size_t aSizeX = aPlaneOut.getSizeX();
+        for(size_t aRow = 0; aRow < aPlaneOut.getSizeY(); ++aRow) {
+            GLubyte*       aDst = aPlaneOut.changeData(aRow, 0);
+            const GLubyte* aSrc = aPlaneR.getData(aRow, 0);
+            for(size_t aCol = 0; aCol < aSizeX; ++aCol, aDst += 3, aSrc += 3) {
+                aDst[1] = aSrc[1];
+                aDst[2] = aSrc[2];
+            }
+        }
+        return true;
+    }
+
+}
+
+bool StImageBatchConverter::layoutFromString(const StString& theString,
+                                             OutLayout&      theLayout) {
+    if(theString.isEqualsIgnoreCase(stCString("jps"))
+    || theString.isEqualsIgnoreCase(stCString("crossEyed"))) {
+        theLayout = OutLayout_SideBySideRL;
+    } else if(theString.isEqualsIgnoreCase(stCString("sbs"))
+           || theString.isEqualsIgnoreCase(stCString("parallelPair"))) {
+        theLayout = OutLayout_SideBySideLR;
+    } else if(theString.isEqualsIgnoreCase(stCString("ou"))
+           || theString.isEqualsIgnoreCase(stCString("overUnder"))) {
+        theLayout = OutLayout_OverUnder;
+    } else if(theString.isEqualsIgnoreCase(stCString("anaglyph"))) {
+        theLayout = OutLayout_Anaglyph;
+    } else if(theString.isEqualsIgnoreCase(stCString("separate"))) {
+        theLayout = OutLayout_Separate;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+void StImageBatchConverter::getInputExtensions(StArrayList<StString>& theExtensions) {
+    theExtensions.add(stCString("mpo"));
+    theExtensions.add(stCString("jps"));
+    theExtensions.add(stCString("pns"));
+    theExtensions.add(stCString("jpg"));
+    theExtensions.add(stCString("jpeg"));
+    theExtensions.add(stCString("png"));
+    theExtensions.add(stCString("webp"));
+    theExtensions.add(stCString("bmp"));
+    theExtensions.add(stCString("tif"));
+    theExtensions.add(stCString("tiff"));
+}
+
+StImageBatchConverter::StImageBatchConverter(const Options& theOptions)
+: myOptions(theOptions),
+  myEvWake(false),
+  myFiles(NULL),
+  myNextFile(0),
+  myNbInFlight(0),
+  myMaxInFlight(1) {
+    //
+}
+
+StImageBatchConverter::~StImageBatchConverter() {
+    //
+}
+
+bool StImageBatchConverter::perform(const StArrayList<StString>& theFiles) {
+    myStats = Stats();
+    myErrors.clear();
+    if(theFiles.isEmpty()) {
+        return true;
+    }
+
+    int aNbThreads = myOptions.NbThreads > 0 ? myOptions.NbThreads : StThread::countLogicalProcessors();
+    aNbThreads = stMax(stMin(aNbThreads, int(theFiles.size())), 1);
+
+    myFiles       = &theFiles;
+    myNextFile    = 0;
+    myNbInFlight  = 0;
+    myMaxInFlight = myOptions.MaxInFlight > 0 ? myOptions.MaxInFlight : aNbThreads * 2;
+    myConvertQueue.clear();
+    myEncodeQueue.clear();
+    myEvWake.reset();
+
+    // files are processed in parallel - splitting of a single image between threads would only add contention
+    const bool wasMultiThreaded = StImageKernels::isMultiThreaded();
+    StImageKernels::setMultiThreaded(false);
+    StAVImage::init();
+
+    StTimer aTimer(true);
+    std::vector< StHandle<StThread> > aThreads;
+    aThreads.reserve(aNbThreads);
+    for(int aThreadIter = 0; aThreadIter < aNbThreads; ++aThreadIter) {
+        aThreads.push_back(new StThread(workerThreadFunction, this, "StImageConvert"));
+    }
+    for(size_t aThreadIter = 0; aThreadIter < aThreads.size(); ++aThreadIter) {
+        aThreads[aThreadIter]->wait();
+    }
+    aThreads.clear();
+
+    myStats.WallMSec  = aTimer.getElapsedTimeInMilliSec();
+    myStats.NbThreads = aNbThreads;
+    myFiles = NULL;
+    StImageKernels::setMultiThreaded(wasMultiThreaded);
+    return myStats.NbFailed == 0;
+}
+
+SV_THREAD_FUNCTION StImageBatchConverter::workerThreadFunction(void* theConverter) {
+    StProfilerThread aProfilerThread("StImageConvert");
+    StImageBatchConverter* aConverter = (StImageBatchConverter* )theConverter;
+    aConverter->workerLoop();
+    return SV_THREAD_RETURN 0;
+}
+
+void StImageBatchConverter::workerLoop() {
+    for(;;) {
+        StHandle<Job> aJob;
+        Stage aStage = Stage_Decode;
+        myMutex.lock();
+        for(;;) {
+            if(!myEncodeQueue.empty()) {
+                aJob = myEncodeQueue.front();
+                myEncodeQueue.pop_front();
+                aStage = Stage_Encode;
+                break;
+            } else if(!myConvertQueue.empty()) {
+                aJob = myConvertQueue.front();
+                myConvertQueue.pop_front();
+                aStage = Stage_Convert;
+                break;
+            } else if(myNextFile < myFiles->size()
+                   && myNbInFlight < myMaxInFlight) {
+                aJob = new Job();
+                aJob->Path = myFiles->getValue(myNextFile++);
+                ++myNbInFlight;
+                aStage = Stage_Decode;
+                break;
+            } else if(myNextFile >= myFiles->size()
+                   && myNbInFlight == 0) {
+                // batch is done - wake up other workers to let them exit
+                myMutex.unlock();
+                myEvWake.set();
+                return;
+            }
+
+            // event is reset under lock, so that update from another worker can not be missed
+            myEvWake.reset();
+            myMutex.unlock();
+            myEvWake.wait();
+            myMutex.lock();
+        }
+        myMutex.unlock();
+
+        StTimer aTimer(true);
+        Result aResult = Result_Failed;
+        switch(aStage) {
+            case Stage_Decode:  aResult = decode (*aJob); break;
+            case Stage_Convert: aResult = convert(*aJob); break;
+            case Stage_Encode:  aResult = encode (*aJob); break;
+        }
+        const double aStageMSec = aTimer.getElapsedTimeInMilliSec();
+
+        myMutex.lock();
+        switch(aStage) {
+            case Stage_Decode:  myStats.DecodeMSec  += aStageMSec; break;
+            case Stage_Convert: myStats.ConvertMSec += aStageMSec; break;
+            case Stage_Encode:  myStats.EncodeMSec  += aStageMSec; break;
+        }
+        switch(aResult) {
+            case Result_Next: {
+                if(aStage == Stage_Decode) {
+                    myConvertQueue.push_back(aJob);
+                } else {
+                    myEncodeQueue.push_back(aJob);
+                }
+                break;
+            }
+            case Result_Done: {
+                ++myStats.NbDone;
+                myStats.NbMegaPixels += aJob->MegaPixels;
+                --myNbInFlight;
+                break;
+            }
+            case Result_Skipped: {
+                ++myStats.NbSkipped;
+                --myNbInFlight;
+                break;
+            }
+            case Result_Failed: {
+                ++myStats.NbFailed;
+                myErrors.add(aJob->Path + ": " + aJob->Error);
+                --myNbInFlight;
+                break;
+            }
+        }
+        myMutex.unlock();
+        myEvWake.set();
+    }
+}
+
+bool StImageBatchConverter::loadImage(const StString&              thePath,
+                                      const StImageFile::ImageType theType,
+                                      const uint8_t*               theData,
+                                      const size_t                 theSize,
+                                      StHandle<StImage>&           theImage,
+                                      StFormat&                    theSrcFormat,
+                                      StString&                    theError) {
+    StHandle<StImageFile> anImageFile = StImageFile::create(StImageFile::ST_LIBAV, theType);
+    if(anImageFile.isNull()) {
+        theError = "no image library was found";
+        return false;
+    } else if(!anImageFile->load(thePath, theType, (uint8_t* )theData, (int )theSize)) {
+        theError = anImageFile->getState();
+        return false;
+    }
+
+    // image library data is invalidated on close
+    theImage = new StImage();
+    const bool isCopied = theImage->initCopy(*anImageFile, true);
+    theSrcFormat = anImageFile->getFormat();
+    anImageFile->close();
+    if(!isCopied) {
+        theImage.nullify();
+        theError = "not enough memory";
+        return false;
+    }
+    return true;
+}
+
+StString StImageBatchConverter::outputPath(const StString& thePath,
+                                           const bool      theIsRight) const {
+    const char* aSuffix = "";
+    switch(myOptions.Layout) {
+        case OutLayout_SideBySideRL: aSuffix = "";          break;
+        case OutLayout_SideBySideLR: aSuffix = "-lr";       break;
+        case OutLayout_OverUnder:    aSuffix = "-ab";       break;
+        case OutLayout_Anaglyph:     aSuffix = "-anaglyph"; break;
+        case OutLayout_Separate:     aSuffix = theIsRight ? "-right" : "-left"; break;
+    }
+
+    StString aFolder, aFileName, aName, anExt;
+    StFileNode::getFolderAndFile(thePath, aFolder, aFileName);
+    StFileNode::getNameAndExtension(aFileName, aName, anExt);
+    if(!myOptions.OutFolder.isEmpty()) {
+        aFolder = myOptions.OutFolder;
+    }
+
+    const bool isPng = myOptions.OutType == StImageFile::ST_TYPE_PNG;
+    if(myOptions.Layout == OutLayout_SideBySideRL) {
+        anExt = isPng ? stCString("pns") : stCString("jps");
+    } else {
+        anExt = isPng ? stCString("png") : stCString("jpg");
+    }
+    return (aFolder.isEmpty() ? StString() : (aFolder + SYS_FS_SPLITTER)) + aName + aSuffix + "." + anExt;
+}
+
+StImageBatchConverter::Result StImageBatchConverter::decode(Job& theJob) {
+    // check the output before reading the file
+    const StString anOutPath1 = outputPath(theJob.Path);
+    const StString anOutPath2 = myOptions.Layout == OutLayout_Separate ? outputPath(theJob.Path, true) : StString();
+    if(anOutPath1.isEqualsIgnoreCase(theJob.Path)
+    || anOutPath2.isEqualsIgnoreCase(theJob.Path)) {
+        theJob.Error = "output file would overwrite the input";
+        return Result_Skipped;
+    } else if(!myOptions.ToOverwrite
+           && StFileNode::isFileExists(anOutPath1)
+           && (anOutPath2.isEmpty() || StFileNode::isFileExists(anOutPath2))) {
+        theJob.Error = "output file already exists";
+        return Result_Skipped;
+    }
+
+    const StImageFile::ImageType anImgType = StImageFile::guessImageType(theJob.Path, StMIME());
+    StFormat aSrcFormat = myOptions.SrcFormat;
+    if(anImgType == StImageFile::ST_TYPE_MPO
+    || anImgType == StImageFile::ST_TYPE_JPEG
+    || anImgType == StImageFile::ST_TYPE_JPS) {
+        // the same procedure as within StImageViewer to divide MPO (Multi Picture Object)
+        StJpegParser aParser;
+        if(!aParser.readFile(theJob.Path)) {
+            theJob.Error = "can not read the file";
+            return Result_Failed;
+        }
+
+        StHandle<StJpegParser::Image> anImg1, anImg2;
+        size_t aMaxSizeX = 0;
+        size_t aMaxSizeY = 0;
+        for(StHandle<StJpegParser::Image> anImgIter = aParser.getImage(0); !anImgIter.isNull();
+            anImgIter = anImgIter->Next) {
+            aMaxSizeX = stMax(aMaxSizeX, anImgIter->SizeX);
+            aMaxSizeY = stMax(aMaxSizeY, anImgIter->SizeY);
+        }
+        for(StHandle<StJpegParser::Image> anImgIter = aParser.getImage(0); !anImgIter.isNull();
+            anImgIter = anImgIter->Next) {
+            if(anImgIter->SizeX == aMaxSizeX
+            && anImgIter->SizeY == aMaxSizeY) {
+                if(anImg1.isNull()) {
+                    anImg1 = anImgIter;
+                } else if(anImg2.isNull()) {
+                    anImg2 = anImgIter;
+                }
+            }
+        }
+        if(anImg1.isNull()) {
+            anImg1 = aParser.getImage(0);
+        }
+        if(anImg1.isNull()) {
+            theJob.Error = "StJpegParser failed";
+            return Result_Failed;
+        }
+
+        StFormat aFileFormat = StFormat_AUTO;
+        if(!loadImage(theJob.Path, StImageFile::ST_TYPE_JPEG, anImg1->Data, anImg1->Length, theJob.DataL, aFileFormat, theJob.Error)
+        && !loadImage(theJob.Path, StImageFile::ST_TYPE_JPEG, aParser.getBuffer(), aParser.getSize(), theJob.DataL, aFileFormat, theJob.Error)) {
+            return Result_Failed;
+        }
+        if(!anImg2.isNull()) {
+            if(!loadImage(theJob.Path, StImageFile::ST_TYPE_JPEG, anImg2->Data, anImg2->Length, theJob.DataR, aFileFormat, theJob.Error)) {
+                return Result_Failed;
+            }
+            aSrcFormat = StFormat_SeparateFrames;
+        } else if(aSrcFormat == StFormat_AUTO) {
+            aSrcFormat = aParser.getSrcFormat();
+        }
+    } else {
+        StFormat aFileFormat = StFormat_AUTO;
+        if(!loadImage(theJob.Path, anImgType, NULL, 0, theJob.DataL, aFileFormat, theJob.Error)) {
+            return Result_Failed;
+        }
+        if(aSrcFormat == StFormat_AUTO) {
+            aSrcFormat = aFileFormat;
+        }
+    }
+
+    if(aSrcFormat == StFormat_AUTO) {
+        StString aFolder, aFileName;
+        StFileNode::getFolderAndFile(theJob.Path, aFolder, aFileName);
+        bool isAnamorph = false;
+        aSrcFormat = st::formatFromName(aFileName, myOptions.ToSwapJps, isAnamorph);
+    }
+    theJob.SrcFormat = aSrcFormat;
+    return Result_Next;
+}
+
+StImageBatchConverter::Result StImageBatchConverter::convert(Job& theJob) {
+    StHandle<StImage> aViewL, aViewR;
+    switch(theJob.SrcFormat) {
+        case StFormat_SeparateFrames: {
+            aViewL = theJob.DataL;
+            aViewR = theJob.DataR;
+            break;
+        }
+        case StFormat_SideBySide_LR:
+        case StFormat_SideBySide_RL:
+        case StFormat_TopBottom_LR:
+        case StFormat_TopBottom_RL:
+        case StFormat_Rows:
+        case StFormat_Columns: {
+            // split stereo pair in the same way as for texture upload;
+            // decoded image is referenced (not copied) by splitter for all layouts but column-interlaced
+            static const StGLDeviceCaps THE_DEV_CAPS = headlessDeviceCaps();
+            StHandle<StBufferCounter> aRef = new StImageFileCounter(theJob.DataL);
+            StImage aPair;
+            aPair.initReference(*theJob.DataL, aRef);
+
+            StGLTextureData aTextureData(new StGLTextureUploadParams());
+            aTextureData.updateData(THE_DEV_CAPS, aPair, StImage(), new StStereoParams(),
+                                    theJob.SrcFormat, StCubemap_OFF, 0.0);
+            aViewL = new StImage();
+            aViewR = new StImage();
+            aTextureData.getCopy(aViewL.access(), aViewR.access());
+            break;
+        }
+        case StFormat_Mono:
+        case StFormat_AUTO: {
+            theJob.Error = "mono image";
+            return Result_Skipped;
+        }
+        default: {
+            theJob.Error = StString("unsupported source format ") + st::formatToString(theJob.SrcFormat);
+            return Result_Skipped;
+        }
+    }
+    theJob.DataL.nullify();
+    theJob.DataR.nullify();
+    if(aViewL.isNull() || aViewL->isNull()
+    || aViewR.isNull() || aViewR->isNull()) {
+        theJob.Error = "failed to split stereo pair";
+        return Result_Failed;
+    }
+    theJob.MegaPixels = double(aViewL->getSizeX() * aViewL->getSizeY()
+                             + aViewR->getSizeX() * aViewR->getSizeY()) / 1000000.0;
+
+    if(myOptions.Layout == OutLayout_Separate) {
+        theJob.OutL = aViewL;
+        theJob.OutR = aViewR;
+        return Result_Next;
+    } else if(!isSameSize(*aViewL, *aViewR)) {
+        theJob.Error = "left and right views have different dimensions";
+        return Result_Failed;
+    }
+
+    theJob.OutL = new StImage();
+    bool isComposed = false;
+    switch(myOptions.Layout) {
+        case OutLayout_SideBySideRL: isComposed = theJob.OutL->initSideBySide(*aViewL, *aViewR, 0, 0); break;
+        case OutLayout_SideBySideLR: isComposed = theJob.OutL->initSideBySide(*aViewR, *aViewL, 0, 0); break; // initSideBySide() puts the first image on the right
+        case OutLayout_OverUnder:    isComposed = composeOverUnder(*aViewL, *aViewR, *theJob.OutL); break;
+        case OutLayout_Anaglyph:     isComposed = composeAnaglyph (*aViewL, *aViewR, *theJob.OutL); break;
+        case OutLayout_Separate:     break;
+    }
+    if(!isComposed) {
+        theJob.OutL.nullify();
+        theJob.Error = "failed to compose output image";
+        return Result_Failed;
+    }
+    return Result_Next;
+}
+
+bool StImageBatchConverter::saveImage(const StImage&  theImage,
+                                      const StString& thePath,
+                                      const StFormat  theFormat,
+                                      StString&       theError) const {
+    StImageFile::SaveImageParams aParams;
+    aParams.SaveImageType = myOptions.OutType;
+    aParams.StereoFormat  = theFormat;
+    aParams.Compression   = myOptions.Compression;
+    if(myOptions.Layout == OutLayout_SideBySideRL) {
+        aParams.SaveImageType = myOptions.OutType == StImageFile::ST_TYPE_PNG
+                              ? StImageFile::ST_TYPE_PNS
+                              : StImageFile::ST_TYPE_JPS;
+    }
+
+    StHandle<StImageFile> anImageFile = StImageFile::create(StImageFile::ST_LIBAV, aParams.SaveImageType);
+    if(anImageFile.isNull()) {
+        theError = "no image library was found";
+        return false;
+    }
+
+    anImageFile->initWrapper(theImage);
+    if(!anImageFile->save(thePath, aParams)) {
+        theError = StString("can not save '") + thePath + "': " + anImageFile->getState();
+        return false;
+    }
+    return true;
+}
+
+StImageBatchConverter::Result StImageBatchConverter::encode(Job& theJob) {
+    bool isSaved = false;
+    switch(myOptions.Layout) {
+        case OutLayout_SideBySideRL:
+            isSaved = saveImage(*theJob.OutL, outputPath(theJob.Path), StFormat_SideBySide_RL, theJob.Error);
+            break;
+        case OutLayout_SideBySideLR:
+            isSaved = saveImage(*theJob.OutL, outputPath(theJob.Path), StFormat_SideBySide_LR, theJob.Error);
+            break;
+        case OutLayout_OverUnder:
+            isSaved = saveImage(*theJob.OutL, outputPath(theJob.Path), StFormat_TopBottom_LR,  theJob.Error);
+            break;
+        case OutLayout_Anaglyph:
+            isSaved = saveImage(*theJob.OutL, outputPath(theJob.Path), StFormat_AnaglyphRedCyan, theJob.Error);
+            break;
+        case OutLayout_Separate:
+            isSaved = saveImage(*theJob.OutL, outputPath(theJob.Path, false), StFormat_Mono, theJob.Error)
+                   && saveImage(*theJob.OutR, outputPath(theJob.Path, true),  StFormat_Mono, theJob.Error);
+            break;
+    }
+    theJob.OutL.nullify();
+    theJob.OutR.nullify();
+    return isSaved ? Result_Done : Result_Failed;
+}
@@ -0,0 +1,258 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StImageConvert program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StImageConvert program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __StImageBatchConverter_h_
+#define __StImageBatchConverter_h_
+
+#include <StImage/StImageFile.h>
+#include <StThreads/StCondition.h>
+#include <StThreads/StMutex.h>
+#include <StThreads/StThread.h>
+
+#include <deque>
+
+/**
+ * Headless conversion of stereoscopic images into another stereo layout.
+ *
+ * Files are processed by a pool of worker threads as a pipeline of three stages:
+ * - decode  - parse the file (MPO / JPS / stereo tags) and decode views into memory;
+ * - convert - split single-frame stereo pair into views and compose the output layout;
+ * - encode  - encode the output image(s) and write them into the file.
+ * Any worker takes any stage, preferring stages closer to the end of the pipeline,
+ * so that decoded images do not pile up in memory;
+ * the number of files within the pipeline at once is limited by Options::MaxInFlight.
+ * No window or OpenGL context is created.
+ */
+class StImageBatchConverter {
+
+        public:
+
+    /**
+     * Output stereo layout.
+     */
+    enum OutLayout {
+        OutLayout_SideBySideRL, //!< cross-eyed side-by-side pair, JPS / PNS file
+        OutLayout_SideBySideLR, //!< parallel side-by-side pair, "-lr" name suffix
+        OutLayout_OverUnder,    //!< left view above right view, "-ab" name suffix
+        OutLayout_Anaglyph,     //!< red-cyan anaglyph, "-anaglyph" name suffix
+        OutLayout_Separate,     //!< left and right views into separate files, "-left" and "-right" name suffixes
+    };
+
+    /**
+     * Conversion options.
+     */
+    struct Options {
+        StString               OutFolder;   //!< output folder; empty means folder of input file
+        OutLayout              Layout;      //!< output layout
+        StImageFile::ImageType OutType;     //!< output image type, ST_TYPE_JPEG or ST_TYPE_PNG
+        StFormat               SrcFormat;   //!< source stereo format; StFormat_AUTO to detect from file
+        float                  Compression; //!< compression level within [0..1] range, -1 for default
+        int                    NbThreads;   //!< number of worker threads; 0 to use all logical processors
+        int                    MaxInFlight; //!< maximum number of files within pipeline; 0 for twice the number of threads
+        bool                   ToSwapJps;   //!< treat JPS / PNS files as parallel pair instead of cross-eyed
+        bool                   ToOverwrite; //!< overwrite existing output files
+
+        Options()
+        : Layout(OutLayout_SideBySideRL),
+          OutType(StImageFile::ST_TYPE_JPEG),
+          SrcFormat(StFormat_AUTO),
+          Compression(-1.0f),
+          NbThreads(0),
+          MaxInFlight(0),
+          ToSwapJps(false),
+          ToOverwrite(false) {}
+    };
+
+    /**
+     * Conversion statistics.
+     */
+    struct Stats {
+        size_t NbDone;        //!< number of converted files
+        size_t NbFailed;      //!< number of files failed to convert
+        size_t NbSkipped;     //!< number of skipped files (mono images or existing output)
+        double NbMegaPixels;  //!< total number of converted pixels (both views) in megapixels
+        double DecodeMSec;    //!< time spent in decode  stage summed across threads
+        double ConvertMSec;   //!< time spent in convert stage summed across threads
+        double EncodeMSec;    //!< time spent in encode  stage summed across threads
+        double WallMSec;      //!< elapsed time of the whole batch
+        int    NbThreads;     //!< number of used worker threads
+
+        Stats()
+        : NbDone(0),
+          NbFailed(0),
+          NbSkipped(0),
+          NbMegaPixels(0.0),
+          DecodeMSec(0.0),
+          ConvertMSec(0.0),
+          EncodeMSec(0.0),
+          WallMSec(0.0),
+          NbThreads(0) {}
+    };
+
+        public:
+
+    /**
+     * Return output layout from string (jps, sbs, ou, anaglyph, separate).
+     * @return FALSE if string is unknown
+     */
+    ST_LOCAL static bool layoutFromString(const StString& theString,
+                                          OutLayout&      theLayout);
+
+    /**
+     * Return the list of supported input file extensions.
+     */
+    ST_LOCAL static void getInputExtensions(StArrayList<StString>& theExtensions);
+
+    /**
+     * Main constructor.
+     */
+    ST_LOCAL StImageBatchConverter(const Options& theOptions);
+
+    /**
+     * Destructor.
+     */
+    ST_LOCAL ~StImageBatchConverter();
+
+    /**
+     * Convert the list of files.
+     * Blocks until all files are processed.
+     * @param theFiles input files
+     * @return FALSE if any file has failed to convert
+     */
+    ST_LOCAL bool perform(const StArrayList<StString>& theFiles);
+
+    /**
+     * @return statistics of the last batch
+     */
+    ST_LOCAL const Stats& getStats() const { return myStats; }
+
+    /**
+     * @return error messages of the last batch
+     */
+    ST_LOCAL const StArrayList<StString>& getErrors() const { return myErrors; }
+
+        private:
+
+    /**
+     * Pipeline stage.
+     */
+    enum Stage {
+        Stage_Decode,
+        Stage_Convert,
+        Stage_Encode,
+    };
+
+    /**
+     * Stage result.
+     */
+    enum Result {
+        Result_Next,    //!< stage done, pass to the next stage
+        Result_Done,    //!< file has been converted
+        Result_Skipped, //!< file has been skipped
+        Result_Failed,  //!< file has failed to convert
+    };
+
+    /**
+     * Single file within the pipeline.
+     */
+    struct Job {
+        StString          Path;      //!< input file path
+        StString          Error;     //!< error or skip description
+        StFormat          SrcFormat; //!< stereo format of decoded data
+        StHandle<StImage> DataL;     //!< decoded image (left view or stereo pair)
+        StHandle<StImage> DataR;     //!< decoded right view (separate frames only)
+        StHandle<StImage> OutL;      //!< output image (left view for separate layout)
+        StHandle<StImage> OutR;      //!< output right view (separate layout only)
+        double            MegaPixels; //!< number of pixels in both views
+
+        Job() : SrcFormat(StFormat_AUTO), MegaPixels(0.0) {}
+    };
+
+        private:
+
+    /**
+     * Thread function.
+     */
+    static SV_THREAD_FUNCTION workerThreadFunction(void* theConverter);
+
+    /**
+     * Main loop of worker thread.
+     */
+    ST_LOCAL void workerLoop();
+
+    /**
+     * Parse and decode the file into memory.
+     */
+    ST_LOCAL Result decode(Job& theJob);
+
+    /**
+     * Split views and compose the output layout.
+     */
+    ST_LOCAL Result convert(Job& theJob);
+
+    /**
+     * Encode output and write it into file(s).
+     */
+    ST_LOCAL Result encode(Job& theJob);
+
+    /**
+     * Load the image (or JPEG sub-image from memory) and copy it into own buffer.
+     * @param theSrcFormat stereo format stored in the file
+     */
+    ST_LOCAL bool loadImage(const StString&              thePath,
+                            const StImageFile::ImageType theType,
+                            const uint8_t*               theData,
+                            const size_t                 theSize,
+                            StHandle<StImage>&           theImage,
+                            StFormat&                    theSrcFormat,
+                            StString&                    theError);
+
+    /**
+     * Compose output file path from input path for current output layout.
+     * @param thePath    input file path
+     * @param theIsRight return path to the right view (OutLayout_Separate only)
+     */
+    ST_LOCAL StString outputPath(const StString& thePath,
+                                 const bool      theIsRight = false) const;
+
+    /**
+     * Write the image into the file.
+     */
+    ST_LOCAL bool saveImage(const StImage&  theImage,
+                            const StString& thePath,
+                            const StFormat  theFormat,
+                            StString&       theError) const;
+
+        private:
+
+    Options                      myOptions;    //!< conversion options
+    Stats                        myStats;      //!< statistics of the current batch
+    StArrayList<StString>        myErrors;     //!< errors of the current batch
+
+    StMutex                      myMutex;      //!< lock for the fields below
+    StCondition                  myEvWake;     //!< event to wake up idle workers
+    const StArrayList<StString>* myFiles;      //!< input files of the current batch
+    size_t                       myNextFile;   //!< index of the next file to decode
+    int                          myNbInFlight; //!< number of files within the pipeline
+    int                          myMaxInFlight; //!< limit for the number of files within the pipeline
+    std::deque< StHandle<Job> >  myConvertQueue; //!< decoded files
+    std::deque< StHandle<Job> >  myEncodeQueue;  //!< converted files
+
+};
+
+#endif // __StImageBatchConverter_h_
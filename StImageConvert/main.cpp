@@ -0,0 +1,168 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StImageConvert program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StImageConvert program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StImageBatchConverter.h"
+
+#include <StFile/StFolder.h>
+#include <StThreads/StProcess.h>
+#include <StStrings/stConsole.h>
+#include <StVersion.h>
+
+#include <cstdlib>
+
+namespace {
+
+    /**
+     * Append the file or all supported files within the folder.
+     */
+    static void addInput(const StString&        thePath,
+                         StArrayList<StString>& theFiles) {
+        if(!StFolder::isFolder(thePath)) {
+            theFiles.add(thePath);
+            return;
+        }
+
+        StArrayList<StString> anExtensions;
+        StImageBatchConverter::getInputExtensions(anExtensions);
+        StFolder aFolder(thePath);
+        aFolder.init(anExtensions, 1);
+        for(size_t aNodeIter = 0; aNodeIter < aFolder.size(); ++aNodeIter) {
+            const StFileNode* aNode = aFolder.getValue(aNodeIter);
+            if(!aNode->isFolder()) {
+                theFiles.add(aNode->getPath());
+            }
+        }
+    }
+
+    static void printUsage() {
+        st::cout << stostream_text("Usage: StImageConvert [options] file1 [file2 ...] [folder ...]\n")
+                 << stostream_text("  --help           Show this help\n")
+                 << stostream_text("  --in=path        Input file or folder (might be specified several times)\n")
+                 << stostream_text("  --out=folder     Output folder (folder of input file by default)\n")
+                 << stostream_text("  --layout=jps     Output layout: jps (cross-eyed JPS/PNS), sbs (parallel),\n")
+                 << stostream_text("                   ou (over/under), anaglyph (red-cyan), separate (left/right files)\n")
+                 << stostream_text("  --png            Write PNG instead of JPEG\n")
+                 << stostream_text("  --quality=0.9    Output quality within 0..1 range\n")
+                 << stostream_text("  --src=auto       Source format: auto, crossEyed, parallelPair, overUnderLR, overUnderRL, interlaceRow\n")
+                 << stostream_text("  --swapJps        Treat JPS/PNS files as parallel pair\n")
+                 << stostream_text("  --threads=N      Number of worker threads (all logical processors by default)\n")
+                 << stostream_text("  --queue=N        Maximum number of files in memory (twice the number of threads by default)\n")
+                 << stostream_text("  --overwrite      Overwrite existing output files\n");
+    }
+
+    static StString formatNumber(const char*  theFormat,
+                                 const double theValue) {
+        char aBuff[64];
+        stsprintf(aBuff, sizeof(aBuff), theFormat, theValue);
+        return StString(aBuff);
+    }
+
+}
+
+int main(int , char** ) {
+#ifdef _WIN32
+    setlocale(LC_ALL, ".OCP"); // we set default locale for console output
+#endif
+
+    const StString ARGUMENT_ANY       = "--";
+    const StString ARGUMENT_HELP      = "help";
+    const StString ARGUMENT_IN        = "in";
+    const StString ARGUMENT_OUT       = "out";
+    const StString ARGUMENT_LAYOUT    = "layout";
+    const StString ARGUMENT_PNG       = "png";
+    const StString ARGUMENT_QUALITY   = "quality";
+    const StString ARGUMENT_SRC       = "src";
+    const StString ARGUMENT_SWAP_JPS  = "swapJps";
+    const StString ARGUMENT_THREADS   = "threads";
+    const StString ARGUMENT_QUEUE     = "queue";
+    const StString ARGUMENT_OVERWRITE = "overwrite";
+
+    StImageBatchConverter::Options anOptions;
+    StArrayList<StString> aFiles;
+    StArrayList<StString> anArgs = StProcess::getArguments();
+    for(size_t aParamIter = 1; aParamIter < anArgs.size(); ++aParamIter) {
+        StString aParam = anArgs[aParamIter];
+        if(!aParam.isStartsWith(ARGUMENT_ANY)) {
+            addInput(aParam, aFiles);
+            continue;
+        }
+
+        StArgument anArg; anArg.parseString(aParam.subString(2, aParam.getLength())); // cut suffix --
+        if(anArg.getKey().isEqualsIgnoreCase(ARGUMENT_HELP)) {
+            printUsage();
+            return 0;
+        } else if(anArg.getKey().isEqualsIgnoreCase(ARGUMENT_IN)) {
+            addInput(anArg.getValue(), aFiles);
+        } else if(anArg.getKey().isEqualsIgnoreCase(ARGUMENT_OUT)) {
+            anOptions.OutFolder = anArg.getValue();
+        } else if(anArg.getKey().isEqualsIgnoreCase(ARGUMENT_LAYOUT)) {
+            if(!StImageBatchConverter::layoutFromString(anArg.getValue(), anOptions.Layout)) {
+                st::cout << st::COLOR_FOR_RED << stostream_text("Unknown layout '") << anArg.getValue() << stostream_text("'\n") << st::COLOR_FOR_WHITE;
+                return -1;
+            }
+        } else if(anArg.getKey().isEqualsIgnoreCase(ARGUMENT_PNG)) {
+            anOptions.OutType = StImageFile::ST_TYPE_PNG;
+        } else if(anArg.getKey().isEqualsIgnoreCase(ARGUMENT_QUALITY)) {
+            const double aQuality = ::atof(anArg.getValue().toCString());
+            anOptions.Compression = 1.0f - stClamp(float(aQuality), 0.0f, 1.0f);
+        } else if(anArg.getKey().isEqualsIgnoreCase(ARGUMENT_SRC)) {
+            anOptions.SrcFormat = st::formatFromString(anArg.getValue());
+        } else if(anArg.getKey().isEqualsIgnoreCase(ARGUMENT_SWAP_JPS)) {
+            anOptions.ToSwapJps = true;
+        } else if(anArg.getKey().isEqualsIgnoreCase(ARGUMENT_THREADS)) {
+            anOptions.NbThreads = stMax(int(::atol(anArg.getValue().toCString())), 0);
+        } else if(anArg.getKey().isEqualsIgnoreCase(ARGUMENT_QUEUE)) {
+            anOptions.MaxInFlight = stMax(int(::atol(anArg.getValue().toCString())), 0);
+        } else if(anArg.getKey().isEqualsIgnoreCase(ARGUMENT_OVERWRITE)) {
+            anOptions.ToOverwrite = true;
+        } else {
+            st::cout << stostream_text("Unknown argument '") << aParam << stostream_text("'\n");
+        }
+    }
+
+    st::cout << stostream_text("StImageConvert ") << StVersionInfo::getSDKVersionString()
+             << stostream_text(" by Kirill Gavrilov (kirill@sview.ru)\n\n");
+    if(aFiles.isEmpty()) {
+        printUsage();
+        return -1;
+    }
+
+    StImageBatchConverter aConverter(anOptions);
+    const bool isDone = aConverter.perform(aFiles);
+
+    const StArrayList<StString>& anErrors = aConverter.getErrors();
+    for(size_t anErrIter = 0; anErrIter < anErrors.size(); ++anErrIter) {
+        st::cout << st::COLOR_FOR_RED << anErrors.getValue(anErrIter) << stostream_text("\n") << st::COLOR_FOR_WHITE;
+    }
+
+    const StImageBatchConverter::Stats& aStats = aConverter.getStats();
+    const double aWallSec = stMax(aStats.WallMSec * 0.001, 0.000001);
+    const double aNbFiles = stMax(double(aStats.NbDone), 1.0);
+    st::cout << stostream_text("Converted ") << aStats.NbDone << stostream_text(" files (")
+             << aStats.NbSkipped << stostream_text(" skipped, ") << aStats.NbFailed << stostream_text(" failed) in ")
+             << formatNumber("%.2f", aWallSec) << stostream_text(" s using ") << aStats.NbThreads << stostream_text(" threads\n")
+             << stostream_text("  throughput: ") << formatNumber("%.2f", double(aStats.NbDone) / aWallSec) << stostream_text(" files/s, ")
+             << formatNumber("%.1f", aStats.NbMegaPixels / aWallSec) << stostream_text(" MPix/s\n")
+             << stostream_text("  decode:  ") << formatNumber("%9.1f", aStats.DecodeMSec)  << stostream_text(" ms (")
+             << formatNumber("%.1f", aStats.DecodeMSec  / aNbFiles) << stostream_text(" ms per file)\n")
+             << stostream_text("  convert: ") << formatNumber("%9.1f", aStats.ConvertMSec) << stostream_text(" ms (")
+             << formatNumber("%.1f", aStats.ConvertMSec / aNbFiles) << stostream_text(" ms per file)\n")
+             << stostream_text("  encode:  ") << formatNumber("%9.1f", aStats.EncodeMSec)  << stostream_text(" ms (")
+             << formatNumber("%.1f", aStats.EncodeMSec  / aNbFiles) << stostream_text(" ms per file)\n");
+    return isDone ? 0 : 1;
+}
@@ -24,6 +24,7 @@
 #include "../StMoviePlayer/StMoviePlayerInfo.h"
 
 #include <StAV/StAVImage.h>
+#include <StImage/StMemoryBudget.h>
 #include <StThreads/StThread.h>
 
 using namespace StImageViewerStrings;
@@ -68,6 +69,8 @@ StImageLoader::StImageLoader(const StImageFile::ImageClass      theImageLib,
   myMsgQueue(theMsgQueue),
   myImageLib(theImageLib),
   myAction(Action_NONE),
+  myToLoadNext(false),
+  myToFillInfo(false),
   myIsTheaterMode(false),
   myToStickPano360(false),
   myToFlipCubeZ6x1(false),
@@ -275,6 +278,9 @@ bool StImageLoader::loadImage(const StHandle<StFileNode>& theSource,
 
     // clear active
     myTextureQueue->clear();
+    myMetaParser.nullify();
+    myMetaImage.nullify();
+    myMetaLib.clear();
 
     StHandle<StImageInfo> anImgInfo = new StImageInfo();
     anImgInfo->Id        = theParams;
@@ -295,6 +301,8 @@ bool StImageLoader::loadImage(const StHandle<StFileNode>& theSource,
         anImgInfo->Info.add(StArgument(tr(INFO_FILE_NAME), aTitleString));
     }
 
+    StHandle<StJpegParser>        aMetaParser;
+    StHandle<StJpegParser::Image> aMetaImage;
     StTimer aLoadTimer(true);
     StFormat  aSrcFormatCurr = myStFormatByUser;
     StPanorama aSrcPanorama = StPanorama_OFF;
@@ -307,21 +315,21 @@ bool StImageLoader::loadImage(const StHandle<StFileNode>& theSource,
         }
 
         // special procedure to divide MPO (Multi Picture Object)
-        StJpegParser aParser;
+        StHandle<StJpegParser> aParser = new StJpegParser();
         double anHParallax = 0.0; // parallax in percents
-        const bool isParsed = aParser.readFile(aFilePath, aFileDescriptor);
+        const bool isParsed = aParser->readFile(aFilePath, aFileDescriptor);
 
         StHandle<StJpegParser::Image> anImg1, anImg2;
         size_t aMaxSizeX = 0;
         size_t aMaxSizeY = 0;
-        for(StHandle<StJpegParser::Image> anImgIter = aParser.getImage(0); !anImgIter.isNull();
+        for(StHandle<StJpegParser::Image> anImgIter = aParser->getImage(0); !anImgIter.isNull();
             anImgIter = anImgIter->Next) {
             aMaxSizeX = stMax(aMaxSizeX, anImgIter->SizeX);
             aMaxSizeY = stMax(aMaxSizeY, anImgIter->SizeY);
         }
 
         int anImgCounter = 1;
-        for(StHandle<StJpegParser::Image> anImgIter = aParser.getImage(0); !anImgIter.isNull();
+        for(StHandle<StJpegParser::Image> anImgIter = aParser->getImage(0); !anImgIter.isNull();
             anImgIter = anImgIter->Next, ++anImgCounter) {
             if(anImgIter->SizeX == aMaxSizeX
             && anImgIter->SizeY == aMaxSizeY) {
@@ -339,54 +347,34 @@ bool StImageLoader::loadImage(const StHandle<StFileNode>& theSource,
         if (anImg1.isNull()) {
             // handle broken or unknown JPEG files / issues in JPEG parser
             ST_DEBUG_LOG("Warning, StJpegParser returned inconclusive list of sub-images");
-            anImg1 = aParser.getImage(0);
+            anImg1 = aParser->getImage(0);
         }
         if (anImg1.isNull()) {
             processLoadFail(StString("StJpegParser failed on \"") + aFilePath + '\"');
             return false;
         }
 
-        // copy metadata
-        if(!aParser.getComment().isEmpty()) {
-            StDictEntry& anEntry  = anImgInfo->Info.addChange("Jpeg.Comment");
-            anEntry.changeValue() = aParser.getComment();
-        }
-        if(!aParser.getJpsComment().isEmpty()) {
-            StDictEntry& anEntry  = anImgInfo->Info.addChange("Jpeg.JpsComment");
-            anEntry.changeValue() = aParser.getJpsComment();
-        }
-        if(!aParser.getXMP().isEmpty()) {
-            StDictEntry& anEntry  = anImgInfo->Info.addChange("Jpeg.XMP");
-            anEntry.changeValue() = aParser.getXMP();
-        }
-        if(!anImg1.isNull()) {
-            for(size_t anExifId = 0; anExifId < anImg1->Exif.size(); ++anExifId) {
-                metadataFromExif(anImg1->Exif[anExifId], anImgInfo);
-            }
-            const StString aTime = anImg1->getDateTime();
-            if(!aTime.isEmpty()) {
-                StDictEntry& anEntry  = anImgInfo->Info.addChange("Exif.Image.DateTime");
-                anEntry.changeValue() = aTime;
-            }
-        }
+        // only display-critical tags are queried here, metadata is extracted by fillImageInfo() on request
+        aMetaParser = aParser;
+        aMetaImage  = anImg1;
         if(myStFormatByUser == StFormat_AUTO) {
-            if(aParser.getSrcFormat() != StFormat_AUTO) {
-                aSrcFormatCurr = aParser.getSrcFormat();
+            if(aParser->getSrcFormat() != StFormat_AUTO) {
+                aSrcFormatCurr = aParser->getSrcFormat();
             } else if(!anImg1.isNull() && anImg2.isNull()
                     && anImg1->getQooCamMakerNote(aSrcFormatCurr)) {
                 //
             }
         }
-        aSrcPanorama = aParser.getPanorama();
+        aSrcPanorama = aParser->getPanorama();
 
-        //aParser.fillDictionary(anImgInfo->Info, true);
+        //aParser->fillDictionary(anImgInfo->Info, true);
         if(!isParsed) {
             processLoadFail(StString("Can not read the file \"") + aFilePath + '\"');
             return false;
         }
 
         anImgInfo->IsSavable = anImg2.isNull();
-        anImgInfo->StInfoStream = aParser.getSrcFormat();
+        anImgInfo->StInfoStream = aParser->getSrcFormat();
         if(anImgInfo->StInfoStream != StFormat_AUTO) {
             StDictEntry& anEntry  = anImgInfo->Info.addChange("Jpeg.JpsStereo");
             anEntry.changeValue() = tr(StImageViewerGUI::trSrcFormatId(anImgInfo->StInfoStream));
@@ -399,7 +387,7 @@ bool StImageLoader::loadImage(const StHandle<StFileNode>& theSource,
         if(!anImageFileL->load(aFilePath, StImageFile::ST_TYPE_JPEG,
                                (uint8_t* )anImg1->Data, (int )anImg1->Length)
         && !anImageFileL->load(aFilePath, StImageFile::ST_TYPE_JPEG,
-                               (uint8_t* )aParser.getBuffer(), (int )aParser.getSize())) {
+                               (uint8_t* )aParser->getBuffer(), (int )aParser->getSize())) {
             processLoadFail(formatError(aFilePath, anImageFileL->getState()));
             return false;
         }
@@ -468,11 +456,10 @@ bool StImageLoader::loadImage(const StHandle<StFileNode>& theSource,
     }
     const double aLoadTimeMSec = aLoadTimer.getElapsedTimeInMilliSec();
 
-    // copy metadata
-    for(size_t aTagIter = 0; aTagIter < anImageFileL->getMetadata().size(); ++aTagIter) {
-        const StDictEntry& aTag = anImageFileL->getMetadata().getFromIndex(aTagIter);
-        anImgInfo->Info.add(aTag);
-    }
+    // keep metadata for deferred extraction (image library releases it on close)
+    myMetaParser = aMetaParser;
+    myMetaImage  = aMetaImage;
+    myMetaLib    = anImageFileL->getMetadata();
 
     // detect information from file name
     bool isAnamorphByName = false;
@@ -602,11 +589,14 @@ bool StImageLoader::loadImage(const StHandle<StFileNode>& theSource,
     myTextureQueue->setConnectedStream(true);
 
     {
+        // decoded images are kept alive by texture queue until uploaded - register them within memory budget
         StImage anImageRefL, anImageRefR;
-        StHandle<StBufferCounter> aRefL = new StImageFileCounter(anImageL);
+        StHandle<StBufferCounter> aRefL = new StMemoryBudgetCounter(new StImageFileCounter(anImageL),
+                                                                    StMemoryBudget::Subsystem_Images, anImageL->getSizeBytes());
         anImageRefL.initReference(*anImageL, aRefL);
         if(!anImageR->isNull()) {
-            StHandle<StBufferCounter> aRefR = new StImageFileCounter(anImageR);
+            StHandle<StBufferCounter> aRefR = new StMemoryBudgetCounter(new StImageFileCounter(anImageR),
+                                                                        StMemoryBudget::Subsystem_Images, anImageR->getSizeBytes());
             anImageRefR.initReference(*anImageR, aRefR);
         }
 
@@ -640,6 +630,8 @@ bool StImageLoader::loadImage(const StHandle<StFileNode>& theSource,
                                        aFormatL));
     }
     anImgInfo->Info.add(StArgument(tr(INFO_LOAD_TIME), StString(aLoadTimeMSec) + " " + tr(INFO_TIME_MSEC)));
+
+    anImgInfo->IsComplete = myMetaParser.isNull() && myMetaLib.isEmpty();
     myLock.lock();
     myImgInfo = anImgInfo;
     myLock.unlock();
@@ -768,6 +760,77 @@ bool StImageLoader::saveImage(const StHandle<StFileNode>&     theSource,
     return true;
 }
 
+void StImageLoader::fillImageInfo() {
+    myLock.lock();
+    StHandle<StImageInfo> anInfo = myImgInfo;
+    myLock.unlock();
+    if(anInfo.isNull()
+    || anInfo->IsComplete) {
+        return;
+    }
+
+    // fill a copy, since current info might be accessed by GUI thread
+    StHandle<StImageInfo> aFullInfo = new StImageInfo(*anInfo);
+    if(!myMetaParser.isNull()) {
+        if(!myMetaParser->getComment().isEmpty()) {
+            StDictEntry& anEntry  = aFullInfo->Info.addChange("Jpeg.Comment");
+            anEntry.changeValue() = myMetaParser->getComment();
+        }
+        if(!myMetaParser->getJpsComment().isEmpty()) {
+            StDictEntry& anEntry  = aFullInfo->Info.addChange("Jpeg.JpsComment");
+            anEntry.changeValue() = myMetaParser->getJpsComment();
+        }
+        if(!myMetaParser->getXMP().isEmpty()) {
+            StDictEntry& anEntry  = aFullInfo->Info.addChange("Jpeg.XMP");
+            anEntry.changeValue() = myMetaParser->getXMP();
+        }
+    }
+    if(!myMetaImage.isNull()) {
+        for(size_t anExifId = 0; anExifId < myMetaImage->Exif.size(); ++anExifId) {
+            metadataFromExif(myMetaImage->Exif[anExifId], aFullInfo);
+        }
+        const StString aTime = myMetaImage->getDateTime();
+        if(!aTime.isEmpty()) {
+            StDictEntry& anEntry  = aFullInfo->Info.addChange("Exif.Image.DateTime");
+            anEntry.changeValue() = aTime;
+        }
+    }
+    for(size_t aTagIter = 0; aTagIter < myMetaLib.size(); ++aTagIter) {
+        aFullInfo->Info.add(myMetaLib.getFromIndex(aTagIter));
+    }
+    aFullInfo->IsComplete = true;
+
+    // release file data
+    myMetaImage.nullify();
+    myMetaParser.nullify();
+    myMetaLib.clear();
+
+    myLock.lock();
+    myImgInfo = aFullInfo;
+    myLock.unlock();
+}
+
+StHandle<StImageInfo> StImageLoader::getFileInfo(const StHandle<StStereoParams>& theParams,
+                                                 const bool                      theToComplete) {
+    myLock.lock();
+    StHandle<StImageInfo> anInfo = myImgInfo;
+    myLock.unlock();
+    if(anInfo.isNull()
+    || anInfo->Id != theParams) {
+        return NULL;
+    } else if(!theToComplete
+           ||  anInfo->IsComplete
+           ||  myAction == Action_Quit) {
+        return anInfo;
+    }
+
+    // request metadata from loader thread without waiting;
+    // caller should check IsComplete flag and request info again later
+    myToFillInfo = true;
+    myLoadNextEvent.set();
+    return anInfo;
+}
+
 bool StImageLoader::saveImageInfo(const StHandle<StImageInfo>& theInfo) {
     if(theInfo.isNull()
     || theInfo->Path.isEmpty()) {
@@ -803,6 +866,19 @@ void StImageLoader::mainLoop() {
     StHandle<StStereoParams> aFileParams;
     for(;;) {
         myLoadNextEvent.wait();
+        if(myToFillInfo) {
+            myToFillInfo = false;
+            fillImageInfo();
+            myLoadNextEvent.reset();
+            if(myAction == Action_NONE
+            && !myToLoadNext) {
+                if(myToFillInfo) {
+                    myLoadNextEvent.set();
+                }
+                continue;
+            }
+        }
+
         switch(myAction) {
             case Action_Quit: {
                 // exit the loop
@@ -837,6 +913,7 @@ void StImageLoader::mainLoop() {
             case Action_NONE:
             default: {
                 // load next image (set as current in playlist)
+                myToLoadNext = false;
                 myLoadNextEvent.reset();
                 if(myPlayList->getCurrentFile(aFileToLoad, aFileParams)) {
                     loadImage(aFileToLoad, aFileParams);
@@ -41,8 +41,9 @@ struct StImageInfo {
     StFormat                 StInfoStream;   //!< source format as stored in file metadata
     StFormat                 StInfoFileName; //!< source format detected from file name
     bool                     IsSavable;      //!< indicate that file can be saved without re-encoding
+    bool                     IsComplete;     //!< indicate that Info includes complete metadata (filled on demand)
 
-    StImageInfo() : ImageType(StImageFile::ST_TYPE_NONE), StInfoStream(StFormat_AUTO), StInfoFileName(StFormat_AUTO), IsSavable(false) {}
+    StImageInfo() : ImageType(StImageFile::ST_TYPE_NONE), StInfoStream(StFormat_AUTO), StInfoFileName(StFormat_AUTO), IsSavable(false), IsComplete(false) {}
 
 };
 
@@ -88,6 +89,7 @@ class StImageLoader {
     ST_LOCAL void mainLoop();
 
     ST_LOCAL void doLoadNext() {
+        myToLoadNext = true;
         myLoadNextEvent.set();
     }
 
@@ -115,12 +117,16 @@ class StImageLoader {
         myLoadNextEvent.set();
     }
 
-    ST_LOCAL StHandle<StImageInfo> getFileInfo(const StHandle<StStereoParams>& theParams) const {
-        myLock.lock();
-        StHandle<StImageInfo> anInfo = myImgInfo;
-        myLock.unlock();
-        return (!anInfo.isNull() && anInfo->Id == theParams) ? anInfo : NULL;
-    }
+    /**
+     * Return information about currently loaded image.
+     * Image is displayed before its metadata is extracted,
+     * so that complete metadata dictionary is filled by loader thread only on request.
+     * @param theParams     image identifier
+     * @param theToComplete request complete metadata from loader thread (returned info remains incomplete till it is filled)
+     * @return image information or NULL if another image is loaded
+     */
+    ST_LOCAL StHandle<StImageInfo> getFileInfo(const StHandle<StStereoParams>& theParams,
+                                               const bool                      theToComplete = false);
 
     ST_LOCAL void setStereoFormat(const StFormat theSrcFormat) {
         myStFormatByUser = theSrcFormat;
@@ -193,6 +199,11 @@ class StImageLoader {
 
     ST_LOCAL bool saveImageInfo(const StHandle<StImageInfo>& theInfo);
 
+    /**
+     * Fill complete metadata of currently loaded image from data kept by loadImage().
+     */
+    ST_LOCAL void fillImageInfo();
+
     ST_LOCAL int getSnapshot(StImage* outDataLeft, StImage* outDataRight, bool isForce = false) {
         return myTextureQueue->getSnapshot(outDataLeft, outDataRight, isForce);
     }
@@ -227,10 +238,15 @@ class StImageLoader {
     StHandle<StGLTextureQueue>  myTextureQueue;  //!< decoded frames queue
     StHandle<StImageInfo>       myImgInfo;       //!< info about currently loaded image
     StHandle<StImageInfo>       myInfoToSave;    //!< modified info to be saved
+    StHandle<StJpegParser>      myMetaParser;    //!< JPEG structure of currently loaded image for deferred metadata extraction
+    StHandle<StJpegParser::Image> myMetaImage;   //!< JPEG image with EXIF of currently loaded image
+    StDictionary                myMetaLib;       //!< metadata of currently loaded image returned by image library
     StHandle<StMsgQueue>        myMsgQueue;      //!< messages queue
 
     volatile StImageFile::ImageClass myImageLib;
     volatile Action            myAction;
+    volatile bool              myToLoadNext;     //!< flag indicating requested loading of the next image
+    volatile bool              myToFillInfo;     //!< flag indicating requested complete metadata
     volatile bool              myIsTheaterMode;  //!< flag indicating theater mode
     volatile bool              myToStickPano360; //!< stick to panorama 360 mode
     volatile bool              myToFlipCubeZ6x1; //!< flip Z within 6x1 cubemap input
@@ -1570,11 +1570,12 @@ void StImageViewer::doFileNext() {
 
 bool StImageViewer::getCurrentFile(StHandle<StFileNode>&     theFileNode,
                                    StHandle<StStereoParams>& theParams,
-                                   StHandle<StImageInfo>&    theInfo) {
+                                   StHandle<StImageInfo>&    theInfo,
+                                   const bool                theToCompleteInfo) {
     theInfo.nullify();
     if(!myPlayList->getCurrentFile(theFileNode, theParams)) {
         return false;
     }
-    theInfo = myLoader->getFileInfo(theParams);
+    theInfo = myLoader->getFileInfo(theParams, theToCompleteInfo);
     return true;
 }
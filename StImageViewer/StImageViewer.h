@@ -181,7 +181,8 @@ class StImageViewer : public StApplication {
      */
     ST_LOCAL bool getCurrentFile(StHandle<StFileNode>&     theFileNode,
                                  StHandle<StStereoParams>& theParams,
-                                 StHandle<StImageInfo>&    theInfo);
+                                 StHandle<StImageInfo>&    theInfo,
+                                 const bool                theToCompleteInfo = false);
 
         private: //! @name private callback Slots
 
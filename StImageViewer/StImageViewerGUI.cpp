@@ -44,6 +44,7 @@
 #include <StGLWidgets/StGLFpsLabel.h>
 
 #include <StImage/StImageFile.h>
+#include <StImage/StFrameBufferPool.h>
 #include <StVersion.h>
 
 #include "StImageViewerStrings.h"
@@ -568,6 +569,8 @@ void StImageViewerGUI::doAboutProgram(const size_t ) {
 
     StArgumentsMap anInfo;
     anInfo.add(StDictEntry("CPU cores", StString(StThread::countLogicalProcessors()) + StString(" logical processor(s)")));
+    anInfo.add(StDictEntry("Memory budget", StMemoryBudget::GetDefault().formatStats()));
+    anInfo.add(StDictEntry("Frame buffers", StFrameBufferPool::GetDefault().formatStats()));
     getContext().stglFullInfo(anInfo);
 
     StGLMessageBox* aDialog = new StGLMessageBox(this, tr(MENU_HELP_ABOUT), "", scale(512), scale(300));
@@ -597,13 +600,20 @@ void StImageViewerGUI::doUserTips(const size_t ) {
     StProcess::openURL("https://sview.ru/en/sview/usertips/");
 }
 
+void StImageViewerGUI::doInfoDialogDestroyed(StGLMessageBox* theDialog) {
+    if(myInfoDialog == theDialog) {
+        myInfoDialog = NULL;
+    }
+}
+
 void StImageViewerGUI::doAboutImage(const size_t ) {
     StHandle<StImageInfo>& anExtraInfo = myPlugin->myFileInfo;
     anExtraInfo.nullify();
+    myInfoDialog = NULL;
 
     StHandle<StFileNode>     aFileNode;
     StHandle<StStereoParams> aParams;
-    if(!myPlugin->getCurrentFile(aFileNode, aParams, anExtraInfo)
+    if(!myPlugin->getCurrentFile(aFileNode, aParams, anExtraInfo, true)
     ||  anExtraInfo.isNull()) {
         anExtraInfo.nullify();
         StGLMessageBox* aMsgBox = new StGLMessageBox(this, tr(DIALOG_FILE_INFO), tr(DIALOG_FILE_NOINFO));
@@ -616,7 +626,8 @@ void StImageViewerGUI::doAboutImage(const size_t ) {
     const StString aTitle  = tr(DIALOG_FILE_INFO);
     StInfoDialog*  aDialog = new StInfoDialog(myPlugin, this, aTitle, scale(512), scale(300));
 
-    // translate known metadata tag names
+    // translate known metadata tag names (within a copy, since info is shared with loader thread)
+    anExtraInfo = new StImageInfo(*anExtraInfo);
     for(size_t aMapIter = 0; aMapIter < anExtraInfo->Info.size(); ++aMapIter) {
         StDictEntry& anEntry = anExtraInfo->Info.changeValue(aMapIter);
         const size_t aSize = anEntry.getValue().getSize();
@@ -686,6 +697,11 @@ void StImageViewerGUI::doAboutImage(const size_t ) {
     aDialog->addButton(tr(BUTTON_CLOSE), true);
     aDialog->stglInit();
     setModalDialog(aDialog);
+    if(!anExtraInfo->IsComplete) {
+        // metadata is extracted by loader thread - show what is ready and refresh the dialog later
+        myInfoDialog = aDialog;
+        aDialog->signals.onDestroy += stSlot(this, &StImageViewerGUI::doInfoDialogDestroyed);
+    }
 }
 
 /**
@@ -1287,6 +1303,7 @@ StImageViewerGUI::StImageViewerGUI(StImageViewer*  thePlugin,
   //
   myFpsWidget(NULL),
   myHKeysTable(NULL),
+  myInfoDialog(NULL),
   //
   myIsMinimalGUI(true) {
     const GLfloat aScale = myPlugin->params.ScaleHiDPI2X->getValue() ? 2.0f : myPlugin->params.ScaleHiDPI ->getValue();
@@ -1562,6 +1579,21 @@ void StImageViewerGUI::stglUpdate(const StPointD_t& thePointZo,
     if(myDescr != NULL) {
         myDescr->setPoint(thePointZo);
     }
+
+    if(myInfoDialog != NULL) {
+        StHandle<StFileNode>     aFileNode;
+        StHandle<StStereoParams> aParams;
+        StHandle<StImageInfo>    anInfo;
+        if(getModalDialog() != myInfoDialog
+        || !myPlugin->getCurrentFile(aFileNode, aParams, anInfo)
+        ||  anInfo.isNull()) {
+            // dialog has been closed or another image has been opened
+            myInfoDialog = NULL;
+        } else if(anInfo->IsComplete) {
+            // replace the dialog with complete metadata
+            doAboutImage(0);
+        }
+    }
 }
 
 void StImageViewerGUI::stglResize(const StGLBoxPx&  theViewPort,
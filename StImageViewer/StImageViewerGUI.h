@@ -193,6 +193,7 @@ class StImageViewerGUI : public StGLRootWidget {
                            const double theDuration);
 
     ST_LOCAL void doAboutProgram(const size_t );
+    ST_LOCAL void doInfoDialogDestroyed(StGLMessageBox* theDialog);
     ST_LOCAL void doUserTips    (const size_t );
     ST_LOCAL void doCheckUpdates(const size_t );
     ST_LOCAL void doOpenLicense (const size_t );
@@ -249,6 +250,7 @@ class StImageViewerGUI : public StGLRootWidget {
     StGLFpsLabel*       myFpsWidget;
 
     StGLTable*          myHKeysTable;
+    StGLMessageBox*     myInfoDialog;       //!< image info dialog waiting for complete metadata
 
     bool                myIsMinimalGUI;
 
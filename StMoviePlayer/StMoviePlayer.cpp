@@ -28,7 +28,11 @@
 #include <StImage/StImageFile.h>
 #include <StSocket/StCheckUpdates.h>
 #include <StSettings/StSettings.h>
+#include <StStrings/StStringBuilder.h>
 #include <StStrings/StStringStream.h>
+#include <StThreads/StProfiler.h>
+#include <StThreads/StStartupTimeline.h>
+#include <StThreads/StThreadBudget.h>
 #include <StCore/StSearchMonitors.h>
 
 #include <StGL/StGLContext.h>
@@ -190,6 +194,7 @@ void StMoviePlayer::updateStrings() {
     params.ToTrackHead->setName(tr(MENU_VIEW_TRACK_HEAD));
     params.ToTrackHeadAudio->setName(tr(MENU_VIEW_TRACK_HEAD_AUDIO));
     params.ToForceBFormat->setName(stCString("Force B-Format"));
+    params.ToUseAlCallback->setName(stCString("Low-latency audio output"));
     params.ToShowFps->setName(tr(MENU_FPS_METER));
     params.ToShowMenu->setName(stCString("Show main menu"));
     params.ToShowTopbar->setName(stCString("Show top toolbar"));
@@ -202,6 +207,7 @@ void StMoviePlayer::updateStrings() {
     params.ToUseDeepColor->setName(tr(OPTION_USE_DEEP_COLOR));
     params.ToLimitFps->setName(tr(MENU_FPS_BOUND));
     params.ToSmoothUploads->setName("Smooth texture uploading");
+    params.ToBoostThreads->setName(stCString("Prioritize rendering and audio threads"));
     params.StartWebUI->setName(stCString("Web UI start option"));
     params.StartWebUI->defineOption(WEBUI_OFF,  tr(MENU_MEDIA_WEBUI_OFF));
     params.StartWebUI->defineOption(WEBUI_ONCE, tr(MENU_MEDIA_WEBUI_ONCE));
@@ -233,6 +239,7 @@ void StMoviePlayer::updateStrings() {
     params.UseOpenJpeg->setName(stCString("Use OpenJPEG instead of jpeg2000"));
     params.SnapshotImgType->setName(stCString("Snapshot Image Format"));
     params.Benchmark->setName(stCString("Benchmark"));
+    params.Profiler->setName(stCString("Profiler"));
     myLangMap->params.language->setName(tr(MENU_HELP_LANGS));
 }
 
@@ -242,6 +249,7 @@ StMoviePlayer::StMoviePlayer(const StHandle<StResourceManager>& theResMgr,
 : StApplication(theResMgr, theParentWin, theOpenInfo),
   myPlayList(new StPlayList(4, true)),
   myEventLoaded(false),
+  myEventThumbs(false),
   mySeekOnLoad(-1.0),
   myAudioOnLoad(-1),
   mySubsOnLoad(-1),
@@ -251,8 +259,14 @@ StMoviePlayer::StMoviePlayer(const StHandle<StResourceManager>& theResMgr,
   myToUpdateALList(false),
   myToCheckUpdates(true),
   myToCheckPoorOrient(true) {
-    mySettings = new StSettings(myResMgr, ST_DRAWER_PLUGIN_NAME);
-    myLangMap  = new StTranslations(myResMgr, StMoviePlayer::ST_DRAWER_PLUGIN_NAME);
+    {
+        ST_STARTUP_PHASE("StSettings");
+        mySettings = new StSettings(myResMgr, ST_DRAWER_PLUGIN_NAME);
+    }
+    {
+        ST_STARTUP_PHASE("StTranslations");
+        myLangMap  = new StTranslations(myResMgr, StMoviePlayer::ST_DRAWER_PLUGIN_NAME);
+    }
     myOpenDialog = new StMovieOpenDialog(this);
     StMoviePlayerStrings::loadDefaults(*myLangMap);
     myLangMap->params.language->signals.onChanged += stSlot(this, &StMoviePlayer::doChangeLanguage);
@@ -343,6 +357,7 @@ StMoviePlayer::StMoviePlayer(const StHandle<StResourceManager>& theResMgr,
     params.ToTrackHead      = new StBoolParamNamed(true,  stCString("toTrackHead"));
     params.ToTrackHeadAudio = new StBoolParamNamed(true,  stCString("toTrackHeadAudio"));
     params.ToForceBFormat   = new StBoolParamNamed(false, stCString("toForceBFormat"));
+    params.ToUseAlCallback  = new StBoolParamNamed(false, stCString("toUseAlCallback"));
     params.ToShowFps   = new StBoolParamNamed(false, stCString("toShowFps"));
     params.ToShowMenu  = new StBoolParamNamed(true,  stCString("toShowMenu"));
     params.ToShowTopbar= new StBoolParamNamed(true,  stCString("toShowTopbar"));
@@ -355,6 +370,7 @@ StMoviePlayer::StMoviePlayer(const StHandle<StResourceManager>& theResMgr,
     params.SlideShowDelay->setStep(1.0f);
     params.SlideShowDelay->setTolerance(0.1f);
     params.SlideShowDelay->setFormat(stCString("%01.1f s"));
+    params.ReadAheadMiB = new StInt32ParamNamed(0, stCString("readAheadMiB"));
     params.IsMobileUI  = new StBoolParamNamed(StWindow::isMobile(), stCString("isMobileUI"));
     params.IsMobileUI->signals.onChanged = stSlot(this, &StMoviePlayer::doChangeMobileUI);
     params.IsMobileUISwitch = new StBoolParam(params.IsMobileUI->getValue());
@@ -369,6 +385,7 @@ StMoviePlayer::StMoviePlayer(const StHandle<StResourceManager>& theResMgr,
 #endif
     params.ToLimitFps       = new StBoolParamNamed(true, stCString("toLimitFps"));
     params.ToSmoothUploads  = new StBoolParamNamed(true, stCString("toSmoothUploads"));
+    params.ToBoostThreads   = new StBoolParamNamed(false, stCString("toBoostThreads"));
     params.StartWebUI       = new StEnumParam(WEBUI_OFF, stCString("webuiOn"));
     params.ToPrintWebErrors = new StBoolParamNamed(true,  stCString("webuiShowErrors"));
     params.IsLocalWebUI     = new StBoolParamNamed(false, stCString("isLocalWebUI"));
@@ -394,6 +411,8 @@ StMoviePlayer::StMoviePlayer(const StHandle<StResourceManager>& theResMgr,
     params.SnapshotImgType = new StInt32ParamNamed(StImageFile::ST_TYPE_JPEG, stCString("snapImgType"));
     params.Benchmark = new StBoolParamNamed(false, stCString("benchmark"));
     params.Benchmark->signals.onChanged = stSlot(this, &StMoviePlayer::doSetBenchmark);
+    params.Profiler = new StBoolParamNamed(false, stCString("profiler"));
+    params.Profiler->signals.onChanged = stSlot(this, &StMoviePlayer::doSetProfiler);
 
     updateStrings();
 
@@ -432,10 +451,12 @@ StMoviePlayer::StMoviePlayer(const StHandle<StResourceManager>& theResMgr,
     mySettings->loadParam (params.ToStickPanorama);
     mySettings->loadParam (params.ToTrackHeadAudio);
     mySettings->loadParam (params.ToForceBFormat);
+    mySettings->loadParam (params.ToUseAlCallback);
     mySettings->loadParam (params.AudioAlOutput);
     mySettings->loadParam (params.AudioAlHrtf);
     mySettings->loadParam (params.ToShowFps);
     mySettings->loadParam (params.SlideShowDelay);
+    mySettings->loadParam (params.ReadAheadMiB);
     mySettings->loadParam (params.ToMixImagesVideos);
     mySettings->loadParam (params.IsMobileUI);
     mySettings->loadParam (params.IsExclusiveFullScreen);
@@ -443,6 +464,7 @@ StMoviePlayer::StMoviePlayer(const StHandle<StResourceManager>& theResMgr,
     mySettings->loadParam (params.ToUseDeepColor);
     mySettings->loadParam (params.ToLimitFps);
     mySettings->loadParam (params.ToSmoothUploads);
+    mySettings->loadParam (params.ToBoostThreads);
     mySettings->loadParam (params.UseGpu);
     mySettings->loadParam (params.UseOpenJpeg);
 
@@ -469,19 +491,24 @@ StMoviePlayer::StMoviePlayer(const StHandle<StResourceManager>& theResMgr,
     params.AudioAlOutput->signals.onChanged.connect(this, &StMoviePlayer::doSwitchAudioAlHints);
     params.AudioAlHrtf  ->signals.onChanged.connect(this, &StMoviePlayer::doSwitchAudioAlHints);
     params.ToForceBFormat->signals.onChanged = stSlot(this, &StMoviePlayer::doSetForceBFormat);
+    params.ToUseAlCallback->signals.onChanged = stSlot(this, &StMoviePlayer::doSetAlCallbackOutput);
+    params.ToBoostThreads->signals.onChanged = stSlot(this, &StMoviePlayer::doSetBoostThreads);
 
-#if defined(__ANDROID__)
-    addRenderer(new StOutInterlace  (myResMgr, theParentWin));
-    addRenderer(new StOutAnaglyph   (myResMgr, theParentWin));
-    addRenderer(new StOutDistorted  (myResMgr, theParentWin));
-#else
-    addRenderer(new StOutAnaglyph   (myResMgr, theParentWin));
-    addRenderer(new StOutDual       (myResMgr, theParentWin));
-    addRenderer(new StOutIZ3D       (myResMgr, theParentWin));
-    addRenderer(new StOutInterlace  (myResMgr, theParentWin));
-    addRenderer(new StOutDistorted  (myResMgr, theParentWin));
-    addRenderer(new StOutPageFlipExt(myResMgr, theParentWin));
-#endif
+    {
+        ST_STARTUP_PHASE("StMoviePlayer, output plugins");
+    #if defined(__ANDROID__)
+        addRenderer(new StOutInterlace  (myResMgr, theParentWin));
+        addRenderer(new StOutAnaglyph   (myResMgr, theParentWin));
+        addRenderer(new StOutDistorted  (myResMgr, theParentWin));
+    #else
+        addRenderer(new StOutAnaglyph   (myResMgr, theParentWin));
+        addRenderer(new StOutDual       (myResMgr, theParentWin));
+        addRenderer(new StOutIZ3D       (myResMgr, theParentWin));
+        addRenderer(new StOutInterlace  (myResMgr, theParentWin));
+        addRenderer(new StOutDistorted  (myResMgr, theParentWin));
+        addRenderer(new StOutPageFlipExt(myResMgr, theParentWin));
+    #endif
+    }
 
     // no need in Depth buffer
     const StWinAttr anAttribs[] = {
@@ -787,8 +814,10 @@ void StMoviePlayer::saveAllParams() {
         mySettings->saveParam (params.ToTrackHead);
         mySettings->saveParam (params.ToTrackHeadAudio);
         mySettings->saveParam (params.ToForceBFormat);
+        mySettings->saveParam (params.ToUseAlCallback);
         mySettings->saveParam (params.ToShowFps);
         mySettings->saveParam (params.SlideShowDelay);
+        mySettings->saveParam (params.ReadAheadMiB);
         mySettings->saveParam (params.ToMixImagesVideos);
         mySettings->saveParam (params.IsMobileUI);
         mySettings->saveParam (params.IsExclusiveFullScreen);
@@ -796,6 +825,7 @@ void StMoviePlayer::saveAllParams() {
         mySettings->saveParam (params.ToUseDeepColor);
         mySettings->saveParam (params.ToLimitFps);
         mySettings->saveParam (params.ToSmoothUploads);
+        mySettings->saveParam (params.ToBoostThreads);
         mySettings->saveParam (params.UseGpu);
         mySettings->saveParam (params.UseOpenJpeg);
         if(!params.IsLocalWebUI->getValue()) {
@@ -866,6 +896,7 @@ bool StMoviePlayer::createGui(StHandle<StGLTextureQueue>& theTextureQueue,
     doChangeMobileUI(params.IsMobileUI->getValue());
     myGUI = new StMoviePlayerGUI(this, myWindow.access(), myLangMap.access(), myPlayList,
                                  theTextureQueue, theSubQueue1, theSubQueue2);
+    myEventThumbs.set(); // pass thumbnails to the new seek bar
     myGUI->setContext(myContext);
     theTextureQueue->setDeviceCaps(myContext->getDeviceCaps());
 
@@ -901,11 +932,17 @@ bool StMoviePlayer::createGui(StHandle<StGLTextureQueue>& theTextureQueue,
     myGUI->myImage->params.SeparationRot->setValue(0.01f * loadedSepRot);
 
     // initialize frame region early to show dedicated error description
-    if(!myGUI->myImage->stglInit()) {
-        return false;
+    {
+        ST_STARTUP_PHASE("StGLImageRegion::stglInit");
+        if(!myGUI->myImage->stglInit()) {
+            return false;
+        }
     }
 
-    myGUI->stglInit();
+    {
+        ST_STARTUP_PHASE("StMoviePlayerGUI::stglInit");
+        myGUI->stglInit();
+    }
     StRectF_t aFrustL, aFrustR;
     if(myWindow->getCustomProjection(aFrustL, aFrustR)) {
         myGUI->changeCamera()->setCustomProjection(aFrustL, aFrustR);
@@ -1036,6 +1073,7 @@ bool StMoviePlayer::init() {
     // initialize GL context
     myContext = myWindow->getContext();
     myContext->setMessagesQueue(myMsgQueue);
+    StProfiler::GetDefault().setThreadName("Render");
     if(!myContext->isGlGreaterEqual(2, 0)) {
         myMsgQueue->pushError(stCString("OpenGL 2.0 is required by Movie Player!"));
         myMsgQueue->popAll();
@@ -1065,7 +1103,12 @@ bool StMoviePlayer::init() {
     // create the GUI with default values
     StHandle<StGLTextureQueue> aTextureQueue;
     StHandle<StSubQueue>       aSubQueue1, aSubQueue2;
-    if(!createGui(aTextureQueue, aSubQueue1, aSubQueue2)) {
+    bool isGuiCreated = false;
+    {
+        ST_STARTUP_PHASE("StMoviePlayer::createGui");
+        isGuiCreated = createGui(aTextureQueue, aSubQueue1, aSubQueue2);
+    }
+    if(!isGuiCreated) {
         myMsgQueue->pushError(stCString("Movie Player - critical error:\n"
                                         "Frame region initialization failed!"));
         myMsgQueue->popAll();
@@ -1079,22 +1122,29 @@ bool StMoviePlayer::init() {
 
     // create the video playback thread
     if(!isReset) {
+        ST_STARTUP_PHASE("StVideo");
         myVideo = new StVideo(params.AudioAlDevice->getCTitle(),
                               (StAudioQueue::StAlHintOutput )params.AudioAlOutput->getValue(),
                               (StAudioQueue::StAlHintHrtf   )params.AudioAlHrtf->getValue(),
                               myResMgr, myLangMap, myPlayList,
                               aTextureQueue, aSubQueue1, aSubQueue2);
-        myVideo->signals.onError  = stSlot(myMsgQueue.access(), &StMsgQueue::doPushError);
-        myVideo->signals.onLoaded = stSlot(this,                &StMoviePlayer::doLoaded);
+        myVideo->signals.onError      = stSlot(myMsgQueue.access(), &StMsgQueue::doPushError);
+        myVideo->signals.onLoaded     = stSlot(this,                &StMoviePlayer::doLoaded);
+        myVideo->signals.onThumbnails = stSlot(this,                &StMoviePlayer::doThumbnails);
         myVideo->params.UseGpu       = params.UseGpu;
         myVideo->params.UseOpenJpeg  = params.UseOpenJpeg;
         myVideo->params.ToAutoLoadSubs = params.ToAutoLoadSubs;
         myVideo->params.ToSearchSubs = params.ToSearchSubs;
         myVideo->params.ToTrackHeadAudio = params.ToTrackHeadAudio;
         myVideo->params.SlideShowDelay = params.SlideShowDelay;
+        myVideo->params.ReadAheadMiB   = params.ReadAheadMiB;
         myVideo->setSwapJPS(params.ToSwapJPS->getValue());
         myVideo->setStickPano360(params.ToStickPanorama->getValue());
         myVideo->setForceBFormat(params.ToForceBFormat->getValue());
+        myVideo->setAlCallbackOutput(params.ToUseAlCallback->getValue());
+        if(params.ToBoostThreads->getValue()) {
+            doSetBoostThreads(true);
+        }
         doChangeMixImagesVideos(params.ToMixImagesVideos->getValue());
 
     #ifdef ST_HAVE_MONGOOSE
@@ -1106,9 +1156,11 @@ bool StMoviePlayer::init() {
     myPlayList->setShuffle   (params.IsShuffle   ->getValue());
     myPlayList->setLoopSingle(params.ToLoopSingle->getValue());
 
-    StString aRecentList;
-    mySettings->loadString(ST_SETTING_RECENT_FILES, aRecentList);
-    myPlayList->loadRecentList(aRecentList);
+    if(!waitRecentListLoad()) {
+        StString aRecentList;
+        mySettings->loadString(ST_SETTING_RECENT_FILES, aRecentList);
+        myPlayList->loadRecentList(aRecentList);
+    }
 
     if(isReset) {
         if(params.IsFullscreen->getValue()) {
@@ -1144,6 +1196,7 @@ void StMoviePlayer::parseArguments(const StArgumentsMap& theArguments) {
     StArgument anArgShuffle    = theArguments[params.IsShuffle->getKey()];
     StArgument anArgLoopSingle = theArguments[params.ToLoopSingle->getKey()];
     StArgument anArgBenchmark  = theArguments[params.Benchmark->getKey()];
+    StArgument anArgProfiler   = theArguments[params.Profiler->getKey()];
     StArgument anArgShowMenu   = theArguments[params.ToShowMenu->getKey()];
     StArgument anArgShowTopbar = theArguments[params.ToShowTopbar->getKey()];
     StArgument anArgMixImages  = theArguments[params.ToMixImagesVideos->getKey()];
@@ -1206,6 +1259,9 @@ void StMoviePlayer::parseArguments(const StArgumentsMap& theArguments) {
     if(anArgBenchmark.isValid()) {
         params.Benchmark->setValue(!anArgBenchmark.isValueOff());
     }
+    if(anArgProfiler.isValid()) {
+        params.Profiler->setValue(!anArgProfiler.isValueOff());
+    }
     if(anArgShowMenu.isValid()) {
         params.ToShowMenu->setValue(!anArgShowMenu.isValueOff());
     }
@@ -1217,10 +1273,44 @@ void StMoviePlayer::parseArguments(const StArgumentsMap& theArguments) {
     }
 }
 
+void StMoviePlayer::startRecentListLoad() {
+    if(!myRecentLoader.isNull()) {
+        return;
+    }
+
+    mySettings->loadString(ST_SETTING_RECENT_FILES, myRecentToLoad);
+    myRecentLoader = new StThread(recentListThread, (void* )this, "StMoviePlayer");
+}
+
+bool StMoviePlayer::waitRecentListLoad() {
+    if(myRecentLoader.isNull()) {
+        return false;
+    }
+
+    myRecentLoader->wait();
+    myRecentLoader.nullify();
+    myRecentToLoad.clear();
+    return true;
+}
+
+SV_THREAD_FUNCTION StMoviePlayer::recentListThread(void* thePlayer) {
+    StMoviePlayer* aPlayer = (StMoviePlayer* )thePlayer;
+    ST_STARTUP_PHASE("StPlayList::loadRecentList");
+    aPlayer->myPlayList->loadRecentList(aPlayer->myRecentToLoad);
+    return SV_THREAD_RETURN 0;
+}
+
 bool StMoviePlayer::open() {
     const bool isReset = !mySwitchTo.isNull();
+    if(!isReset
+    && myGUI.isNull()) {
+        // independent from GL context
+        startRecentListLoad();
+    }
+
     if(!StApplication::open()
     || !init()) {
+        waitRecentListLoad();
         myMsgQueue->popAll();
         return false;
     }
@@ -1810,6 +1900,12 @@ void StMoviePlayer::beforeDraw() {
     }
     if(myGUI->mySeekBar != NULL) {
         myGUI->mySeekBar->setProgress(GLfloat(aPosition));
+        if(myEventThumbs.checkReset()) {
+            StHandle<StImagePlane> aThumbs;
+            int aNbThumbs = 0, aThumbSizeX = 0, aThumbSizeY = 0;
+            myVideo->getThumbnails(aThumbs, aNbThumbs, aThumbSizeX, aThumbSizeY);
+            myGUI->mySeekBar->setThumbnails(aThumbs, aNbThumbs, aThumbSizeX, aThumbSizeY);
+        }
     }
     myGUI->stglUpdate(myWindow->getMousePos(), myWindow->isPreciseCursor());
 
@@ -2011,6 +2107,11 @@ bool StMoviePlayer::hasAlHintOutput() const {
          && myVideo->hasAlHintOutput();
 }
 
+bool StMoviePlayer::hasAlCallbackOutput() const {
+    return !myVideo.isNull()
+         && myVideo->hasAlCallbackOutput();
+}
+
 bool StMoviePlayer::hasAlHintHrtf() const {
     return !myVideo.isNull()
          && myVideo->hasAlHintHrtf();
@@ -2029,6 +2130,19 @@ void StMoviePlayer::doSetForceBFormat(const bool theValue) {
     }
 }
 
+void StMoviePlayer::doSetAlCallbackOutput(const bool theValue) {
+    if(!myVideo.isNull()) {
+        myVideo->setAlCallbackOutput(theValue);
+    }
+}
+
+void StMoviePlayer::doSetBoostThreads(const bool theValue) {
+    // audio thread picks up the flag on its own
+    StThreadBudget& aBudget = StThreadBudget::GetDefault();
+    aBudget.setBoostThreads(theValue);
+    aBudget.applyThreadRole(StThreadBudget::ThreadRole_Render);
+}
+
 void StMoviePlayer::doSetAudioVolume(const float theGaindB) {
     if(!myVideo.isNull()
     && !params.AudioMute->getValue()) {
@@ -2210,6 +2324,10 @@ void StMoviePlayer::doLoaded() {
     myEventLoaded.set();
 }
 
+void StMoviePlayer::doThumbnails() {
+    myEventThumbs.set();
+}
+
 void StMoviePlayer::doListFirst(const size_t ) {
     if(myPlayList->walkToFirst()) {
         myVideo->doLoadNext();
@@ -2413,6 +2531,24 @@ void StMoviePlayer::doSetBenchmark(const bool theValue) {
     myVideo->setBenchmark(theValue);
 }
 
+void StMoviePlayer::doSetProfiler(const bool theValue) {
+    StProfiler& aProfiler = StProfiler::GetDefault();
+    aProfiler.setEnabled(theValue);
+    if(theValue) {
+        // frame time breakdown is displayed by FPS meter
+        params.ToShowFps->setValue(true);
+        return;
+    }
+
+    // dump recorded zones on disabling the profiler
+    const StString aTracePath = myResMgr->getCacheFolder() + "sview-trace.json";
+    if(aProfiler.exportChromeTrace(aTracePath)) {
+        myMsgQueue->pushInfo(StString("Profiler trace has been saved into\n") + aTracePath);
+    } else {
+        myMsgQueue->pushError(StString("Unable to save profiler trace into\n") + aTracePath);
+    }
+}
+
 bool StMoviePlayer::getCurrentFile(StHandle<StFileNode>&     theFileNode,
                                    StHandle<StStereoParams>& theParams,
                                    StHandle<StMovieInfo>&    theInfo) {
@@ -2489,11 +2625,11 @@ int StMoviePlayer::beginRequest(mg_connection*         theConnection,
           double aDuration = 0.0, aPts = 0.0;
           bool isVideoPlayed = false, isAudioPlayed = false;
           const bool isPlaying = myVideo->getPlaybackState(aDuration, aPts, isVideoPlayed, isAudioPlayed);
-            aContent = StString(myPlayList->getSerial())
+            aContent = (StStringBuilder() + myPlayList->getSerial()
                      + ":" + myPlayList->getCurrentId()
                      + ":" + int(gainToVolume(params.AudioGain) * 100.0f)
                      + ":" + int(params.AudioMute->getValue())
-                     + ":" + int(isPlaying);
+                     + ":" + int(isPlaying)).toString();
         } else if(aQuery.isEquals(stCString("title"))) {
             aContent = myPlayList->getCurrentTitle();
         }
@@ -112,6 +112,11 @@ class StMoviePlayer : public StApplication {
      */
     ST_LOCAL void doLoaded();
 
+    /**
+     * Handler for seek bar thumbnails change event.
+     */
+    ST_LOCAL void doThumbnails();
+
     ST_LOCAL void doPlayListReverse(const size_t dummy = 0);
     ST_LOCAL void doListFirst(const size_t dummy = 0);
     ST_LOCAL void doListPrev(const size_t dummy = 0);
@@ -177,6 +182,11 @@ class StMoviePlayer : public StApplication {
      */
     ST_CPPEXPORT bool hasAlHintOutput() const;
 
+    /**
+     * Return TRUE if OpenAL implementation supports callback output.
+     */
+    ST_CPPEXPORT bool hasAlCallbackOutput() const;
+
     /**
      * Return TRUE if OpenAL implementation provides HRTF mixing feature.
      */
@@ -220,6 +230,7 @@ class StMoviePlayer : public StApplication {
         StHandle<StBoolParamNamed>    ToTrackHead;       //!< enable/disable head-tracking
         StHandle<StBoolParamNamed>    ToTrackHeadAudio;  //!< enable/disable head-tracking for audio listener
         StHandle<StBoolParamNamed>    ToForceBFormat;    //!< force B-Format for any 4-channels audio stream
+        StHandle<StBoolParamNamed>    ToUseAlCallback;   //!< low-latency audio output pulled by OpenAL mixer
         StHandle<StBoolParamNamed>    ToShowPlayList;    //!< display playlist
         StHandle<StBoolParamNamed>    ToShowAdjustImage; //!< display image adjustment overlay
         StHandle<StBoolParamNamed>    ToShowFps;         //!< display FPS meter
@@ -228,11 +239,13 @@ class StMoviePlayer : public StApplication {
         StHandle<StBoolParamNamed>    ToShowBottom;      //!< show bottom (seekbar)
         StHandle<StBoolParamNamed>    ToMixImagesVideos; //!< mix videos and images
         StHandle<StFloat32Param>      SlideShowDelay;    //!< slideshow delay
+        StHandle<StInt32ParamNamed>   ReadAheadMiB;      //!< read-ahead buffer size in MiB for local files (0 means disabled)
         StHandle<StBoolParamNamed>    IsMobileUI;        //!< display mobile interface (user option)
         StHandle<StBoolParam>         IsMobileUISwitch;  //!< display mobile interface (actual value)
         StHandle<StBoolParamNamed>    IsExclusiveFullScreen; //!< exclusive fullscreen mode
         StHandle<StBoolParamNamed>    ToLimitFps;        //!< limit CPU usage or not
         StHandle<StBoolParamNamed>    ToSmoothUploads;   //!< smooth texture uploads
+        StHandle<StBoolParamNamed>    ToBoostThreads;    //!< raise priority and dedicate processors to rendering and audio threads
         StHandle<StBoolParamNamed>    IsVSyncOn;         //!< flag to use VSync
         StHandle<StBoolParamNamed>    ToUseDeepColor;    //!< flag to use Deep Color
         StHandle<StEnumParam>         StartWebUI;        //!< to start Web UI or not
@@ -253,6 +266,7 @@ class StMoviePlayer : public StApplication {
         StHandle<StBoolParamNamed>    UseGpu;            //!< use video decoding on GPU when available
         StHandle<StBoolParamNamed>    UseOpenJpeg;       //!< use OpenJPEG (libopenjpeg) instead of built-in jpeg2000 decoder
         StHandle<StBoolParamNamed>    Benchmark;         //!< benchmark flag
+        StHandle<StBoolParamNamed>    Profiler;          //!< record profiler zones and show frame time breakdown
 
     } params;
 
@@ -290,6 +304,22 @@ class StMoviePlayer : public StApplication {
      */
     ST_LOCAL void parseArguments(const StArgumentsMap& theArguments);
 
+    /**
+     * Start parsing of recent files list in background thread (overlaps with window creation).
+     */
+    ST_LOCAL void startRecentListLoad();
+
+    /**
+     * Wait parsing of recent files list started by startRecentListLoad().
+     * @return FALSE if background parsing has not been started
+     */
+    ST_LOCAL bool waitRecentListLoad();
+
+    /**
+     * Thread function parsing recent files list.
+     */
+    ST_LOCAL static SV_THREAD_FUNCTION recentListThread(void* thePlayer);
+
     /**
      * Release GL resources.
      */
@@ -315,6 +345,8 @@ class StMoviePlayer : public StApplication {
     ST_LOCAL void doSwitchAudioDevice(const int32_t theDevId);
     ST_LOCAL void doSwitchAudioAlHints(const int32_t );
     ST_LOCAL void doSetForceBFormat(const bool theToForce);
+    ST_LOCAL void doSetAlCallbackOutput(const bool theToUse);
+    ST_LOCAL void doSetBoostThreads(const bool theToBoost);
     ST_LOCAL void doSetAudioVolume(const float theGain);
     ST_LOCAL void doSetAudioMute(const bool theToMute);
     ST_LOCAL void doSetAudioDelay(const float theDelaySec);
@@ -338,6 +370,7 @@ class StMoviePlayer : public StApplication {
     ST_LOCAL void doImageAdjustReset(const size_t dummy = 0);
     ST_LOCAL void doHideSystemBars(const bool theToHide);
     ST_LOCAL void doSetBenchmark(const bool theValue);
+    ST_LOCAL void doSetProfiler(const bool theValue);
 
         public:
 
@@ -414,8 +447,11 @@ class StMoviePlayer : public StApplication {
     StHandle<StFileNode>        myFileToDelete;    //!< file node for removal
     StHandle<StMovieInfo>       myFileInfo;        //!< file info for opened dialog
     StHandle<StMovieOpenDialog> myOpenDialog;      //!< file open dialog
+    StHandle<StThread>          myRecentLoader;    //!< background parsing of recent files list at startup
+    StString                    myRecentToLoad;    //!< recent files list read from settings for background parsing
 
     StCondition                 myEventLoaded;     //!< indicate that new file was open
+    StCondition                 myEventThumbs;     //!< indicate that seek bar thumbnails have been changed
     StTimer                     myInactivityTimer; //!< timer initialized when application goes into paused state
     double                      mySeekOnLoad;      //!< seeking target
     int32_t                     myAudioOnLoad;     //!< audio     track on load
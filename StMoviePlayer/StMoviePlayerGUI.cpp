@@ -28,7 +28,9 @@
 
 #include <StCore/StSearchMonitors.h>
 #include <StImage/StImageFile.h>
+#include <StImage/StFrameBufferPool.h>
 #include <StSettings/StEnumParam.h>
+#include <StThreads/StThreadBudget.h>
 
 #include <StGLWidgets/StGLAssignHotKey.h>
 #include <StGLWidgets/StGLButton.h>
@@ -381,6 +383,7 @@ StGLMenu* StMoviePlayerGUI::createMediaMenu() {
 
     if(myPlugin->params.ToShowExtra->getValue()) {
         aMenuMedia->addItem(myPlugin->params.Benchmark->getName(), myPlugin->params.Benchmark);
+        aMenuMedia->addItem(myPlugin->params.Profiler->getName(),  myPlugin->params.Profiler);
     }
 
     aMenuMedia->addItem(tr(MENU_MEDIA_QUIT), myPlugin->getAction(StMoviePlayer::Action_Quit));
@@ -947,6 +950,9 @@ void StMoviePlayerGUI::doAboutProgram(const size_t ) {
 
     StDictionary anInfo;
     anInfo.add(StDictEntry("CPU cores", StString(StThread::countLogicalProcessors()) + StString(" logical processor(s)")));
+    anInfo.add(StDictEntry("Decoding threads", StThreadBudget::GetDefault().formatStats()));
+    anInfo.add(StDictEntry("Memory budget", StMemoryBudget::GetDefault().formatStats()));
+    anInfo.add(StDictEntry("Frame buffers", StFrameBufferPool::GetDefault().formatStats()));
     getContext().stglFullInfo(anInfo);
     anInfo.add(StDictEntry("Display Scale", StString(myWindow->getMonitors()[myWindow->getPlacement().center()].getScale()) + "x"));
 
@@ -2327,9 +2333,15 @@ void StMoviePlayerGUI::stglDraw(unsigned int theView) {
         myImage->getTextureQueue()->getQueueInfo(myFpsWidget->changePlayQueued(),
                                                  myFpsWidget->changePlayQueueLength(),
                                                  myFpsWidget->changePlayFps());
+        StString anExtraInfo = myPlugin->getMainWindow()->getStatistics();
+        const StVideoQueue::DecodeLoad aDecodeLoad = myPlugin->myVideo->getDecodeLoad();
+        if(aDecodeLoad != StVideoQueue::DecodeLoad_Full) {
+            anExtraInfo = StString("Decoding load ") + int(aDecodeLoad) + ": " + StVideoQueue::decodeLoadString(aDecodeLoad)
+                        + (anExtraInfo.isEmpty() ? "" : "\n") + anExtraInfo;
+        }
         myFpsWidget->update(myPlugin->getMainWindow()->isStereoOutput(),
                             myPlugin->getMainWindow()->getTargetFps(),
-                            myPlugin->getMainWindow()->getStatistics());
+                            anExtraInfo);
     }
     StGLRootWidget::stglDraw(theView);
 }
@@ -2487,6 +2499,9 @@ void StMoviePlayerGUI::doMobileSettings(const size_t ) {
     } else if(myPlugin->hasAlHintHrtf()) {
         aParams.add(myPlugin->params.AudioAlHrtf); // legacy option
     }
+    if(myPlugin->hasAlCallbackOutput()) {
+        aParams.add(myPlugin->params.ToUseAlCallback);
+    }
     aParams.add(myPlugin->params.ToAutoLoadSubs);
 
     if(avcodec_find_decoder_by_name("libopenjpeg") != NULL) {
@@ -2502,6 +2517,7 @@ void StMoviePlayerGUI::doMobileSettings(const size_t ) {
 #endif
     aParams.add(myPlugin->params.ToUseDeepColor);
     aParams.add(myPlugin->params.ToSmoothUploads);
+    aParams.add(myPlugin->params.ToBoostThreads);
     if(isMobile()) {
         //aParams.add(myPlugin->params.ToHideStatusBar);
         aParams.add(myPlugin->params.ToHideNavBar);
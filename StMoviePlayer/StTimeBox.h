@@ -22,6 +22,7 @@
 #include <StGLWidgets/StGLTextureButton.h>
 #include <StGLWidgets/StGLTextArea.h>
 #include <StStrings/StFormatTime.h>
+#include <StStrings/StStringBuilder.h>
 
 class ST_LOCAL StTimeBox : public StGLTextureButton {
 
@@ -102,8 +103,8 @@ class ST_LOCAL StTimeBox : public StGLTextureButton {
         && (theDurationSec > 0.1 || myDurationSec < 0.0)) {
             int aWidth  = 0;
             int aHeight = 0;
-            myTextArea->computeTextWidth(StFormatTime::formatSeconds(theDurationSec) + " / "
-                                       + StFormatTime::formatSeconds(theDurationSec),
+            myTextArea->computeTextWidth((StStringBuilder() + StFormatTime::formatSeconds(theDurationSec) + " / "
+                                                             + StFormatTime::formatSeconds(theDurationSec)).toString(),
                                         -1.0f, aWidth, aHeight);
             const int aWidthNew = aWidth + myMargins.left + myMargins.right;
             const int aWidthOld = getRectPx().width();
@@ -118,8 +119,8 @@ class ST_LOCAL StTimeBox : public StGLTextureButton {
         myProgressSec = theProgressSec;
         myDurationSec = theDurationSec;
         if(myToShowElapsed) {
-            myTextArea->setText(StFormatTime::formatSeconds(myProgressSec) + " / "
-                              + StFormatTime::formatSeconds(myDurationSec));
+            myTextArea->setText((StStringBuilder() + StFormatTime::formatSeconds(myProgressSec) + " / "
+                                                    + StFormatTime::formatSeconds(myDurationSec)).toString());
         } else {
             myTextArea->setText(StFormatTime::formatSeconds(myProgressSec - myDurationSec));
         }
@@ -94,8 +94,12 @@ StALContext::StALContext()
   hasExtDisconnect(false),
   hasExtSoftOutMode(false),
   hasExtSoftHrtf(false),
+  hasExtSoftCallback(false),
+  hasExtSoftClock(false),
   alcGetStringiSOFT(NULL),
   alcResetDeviceSOFT(NULL),
+  alBufferCallbackSOFT(NULL),
+  alcGetInteger64vSOFT(NULL),
   myAlDevice(NULL),
   myAlContext(NULL) {
     stalGlobalInit();
@@ -113,6 +117,8 @@ StString StALContext::toStringExtensions() const {
     if(hasExtMultiChannel){ anExtList += "multi-channel "; }
     if(hasExtBFormat)     { anExtList += "B-Format "; }
     if(hasExtDisconnect)  { anExtList += "ALC_EXT_disconnect "; }
+    if(hasExtSoftCallback){ anExtList += "AL_SOFT_callback_buffer "; }
+    if(hasExtSoftClock)   { anExtList += "ALC_SOFT_device_clock "; }
     if(hasExtSoftOutMode) {
         ALCint anOutMode = ALC_ANY_SOFT;
         alcGetIntegerv(myAlDevice, ALC_OUTPUT_MODE_SOFT, 1, &anOutMode);
@@ -172,6 +178,14 @@ bool StALContext::create(const std::string& theDeviceName) {
         hasExtSoftHrtf = alcGetStringiSOFT  != NULL
                       && alcResetDeviceSOFT != NULL;
     }
+    if(alIsExtensionPresent("AL_SOFT_callback_buffer") == AL_TRUE) {
+        alBufferCallbackSOFT = (alBufferCallbackSOFT_t )alGetProcAddress("alBufferCallbackSOFT");
+        hasExtSoftCallback = alBufferCallbackSOFT != NULL;
+    }
+    if(alcIsExtensionPresent(myAlDevice, "ALC_SOFT_device_clock") == AL_TRUE) {
+        alcGetInteger64vSOFT = (alcGetInteger64vSOFT_t )alcGetProcAddress(myAlDevice, "alcGetInteger64vSOFT");
+        hasExtSoftClock = alcGetInteger64vSOFT != NULL;
+    }
 
     // debug info
     ST_DEBUG_LOG(toStringExtensions());
@@ -186,6 +200,8 @@ void StALContext::fullInfo(StDictionary& theMap) const {
     if(hasExtMultiChannel){ anExtensions += "AL_EXT_MCFORMATS "; }
     if(hasExtBFormat)     { anExtensions += "AL_EXT_BFORMAT "; }
     if(hasExtDisconnect)  { anExtensions += "ALC_EXT_disconnect "; }
+    if(hasExtSoftCallback){ anExtensions += "AL_SOFT_callback_buffer "; }
+    if(hasExtSoftClock)   { anExtensions += "ALC_SOFT_device_clock "; }
     if(hasExtSoftOutMode) {
         anExtensions += "ALC_SOFT_output_mode ";
 
@@ -257,8 +273,12 @@ void StALContext::destroy() {
     hasExtDisconnect   = false;
     hasExtSoftOutMode  = false;
     hasExtSoftHrtf     = false;
+    hasExtSoftCallback = false;
+    hasExtSoftClock    = false;
     alcGetStringiSOFT  = NULL;
     alcResetDeviceSOFT = NULL;
+    alBufferCallbackSOFT = NULL;
+    alcGetInteger64vSOFT = NULL;
 }
 
 bool StALContext::makeCurrent() {
@@ -276,3 +296,24 @@ bool StALContext::isConnected() const {
     alcGetIntegerv(myAlDevice, ALC_CONNECTED, 1, &aConnected);
     return aConnected == AL_TRUE;
 }
+
+double StALContext::getDevicePeriod() const {
+    if(myAlDevice == NULL) {
+        return 0.0;
+    }
+
+    ALCint aRefresh = 0;
+    alcGetIntegerv(myAlDevice, ALC_REFRESH, 1, &aRefresh);
+    return aRefresh > 0 ? 1.0 / double(aRefresh) : 0.0;
+}
+
+double StALContext::getDeviceLatency() const {
+    if(myAlDevice == NULL
+    || !hasExtSoftClock) {
+        return 0.0;
+    }
+
+    int64_t aLatencyNs = 0;
+    alcGetInteger64vSOFT(myAlDevice, ALC_DEVICE_LATENCY_SOFT, 1, &aLatencyNs);
+    return aLatencyNs > 0 ? double(aLatencyNs) * 0.000000001 : 0.0;
+}
@@ -73,6 +73,17 @@ namespace {
 
     typedef const ALCchar* (ALC_APIENTRY* alcGetStringiSOFT_t )(ALCdevice* device, ALCenum paramName, ALCsizei index);
     typedef ALCboolean     (ALC_APIENTRY* alcResetDeviceSOFT_t)(ALCdevice* device, const ALCint* attrList);
+
+    // AL_SOFT_callback_buffer extension
+    typedef ALsizei (AL_APIENTRY* alBufferCallbackFunc_t)(ALvoid* userptr, ALvoid* sampledata, ALsizei numbytes);
+    typedef void    (AL_APIENTRY* alBufferCallbackSOFT_t)(ALuint buffer, ALenum format, ALsizei freq, alBufferCallbackFunc_t callback, ALvoid* userptr);
+
+    // ALC_SOFT_device_clock extension
+    #define ALC_DEVICE_CLOCK_SOFT                    0x1600
+    #define ALC_DEVICE_LATENCY_SOFT                  0x1601
+    #define ALC_DEVICE_CLOCK_LATENCY_SOFT            0x1602
+
+    typedef void (ALC_APIENTRY* alcGetInteger64vSOFT_t)(ALCdevice* device, ALCenum pname, ALCsizei size, int64_t* values);
 }
 
 /**
@@ -91,9 +102,13 @@ class StALContext {
     bool hasExtDisconnect;   //!< ALC_EXT_disconnect
     bool hasExtSoftOutMode;  //!< ALC_SOFT_output_mode
     bool hasExtSoftHrtf;     //!< ALC_SOFT_HRTF
+    bool hasExtSoftCallback; //!< AL_SOFT_callback_buffer
+    bool hasExtSoftClock;    //!< ALC_SOFT_device_clock
 
-    alcGetStringiSOFT_t  alcGetStringiSOFT;
-    alcResetDeviceSOFT_t alcResetDeviceSOFT;
+    alcGetStringiSOFT_t    alcGetStringiSOFT;
+    alcResetDeviceSOFT_t   alcResetDeviceSOFT;
+    alBufferCallbackSOFT_t alBufferCallbackSOFT;
+    alcGetInteger64vSOFT_t alcGetInteger64vSOFT;
 
         public:
 
@@ -138,6 +153,16 @@ class StALContext {
      */
     ST_CPPEXPORT bool isConnected() const;
 
+    /**
+     * Return device mixing period in seconds (time between two mixer updates), or 0 if unknown.
+     */
+    ST_CPPEXPORT double getDevicePeriod() const;
+
+    /**
+     * Return device output latency in seconds (requires ALC_SOFT_device_clock), or 0 if unknown.
+     */
+    ST_CPPEXPORT double getDeviceLatency() const;
+
     /**
      * Return OpenAL device.
      */
@@ -1,5 +1,5 @@
 /**
- * Copyright © 2009-2025 Kirill Gavrilov <kirill@sview.ru>
+ * Copyright © 2009-2026 Kirill Gavrilov <kirill@sview.ru>
  *
  * StMoviePlayer program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU General Public License as published by
@@ -18,6 +18,8 @@
 
 #include "StAVPacketQueue.h"
 
+#include <StThreads/StThreadBudget.h>
+
 namespace {
 
     const StAVPacket ST_START_PACKET(NULL, StAVPacket::START_PACKET);
@@ -51,6 +53,7 @@ StAVPacketQueue::StAVPacketQueue(const size_t theSizeLimit)
   myPtsStartBase(0.0),
   myPtsStartStream(0.0),
   myStreamId(-1),
+  myBudgetId(0),
   myToFlush(false),
   myToQuit(false),
   // playback control
@@ -113,6 +116,12 @@ bool StAVPacketQueue::init(AVFormatContext*   theFormatCtx,
         return false;
     }
     myCodecAutoId = myStream->codecpar->codec_id;
+    if(myBudgetId == 0
+    && getCodecType() != AVMEDIA_TYPE_SUBTITLE) {
+        // single-threaded decoder by default, video decoders update their weight on opening codec;
+        // sparse subtitles are not counted
+        myBudgetId = StThreadBudget::GetDefault().addConsumer(StString("#") + theStreamId + " " + avcodec_get_name(myCodecAutoId), 0.0, 1);
+    }
     myCodecCtx = avcodec_alloc_context3(NULL);
     if(avcodec_parameters_to_context(myCodecCtx, myStream->codecpar) < 0) {
         signals.onError(stCString("Internal error: unable to copy codec parameters"));
@@ -169,6 +178,10 @@ void StAVPacketQueue::deinit() {
     myGetBuffInit = NULL;
     myStreamId    = -1;
     myIsAttachedPic = false;
+    if(myBudgetId != 0) {
+        StThreadBudget::GetDefault().removeConsumer(myBudgetId);
+        myBudgetId = 0;
+    }
 }
 
 void StAVPacketQueue::fillCodecInfo(const AVCodec*  theCodec,
@@ -210,6 +223,7 @@ StHandle<StAVPacket> StAVPacketQueue::pop() {
         delete anItem;
         --mySize;
         mySizeSeconds -= aPacket->getDurationSeconds();
+        StMemoryBudget::GetDefault().release(StMemoryBudget::Subsystem_Packets, size_t(aPacket->getSize()));
     myMutex.unlock();
     return aPacket;
 }
@@ -225,6 +239,7 @@ void StAVPacketQueue::push(const StAVPacket& thePacket) {
         }
         ++mySize;
         mySizeSeconds += thePacket.getDurationSeconds();
+        StMemoryBudget::GetDefault().allocate(StMemoryBudget::Subsystem_Packets, size_t(thePacket.getSize()));
     myMutex.unlock();
 }
 
@@ -1,5 +1,5 @@
 /**
- * Copyright © 2009-2025 Kirill Gavrilov <kirill@sview.ru>
+ * Copyright © 2009-2026 Kirill Gavrilov <kirill@sview.ru>
  *
  * StMoviePlayer program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU General Public License as published by
@@ -19,6 +19,7 @@
 #ifndef __StAVPacketQueue_h_
 #define __StAVPacketQueue_h_
 
+#include <StImage/StMemoryBudget.h>
 #include <StThreads/StMutex.h>
 #include <StTemplates/StHandle.h>
 #include <StSlots/StSignal.h>
@@ -99,7 +100,9 @@ class StAVPacketQueue {
      */
     ST_LOCAL bool isFull() const {
         myMutex.lock();
-            bool aResult = (mySize >= mySizeLimit) || (mySizeSeconds >= 5.0);
+            // keep only one second of packets while memory budget is under pressure
+            bool aResult = (mySize >= mySizeLimit) || (mySizeSeconds >= 5.0)
+                        || (mySizeSeconds >= 1.0 && StMemoryBudget::GetDefault().isUnderPressure());
             //if(mySize >= mySizeLimit) { ST_DEBUG_LOG("stream" + streamId + " sizeSeconds= " + sizeSeconds + "; mySize= " + mySize); }
         myMutex.unlock();
         return aResult;
@@ -261,6 +264,7 @@ class StAVPacketQueue {
     double           myPtsStartBase;   //!< starting PTS in context
     double           myPtsStartStream; //!< starting PTS in the stream
     signed int       myStreamId;       //!< stream ID
+    int              myBudgetId;       //!< decoder id within StThreadBudget, 0 if not registered
     volatile bool    myToFlush;        //!< flag indicates FLUSH event was pushed in packets queue
     volatile bool    myToQuit;         //!< flag to terminate decoding loop
 
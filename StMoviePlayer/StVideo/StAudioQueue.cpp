@@ -20,6 +20,7 @@
 
 #include <StGL/StGLVec.h>
 #include <StThreads/StThread.h>
+#include <StThreads/StThreadBudget.h>
 
 namespace {
 
@@ -55,6 +56,11 @@ namespace {
     static const StGLVec3 THE_POSITION_SIDE_LEFT71  (-1.0f, 0.0f,  0.0f);
     static const StGLVec3 THE_POSITION_SIDE_RIGHT71 ( 1.0f, 0.0f,  0.0f);
 
+    static const double THE_AL_CB_PERIOD_DEF   = 0.02;  //!< device period assumed when it cannot be retrieved
+    static const double THE_AL_CB_RING_SEC     = 0.5;   //!< capacity of PCM ring in seconds
+    static const size_t THE_AL_CB_PERIODS_MIN  = 3;     //!< initial amount of buffered data in device periods
+    static const double THE_AL_CB_SYNC_EPSILON = 0.002; //!< tolerance for playback timer correction
+
     static const StGLVec3 THE_LISTENER_FORWARD      ( 0.0f, 0.0f, -1.0f);
     static const StGLVec3 THE_LISTENER_UP           ( 0.0f, 1.0f,  0.0f);
 
@@ -150,6 +156,17 @@ bool StAudioQueue::stalInit() {
     alGenSources(THE_NUM_AL_SOURCES, myAlSources);
     stalCheckErrors("alGenSources");
 
+    // callback buffer is attached to the first source on demand
+    myAlCbFormat    = 0;
+    myAlCbFreq      = 0;
+    myAlCbBadFormat = 0;
+    if(myAlCtx.hasExtSoftCallback) {
+        alGenBuffers(1, &myAlCbBuffer);
+        if(!stalCheckErrors("alGenBuffers (callback)")) {
+            myAlCbBuffer = 0;
+        }
+    }
+
     // configure sources
     const StGLVec3 aZeroVec(0.0f);
     for(size_t aSrcId = 0; aSrcId < THE_NUM_AL_SOURCES; ++aSrcId) {
@@ -174,11 +191,18 @@ bool StAudioQueue::stalInit() {
 void StAudioQueue::stalDeinit() {
     // clear buffers
     stalEmpty();
+    stalCallbackRelease();
     alSourceStopv(THE_NUM_AL_SOURCES, myAlSources);
 
     alDeleteSources(THE_NUM_AL_SOURCES, myAlSources);
     stalCheckErrors("alDeleteSources");
 
+    if(myAlCbBuffer != 0) {
+        alDeleteBuffers(1, &myAlCbBuffer);
+        stalCheckErrors("alDeleteBuffers (callback)");
+        myAlCbBuffer = 0;
+    }
+
     for(size_t aSrcId = 0; aSrcId < THE_NUM_AL_SOURCES; ++aSrcId) {
         alDeleteBuffers(THE_NUM_AL_BUFFERS, &myAlBuffers[aSrcId][0]);
         stalCheckErrors(StString("alDeleteBuffers") + aSrcId);
@@ -276,6 +300,15 @@ void StAudioQueue::stalOrientListener() {
 }
 
 void StAudioQueue::stalEmpty() {
+    if(myAlCbFormat != 0) {
+        // keep callback buffer attached, just drop buffered data
+        alSourceStop(myAlSources[0]);
+        myAlRing.clear();
+        myAlCbHadData       = false;
+        myAlCbUnderrunsPrev = StAtomicOp::Add(myAlCbUnderruns, 0);
+        return;
+    }
+
     alSourceStopv(THE_NUM_AL_SOURCES, myAlSources);
 
     ALint aBufQueued = 0;
@@ -347,7 +380,29 @@ StAudioQueue::StAudioQueue(const std::string& theAlDeviceName,
   myAlHintHrtf(theAlHrtf),
   myAlHintHrtfPrev(theAlHrtf),
   myDbgPrevQueued(-1),
-  myDbgPrevSrcState(-1) {
+  myDbgPrevSrcState(-1),
+  myAlCbClock(true),
+  myAlCbBuffer(0),
+  myAlCbFormat(0),
+  myAlCbFreq(0),
+  myAlCbBadFormat(0),
+  myAlCbFrameSize(1),
+  myAlCbPeriod(0),
+  myAlCbTarget(0),
+  myAlCbByteRate(1.0),
+  myAlCbLatency(0.0),
+  myAlCbPtsEnd(0.0),
+  myAlCbPosEnd(0),
+  myAlCbUnderrunsPrev(0),
+  myAlCbUnderruns(0),
+  myAlCbSeq(0),
+  myAlCbStamp(0.0),
+  myAlCbChunk(0),
+  myAlCbReadPos(0),
+  myAlCbSilence(0),
+  myAlCbHadData(false),
+  myToUseAlCallback(false),
+  myAlCbActive(false) {
     stMemSet(myAlSources, 0, sizeof(myAlSources));
 
     // launch thread parse incoming packets from queue
@@ -1040,6 +1095,14 @@ void StAudioQueue::stalFillBuffers(const double thePts,
         parseEvents();
     }
 
+    if(myAlCbActive) {
+        stalCallbackFill(thePts, toIgnoreEvents);
+        if(myAlCbActive) {
+            return;
+        }
+        // callback buffer has rejected stream format - fallback to buffer queue
+    }
+
     bool toSkipPlaybackFrom = false;
     while(!stalQueue(thePts)) {
         // AL queue is full
@@ -1138,8 +1201,10 @@ void StAudioQueue::decodePacket(const StHandle<StAVPacket>& thePacket,
             myBufferSrc.setPlaneSize(aPlaneSize); // notice that myFrame.getLineSize(0) contains extra alignment
 
             checkMoreFrames = true;
-            if(myBufferOut.addData(myBufferSrc)) {
+            if(!stalUpdateOutputMode()
+            && myBufferOut.addData(myBufferSrc)) {
                 // 'big buffer' still not full
+                // (callback output pushes every frame to the PCM ring instead)
                 break;
             }
 
@@ -1190,7 +1255,14 @@ void StAudioQueue::decodeLoop() {
 
     double aPts = 0.0;
     StHandle<StAVPacket> aPacket;
+    StThreadBudget& aBudget = StThreadBudget::GetDefault();
+    bool isBoosted = false;
     for(;;) {
+        if(aBudget.toBoostThreads() != isBoosted) {
+            isBoosted = aBudget.toBoostThreads();
+            aBudget.applyThreadRole(StThreadBudget::ThreadRole_Audio);
+        }
+
         // wait for upcoming packets
         if(isEmpty()) {
             myDowntimeEvent.set();
@@ -1254,6 +1326,262 @@ void StAudioQueue::decodeLoop() {
     }
 }
 
+bool StAudioQueue::stalUpdateOutputMode() {
+    const bool toUseCallback = myToUseAlCallback
+                            && myAlCbBuffer != 0
+                            && myBufferOut.getPlanesNb() == 1
+                            && myAlCbBadFormat != myAlFormat;
+    if(toUseCallback == myAlCbActive) {
+        return myAlCbActive;
+    }
+
+    if(toUseCallback) {
+        ST_DEBUG_LOG("OpenAL, switch to callback output");
+    } else {
+        ST_DEBUG_LOG("OpenAL, switch to buffer queue output");
+    }
+    stalEmpty();
+    stalCallbackRelease();
+    myPrevFrequency = 0; // force reinitialization of the buffer queue
+    myAlCbActive = toUseCallback;
+    return myAlCbActive;
+}
+
+bool StAudioQueue::stalCallbackConfigure() {
+    stalCallbackRelease();
+    if(myAlCbBuffer == 0) {
+        // device has been re-initialized without extension
+        stalUpdateOutputMode();
+        return false;
+    }
+
+    const ALsizei aFreq    = (ALsizei )myBufferOut.getFreq();
+    const size_t  aSecSize = myBufferOut.getSecondSize();
+    if(aFreq <= 0 || aSecSize == 0) {
+        return false;
+    }
+
+    const size_t aFrameSize = aSecSize / size_t(aFreq);
+    double aPeriodSec = myAlCtx.getDevicePeriod();
+    if(aPeriodSec <= 0.0) {
+        aPeriodSec = THE_AL_CB_PERIOD_DEF;
+    }
+    const size_t aPeriod = stMax(size_t(double(aSecSize) * aPeriodSec) / aFrameSize, size_t(1)) * aFrameSize;
+
+    alGetError(); // clear error code
+    myAlCtx.alBufferCallbackSOFT(myAlCbBuffer, myAlFormat, aFreq, stalBufferCallback, this);
+    if(!stalCheckErrors("alBufferCallbackSOFT")
+    || !myAlRing.init(stMax(size_t(double(aSecSize) * THE_AL_CB_RING_SEC), aPeriod * THE_AL_CB_PERIODS_MIN * 2))) {
+        ST_ERROR_LOG("OpenAL, callback output is unavailable for format " + int(myAlFormat) + "; buffer queue will be used");
+        myAlCbBadFormat = myAlFormat;
+        stalUpdateOutputMode();
+        return false;
+    }
+
+    alSourcei(myAlSources[0], AL_BUFFER, (ALint )myAlCbBuffer);
+    stalCheckErrors("alSourcei (callback buffer)");
+
+    myAlCbFormat        = myAlFormat;
+    myAlCbFreq          = aFreq;
+    myAlCbFrameSize     = aFrameSize;
+    myAlCbPeriod        = aPeriod;
+    myAlCbTarget        = stMin(aPeriod * THE_AL_CB_PERIODS_MIN, myAlRing.getCapacity() / aFrameSize * aFrameSize);
+    myAlCbByteRate      = double(aSecSize);
+    myAlCbLatency       = myAlCtx.getDeviceLatency();
+    myAlCbPtsEnd        = 0.0;
+    myAlCbPosEnd        = myAlRing.getWritePos();
+    myAlCbUnderrunsPrev = 0;
+    myAlCbUnderruns     = 0;
+    stalCallbackPublish(0.0, 0, myAlRing.getReadPos());
+    myAlCbHadData       = false;
+    myAlCbSilence       = myBufferOut.getFormat() == StPcmFormat_UInt8 ? 0x80 : 0x00;
+    ST_DEBUG_LOG("OpenAL, callback output: period= " + aPeriod + " bytes (" + (aPeriodSec * 1000.0) + " ms)"
+               + "; ring= " + myAlRing.getCapacity() + " bytes"
+               + "; latency= " + (myAlCbLatency * 1000.0) + " ms");
+    return true;
+}
+
+void StAudioQueue::stalCallbackRelease() {
+    if(myAlCbFormat == 0) {
+        return;
+    }
+
+    // mixer stops calling the callback once the buffer is detached from stopped source
+    alSourceStop(myAlSources[0]);
+    alSourcei(myAlSources[0], AL_BUFFER, 0);
+    stalCheckErrors("alSourcei (detach callback buffer)");
+    myAlCbFormat = 0;
+    myAlCbFreq   = 0;
+    myAlRing.clear();
+}
+
+void StAudioQueue::stalCallbackFill(const double thePts,
+                                    const bool   toIgnoreEvents) {
+    const uint8_t* aData    = myBufferOut.getPlane(0);
+    const size_t   aNbBytes = myBufferOut.getPlaneSize();
+    size_t         aWritten = 0;
+    for(;;) {
+        if(myAlCbFormat != myAlFormat
+        || myAlCbFreq   != (ALsizei )myBufferOut.getFreq()) {
+            if(myAlCbFormat == 0
+            || myAlRing.getFilled() == 0
+            || stalGetSourceState() != AL_PLAYING) {
+                if(!stalCallbackConfigure()) {
+                    return;
+                }
+                continue;
+            }
+            // wait until tail of previous stream played
+        } else {
+            // increase buffering on data starvation
+            const int32_t anUnderruns = StAtomicOp::Add(myAlCbUnderruns, 0);
+            if(anUnderruns != myAlCbUnderrunsPrev) {
+                myAlCbUnderrunsPrev = anUnderruns;
+                // ring capacity is power of two - keep target in whole sample frames
+                const size_t aTarget = stMin(myAlCbTarget + myAlCbPeriod, myAlRing.getCapacity() / myAlCbFrameSize * myAlCbFrameSize);
+                if(aTarget != myAlCbTarget) {
+                    ST_DEBUG_LOG("OpenAL, callback output underrun; buffering increased to " + aTarget + " bytes");
+                    myAlCbTarget = aTarget;
+                }
+            }
+
+            // write whole sample frames only - mixer pads partial frame with silence shifting channels
+            const size_t aFilled  = myAlRing.getFilled();
+            const size_t aToWrite = aFilled < myAlCbTarget
+                                  ? stMin(aNbBytes - aWritten, myAlCbTarget - aFilled) / myAlCbFrameSize * myAlCbFrameSize
+                                  : 0;
+            if(aToWrite != 0) {
+                aWritten += myAlRing.write(aData + aWritten, aToWrite);
+                myAlCbPosEnd = myAlRing.getWritePos();
+                myAlCbPtsEnd = thePts - double(aNbBytes - aWritten) / myAlCbByteRate;
+            }
+
+            // the last portion of the stream should be played regardless of buffering target
+            stalCallbackPlay(toIgnoreEvents && aWritten == aNbBytes);
+            stalCallbackSyncTimer();
+            if(aWritten == aNbBytes) {
+                return;
+            }
+        }
+
+        if(!toIgnoreEvents) {
+            parseEvents();
+            if(myBufferOut.isEmpty()
+            || !myAlCbActive) {
+                // buffers have been reset
+                return;
+            }
+        }
+        if(myToQuit) {
+            return;
+        }
+        StThread::sleep(1);
+    }
+}
+
+void StAudioQueue::stalCallbackPlay(const bool theToForce) {
+    const ALenum aState = stalGetSourceState();
+    if(aState == AL_PLAYING
+    || aState == AL_PAUSED
+    || (!theToForce && myAlRing.getFilled() < myAlCbTarget)) {
+        return;
+    }
+
+    const double aPts = myAlCbPtsEnd - double(myAlRing.getFilled()) / myAlCbByteRate;
+    playTimerStart(aPts < 100000.0 ? aPts : 0.0);
+    alSourcePlay(myAlSources[0]);
+    if(!stalCheckConnected()) {
+        return;
+    }
+    ST_DEBUG_LOG("!!! OpenAL callback output was in stopped state, now resume playback from " + aPts);
+
+    // pause playback if not in playing state
+    myEventMutex.lock();
+    const bool toPause = !myIsPlaying;
+    myEventMutex.unlock();
+    if(toPause) {
+        alSourcePause(myAlSources[0]);
+    }
+}
+
+void StAudioQueue::stalCallbackSyncTimer() {
+    if(stalGetSourceState() != AL_PLAYING) {
+        return;
+    }
+
+    // position of the data consumed by mixer, extrapolated from the time stamp of the last callback
+    double   aStamp   = 0.0;
+    uint32_t aNbChunk = 0;
+    uint32_t aReadPos = 0;
+    if(!stalCallbackSnapshot(aStamp, aNbChunk, aReadPos)) {
+        return;
+    }
+
+    const double   aChunk   = double(aNbChunk) / myAlCbByteRate;
+    const double   aSince   = stMin(stMax(myAlCbClock.getElapsedTimeInSec() - aStamp, 0.0), aChunk);
+    const double   aPts     = myAlCbPtsEnd - double(uint32_t(myAlCbPosEnd - aReadPos)) / myAlCbByteRate
+                            - aChunk + aSince - myAlCbLatency;
+    if(aPts < 100000.0
+    && std::abs(aPts - getPts()) > THE_AL_CB_SYNC_EPSILON) {
+        playTimerStart(aPts);
+    }
+}
+
+size_t StAudioQueue::stalCallbackRead(uint8_t*     theData,
+                                      const size_t theNbBytes) {
+    const size_t aNbRead = myAlRing.read(theData, theNbBytes);
+    if(aNbRead != 0) {
+        stalCallbackPublish(myAlCbClock.getElapsedTimeInSec(), uint32_t(aNbRead), myAlRing.getReadPos());
+    }
+    if(aNbRead < theNbBytes) {
+        // fill the gap with silence to keep the source playing
+        stMemSet(theData + aNbRead, myAlCbSilence, theNbBytes - aNbRead);
+        if(myAlCbHadData) {
+            StAtomicOp::Increment(myAlCbUnderruns);
+        }
+    }
+    myAlCbHadData = aNbRead == theNbBytes;
+    return theNbBytes;
+}
+
+void StAudioQueue::stalCallbackPublish(const double   theStamp,
+                                       const uint32_t theChunk,
+                                       const uint32_t theReadPos) {
+    // single writer - odd sequence marks values being modified,
+    // atomic increments act as full memory barriers around the stores
+    StAtomicOp::Increment(myAlCbSeq);
+    myAlCbStamp   = theStamp;
+    myAlCbChunk   = theChunk;
+    myAlCbReadPos = theReadPos;
+    StAtomicOp::Increment(myAlCbSeq);
+}
+
+bool StAudioQueue::stalCallbackSnapshot(double&   theStamp,
+                                        uint32_t& theChunk,
+                                        uint32_t& theReadPos) const {
+    for(int anAttempt = 0; anAttempt < 16; ++anAttempt) {
+        const int32_t aSeqBefore = StAtomicOp::Add(myAlCbSeq, 0);
+        if((aSeqBefore & 1) != 0) {
+            continue;
+        }
+
+        theStamp   = myAlCbStamp;
+        theChunk   = myAlCbChunk;
+        theReadPos = myAlCbReadPos;
+        if(StAtomicOp::Add(myAlCbSeq, 0) == aSeqBefore) {
+            return true;
+        }
+    }
+    return false;
+}
+
+ALsizei AL_APIENTRY StAudioQueue::stalBufferCallback(ALvoid* theUserPtr,
+                                                     ALvoid* theData,
+                                                     ALsizei theNbBytes) {
+    StAudioQueue* aQueue = (StAudioQueue* )theUserPtr;
+    return (ALsizei )aQueue->stalCallbackRead((uint8_t* )theData, (size_t )theNbBytes);
+}
+
 void StAudioQueue::pushPlayEvent(const StPlayEvent_t theEventId,
                                  const double        theSeekParam) {
     myEventMutex.lock();
@@ -28,6 +28,7 @@
 
 #include "StAVPacketQueue.h"// StAVPacketQueue class
 #include "StPCMBuffer.h"    // audio PCM buffer class
+#include "StPCMRing.h"      // PCM ring buffer for callback output
 #include "StALContext.h"
 
 // forward declarations
@@ -41,6 +42,12 @@ ST_DEFINE_HANDLE(StAudioQueue, StAVPacketQueue);
  * This is Audio playback class (OpenAL is used)
  * which feed with packets (StAVPacket),
  * so it also implements StAVPacketQueue.
+ *
+ * Two output paths are implemented:
+ * - buffer queue (default), where decoding thread polls the source and refills processed buffers;
+ * - callback output (AL_SOFT_callback_buffer), where OpenAL mixer thread pulls data from the PCM ring
+ *   filled by decoding thread; buffering is adapted to device period and playback position
+ *   is computed from the data consumed by mixer and device latency.
  */
 class StAudioQueue : public StAVPacketQueue {
 
@@ -178,6 +185,19 @@ class StAudioQueue : public StAVPacketQueue {
         myToSwitchDev  = true;
     }
 
+    /**
+     * Request callback output (AL_SOFT_callback_buffer) instead of buffer queue.
+     * Buffer queue is still used when extension is unavailable or stream is mixed by multiple sources.
+     */
+    ST_LOCAL void setAlCallbackOutput(bool theToUse) {
+        myToUseAlCallback = theToUse;
+    }
+
+    /**
+     * Return TRUE if OpenAL implementation supports callback output.
+     */
+    ST_LOCAL bool hasAlCallbackOutput() const { return myAlCtx.hasExtSoftCallback; }
+
     /**
      * Return TRUE if OpenAL implementation supports output mode hints.
      */
@@ -236,6 +256,70 @@ class StAudioQueue : public StAVPacketQueue {
 
     ST_LOCAL bool parseEvents();
 
+        private: //! @name callback output
+
+    /**
+     * Choose output path for current stream.
+     * @return TRUE if callback output should be used
+     */
+    ST_LOCAL bool stalUpdateOutputMode();
+
+    /**
+     * Attach callback buffer with current format to the source and allocate PCM ring for device period.
+     */
+    ST_LOCAL bool stalCallbackConfigure();
+
+    /**
+     * Detach callback buffer from the source.
+     */
+    ST_LOCAL void stalCallbackRelease();
+
+    /**
+     * Push output buffer into PCM ring (waits for free space).
+     * @param thePts PTS at the end of output buffer
+     */
+    ST_LOCAL void stalCallbackFill(const double thePts,
+                                   const bool   toIgnoreEvents);
+
+    /**
+     * Start the source when enough data is buffered.
+     */
+    ST_LOCAL void stalCallbackPlay(const bool theToForce);
+
+    /**
+     * Update playback timer from the data consumed by mixer.
+     */
+    ST_LOCAL void stalCallbackSyncTimer();
+
+    /**
+     * Read data for the mixer (called from OpenAL mixer thread).
+     */
+    ST_LOCAL size_t stalCallbackRead(uint8_t*     theData,
+                                     const size_t theNbBytes);
+
+    /**
+     * Publish the state of the last mixer callback with data (called from OpenAL mixer thread).
+     * Values are guarded by sequence counter, so that decoding thread never sees a torn state.
+     */
+    ST_LOCAL void stalCallbackPublish(const double   theStamp,
+                                      const uint32_t theChunk,
+                                      const uint32_t theReadPos);
+
+    /**
+     * Read consistent state published by stalCallbackPublish().
+     * @return FALSE if mixer thread kept updating values during all attempts
+     */
+    ST_LOCAL bool stalCallbackSnapshot(double&   theStamp,
+                                       uint32_t& theChunk,
+                                       uint32_t& theReadPos) const;
+
+    /**
+     * OpenAL buffer callback redirecting to stalCallbackRead().
+     */
+    ST_LOCAL static ALsizei AL_APIENTRY stalBufferCallback(ALvoid* theUserPtr,
+                                                           ALvoid* theData,
+                                                           ALsizei theNbBytes);
+
     ST_LOCAL void decodePacket(const StHandle<StAVPacket>& thePacket,
                                double& thePts);
 
@@ -406,6 +490,32 @@ class StAudioQueue : public StAVPacketQueue {
     ALint              myDbgPrevQueued;
     ALenum             myDbgPrevSrcState;
 
+        private: //! @name callback output items
+
+    StPCMRing          myAlRing;        //!< PCM ring read by OpenAL mixer thread
+    StTimer            myAlCbClock;     //!< clock for time stamps of mixer callbacks
+    ALuint             myAlCbBuffer;    //!< callback buffer
+    ALenum             myAlCbFormat;    //!< format of attached callback buffer (0 if detached)
+    ALsizei            myAlCbFreq;      //!< frequency of attached callback buffer
+    ALenum             myAlCbBadFormat; //!< format rejected by callback buffer
+    size_t             myAlCbFrameSize; //!< size of one sample frame (all channels) in bytes
+    size_t             myAlCbPeriod;    //!< device period in bytes of stream format
+    size_t             myAlCbTarget;    //!< amount of data to keep buffered, grows on underruns
+    double             myAlCbByteRate;  //!< bytes per second of attached stream format
+    double             myAlCbLatency;   //!< device output latency in seconds
+    double             myAlCbPtsEnd;    //!< PTS at ring write position
+    uint32_t           myAlCbPosEnd;    //!< ring write position corresponding to myAlCbPtsEnd
+    int32_t            myAlCbUnderrunsPrev; //!< number of handled underruns
+    volatile int32_t   myAlCbUnderruns; //!< number of mixer callbacks ran out of data
+    mutable volatile int32_t myAlCbSeq; //!< sequence counter guarding callback state below, odd while being written
+    volatile double    myAlCbStamp;     //!< time stamp of the last mixer callback with data
+    volatile uint32_t  myAlCbChunk;     //!< bytes read by the last mixer callback with data
+    volatile uint32_t  myAlCbReadPos;   //!< ring read position after the last mixer callback with data
+    uint8_t            myAlCbSilence;   //!< silence byte value for current format
+    bool               myAlCbHadData;   //!< the last mixer callback was fully filled (mixer thread)
+    volatile bool      myToUseAlCallback; //!< callback output is requested
+    bool               myAlCbActive;    //!< callback output is used for current stream
+
 };
 
 #endif //__StAudioQueue_h_
@@ -0,0 +1,233 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StMoviePlayer program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StMoviePlayer program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StKeyframeIndex.h"
+
+#include <StAV/StAVPacket.h>
+#include <StFile/StFileNode.h>
+#include <StFile/StFolder.h>
+#include <StFile/StRawFile.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+    /**
+     * Thread function just call buildLoop() function.
+     */
+    static SV_THREAD_FUNCTION threadFunction(void* theIndex) {
+        StKeyframeIndex* anIndex = (StKeyframeIndex* )theIndex;
+        anIndex->buildLoop();
+        return SV_THREAD_RETURN 0;
+    }
+
+    /**
+     * Header of index file.
+     */
+    struct StKeyframeIndexHeader {
+        char    Magic[8];    //!< file format identifier
+        int64_t FileSize;    //!< size of indexed video file
+        int32_t StreamId;    //!< indexed stream
+        int32_t NbEntries;   //!< number of key frames following the header
+    };
+
+    static const char THE_INDEX_MAGIC[8] = { 's', 'V', 'K', 'F', 'I', 'D', 'X', '1' };
+
+    /**
+     * FNV-1a hash of the string.
+     */
+    static uint64_t hashString(const StString& theString) {
+        uint64_t aHash = 14695981039346656037ULL;
+        const char* aData = theString.toCString();
+        for(size_t anIter = 0; anIter < theString.getSize(); ++anIter) {
+            aHash ^= (uint8_t )aData[anIter];
+            aHash *= 1099511628211ULL;
+        }
+        return aHash;
+    }
+
+}
+
+bool StKeyframeIndex::isSupportedPath(const StString& theFilePath) {
+    return !theFilePath.isEmpty()
+        && !StFileNode::isContentProtocolPath(theFilePath)
+        && !StFileNode::isRemoteProtocolPath(theFilePath);
+}
+
+StString StKeyframeIndex::getCacheName(const StString& theFilePath,
+                                       const int       theStreamId) {
+    // file replaced by another one of the same size should not reuse the cache
+    int64_t aFileSize = 0, aModTime = 0;
+    if(!StFileNode::getFileStats(theFilePath, aFileSize, aModTime)) {
+        return StString();
+    }
+
+    char aName[128];
+    stsprintf(aName, sizeof(aName), "%016llx-%llx-%llx-%d",
+              (unsigned long long )hashString(theFilePath),
+              (unsigned long long )aFileSize, (unsigned long long )aModTime,
+              theStreamId);
+    return aName;
+}
+
+StKeyframeIndex::StKeyframeIndex(const StString& theFilePath,
+                                 const int       theStreamId,
+                                 const StString& theCacheFolder)
+: myFilePath(theFilePath),
+  myStreamId(theStreamId),
+  myToAbort(false),
+  myIsReady(false) {
+    const StString aCacheName = getCacheName(theFilePath, theStreamId);
+    if(!theCacheFolder.isEmpty()
+    && !aCacheName.isEmpty()) {
+        const StString aFolder = theCacheFolder + "keyframes/";
+        StFolder::createFolder(aFolder);
+        myCachePath = aFolder + aCacheName + ".idx";
+    }
+    myThread = new StThread(threadFunction, (void* )this, "StKeyframeIndex");
+}
+
+StKeyframeIndex::~StKeyframeIndex() {
+    myToAbort = true;
+    myThread->wait();
+    myThread.nullify();
+}
+
+bool StKeyframeIndex::findPrevious(const int64_t theTarget,
+                                   int64_t&      theKeyframe) const {
+    if(!myIsReady) {
+        return false;
+    }
+
+    StMutexAuto aLock(&myMutex);
+    std::vector<int64_t>::const_iterator anIter = std::upper_bound(myKeyframes.begin(), myKeyframes.end(), theTarget);
+    if(anIter == myKeyframes.begin()) {
+        return false;
+    }
+    theKeyframe = *(--anIter);
+    return true;
+}
+
+bool StKeyframeIndex::load(const int64_t theFileSize) {
+    if(myCachePath.isEmpty()
+    || !StFileNode::isFileExists(myCachePath)) {
+        return false;
+    }
+
+    StRawFile aFile(myCachePath);
+    if(!aFile.readFile()
+    || aFile.getSize() < sizeof(StKeyframeIndexHeader)) {
+        return false;
+    }
+
+    StKeyframeIndexHeader aHeader;
+    stMemCpy(&aHeader, aFile.getBuffer(), sizeof(aHeader));
+    if(std::memcmp(aHeader.Magic, THE_INDEX_MAGIC, sizeof(THE_INDEX_MAGIC)) != 0
+    || aHeader.FileSize  != theFileSize
+    || aHeader.StreamId  != myStreamId
+    || aHeader.NbEntries <= 0
+    || aFile.getSize() != sizeof(aHeader) + size_t(aHeader.NbEntries) * sizeof(int64_t)) {
+        return false;
+    }
+
+    StMutexAuto aLock(&myMutex);
+    myKeyframes.resize(aHeader.NbEntries);
+    stMemCpy(&myKeyframes.front(), aFile.getBuffer() + sizeof(aHeader), size_t(aHeader.NbEntries) * sizeof(int64_t));
+    return true;
+}
+
+bool StKeyframeIndex::save(const int64_t theFileSize) const {
+    if(myCachePath.isEmpty()
+    || myKeyframes.empty()) {
+        return false;
+    }
+
+    StKeyframeIndexHeader aHeader;
+    stMemCpy(aHeader.Magic, THE_INDEX_MAGIC, sizeof(THE_INDEX_MAGIC));
+    aHeader.FileSize  = theFileSize;
+    aHeader.StreamId  = myStreamId;
+    aHeader.NbEntries = int32_t(myKeyframes.size());
+
+    const size_t aDataSize = myKeyframes.size() * sizeof(int64_t);
+    StRawFile aFile(myCachePath);
+    aFile.initBuffer(sizeof(aHeader) + aDataSize);
+    stMemCpy(aFile.changeBuffer(), &aHeader, sizeof(aHeader));
+    stMemCpy(aFile.changeBuffer() + sizeof(aHeader), &myKeyframes.front(), aDataSize);
+    return aFile.saveFile(myCachePath);
+}
+
+void StKeyframeIndex::buildLoop() {
+    AVFormatContext* aFormatCtx = NULL;
+    if(avformat_open_input(&aFormatCtx, myFilePath.toCString(), NULL, NULL) != 0) {
+        if(aFormatCtx != NULL) {
+            avformat_close_input(&aFormatCtx);
+        }
+        return;
+    }
+
+    const int64_t aFileSize = aFormatCtx->pb != NULL ? avio_size(aFormatCtx->pb) : -1;
+    if(load(aFileSize)) {
+        avformat_close_input(&aFormatCtx);
+        myIsReady = true;
+        return;
+    }
+
+    if(myStreamId < 0
+    || myStreamId >= int(aFormatCtx->nb_streams)) {
+        avformat_close_input(&aFormatCtx);
+        return;
+    }
+
+    // demuxers skip reading data of discarded streams
+    for(unsigned int aStreamId = 0; aStreamId < aFormatCtx->nb_streams; ++aStreamId) {
+        if(int(aStreamId) != myStreamId) {
+            aFormatCtx->streams[aStreamId]->discard = AVDISCARD_ALL;
+        }
+    }
+
+    std::vector<int64_t> aKeyframes;
+    StAVPacket aPacket;
+    while(!myToAbort
+       && av_read_frame(aFormatCtx, aPacket.getAVpkt()) >= 0) {
+        if(aPacket.getStreamId() == myStreamId
+        && aPacket.isKeyFrame()) {
+            const int64_t aTime = aPacket.getPts() != stAV::NOPTS_VALUE ? aPacket.getPts() : aPacket.getDts();
+            if(aTime != stAV::NOPTS_VALUE) {
+                aKeyframes.push_back(aTime);
+            }
+        }
+        aPacket.free();
+    }
+    avformat_close_input(&aFormatCtx);
+    if(myToAbort
+    || aKeyframes.empty()) {
+        return;
+    }
+
+    std::sort(aKeyframes.begin(), aKeyframes.end());
+    aKeyframes.erase(std::unique(aKeyframes.begin(), aKeyframes.end()), aKeyframes.end());
+    myMutex.lock();
+    myKeyframes.swap(aKeyframes);
+    myMutex.unlock();
+    myIsReady = true;
+    if(!save(aFileSize)) {
+        ST_DEBUG_LOG("StKeyframeIndex, unable to save index '" + myCachePath + "'");
+    }
+    ST_DEBUG_LOG("StKeyframeIndex, " + myKeyframes.size() + " key frames have been indexed in '" + myFilePath + "'");
+}
@@ -0,0 +1,116 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StMoviePlayer program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StMoviePlayer program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __StKeyframeIndex_h_
+#define __StKeyframeIndex_h_
+
+#include <StStrings/StString.h>
+#include <StThreads/StMutex.h>
+#include <StThreads/StThread.h>
+
+#include <vector>
+
+/**
+ * Index of key frames within video stream.
+ * The index is built in background thread by reading packets flags
+ * from dedicated demuxer (other streams are discarded),
+ * and persisted in cache folder to be reused when the same file is opened next time.
+ * Index allows seeking directly to the key frame preceding the target,
+ * which is not guaranteed by av_seek_frame() for streams with incomplete demuxer index.
+ */
+class StKeyframeIndex {
+
+        public:
+
+    /**
+     * Start building (or loading) index in background.
+     * @param theFilePath    local file path
+     * @param theStreamId    video stream index
+     * @param theCacheFolder folder to store index files
+     */
+    ST_LOCAL StKeyframeIndex(const StString& theFilePath,
+                             const int       theStreamId,
+                             const StString& theCacheFolder);
+
+    /**
+     * Destructor, aborts index building.
+     */
+    ST_LOCAL ~StKeyframeIndex();
+
+    /**
+     * @return video stream index
+     */
+    ST_LOCAL int getStreamId() const { return myStreamId; }
+
+    /**
+     * @return true if index has been completed
+     */
+    ST_LOCAL bool isReady() const { return myIsReady; }
+
+    /**
+     * Find the closest key frame at or before specified timestamp.
+     * @param theTarget   target timestamp in stream time base units
+     * @param theKeyframe found key frame timestamp in stream time base units
+     * @return FALSE if index is not yet ready or no key frame has been found
+     */
+    ST_LOCAL bool findPrevious(const int64_t theTarget,
+                               int64_t&      theKeyframe) const;
+
+    /**
+     * Thread function building the index.
+     */
+    ST_LOCAL void buildLoop();
+
+    /**
+     * @return true if index can be built for specified path (local files only)
+     */
+    ST_LOCAL static bool isSupportedPath(const StString& theFilePath);
+
+    /**
+     * @return cache file name (without extension) for specified video stream,
+     *         including file size and modification time; empty string if file is inaccessible
+     */
+    ST_LOCAL static StString getCacheName(const StString& theFilePath,
+                                          const int       theStreamId);
+
+        private:
+
+    /**
+     * Read index from cache file.
+     */
+    ST_LOCAL bool load(const int64_t theFileSize);
+
+    /**
+     * Write index into cache file.
+     */
+    ST_LOCAL bool save(const int64_t theFileSize) const;
+
+        private:
+
+    StString             myFilePath;   //!< video file path
+    StString             myCachePath;  //!< index file path
+    int                  myStreamId;   //!< video stream index
+    std::vector<int64_t> myKeyframes;  //!< sorted key frames timestamps in stream time base units
+    mutable StMutex      myMutex;      //!< lock for myKeyframes
+    StHandle<StThread>   myThread;     //!< index building thread
+    volatile bool        myToAbort;    //!< abort index building
+    volatile bool        myIsReady;    //!< index has been completed
+
+};
+
+#endif // __StKeyframeIndex_h_
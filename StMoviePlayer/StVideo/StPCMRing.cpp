@@ -0,0 +1,117 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StMoviePlayer program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StMoviePlayer program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StPCMRing.h"
+
+StPCMRing::StPCMRing()
+: myBuffer(NULL),
+  mySize(0),
+  myWritePos(0),
+  myReadPos(0) {
+    //
+}
+
+StPCMRing::~StPCMRing() {
+    release();
+}
+
+bool StPCMRing::init(const size_t theSizeMin) {
+    size_t aSize = 1024;
+    while(aSize < theSizeMin && aSize < (size_t(1) << 30)) {
+        aSize *= 2;
+    }
+
+    if(aSize != mySize) {
+        release();
+        myBuffer = stMemAllocAligned<uint8_t*>(aSize, 16);
+        if(myBuffer == NULL) {
+            return false;
+        }
+        mySize = aSize;
+    }
+
+    myClearLock.lock();
+    myWritePos = 0;
+    myReadPos  = 0;
+    StAtomicOp::Add(myReadPos, 0); // memory barrier
+    myClearLock.unlock();
+    return true;
+}
+
+void StPCMRing::release() {
+    stMemFreeAligned(myBuffer);
+    myBuffer   = NULL;
+    mySize     = 0;
+    myWritePos = 0;
+    myReadPos  = 0;
+}
+
+void StPCMRing::clear() {
+    // consumer never waits for this lock, so that the data is just not read in the meantime
+    myClearLock.lock();
+    StAtomicOp::Add(myReadPos, getWritePos() - getReadPos());
+    myClearLock.unlock();
+}
+
+size_t StPCMRing::write(const uint8_t* theData,
+                        const size_t   theNbBytes) {
+    if(myBuffer == NULL) {
+        return 0;
+    }
+
+    const uint32_t aWritePos = getWritePos();
+    const size_t   aNbBytes  = stMin(theNbBytes, mySize - size_t(aWritePos - getReadPos()));
+    if(aNbBytes == 0) {
+        return 0;
+    }
+
+    const size_t anOffset = size_t(aWritePos) & (mySize - 1);
+    const size_t aPart1   = stMin(aNbBytes, mySize - anOffset);
+    stMemCpy(myBuffer + anOffset, theData, aPart1);
+    if(aPart1 < aNbBytes) {
+        stMemCpy(myBuffer, theData + aPart1, aNbBytes - aPart1);
+    }
+
+    // publish the data
+    StAtomicOp::Add(myWritePos, uint32_t(aNbBytes));
+    return aNbBytes;
+}
+
+size_t StPCMRing::read(uint8_t*     theData,
+                       const size_t theNbBytes) {
+    if(myBuffer == NULL
+    || !myClearLock.tryLock()) {
+        return 0;
+    }
+
+    const uint32_t aReadPos = getReadPos();
+    const size_t   aNbBytes = stMin(theNbBytes, size_t(getWritePos() - aReadPos));
+    if(aNbBytes != 0) {
+        const size_t anOffset = size_t(aReadPos) & (mySize - 1);
+        const size_t aPart1   = stMin(aNbBytes, mySize - anOffset);
+        stMemCpy(theData, myBuffer + anOffset, aPart1);
+        if(aPart1 < aNbBytes) {
+            stMemCpy(theData + aPart1, myBuffer, aNbBytes - aPart1);
+        }
+
+        // release the space
+        StAtomicOp::Add(myReadPos, uint32_t(aNbBytes));
+    }
+    myClearLock.unlock();
+    return aNbBytes;
+}
@@ -0,0 +1,130 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StMoviePlayer program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StMoviePlayer program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __StPCMRing_h_
+#define __StPCMRing_h_
+
+#include <StThreads/StAtomicOp.h>
+#include <StThreads/StMutex.h>
+
+/**
+ * Ring buffer passing PCM data from single producer (decoding thread) to single consumer (audio mixer thread).
+ * Read and write positions are monotonic 32-bit counters (wrapping around), capacity is power of two.
+ *
+ * Data transfer is lock-free; consumer never blocks - it takes lock only in non-blocking way
+ * to protect the data against concurrent clear() called by producer,
+ * and reports empty buffer if lock is taken.
+ */
+class StPCMRing {
+
+        public:
+
+    /**
+     * Empty constructor.
+     */
+    ST_LOCAL StPCMRing();
+
+    /**
+     * Destructor.
+     */
+    ST_LOCAL ~StPCMRing();
+
+    /**
+     * Allocate the buffer (should not be called while consumer is active).
+     * @param theSizeMin minimal capacity in bytes, rounded up to power of two
+     * @return FALSE on allocation failure
+     */
+    ST_LOCAL bool init(const size_t theSizeMin);
+
+    /**
+     * Release the buffer (should not be called while consumer is active).
+     */
+    ST_LOCAL void release();
+
+    /**
+     * @return buffer capacity in bytes
+     */
+    ST_LOCAL size_t getCapacity() const { return mySize; }
+
+    /**
+     * @return number of bytes written but not yet read
+     */
+    ST_LOCAL size_t getFilled() const {
+        return size_t(getWritePos() - getReadPos());
+    }
+
+    /**
+     * @return number of bytes which can be written
+     */
+    ST_LOCAL size_t getFree() const {
+        return mySize - getFilled();
+    }
+
+    /**
+     * @return total number of written bytes (wrapping around)
+     */
+    ST_LOCAL uint32_t getWritePos() const {
+        return StAtomicOp::Add(myWritePos, 0);
+    }
+
+    /**
+     * @return total number of read bytes (wrapping around)
+     */
+    ST_LOCAL uint32_t getReadPos() const {
+        return StAtomicOp::Add(myReadPos, 0);
+    }
+
+    /**
+     * Discard written data (producer side).
+     */
+    ST_LOCAL void clear();
+
+    /**
+     * Write data (producer side).
+     * @param theData   data to write
+     * @param theNbBytes number of bytes to write
+     * @return number of written bytes, might be smaller than requested when buffer is full
+     */
+    ST_LOCAL size_t write(const uint8_t* theData,
+                          const size_t   theNbBytes);
+
+    /**
+     * Read data (consumer side).
+     * @param theData    buffer to fill
+     * @param theNbBytes number of bytes to read
+     * @return number of read bytes, might be smaller than requested when buffer is empty
+     */
+    ST_LOCAL size_t read(uint8_t*     theData,
+                         const size_t theNbBytes);
+
+        private:
+
+    StPCMRing(const StPCMRing& );
+    StPCMRing& operator=(const StPCMRing& );
+
+        private:
+
+    uint8_t*          myBuffer;   //!< ring data
+    size_t            mySize;     //!< capacity (power of two)
+    mutable volatile uint32_t myWritePos; //!< total number of written bytes, modified by producer
+    mutable volatile uint32_t myReadPos;  //!< total number of read bytes, modified by consumer
+    StMutex           myClearLock; //!< lock preventing reading of data being discarded
+
+};
+
+#endif // __StPCMRing_h_
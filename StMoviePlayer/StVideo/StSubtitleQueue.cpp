@@ -1,5 +1,5 @@
 /**
- * Copyright © 2011-2025 Kirill Gavrilov <kirill@sview.ru>
+ * Copyright © 2011-2026 Kirill Gavrilov <kirill@sview.ru>
  *
  * StMoviePlayer program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU General Public License as published by
@@ -162,31 +162,33 @@ void StSubtitleQueue::decodeLoop() {
                             }
 
                             StHandle<StSubItem> aNewSubItem = new StSubItem(aPts, aPts + aDuration);
-                            aNewSubItem->Image.initTrash(StImagePlane::ImgRGBA, aRect->w, aRect->h);
                             aNewSubItem->Scale = myImageScale;
 
-                            uint8_t** anImgData = aRect->data;
-                            int* anImgLineSizes = aRect->linesize;
-
-                            SwsContext* aCtxToRgb = sws_getContext(aRect->w, aRect->h, stAV::PIX_FMT::PAL8,
-                                                                   aRect->w, aRect->h, stAV::PIX_FMT::RGBA32,
-                                                                   SWS_BICUBIC, NULL, NULL, NULL);
-                            if(aCtxToRgb == NULL) {
+                            // keep the image palettized - colors are looked up by GPU while rendering
+                            if(aRect->w <= 0 || aRect->h <= 0
+                            || !aNewSubItem->Image.initTrash(StImagePlane::ImgGray, aRect->w, aRect->h)
+                            || !aNewSubItem->Palette.initZero(StImagePlane::ImgRGBA, 16, 16)) {
                                 break;
                             }
 
-                            uint8_t* aDstData[4] = {
-                                (uint8_t* )aNewSubItem->Image.getData(), NULL, NULL, NULL
-                            };
-                            /*const*/ int aDstLinesize[4] = {
-                                (int )aNewSubItem->Image.getSizeRowBytes(), 0, 0, 0
-                            };
-
-                            sws_scale(aCtxToRgb,
-                                      anImgData, anImgLineSizes,
-                                      0, aRect->h,
-                                      aDstData, aDstLinesize);
-                            sws_freeContext(aCtxToRgb);
+                            const size_t aRowBytes = size_t(aRect->w);
+                            for(int aRow = 0; aRow < aRect->h; ++aRow) {
+                                stMemCpy(aNewSubItem->Image.changeData(aRow, 0),
+                                         aRect->data[0] + size_t(aRow) * size_t(aRect->linesize[0]),
+                                         aRowBytes);
+                            }
+
+                            // AVPALETTE stores native-endian 0xAARRGGBB values
+                            const uint32_t* aPalette = (const uint32_t* )aRect->data[1];
+                            const int aNbColors = stMin(aRect->nb_colors, 256);
+                            for(int aColorIter = 0; aColorIter < aNbColors; ++aColorIter) {
+                                const uint32_t aColor = aPalette[aColorIter];
+                                GLubyte* aDst = aNewSubItem->Palette.changeData(aColorIter / 16, aColorIter % 16);
+                                aDst[0] = GLubyte((aColor >> 16) & 0xFF);
+                                aDst[1] = GLubyte((aColor >>  8) & 0xFF);
+                                aDst[2] = GLubyte( aColor        & 0xFF);
+                                aDst[3] = GLubyte((aColor >> 24) & 0xFF);
+                            }
 
                             /*ST_DEBUG_LOG("  |" + aRectId + "/" + aSubtitle.num_rects + "| " //+ aRect->x + "x" + aRect->y + " WH= "
                                             + aRect->w + "x" + aRect->h + " c= " + aRect->nb_colors
@@ -146,6 +146,7 @@ StVideo::StVideo(const std::string&                 theALDeviceName,
 
     params.UseGpu           = new StBoolParam(false);
     params.UseOpenJpeg      = new StBoolParam(false);
+    params.ReadAheadMiB     = new StInt32ParamNamed(0, stCString("readAheadMiB"));
     params.activeAudio      = new StParamActiveStream();
     params.activeSubtitles1 = new StParamActiveStream();
     params.activeSubtitles2 = new StParamActiveStream();
@@ -280,6 +281,18 @@ StVideo::~StVideo() {
 }
 
 void StVideo::close() {
+    myKeyframes.nullify();
+    {
+        // release outside of the lock, since destructor waits for the generation thread
+        StHandle<StVideoThumbnails> aThumbs;
+        myEventMutex.lock();
+        aThumbs = myThumbnails;
+        myThumbnails.nullify();
+        myEventMutex.unlock();
+        if(!aThumbs.isNull()) {
+            signals.onThumbnails();
+        }
+    }
     if(!myVideoSlave.isNull())  { myVideoSlave->deinit(); }
     if(!myVideoMaster.isNull()) { myVideoMaster->deinit(); }
     if(!myAudio.isNull())       { myAudio->deinit(); }
@@ -291,6 +304,15 @@ void StVideo::close() {
             avformat_close_input(&formatCtx);
         }
     }
+    for(size_t anIOIter = 0; anIOIter < myFileIOList.size(); ++anIOIter) {
+        StHandle<StAVIOReadAheadContext> aReadAhead = StHandle<StAVIOReadAheadContext>::downcast(myFileIOList[anIOIter]);
+        if(!aReadAhead.isNull()) {
+            const StString aStats = aReadAhead->formatStats();
+            if(!aStats.isEmpty()) {
+                ST_DEBUG_LOG("StVideo, " + aStats);
+            }
+        }
+    }
     myFileList.clear();
     myCtxList.clear();
     myFileIOList.clear();
@@ -347,6 +369,25 @@ bool StVideo::addFile(const StString& theFileToLoad,
         }
     }
 #endif
+
+    // read local files ahead of demuxer within dedicated I/O thread
+    const int  aReadAheadMiB = params.ReadAheadMiB->getValue();
+    const bool isContentPath = StFileNode::isContentProtocolPath(theFileToLoad);
+    if(aReadAheadMiB > 0
+    && (isContentPath || !StFileNode::isRemoteProtocolPath(theFileToLoad))) {
+        StHandle<StAVIOContext> aSource = anIOContext;
+        if(aSource.isNull()
+        && !isContentPath) {
+            StHandle<StAVIOFileContext> aFileCtx = new StAVIOFileContext();
+            if(aFileCtx->open(theFileToLoad)) {
+                aSource = aFileCtx;
+            }
+        }
+        if(!aSource.isNull()) {
+            anIOContext = new StAVIOReadAheadContext(aSource, size_t(aReadAheadMiB) * 1024 * 1024);
+        }
+    }
+
     AVFormatContext* aFormatCtx = NULL;
     if(!anIOContext.isNull()) {
         aFormatCtx = avformat_alloc_context();
@@ -414,6 +455,17 @@ bool StVideo::addFile(const StString& theFileToLoad,
             if(!myVideoMaster->isInitialized()) {
                 myVideoMaster->init(aFormatCtx, aStreamId, aTitleString, theNewParams);
                 myVideoMaster->setSlave(NULL);
+                if(myVideoMaster->isInitialized()
+                && !myVideoMaster->isAttachedPicture()
+                &&  StKeyframeIndex::isSupportedPath(theFileToLoad)) {
+                    myKeyframes = new StKeyframeIndex(theFileToLoad, aStreamId, myResMgr->getCacheFolder());
+
+                    StHandle<StVideoThumbnails> aThumbs = new StVideoThumbnails(theFileToLoad, aStreamId, myResMgr->getCacheFolder(),
+                                                                                signals.onThumbnails);
+                    myEventMutex.lock();
+                    myThumbnails = aThumbs;
+                    myEventMutex.unlock();
+                }
 
                 if(myVideoMaster->isInitialized()) {
                     myAudio->setTrackHeadOrientation(params.ToTrackHeadAudio->getValue() && theNewParams->ViewingMode != StViewSurface_Plain);
@@ -781,6 +833,10 @@ void StVideo::doSeek(const double theSeekPts,
     for(size_t ctxId = 0; ctxId < myPlayCtxList.size(); ++ctxId) {
         doSeekContext(myPlayCtxList[ctxId], theSeekPts, toSeekBack);
     }
+    if( myVideoMaster->isInitialized()
+    && !myVideoMaster->isAttachedPicture()) {
+        myVideoMaster->setSkipTarget(theSeekPts);
+    }
 
     // clear packet queues from obsolete data
     doFlushSoft();
@@ -845,6 +901,17 @@ bool StVideo::doSeekStream(AVFormatContext* theFormatCtx,
     }
 
     int64_t aSeekTarget = stAV::secondsToUnits(aStream, theSeekPts + stAV::unitsToSeconds(aStream, aStream->start_time));
+
+    // go directly to the key frame preceding the target when index is available
+    int64_t aKeyframe = 0;
+    if(!myKeyframes.isNull()
+    &&  myKeyframes->getStreamId() == theStreamId
+    &&  myVideoMaster->isInContext(theFormatCtx, theStreamId)
+    &&  myKeyframes->findPrevious(aSeekTarget, aKeyframe)
+    &&  av_seek_frame(theFormatCtx, theStreamId, aKeyframe, AVSEEK_FLAG_BACKWARD) >= 0) {
+        return true;
+    }
+
     bool isSeekDone = av_seek_frame(theFormatCtx, theStreamId, aSeekTarget, aFlags) >= 0;
 
     // try 10 more times in backward direction to work-around huge duration between key frames
@@ -1425,6 +1492,7 @@ StHandle<StMovieInfo> StVideo::getFileInfo(const StHandle<StStereoParams>& thePa
     anInfo->Codecs.clear();
     anInfo->Codecs.add(StArgument("vcodec1",    myVideoMaster->getCodecInfo()));
     anInfo->Codecs.add(StArgument("vcodec2",    myVideoSlave ->getCodecInfo()));
+    anInfo->Codecs.add(StArgument("vpairs",     myVideoMaster->getPairingInfo()));
     anInfo->Codecs.add(StArgument("audio",      myAudio      ->getCodecInfo()));
     anInfo->Codecs.add(StArgument("subtitles",  mySubtitles1 ->getCodecInfo()));
     anInfo->Codecs.add(StArgument("subtitles2", mySubtitles2 ->getCodecInfo()));
@@ -23,9 +23,12 @@
 #include "StAudioQueue.h"   // audio queue class
 #include "StSubtitleQueue.h"// subtitles queue class
 #include "StVideoTimer.h"   // video refresher class
+#include "StKeyframeIndex.h"
+#include "StVideoThumbnails.h"
 #include "StParamActiveStream.h"
 
 #include <StAV/StAVIOFileContext.h>
+#include <StAV/StAVIOReadAheadContext.h>
 #include <StFile/StMIMEList.h>
 #include <StThreads/StProcess.h>
 #include <StThreads/StThread.h>
@@ -157,6 +160,11 @@ class StVideo {
      */
     ST_LOCAL bool hasVideoStream() const { return myVideoMaster->isInitialized(); }
 
+    /**
+     * @return current level of decoding load governor
+     */
+    ST_LOCAL StVideoQueue::DecodeLoad getDecodeLoad() const { return myVideoMaster->getDecodeLoad(); }
+
     /**
      * Set the stereoscopic format to be used for video
      * with ambiguous format information.
@@ -225,6 +233,16 @@ class StVideo {
      */
     ST_LOCAL bool hasAlHintHrtf() const { return myAudio->hasAlHintHrtf(); }
 
+    /**
+     * Return TRUE if OpenAL implementation supports callback output.
+     */
+    ST_LOCAL bool hasAlCallbackOutput() const { return myAudio->hasAlCallbackOutput(); }
+
+    /**
+     * Set callback (low-latency) audio output.
+     */
+    ST_LOCAL void setAlCallbackOutput(bool theToUse) { myAudio->setAlCallbackOutput(theToUse); }
+
     /**
      * Setup OpenAL hints.
      */
@@ -274,6 +292,7 @@ class StVideo {
         StHandle<StBoolParam>         ToSearchSubs;    //!< automatically search for additional subtitles/audio track files nearby video file
         StHandle<StBoolParamNamed>    ToTrackHeadAudio;//!< enable/disable head-tracking for audio listener
         StHandle<StFloat32Param>      SlideShowDelay;  //!< slideshow delay
+        StHandle<StInt32ParamNamed>   ReadAheadMiB;    //!< read-ahead buffer size in MiB for local files, 0 to read within demuxer thread
         StHandle<StParamActiveStream> activeAudio;     //!< active Audio stream
         StHandle<StParamActiveStream> activeSubtitles1;//!< active Subtitles stream (first)
         StHandle<StParamActiveStream> activeSubtitles2;//!< active Subtitles stream (secondary)
@@ -291,6 +310,11 @@ class StVideo {
          */
         StSignal<void ()> onLoaded;
 
+        /**
+         * Emit callback Slot when seek bar thumbnails become available or are released on file close.
+         */
+        StSignal<void ()> onThumbnails;
+
         /**
          * Emit callback Slot on error.
          * @param theUserData (const StString& ) - error description.
@@ -312,6 +336,29 @@ class StVideo {
         return theIsVideoPlayed || theIsAudioPlayed;
     }
 
+    /**
+     * Retrieve seek bar thumbnails of currently played file.
+     * @param theAtlas     atlas image, NULL if thumbnails are not (yet) available
+     * @param theNbThumbs  number of thumbnails within atlas
+     * @param theThumbSizeX thumbnail width
+     * @param theThumbSizeY thumbnail height
+     */
+    ST_LOCAL void getThumbnails(StHandle<StImagePlane>& theAtlas,
+                                int& theNbThumbs,
+                                int& theThumbSizeX,
+                                int& theThumbSizeY) const {
+        myEventMutex.lock();
+        if(!myThumbnails.isNull()) {
+            theAtlas      = myThumbnails->getAtlas();
+            theNbThumbs   = myThumbnails->getNbThumbs();
+            theThumbSizeX = myThumbnails->getThumbSizeX();
+            theThumbSizeY = myThumbnails->getThumbSizeY();
+        } else {
+            theAtlas.nullify();
+        }
+        myEventMutex.unlock();
+    }
+
     ST_LOCAL double getDuration() const {
         myEventMutex.lock();
             double aDuration = myDuration;
@@ -461,6 +508,8 @@ class StVideo {
     StMIMEList                    myMimesSubs;
     StMIMEList                    myMimesImages;
     StHandle<StThread>            myThread;      //!< main loop thread
+    StHandle<StKeyframeIndex>     myKeyframes;   //!< key frames index of master video stream
+    StHandle<StVideoThumbnails>   myThumbnails;  //!< seek bar thumbnails of master video stream (guarded by myEventMutex)
     StHandle<StResourceManager>   myResMgr;      //!< resource manager
     StHandle<StTranslations>      myLangMap;     //!< translations dictionary
 
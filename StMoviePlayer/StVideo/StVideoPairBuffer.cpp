@@ -0,0 +1,206 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StMoviePlayer program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StMoviePlayer program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StVideoPairBuffer.h"
+
+#include <StThreads/StTimer.h>
+
+#include <cmath>
+
+namespace {
+
+    /**
+     * Slave frames too far ahead of Master are considered remnants of seeking.
+     */
+    static const double THE_STALE_PTS_DIFF = 6.0;
+
+}
+
+StVideoPairBuffer::StVideoPairBuffer()
+: myFirst(0),
+  myNbFrames(0),
+  myLastSlavePts(0.0),
+  myHasFrame(false),
+  myHasSpace(true),
+  mySkewSumSec(0.0),
+  myIsSlaveEnded(false) {
+    stMemZero(myPts, sizeof(myPts));
+    resetStats();
+}
+
+void StVideoPairBuffer::resetStats() {
+    StMutexAuto aLock(&myMutex);
+    stMemZero(&myStats, sizeof(myStats));
+    mySkewSumSec = 0.0;
+}
+
+void StVideoPairBuffer::popFront() {
+    myFrames[myFirst].nullify();
+    myFirst = (myFirst + 1) % FRAMES_MAX;
+    --myNbFrames;
+}
+
+void StVideoPairBuffer::updateEvents() {
+    if(myNbFrames > 0 || myIsSlaveEnded) {
+        myHasFrame.set();
+    } else {
+        myHasFrame.reset();
+    }
+    if(myNbFrames < FRAMES_MAX) {
+        myHasSpace.set();
+    } else {
+        myHasSpace.reset();
+    }
+}
+
+void StVideoPairBuffer::clear() {
+    StMutexAuto aLock(&myMutex);
+    while(myNbFrames > 0) {
+        popFront();
+    }
+    myFirst = 0;
+    myLastSlave.nullify();
+    myIsSlaveEnded = false;
+    updateEvents();
+}
+
+void StVideoPairBuffer::setSlaveEnded() {
+    StMutexAuto aLock(&myMutex);
+    myIsSlaveEnded = true;
+    updateEvents();
+}
+
+bool StVideoPairBuffer::isEmpty() const {
+    StMutexAuto aLock(&myMutex);
+    return myNbFrames == 0;
+}
+
+bool StVideoPairBuffer::pushSlave(const StImage& theImage,
+                                  const double   thePts,
+                                  const size_t   theTimeoutMs) {
+    // wait for free space before referencing (or copying) the frame,
+    // so that the caller may retry without repeated copies
+    StTimer aStallTimer(true);
+    const bool hasSpace = myHasSpace.wait(theTimeoutMs);
+    {
+        StMutexAuto aLock(&myMutex);
+        myStats.StallSlaveSec += aStallTimer.getElapsedTimeInSec();
+        if(!hasSpace
+        || myNbFrames >= FRAMES_MAX) {
+            return false;
+        }
+    }
+
+    // Slave is the only producer - free space can not be taken by another thread
+    StHandle<StImage> anImage = new StImage();
+    if(!anImage->initReference(theImage)) {
+        // RGB buffer of software scaler is reused by decoder
+        anImage->initCopy(theImage, false);
+    }
+
+    StMutexAuto aLock(&myMutex);
+    if(myNbFrames >= FRAMES_MAX) {
+        return false;
+    }
+
+    const int anIndex = (myFirst + myNbFrames) % FRAMES_MAX;
+    myFrames[anIndex] = anImage;
+    myPts   [anIndex] = thePts;
+    ++myNbFrames;
+    myIsSlaveEnded = false;
+    updateEvents();
+    return true;
+}
+
+StVideoPairBuffer::PairResult StVideoPairBuffer::pairMaster(const double       theMasterPts,
+                                                            const double       theTolerance,
+                                                            StHandle<StImage>& theSlave,
+                                                            const size_t       theTimeoutMs) {
+    theSlave.nullify();
+    StTimer aStallTimer(true);
+    if(!myHasFrame.wait(theTimeoutMs)) {
+        StMutexAuto aLock(&myMutex);
+        myStats.StallMasterSec += aStallTimer.getElapsedTimeInSec();
+        return PairResult_Wait;
+    }
+
+    StMutexAuto aLock(&myMutex);
+    myStats.StallMasterSec += aStallTimer.getElapsedTimeInSec();
+
+    // drop Slave frames behind Master and remnants of seeking
+    while(myNbFrames > 0) {
+        const double aPtsDiff = theMasterPts - myPts[myFirst];
+        if(aPtsDiff <= theTolerance
+        && aPtsDiff >= -THE_STALE_PTS_DIFF) {
+            break;
+        }
+        popFront();
+        ++myStats.NbDropsSlave;
+    }
+
+    PairResult aResult = PairResult_Wait;
+    if(myNbFrames > 0) {
+        const double aPtsDiff = theMasterPts - myPts[myFirst];
+        if(aPtsDiff >= -theTolerance) {
+            theSlave        = myFrames[myFirst];
+            myLastSlave     = theSlave;
+            myLastSlavePts  = myPts[myFirst];
+            popFront();
+            const double aSkew = std::abs(aPtsDiff);
+            mySkewSumSec += aSkew;
+            ++myStats.NbPairs;
+            myStats.SkewMaxSec = stMax(myStats.SkewMaxSec, aSkew);
+            myStats.SkewAvgSec = mySkewSumSec / double(myStats.NbPairs);
+            aResult = PairResult_Matched;
+        } else if(!myLastSlave.isNull()
+               && std::abs(theMasterPts - myLastSlavePts) <= theTolerance) {
+            theSlave = myLastSlave;
+            ++myStats.NbRepeats;
+            aResult = PairResult_Repeated;
+        } else {
+            ++myStats.NbDropsMaster;
+            aResult = PairResult_DropMaster;
+        }
+    } else if(myIsSlaveEnded) {
+        aResult = PairResult_NoSlave;
+    }
+    updateEvents();
+    return aResult;
+}
+
+StVideoPairBuffer::Stats StVideoPairBuffer::getStats() const {
+    StMutexAuto aLock(&myMutex);
+    return myStats;
+}
+
+StString StVideoPairBuffer::formatStats() const {
+    const Stats aStats = getStats();
+    if(aStats.NbPairs == 0
+    && aStats.NbDropsMaster == 0
+    && aStats.NbDropsSlave  == 0) {
+        return StString();
+    }
+
+    char aBuffer[256];
+    stsprintf(aBuffer, sizeof(aBuffer),
+              "[Pairing] %d pairs, skew avg %.1f ms, max %.1f ms; repeats %d, dropped %d/%d (master/slave); stalls %.2f/%.2f s (master/slave)",
+              aStats.NbPairs, aStats.SkewAvgSec * 1000.0, aStats.SkewMaxSec * 1000.0,
+              aStats.NbRepeats, aStats.NbDropsMaster, aStats.NbDropsSlave,
+              aStats.StallMasterSec, aStats.StallSlaveSec);
+    return aBuffer;
+}
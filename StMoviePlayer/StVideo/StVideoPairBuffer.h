@@ -0,0 +1,159 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StMoviePlayer program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StMoviePlayer program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __StVideoPairBuffer_h_
+#define __StVideoPairBuffer_h_
+
+#include <StImage/StImage.h>
+#include <StStrings/StString.h>
+#include <StThreads/StCondition.h>
+#include <StThreads/StMutex.h>
+
+/**
+ * Buffer pairing frames of Master and Slave video streams by PTS.
+ * Slave decoding thread pushes decoded frames ahead (up to FRAMES_MAX) without waiting for Master,
+ * while Master decoding thread picks the Slave frame matching its own frame within specified tolerance.
+ * Drops and repeats are decided at one place for both streams:
+ * - Slave frames older than Master frame are dropped;
+ * - Master frame is dropped when Slave is ahead, unless previously paired Slave frame still matches (repeat).
+ */
+class StVideoPairBuffer {
+
+        public:
+
+    enum {
+        FRAMES_MAX = 4, //!< maximum number of Slave frames decoded ahead
+    };
+
+    /**
+     * Result of pairing Master frame.
+     */
+    enum PairResult {
+        PairResult_Matched,    //!< Slave frame with matching PTS has been found
+        PairResult_Repeated,   //!< previously paired Slave frame has been reused
+        PairResult_DropMaster, //!< Master frame should be dropped, since Slave is ahead
+        PairResult_NoSlave,    //!< Slave stream has ended
+        PairResult_Wait,       //!< no Slave frame arrived within timeout
+    };
+
+    /**
+     * Pairing statistics.
+     */
+    struct Stats {
+        double SkewAvgSec;     //!< average PTS difference within matched pairs
+        double SkewMaxSec;     //!< maximum PTS difference within matched pairs
+        double StallMasterSec; //!< overall time Master waited for Slave frames
+        double StallSlaveSec;  //!< overall time Slave waited for free space in buffer
+        int    NbPairs;        //!< number of matched pairs
+        int    NbRepeats;      //!< number of repeated Slave frames
+        int    NbDropsMaster;  //!< number of dropped Master frames
+        int    NbDropsSlave;   //!< number of dropped Slave frames
+    };
+
+        public:
+
+    /**
+     * Empty constructor.
+     */
+    ST_LOCAL StVideoPairBuffer();
+
+    /**
+     * Remove queued frames (on seeking or stream restart).
+     */
+    ST_LOCAL void clear();
+
+    /**
+     * Reset statistics.
+     */
+    ST_LOCAL void resetStats();
+
+    /**
+     * Mark end of Slave stream - Master will not wait for new frames until next push.
+     */
+    ST_LOCAL void setSlaveEnded();
+
+    /**
+     * Append decoded Slave frame.
+     * Image data is referenced when possible (buffer counter is defined) or copied otherwise.
+     * @param theImage     decoded image
+     * @param thePts       frame PTS
+     * @param theTimeoutMs time to wait for free space in buffer
+     * @return FALSE if buffer remains full after timeout
+     */
+    ST_LOCAL bool pushSlave(const StImage& theImage,
+                            const double   thePts,
+                            const size_t   theTimeoutMs);
+
+    /**
+     * Find Slave frame for Master frame.
+     * @param theMasterPts  Master frame PTS
+     * @param theTolerance  maximum PTS difference within pair
+     * @param theSlave      found Slave frame
+     * @param theTimeoutMs  time to wait for Slave frame when buffer is empty
+     * @return pairing result
+     */
+    ST_LOCAL PairResult pairMaster(const double       theMasterPts,
+                                   const double       theTolerance,
+                                   StHandle<StImage>& theSlave,
+                                   const size_t       theTimeoutMs);
+
+    /**
+     * @return true if buffer has no queued Slave frames
+     */
+    ST_LOCAL bool isEmpty() const;
+
+    /**
+     * Retrieve pairing statistics.
+     */
+    ST_LOCAL Stats getStats() const;
+
+    /**
+     * Format pairing statistics as text.
+     */
+    ST_LOCAL StString formatStats() const;
+
+        private:
+
+    /**
+     * Remove the oldest frame from buffer. Mutex should be locked.
+     */
+    ST_LOCAL void popFront();
+
+    /**
+     * Update events state. Mutex should be locked.
+     */
+    ST_LOCAL void updateEvents();
+
+        private:
+
+    StHandle<StImage> myFrames[FRAMES_MAX]; //!< ring buffer of Slave frames
+    double            myPts[FRAMES_MAX];    //!< PTS of Slave frames
+    int               myFirst;              //!< index of the oldest frame within ring buffer
+    int               myNbFrames;           //!< number of queued frames
+    StHandle<StImage> myLastSlave;          //!< last paired Slave frame (for repeats)
+    double            myLastSlavePts;       //!< PTS of last paired Slave frame
+    mutable StMutex   myMutex;              //!< lock for thread-safety
+    StCondition       myHasFrame;           //!< event indicating that buffer is not empty
+    StCondition       myHasSpace;           //!< event indicating that buffer is not full
+    Stats             myStats;              //!< pairing statistics
+    double            mySkewSumSec;         //!< sum of PTS differences within matched pairs
+    bool              myIsSlaveEnded;       //!< end of Slave stream
+
+};
+
+#endif // __StVideoPairBuffer_h_
@@ -1,5 +1,5 @@
 /**
- * Copyright © 2009-2025 Kirill Gavrilov <kirill@sview.ru>
+ * Copyright © 2009-2026 Kirill Gavrilov <kirill@sview.ru>
  *
  * StMoviePlayer program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU General Public License as published by
@@ -19,7 +19,10 @@
 #include "StVideoQueue.h"
 
 #include <StStrings/StStringStream.h>
+#include <StThreads/StAtomicOp.h>
+#include <StThreads/StProfiler.h>
 #include <StThreads/StThread.h>
+#include <StThreads/StThreadBudget.h>
 
 #if (defined(_WIN64) || defined(__WIN64__))\
  || (defined(_LP64)  || defined(__LP64__))
@@ -37,6 +40,46 @@ namespace {
         return SV_THREAD_RETURN 0;
     }
 
+    /**
+     * Estimate relative cost of software decoding of the stream (1.0 for H.264 1080p at 30 FPS).
+     */
+    static double decodingCost(const AVCodec*         theCodec,
+                               const AVCodecContext*  theCodecCtx,
+                               const AVStream*        theStream) {
+        double aFps = theStream->avg_frame_rate.den != 0 ? av_q2d(theStream->avg_frame_rate) : 0.0;
+        if(aFps <= 0.0 || aFps > 240.0) {
+            aFps = 25.0;
+        }
+
+        const StString aName(theCodec->name);
+        double aCodecFactor = 1.0;
+        if(aName.isEquals(stCString("hevc"))
+        || aName.isEquals(stCString("vp9"))
+        || aName.isStartsWith(stCString("libdav1d"))
+        || aName.isEquals(stCString("av1"))) {
+            aCodecFactor = 1.6;
+        } else if(aName.isEquals(stCString("jpeg2000"))
+               || aName.isEquals(stCString("libopenjpeg"))) {
+            aCodecFactor = 3.0;
+        } else if(aName.isEquals(stCString("mpeg1video"))
+               || aName.isEquals(stCString("mpeg2video"))
+               || aName.isEquals(stCString("mpeg4"))) {
+            aCodecFactor = 0.4;
+        }
+
+        const double aPixels = double(theCodecCtx->width) * double(theCodecCtx->height);
+        return aCodecFactor * aPixels * aFps / (1920.0 * 1080.0 * 30.0);
+    }
+
+    /**
+     * Return the number of threads which decoder might utilize for the stream.
+     */
+    static int decodingMaxThreads(const AVCodecContext* theCodecCtx) {
+        // small frames do not benefit from many threads, FFmpeg frame threading is limited to 16 threads
+        const double aPixels = double(theCodecCtx->width) * double(theCodecCtx->height);
+        return stClamp(int(aPixels / (320.0 * 240.0)), 1, 16);
+    }
+
 }
 
 AVPixelFormat StVideoQueue::getFrameFormat(AVCodecContext*      theCodecCtx,
@@ -160,8 +203,8 @@ StVideoQueue::StVideoQueue(const StHandle<StGLTextureQueue>& theTextureQueue,
   CodecIdJpeg2K(stFindCodecId("jpeg2000")),
   myDowntimeState(true),
   myTextureQueue(theTextureQueue),
-  myHasDataState(false),
   myMaster(theMaster),
+  myPairs(theMaster.isNull() ? new StVideoPairBuffer() : theMaster->myPairs),
 #if defined(__ANDROID__)
   myCodecH264HW(avcodec_find_decoder_by_name("h264_mediacodec")),
   myCodecHevcHW(avcodec_find_decoder_by_name("hevc_mediacodec")),
@@ -171,12 +214,20 @@ StVideoQueue::StVideoQueue(const StHandle<StGLTextureQueue>& theTextureQueue,
   myUseGpu(false),
   myIsGpuFailed(false),
   myUseOpenJpeg(false),
+  myBudgetThreads(0),
   //
   myToRgbCtx(NULL),
   myToRgbPixFmt(stAV::PIX_FMT::NONE),
   myToRgbIsBroken(false),
   //
-  myAvDiscard(AVDISCARD_DEFAULT),
+  myLoadLevel(DecodeLoad_Full),
+  myLoadApplied(DecodeLoad_Full),
+  myLoadRatio(0.0),
+  myLoadBusyMSec(0.0),
+  myLoadNbLate(0),
+  myLoadNbCalm(0),
+  myLoadCalmLimit(0),
+  myLoadNbSinceDown(0),
   myFramePts(0.0),
   myPixelRatio(1.0f),
   myPixelRatioComp(1.0f),
@@ -191,6 +242,8 @@ StVideoQueue::StVideoQueue(const StHandle<StGLTextureQueue>& theTextureQueue,
   myAudioDelayMSec(0),
   myFramesCounter(1),
   myWasFlushed(false),
+  mySkipTargetNext(-1.0),
+  mySkipTarget(-1.0),
   myStFormatByUser(StFormat_AUTO),
   myStFormatByName(StFormat_AUTO),
   myStFormatInStream(StFormat_AUTO),
@@ -285,12 +338,26 @@ bool StVideoQueue::initCodec(const AVCodec* theCodec,
     stAV::meta::Dict* anOpts = NULL;
     av_dict_set(&anOpts, "refcounted_frames", "1", 0);
 
-    // attached pics are sparse, therefore we would not want to delay their decoding till EOF
-    int aNbThreads = theToUseGpu || isAttachedPicture()
-                   ? 1
-                   : StThread::countLogicalProcessors();
+    // attached pics are sparse, therefore we would not want to delay their decoding till EOF;
+    // software decoders share the global threads budget with other active decoders
+    const StString aBudgetName = StString(theCodec->name) + " " + myCodecCtx->width + "x" + myCodecCtx->height
+                               + (myMaster.isNull() ? "" : " (slave)");
+    int aNbThreads = 1;
+    if(theToUseGpu || isAttachedPicture()) {
+        StThreadBudget::GetDefault().changeConsumer(myBudgetId, aBudgetName, 0.0, 1);
+        myBudgetThreads = 0;
+    } else {
+        aNbThreads = StThreadBudget::GetDefault().changeConsumer(myBudgetId, aBudgetName,
+                                                                 decodingCost(theCodec, myCodecCtx, myStream),
+                                                                 decodingMaxThreads(myCodecCtx));
+        myBudgetThreads = aNbThreads;
+    }
     myCodecCtx->thread_count = aNbThreads;
 
+    // preserve decoding load level on re-opening codec
+    myLoadApplied = myMaster.isNull() ? getDecodeLoad() : myMaster->getDecodeLoad();
+    applyDecodeLoad(myCodecCtx, myLoadApplied);
+
     // open codec
     if(avcodec_open2(myCodecCtx, theCodec, &anOpts) < 0) {
         return false;
@@ -528,6 +595,7 @@ void StVideoQueue::deinit() {
     myDataAdp.nullify();
 
     myDataRGB.nullify();
+    myDataRGBBudget.nullify();
     sws_freeContext(myToRgbCtx);
     myToRgbCtx      = NULL;
     myToRgbPixFmt   = stAV::PIX_FMT::NONE;
@@ -535,7 +603,23 @@ void StVideoQueue::deinit() {
 
     myFramesCounter = 1;
     myCachedFrame.nullify();
+    myCachedFrameBudget.nullify();
 
+    if(myBudgetThreads > 0) {
+        ST_DEBUG_LOG("StVideoQueue, decoding threads: " + StThreadBudget::GetDefault().formatStats());
+    }
+    myBudgetThreads = 0;
+    if(myLoadLevel != DecodeLoad_Full) {
+        ST_DEBUG_LOG("StVideoQueue, decoding load level reset from " + int(myLoadLevel) + " (" + decodeLoadString(getDecodeLoad()) + ")");
+    }
+    myLoadLevel       = DecodeLoad_Full;
+    myLoadApplied     = DecodeLoad_Full;
+    myLoadRatio       = 0.0;
+    myLoadBusyMSec    = 0.0;
+    myLoadNbLate      = 0;
+    myLoadNbCalm      = 0;
+    myLoadCalmLimit   = 0;
+    myLoadNbSinceDown = 0;
     StAVPacketQueue::deinit();
     if(!myHWAccelCtx.isNull()) {
         myHWAccelCtx->decoderDestroy(myCodecCtx);
@@ -546,6 +630,7 @@ void StVideoQueue::deinit() {
 }
 
 void StVideoQueue::prepareFrame(const StFormat theSrcFormat) {
+    ST_PROFILER_ZONE("StVideoQueue::prepareFrame");
     int           aFrameSizeX = 0;
     int           aFrameSizeY = 0;
     AVPixelFormat aPixFmt     = stAV::PIX_FMT::NONE;
@@ -677,6 +762,7 @@ void StVideoQueue::prepareFrame(const StFormat theSrcFormat) {
                     signals.onError(stCString("FFmpeg: Failed allocation of RGB frame (out of memory)"));
                     myToRgbIsBroken = true;
                 } else {
+                    myDataRGBBudget = new StMemoryBudget::Allocation(StMemoryBudget::Subsystem_Frames, myDataRGB.getSizeBytes());
                     ST_DEBUG_LOG(" !!! Performance warning! Using SWScaler for " + stAV::PIX_FMT::getString(aPixFmt) + " pixel format.");
                     {
                         StMutexAuto aLock(myMutexInfo);
@@ -763,6 +849,7 @@ void StVideoQueue::pushFrame(const StImage&     theSrcDataLeft,
 }
 
 void StVideoQueue::decodeLoop() {
+    StProfilerThread aProfilerThread(myMaster.isNull() ? "StVideoQueueMaster" : "StVideoQueueSlave");
     double anAverageDelaySec = 40.0;
     double aPrevPts  = 0.0;
     myFramePts = 0.0;
@@ -787,21 +874,52 @@ void StVideoQueue::decodeLoop() {
                 if(myCodecCtx != NULL && myCodec != NULL) {
                     avcodec_flush_buffers(myCodecCtx);
                 }
+                if(myCodec != NULL
+                && myBudgetThreads > 0
+                && myBudgetThreads != StThreadBudget::GetDefault().getNbThreads(myBudgetId)) {
+                    // apply new threads allocation after another stream has been opened or closed
+                    if(!initCodec(myCodec, false)) {
+                        // packets are dropped till the next init()
+                        signals.onError(stCString("FFmpeg: Could not re-open video codec"));
+                        deinit();
+                        if(!myMaster.isNull()) {
+                            // let Master proceed without waiting for frames
+                            myPairs->setSlaveEnded();
+                        }
+                        continue;
+                    }
+                }
                 // now we clear our sttextures buffer
                 if(myMaster.isNull()) {
                     myTextureQueue->clear();
                 }
                 myCachedFrame.nullify();
+                myCachedFrameBudget.nullify();
+                myLoadBusyMSec = 0.0;
+                myLoadNbLate   = 0;
+                myLoadNbCalm   = 0;
                 myAudioClock = 0.0;
                 myVideoClock = 0.0;
                 myToFlush    = false;
                 myWasFlushed = true;
+                myEventMutex.lock();
+                mySkipTarget     = mySkipTargetNext;
+                mySkipTargetNext = -1.0;
+                myEventMutex.unlock();
+                if(!myMaster.isNull()) {
+                    // only producer drops outdated frames - Master might already wait for new ones
+                    myPairs->clear();
+                }
                 continue;
             }
             case StAVPacket::START_PACKET: {
                 myAudioClock = 0.0;
                 myVideoClock = 0.0;
-                myHasDataState.reset();
+                if(!myMaster.isNull()) {
+                    myPairs->clear();
+                } else {
+                    myPairs->resetStats();
+                }
                 isStarted = true;
                 aPrevPts = 0.0;
                 myWasFlushed = true; // force displaying the first frame
@@ -819,15 +937,11 @@ void StVideoQueue::decodeLoop() {
                 // to recieve last frames.
 
                 if(!myMaster.isNull()) {
-                    while(myHasDataState.check() && !myMaster->isInDowntime()) {
-                        StThread::sleep(10);
-                    }
-                    // wake up Master
-                    myDataAdp.nullify();
-                    myHasDataState.set();
+                    // let Master proceed without waiting for more frames
+                    myPairs->setSlaveEnded();
                 } else {
                     if(!mySlave.isNull()) {
-                        mySlave->unlockData();
+                        ST_DEBUG_LOG("StVideoQueue, " + myPairs->formatStats());
                     }
                     StTimer stTimerWaitEmpty(true);
                     double waitTime = anAverageDelaySec * myTextureQueue->getSize() + 0.1;
@@ -845,9 +959,10 @@ void StVideoQueue::decodeLoop() {
             }
         }
 
-        // wait master retrieve previous data
-        while(!myMaster.isNull() && myHasDataState.check()) {
-            //
+        if(myCodecCtx == NULL) {
+            // no codec (e.g. failed to re-open) - drop packets instead of decoding
+            aPacket.nullify();
+            continue;
         }
 
         bool toSendPacket = true;
@@ -860,6 +975,106 @@ void StVideoQueue::decodeLoop() {
     }
 }
 
+const char* StVideoQueue::decodeLoadString(const DecodeLoad theLevel) {
+    switch(theLevel) {
+        case DecodeLoad_Full:                 return "full quality";
+        case DecodeLoad_SkipLoopFilterNonRef: return "skip loop filter on non-ref frames";
+        case DecodeLoad_SkipLoopFilterAll:    return "skip loop filter";
+        case DecodeLoad_Fast:                 return "fast decoding";
+        case DecodeLoad_SkipNonRef:           return "drop non-ref frames";
+        case DecodeLoad_SkipNonKey:           return "key frames only";
+    }
+    return "";
+}
+
+void StVideoQueue::applyDecodeLoad(AVCodecContext*  theCodecCtx,
+                                   const DecodeLoad theLevel) {
+    if(theCodecCtx == NULL) {
+        return;
+    }
+
+    // these options are read by decoder per frame (and propagated to frame threads),
+    // so that they can be switched without re-opening decoder
+    theCodecCtx->skip_loop_filter = theLevel >= DecodeLoad_SkipLoopFilterAll    ? AVDISCARD_ALL
+                                  : theLevel >= DecodeLoad_SkipLoopFilterNonRef ? AVDISCARD_NONREF
+                                  : AVDISCARD_DEFAULT;
+    // skip_idct is not used, since it visibly corrupts B-frames (worse than dropping them at the next level)
+    if(theLevel >= DecodeLoad_Fast) {
+        theCodecCtx->flags2 |= AV_CODEC_FLAG2_FAST;
+    } else {
+        theCodecCtx->flags2 &= ~AV_CODEC_FLAG2_FAST;
+    }
+    theCodecCtx->skip_frame = theLevel >= DecodeLoad_SkipNonKey ? AVDISCARD_NONKEY
+                            : theLevel >= DecodeLoad_SkipNonRef ? AVDISCARD_NONREF
+                            : AVDISCARD_DEFAULT;
+}
+
+void StVideoQueue::updateDecodeLoad(const double theDecodeMSec,
+                                    const double theBudgetSec,
+                                    const double theLagSec) {
+    (void )theDecodeMSec;
+    (void )theBudgetSec;
+    static const double LOAD_LATE_RATIO = 0.9;   // decoding time (relative to frame budget) considered as overload
+    static const double LOAD_CALM_RATIO = 0.6;   // decoding time (relative to frame budget) allowing to step down
+    static const double LAG_LATE_SEC    = 0.2;   // video lag behind audio considered as overload
+    static const double LAG_CALM_SEC    = 0.05;  // video lag behind audio allowing to step down
+    static const double LAG_IGNORE_SEC  = 100.0; // lag is meaningless (audio clock is not yet started or stream is broken)
+    static const int    NB_LATE_FRAMES  = 8;     // consecutive overloaded frames to step up
+    static const int    NB_CALM_FRAMES  = 90;    // consecutive comfortable frames to step down
+    if(myLoadCalmLimit <= 0) {
+        myLoadCalmLimit = NB_CALM_FRAMES;
+    }
+
+    // slave decoder works in parallel - the slowest one defines the pace
+    double aRatio = myLoadRatio;
+    if(!mySlave.isNull()) {
+        aRatio = stMax(aRatio, (double )mySlave->myLoadRatio);
+    }
+    const bool hasLag = theLagSec < LAG_IGNORE_SEC;
+    const bool isLate = aRatio > LOAD_LATE_RATIO
+                     || (hasLag && theLagSec > LAG_LATE_SEC);
+    const bool isCalm = aRatio < LOAD_CALM_RATIO
+                     && (!hasLag || theLagSec < LAG_CALM_SEC);
+    ++myLoadNbSinceDown;
+
+    const DecodeLoad aLevelOld = getDecodeLoad();
+    DecodeLoad aLevel = aLevelOld;
+    if(isLate) {
+        myLoadNbCalm = 0;
+        if(++myLoadNbLate >= NB_LATE_FRAMES
+        && aLevel < DecodeLoad_SkipNonKey) {
+            aLevel = DecodeLoad(aLevel + 1);
+            if(myLoadNbSinceDown < myLoadCalmLimit) {
+                // the previous step down has been too optimistic - stay longer on heavier levels
+                myLoadCalmLimit = stMin(myLoadCalmLimit * 2, NB_CALM_FRAMES * 8);
+            }
+        }
+    } else if(isCalm) {
+        myLoadNbLate = 0;
+        if(++myLoadNbCalm >= myLoadCalmLimit
+        && aLevel > DecodeLoad_Full) {
+            aLevel = DecodeLoad(aLevel - 1);
+            myLoadNbSinceDown = 0;
+        }
+    } else {
+        myLoadNbLate = 0;
+        myLoadNbCalm = 0;
+    }
+    if(aLevel == aLevelOld) {
+        return;
+    }
+
+    StLogger::GetDefault().write((StStringBuilder() + "StVideoQueue, decoding load level " + int(aLevelOld) + " -> " + int(aLevel)
+                               + " (" + decodeLoadString(aLevel) + ")"
+                               + ", decoding " + theDecodeMSec + " ms of " + (theBudgetSec * 1000.0) + " ms budget"
+                               + ", load " + aRatio + ", lag " + theLagSec + " s").toString(), StLogger::ST_INFO);
+    myLoadNbLate = 0;
+    myLoadNbCalm = 0;
+
+    // codec contexts are modified only by their decoding threads (see decodeFrame())
+    StAtomicOp::CompareAndSwap(myLoadLevel, int32_t(aLevelOld), int32_t(aLevel));
+}
+
 bool StVideoQueue::decodeFrame(const StHandle<StAVPacket>& thePacket,
                                bool& theToSendPacket,
                                bool& theIsStarted,
@@ -869,18 +1084,33 @@ bool StVideoQueue::decodeFrame(const StHandle<StAVPacket>& thePacket,
     bool toTryMoreFrames = false;
     (void )theToSendPacket;
     const bool toTryGpu = myUseGpu && !myIsGpuFailed;
-    if(theToSendPacket) {
-        theToSendPacket = false;
-        const int aRes = avcodec_send_packet(myCodecCtx, thePacket->getType() == StAVPacket::DATA_PACKET ? thePacket->getAVpkt() : NULL);
-        if(aRes == AVERROR(EAGAIN)) {
-            // special case used by some hardware decoders - new packet cannot be sent until decoded frame is retrieved
-            theToSendPacket = true;
-        } else if(aRes < 0 && aRes != AVERROR_EOF) {
-            return false;
+    int aRes2 = 0;
+    StTimer aBusyTimer(true);
+    {
+        ST_PROFILER_ZONE("StVideoQueue::decodeFrame");
+        if(theToSendPacket) {
+            // apply decoding load level published by Master
+            const DecodeLoad aLoad = myMaster.isNull() ? getDecodeLoad() : myMaster->getDecodeLoad();
+            if(aLoad != myLoadApplied) {
+                applyDecodeLoad(myCodecCtx, aLoad);
+                myLoadApplied = aLoad;
+            }
+
+            theToSendPacket = false;
+            const int aRes = avcodec_send_packet(myCodecCtx, thePacket->getType() == StAVPacket::DATA_PACKET ? thePacket->getAVpkt() : NULL);
+            if(aRes == AVERROR(EAGAIN)) {
+                // special case used by some hardware decoders - new packet cannot be sent until decoded frame is retrieved
+                theToSendPacket = true;
+            } else if(aRes < 0 && aRes != AVERROR_EOF) {
+                return false;
+            }
         }
-    }
 
-    const int aRes2 = avcodec_receive_frame(myCodecCtx, myFrame.Frame);
+        aRes2 = avcodec_receive_frame(myCodecCtx, myFrame.Frame);
+    }
+    const double aBusyMSec = aBusyTimer.getElapsedTimeInMilliSec();
+    StThreadBudget::GetDefault().addBusyTime(myBudgetId, aBusyMSec);
+    myLoadBusyMSec += aBusyMSec;
     const bool isGpuUsed = myUseGpu && !myIsGpuFailed;
     if(isGpuUsed != toTryGpu) {
         if(!initCodec(myCodecAuto, isGpuUsed)) {
@@ -922,35 +1152,35 @@ bool StVideoQueue::decodeFrame(const StHandle<StAVPacket>& thePacket,
     }
     thePrevPts = myFramePts;
 
-    // do we need to skip frames or not
-    static const double OVERR_LIMIT = 0.2;
+    // measure decoding time against frame duration and adjust decoding load level (ignoring seeking to exact target)
     static const double GREATER_LIMIT = 100.0;
-    if(myMaster.isNull()) {
+    const double aBudgetSec = (aDelay > 0.0 && aDelay < GREATER_LIMIT) ? aDelay : theAverageDelaySec;
+    if(aBudgetSec > 0.0) {
+        myLoadRatio = 0.8 * myLoadRatio + 0.2 * (myLoadBusyMSec * 0.001 / aBudgetSec);
+    }
+    if(myMaster.isNull()
+    && mySkipTarget < 0.0) {
         const double anAudioClock = getAClock() + double(myAudioDelayMSec) * 0.001;
-        double diff = anAudioClock - myFramePts;
-        if(diff > OVERR_LIMIT && diff < GREATER_LIMIT) {
-            if(myAvDiscard != AVDISCARD_NONREF) {
-                ST_DEBUG_LOG("skip frames: AVDISCARD_NONREF (on)"
-                    + " (aClock " + anAudioClock
-                    + " vClock " + myFramePts
-                    + " diff " + diff + ")"
-                );
-                myAvDiscard = AVDISCARD_NONREF;
-                ///myCodecCtx->skip_frame = AVDISCARD_NONKEY;
-                myCodecCtx->skip_frame = myAvDiscard;
-                if(!mySlave.isNull()) {
-                    mySlave->myCodecCtx->skip_frame = myAvDiscard;
-                }
+        updateDecodeLoad(myLoadBusyMSec, aBudgetSec, anAudioClock - myFramePts);
+    }
+    myLoadBusyMSec = 0.0;
+
+    // decode forward to exact seeking target without displaying intermediate frames;
+    // the first frame after flush is still displayed as preview (the nearest key frame)
+    if(mySkipTarget >= 0.0) {
+        if(myFramePts + 0.5 * theAverageDelaySec < mySkipTarget) {
+            if(!myWasFlushed
+            && myMaster.isNull()
+            && mySlave.isNull()
+            && myStFormatByUser   != StFormat_FrameSequence
+            && myStFormatInStream != StFormat_FrameSequence) {
+                myFrame.reset();
+                return toTryMoreFrames;
             }
         } else {
-            if(myAvDiscard != AVDISCARD_DEFAULT) {
-                ST_DEBUG_LOG("skip frames: AVDISCARD_DEFAULT (off)");
-                myAvDiscard = AVDISCARD_DEFAULT;
-                myCodecCtx->skip_frame = myAvDiscard;
-                if(!mySlave.isNull()) {
-                    mySlave->myCodecCtx->skip_frame = myAvDiscard;
-                }
-            }
+            // force displaying the target frame regardless playback timer
+            myWasFlushed = true;
+            mySkipTarget = -1.0;
         }
     }
 
@@ -1045,43 +1275,45 @@ bool StVideoQueue::decodeFrame(const StHandle<StAVPacket>& thePacket,
             theIsStarted = false;
         }
 
-        StImage* aSlaveData = NULL;
-        double aSlavePts = 0.0;
+        // pick Slave frame matching this one; Slave decodes ahead into pairing buffer
+        StHandle<StImage> aSlaveData;
+        StTimer anIdleTimer(false);
         for(;;) {
-            // wait data from Slave
-            if(aSlaveData == NULL) {
-                aSlaveData = mySlave->waitData(aSlavePts);
-            }
-            if(aSlaveData != NULL) {
-                const double aPtsDiff = myFramePts - aSlavePts;
-                if(aPtsDiff > 0.5 * theAverageDelaySec) {
-                    // wait for more recent frame from slave thread
-                    mySlave->unlockData();
-                    aSlaveData = NULL;
-                    StThread::sleep(10);
-                    continue;
-                } else if(aPtsDiff < -0.5 * theAverageDelaySec) {
-                    // too far...
-                    if(aPtsDiff < -6.0) {
-                        // result of seeking?
-                        mySlave->unlockData();
-                        aSlaveData = NULL;
-                    }
+            const StVideoPairBuffer::PairResult aResult = myPairs->pairMaster(myFramePts, 0.5 * theAverageDelaySec, aSlaveData, 10);
+            if(aResult == StVideoPairBuffer::PairResult_Wait) {
+                if(myToQuit || myToFlush) {
                     break;
                 }
 
-                pushFrame(myDataAdp, *aSlaveData, thePacket->getSource(), StFormat_SeparateFrames, aCubemapFormat, myFramePts);
+                // do not wait forever for Slave without data to decode
+                if(!mySlave->isInDowntime()) {
+                    anIdleTimer.stop();
+                } else if(!anIdleTimer.isOn()) {
+                    anIdleTimer.restart();
+                } else if(anIdleTimer.getElapsedTimeInSec() > 1.0) {
+                    pushFrame(myDataAdp, myEmptyImage, thePacket->getSource(), aSrcFormat, aCubemapFormat, myFramePts);
+                    break;
+                }
+                continue;
+            } else if(aResult == StVideoPairBuffer::PairResult_DropMaster) {
+                // Slave is ahead - skip this frame to catch up
+                break;
+            }
 
-                aSlaveData = NULL;
-                mySlave->unlockData();
+            if(!aSlaveData.isNull()) {
+                pushFrame(myDataAdp, *aSlaveData, thePacket->getSource(), StFormat_SeparateFrames, aCubemapFormat, myFramePts);
             } else {
                 pushFrame(myDataAdp, myEmptyImage, thePacket->getSource(), aSrcFormat, aCubemapFormat, myFramePts);
             }
             break;
         }
     } else if(!myMaster.isNull()) {
-        // push data to Master
-        myHasDataState.set();
+        // pass frame to Master, waiting only while pairing buffer is full
+        while(!myPairs->pushSlave(myDataAdp, myFramePts, 10)) {
+            if(myToQuit || myToFlush) {
+                break;
+            }
+        }
     } else {
         if(theIsStarted) {
             StHandle<StStereoParams> aParams = thePacket->getSource();
@@ -1097,6 +1329,11 @@ bool StVideoQueue::decodeFrame(const StHandle<StAVPacket>& thePacket,
             const bool isRightView = !isOddNumber(myFramesCounter);
             if(!isRightView) {
                 myCachedFrame.fill(myDataAdp, false);
+                if(myCachedFrameBudget.isNull()
+                || myCachedFrameBudget->getSizeBytes() != myCachedFrame.getSizeBytes()) {
+                    myCachedFrameBudget.nullify();
+                    myCachedFrameBudget = new StMemoryBudget::Allocation(StMemoryBudget::Subsystem_Frames, myCachedFrame.getSizeBytes());
+                }
             } else {
                 pushFrame(myCachedFrame, myDataAdp, thePacket->getSource(), StFormat_FrameSequence, aCubemapFormat, myFramePts);
             }
@@ -1,5 +1,5 @@
 /**
- * Copyright © 2009-2025 Kirill Gavrilov <kirill@sview.ru>
+ * Copyright © 2009-2026 Kirill Gavrilov <kirill@sview.ru>
  *
  * StMoviePlayer program is free software: you can redistribute it and/or modify
  * it under the terms of the GNU General Public License as published by
@@ -22,7 +22,9 @@
 #include <StGLStereo/StGLTextureQueue.h>
 
 #include "StAVPacketQueue.h"
+#include "StVideoPairBuffer.h"
 #include <StAV/StAVImage.h>
+#include <StImage/StMemoryBudget.h>
 
 // forward declarations
 class StVideoQueue;
@@ -87,6 +89,26 @@ class StVideoQueue : public StAVPacketQueue {
 
         public:
 
+    /**
+     * Decoding load level - the steps of the ladder applied to the decoder when it cannot keep up with playback.
+     * Each level includes all previous ones.
+     */
+    enum DecodeLoad {
+        DecodeLoad_Full = 0,              //!< full quality decoding
+        DecodeLoad_SkipLoopFilterNonRef,  //!< skip loop (deblocking) filter on non-reference frames
+        DecodeLoad_SkipLoopFilterAll,     //!< skip loop filter on all frames
+        DecodeLoad_Fast,                  //!< allow non spec-compliant speedups (AV_CODEC_FLAG2_FAST)
+        DecodeLoad_SkipNonRef,            //!< drop non-reference frames
+        DecodeLoad_SkipNonKey,            //!< decode only key frames
+    };
+
+    /**
+     * Return short description of decoding load level.
+     */
+    ST_LOCAL static const char* decodeLoadString(const DecodeLoad theLevel);
+
+        public:
+
     AVCodecID CodecIdH264;
     AVCodecID CodecIdHEVC;
     AVCodecID CodecIdMPEG2;
@@ -134,17 +156,18 @@ class StVideoQueue : public StAVPacketQueue {
         mySlave = theSlave;
     }
 
-    ST_LOCAL StImage* waitData(double& thePts) {
-        myHasDataState.wait();
-        if(myDataAdp.isNull()) {
-            return NULL;
-        }
-        thePts = myFramePts;
-        return &myDataAdp;
+    /**
+     * @return statistics of Master/Slave frames pairing, empty string for single stream
+     */
+    ST_LOCAL StString getPairingInfo() const {
+        return !mySlave.isNull() ? myPairs->formatStats() : StString();
     }
 
-    ST_LOCAL void unlockData() {
-        myHasDataState.reset();
+    /**
+     * @return current level of decoding load governor
+     */
+    ST_LOCAL DecodeLoad getDecodeLoad() const {
+        return DecodeLoad(myLoadLevel);
     }
 
     ST_LOCAL void setAClock(const double thePts) {
@@ -164,6 +187,18 @@ class StVideoQueue : public StAVPacketQueue {
         myAudioDelayMSec = theDelayMSec;
     }
 
+    /**
+     * Setup exact seeking target for the next FLUSH packet.
+     * Frames decoded after flush preceding the target (except the first one displayed as preview)
+     * will be skipped without conversion and uploading.
+     * @param theSeekPts seeking target in seconds
+     */
+    ST_LOCAL void setSkipTarget(const double theSeekPts) {
+        myEventMutex.lock();
+        mySkipTargetNext = theSeekPts;
+        myEventMutex.unlock();
+    }
+
     ST_LOCAL StCString getPixelFormatString() const {
         return stAV::PIX_FMT::getString(myCodecCtx->pix_fmt);
     }
@@ -349,6 +384,25 @@ private:
             && (getCodedSizeY() == 1080 || getCodedSizeY() == 1088);
     }
 
+    /**
+     * Apply decoding load level to the codec context.
+     */
+    ST_LOCAL static void applyDecodeLoad(AVCodecContext*  theCodecCtx,
+                                         const DecodeLoad theLevel);
+
+    /**
+     * Update decoding load governor (Master only) and publish a new level for master and slave decoders,
+     * each decoding thread applies it to own codec context before sending the next packet.
+     * The level is changed by one step per decision with hysteresis:
+     * increased after sustained overload, decreased after a longer period of comfortable decoding.
+     * @param theDecodeMSec decoding time of the last frame
+     * @param theBudgetSec  time budget for the last frame
+     * @param theLagSec     lag of video behind audio clock
+     */
+    ST_LOCAL void updateDecodeLoad(const double theDecodeMSec,
+                                   const double theBudgetSec,
+                                   const double theLagSec);
+
     ST_LOCAL bool decodeFrame(const StHandle<StAVPacket>& thePacket,
                               bool& theToSendPacket,
                               bool& theIsStarted,
@@ -374,9 +428,9 @@ private:
     StCondition                myDowntimeState;   //!< event to indicate downtime state
     StHandle<StGLTextureQueue> myTextureQueue;    //!< decoded frames queue
 
-    StCondition                myHasDataState;
     StHandle<StVideoQueue>     myMaster;          //!< handle to Master decoding thread
     StHandle<StVideoQueue>     mySlave;           //!< handle to Slave  decoding thread
+    StHandle<StVideoPairBuffer> myPairs;          //!< buffer pairing Master and Slave frames (shared by both threads)
 
     StHandle<StHWAccelContext> myHWAccelCtx;
 #if defined(__ANDROID__)
@@ -388,9 +442,11 @@ private:
     bool                       myUseGpu;          //!< activate decoding on GPU when possible
     bool                       myIsGpuFailed;     //!< flag indicating that GPU decoder can not handle input data
     bool                       myUseOpenJpeg;     //!< use OpenJPEG (libopenjpeg) instead of built-in jpeg2000 decoder
+    int                        myBudgetThreads;   //!< number of threads allocated by StThreadBudget on codec opening, 0 for single-threaded decoding
 
     StAVFrame                  myFrameRGB;        //!< frame, converted to RGB (soft)
     StImagePlane               myDataRGB;         //!< RGB buffer data (for swscale)
+    StHandle<StMemoryBudget::Allocation> myDataRGBBudget; //!< myDataRGB registered within memory budget
     SwsContext*                myToRgbCtx;        //!< software scaler context
     AVPixelFormat              myToRgbPixFmt;     //!< current swscale context - from pixel format
     bool                       myToRgbIsBroken;   //!< indicates broke swscale context - to RGB conversion is impossible
@@ -398,7 +454,14 @@ private:
     StAVFrame                  myFrame;           //!< original decoded video frame
     StHandle<StAVFrameCounter> myFrameBufRef;
     StImage                    myDataAdp;         //!< buffer data adaptor
-    AVDiscard                  myAvDiscard;       //!< discard parameter (to skip or not frames)
+    volatile int32_t           myLoadLevel;       //!< current level of decoding load governor (defined by Master), DecodeLoad
+    DecodeLoad                 myLoadApplied;     //!< level applied to own codec context (accessed by decoding thread)
+    volatile double            myLoadRatio;       //!< smoothed ratio of decoding time to frame budget
+    double                     myLoadBusyMSec;    //!< decoding time accumulated since the last decoded frame
+    int                        myLoadNbLate;      //!< number of consecutive overloaded frames
+    int                        myLoadNbCalm;      //!< number of consecutive comfortably decoded frames
+    int                        myLoadCalmLimit;   //!< number of comfortable frames required to step down
+    int                        myLoadNbSinceDown; //!< number of frames since the last step down
 
     double                     myFramePts;
     GLfloat                    myPixelRatio;      //!< pixel aspect ratio
@@ -415,9 +478,12 @@ private:
     volatile int               myAudioDelayMSec;
 
     int64_t                    myFramesCounter;
-    StImage                    myCachedFrame;
+    StImage                    myCachedFrame;     //!< copy of the left view within frame sequence
+    StHandle<StMemoryBudget::Allocation> myCachedFrameBudget; //!< myCachedFrame registered within memory budget
     StImage                    myEmptyImage;
     bool                       myWasFlushed;
+    double                     mySkipTargetNext;  //!< seeking target for the next FLUSH packet, negative if undefined
+    double                     mySkipTarget;      //!< frames before this PTS are decoded but not displayed, negative if undefined
 
     volatile StFormat          myStFormatByUser;  //!< source format specified by user
     volatile StFormat          myStFormatByName;  //!< source format detected from file name
@@ -0,0 +1,301 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StMoviePlayer program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StMoviePlayer program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StVideoThumbnails.h"
+#include "StKeyframeIndex.h"
+
+#include <StAV/StAVFrame.h>
+#include <StAV/StAVPacket.h>
+#include <StFile/StFileNode.h>
+#include <StFile/StFolder.h>
+#include <StFile/StRawFile.h>
+
+#include <cstring>
+
+namespace {
+
+    /**
+     * Thread function just call buildLoop() function.
+     */
+    static SV_THREAD_FUNCTION threadFunction(void* theThumbs) {
+        StVideoThumbnails* aThumbs = (StVideoThumbnails* )theThumbs;
+        aThumbs->buildLoop();
+        return SV_THREAD_RETURN 0;
+    }
+
+    /**
+     * Header of atlas file.
+     */
+    struct StVideoThumbnailsHeader {
+        char    Magic[8];    //!< file format identifier
+        int64_t FileSize;    //!< size of source video file
+        int32_t StreamId;    //!< source stream
+        int32_t NbThumbs;    //!< number of thumbnails
+        int32_t ThumbSizeX;  //!< thumbnail width
+        int32_t ThumbSizeY;  //!< thumbnail height
+    };
+
+    static const char THE_ATLAS_MAGIC[8] = { 's', 'V', 'T', 'H', 'U', 'M', 'B', '1' };
+
+    /**
+     * Maximum number of packets read after seeking to find the key frame.
+     */
+    static const int THE_PACKETS_MAX = 256;
+
+}
+
+StVideoThumbnails::StVideoThumbnails(const StString&          theFilePath,
+                                     const int                theStreamId,
+                                     const StString&          theCacheFolder,
+                                     const StSignal<void ()>& theOnReady)
+: myFilePath(theFilePath),
+  myStreamId(theStreamId),
+  myOnReady(&theOnReady),
+  myThumbSizeY(0),
+  myToAbort(false) {
+    const StString aCacheName = StKeyframeIndex::getCacheName(theFilePath, theStreamId);
+    if(!theCacheFolder.isEmpty()
+    && !aCacheName.isEmpty()) {
+        const StString aFolder = theCacheFolder + "thumbnails/";
+        StFolder::createFolder(aFolder);
+        myCachePath = aFolder + aCacheName + ".thumbs";
+    }
+    myThread = new StThread(threadFunction, (void* )this, "StVideoThumbnails");
+}
+
+StVideoThumbnails::~StVideoThumbnails() {
+    myToAbort = true;
+    myThread->wait();
+    myThread.nullify();
+}
+
+bool StVideoThumbnails::load(const int64_t theFileSize) {
+    if(myCachePath.isEmpty()
+    || !StFileNode::isFileExists(myCachePath)) {
+        return false;
+    }
+
+    StRawFile aFile(myCachePath);
+    if(!aFile.readFile()
+    || aFile.getSize() < sizeof(StVideoThumbnailsHeader)) {
+        return false;
+    }
+
+    StVideoThumbnailsHeader aHeader;
+    stMemCpy(&aHeader, aFile.getBuffer(), sizeof(aHeader));
+    if(std::memcmp(aHeader.Magic, THE_ATLAS_MAGIC, sizeof(THE_ATLAS_MAGIC)) != 0
+    || aHeader.FileSize   != theFileSize
+    || aHeader.StreamId   != myStreamId
+    || aHeader.NbThumbs   != THUMBS_NB
+    || aHeader.ThumbSizeX != THUMB_SIZE_X
+    || aHeader.ThumbSizeY <= 0
+    || aHeader.ThumbSizeY >  THUMB_SIZE_X * 2) {
+        return false;
+    }
+
+    const size_t aSizeX = size_t(THUMB_SIZE_X) * COLUMNS_NB;
+    const size_t aSizeY = size_t(aHeader.ThumbSizeY) * ((THUMBS_NB + COLUMNS_NB - 1) / COLUMNS_NB);
+    StHandle<StImagePlane> anAtlas = new StImagePlane();
+    if(!anAtlas->initTrash(StImagePlane::ImgRGB, aSizeX, aSizeY)
+    || aFile.getSize() != sizeof(aHeader) + anAtlas->getSizeRowBytes() * aSizeY) {
+        return false;
+    }
+
+    stMemCpy(anAtlas->changeData(), aFile.getBuffer() + sizeof(aHeader), anAtlas->getSizeRowBytes() * aSizeY);
+    myThumbSizeY = aHeader.ThumbSizeY;
+    {
+        StMutexAuto aLock(&myMutex);
+        myAtlas = anAtlas;
+    }
+    (*myOnReady)();
+    return true;
+}
+
+bool StVideoThumbnails::save(const int64_t       theFileSize,
+                             const StImagePlane& theAtlas) const {
+    if(myCachePath.isEmpty()) {
+        return false;
+    }
+
+    StVideoThumbnailsHeader aHeader;
+    stMemCpy(aHeader.Magic, THE_ATLAS_MAGIC, sizeof(THE_ATLAS_MAGIC));
+    aHeader.FileSize   = theFileSize;
+    aHeader.StreamId   = myStreamId;
+    aHeader.NbThumbs   = THUMBS_NB;
+    aHeader.ThumbSizeX = THUMB_SIZE_X;
+    aHeader.ThumbSizeY = myThumbSizeY;
+
+    const size_t aDataSize = theAtlas.getSizeRowBytes() * theAtlas.getSizeY();
+    StRawFile aFile(myCachePath);
+    aFile.initBuffer(sizeof(aHeader) + aDataSize);
+    stMemCpy(aFile.changeBuffer(), &aHeader, sizeof(aHeader));
+    stMemCpy(aFile.changeBuffer() + sizeof(aHeader), theAtlas.getData(), aDataSize);
+    return aFile.saveFile(myCachePath);
+}
+
+void StVideoThumbnails::buildLoop() {
+    AVFormatContext* aFormatCtx = NULL;
+    if(avformat_open_input(&aFormatCtx, myFilePath.toCString(), NULL, NULL) != 0) {
+        if(aFormatCtx != NULL) {
+            avformat_close_input(&aFormatCtx);
+        }
+        return;
+    }
+
+    const int64_t aFileSize = aFormatCtx->pb != NULL ? avio_size(aFormatCtx->pb) : -1;
+    if(load(aFileSize)) {
+        avformat_close_input(&aFormatCtx);
+        return;
+    }
+
+    if(myStreamId < 0
+    || myStreamId >= int(aFormatCtx->nb_streams)
+    || avformat_find_stream_info(aFormatCtx, NULL) < 0) {
+        avformat_close_input(&aFormatCtx);
+        return;
+    }
+
+    AVStream* aStream = aFormatCtx->streams[myStreamId];
+    double aDuration = stAV::unitsToSeconds(aStream, aStream->duration);
+    if(aDuration <= 0.0) {
+        aDuration = stAV::unitsToSeconds(aFormatCtx->duration);
+    }
+    double aStartTime = stAV::unitsToSeconds(aStream, aStream->start_time);
+    if(aStartTime < 0.0) {
+        aStartTime = 0.0;
+    }
+
+    const AVCodec*  aCodec    = avcodec_find_decoder(aStream->codecpar->codec_id);
+    AVCodecContext* aCodecCtx = aCodec != NULL ? avcodec_alloc_context3(aCodec) : NULL;
+    if(aDuration <= 0.0
+    || aCodecCtx == NULL
+    || avcodec_parameters_to_context(aCodecCtx, aStream->codecpar) < 0) {
+        if(aCodecCtx != NULL) {
+            avcodec_free_context(&aCodecCtx);
+        }
+        avformat_close_input(&aFormatCtx);
+        return;
+    }
+
+    // single thread decoding of key frames only to keep playback unaffected
+    aCodecCtx->thread_count = 1;
+    aCodecCtx->skip_frame   = AVDISCARD_NONKEY;
+    aCodecCtx->pkt_timebase = aStream->time_base;
+    if(avcodec_open2(aCodecCtx, aCodec, NULL) < 0) {
+        avcodec_free_context(&aCodecCtx);
+        avformat_close_input(&aFormatCtx);
+        return;
+    }
+
+    // demuxers skip reading data of discarded streams
+    for(unsigned int aStreamId = 0; aStreamId < aFormatCtx->nb_streams; ++aStreamId) {
+        if(int(aStreamId) != myStreamId) {
+            aFormatCtx->streams[aStreamId]->discard = AVDISCARD_ALL;
+        }
+    }
+
+    // thumbnail height follows video aspect ratio
+    double aRatio = aCodecCtx->height > 0 ? double(aCodecCtx->width) / double(aCodecCtx->height) : 0.0;
+    if(aCodecCtx->sample_aspect_ratio.num > 0
+    && aCodecCtx->sample_aspect_ratio.den > 0) {
+        aRatio *= double(aCodecCtx->sample_aspect_ratio.num) / double(aCodecCtx->sample_aspect_ratio.den);
+    }
+    const int aThumbSizeY = aRatio > 0.0
+                          ? stClamp((int(double(THUMB_SIZE_X) / aRatio) / 2) * 2, 16, THUMB_SIZE_X * 2)
+                          : THUMB_SIZE_X * 9 / 16;
+
+    StHandle<StImagePlane> anAtlas = new StImagePlane();
+    if(!anAtlas->initZero(StImagePlane::ImgRGB, size_t(THUMB_SIZE_X) * COLUMNS_NB,
+                         size_t(aThumbSizeY) * ((THUMBS_NB + COLUMNS_NB - 1) / COLUMNS_NB))) {
+        avcodec_free_context(&aCodecCtx);
+        avformat_close_input(&aFormatCtx);
+        return;
+    }
+
+    SwsContext* aScaleCtx = NULL;
+    StAVFrame   aFrame;
+    StAVPacket  aPacket;
+    int aNbDone = 0;
+    for(int aThumbIter = 0; aThumbIter < THUMBS_NB && !myToAbort; ++aThumbIter) {
+        const double aTime = aStartTime + aDuration * (double(aThumbIter) + 0.5) / double(THUMBS_NB);
+        if(av_seek_frame(aFormatCtx, myStreamId, stAV::secondsToUnits(aStream, aTime), AVSEEK_FLAG_BACKWARD) < 0) {
+            continue;
+        }
+        avcodec_flush_buffers(aCodecCtx);
+
+        bool isDecoded = false;
+        for(int aPktIter = 0; aPktIter < THE_PACKETS_MAX && !isDecoded && !myToAbort; ++aPktIter) {
+            if(av_read_frame(aFormatCtx, aPacket.getAVpkt()) < 0) {
+                // drain frames buffered by decoder at the end of stream
+                avcodec_send_packet(aCodecCtx, NULL);
+                isDecoded = avcodec_receive_frame(aCodecCtx, aFrame.Frame) == 0;
+                break;
+            }
+            if(aPacket.getStreamId() == myStreamId
+            && avcodec_send_packet(aCodecCtx, aPacket.getAVpkt()) >= 0) {
+                isDecoded = avcodec_receive_frame(aCodecCtx, aFrame.Frame) == 0;
+            }
+            aPacket.free();
+        }
+        aPacket.free();
+        if(!isDecoded) {
+            continue;
+        }
+
+        int aFrameSizeX = 0, aFrameSizeY = 0;
+        AVPixelFormat aPixFmt = stAV::PIX_FMT::NONE;
+        aFrame.getImageInfo(aCodecCtx, aFrameSizeX, aFrameSizeY, aPixFmt);
+        aScaleCtx = sws_getCachedContext(aScaleCtx,
+                                         aFrameSizeX,  aFrameSizeY, aPixFmt,
+                                         THUMB_SIZE_X, aThumbSizeY, stAV::PIX_FMT::RGB24,
+                                         SWS_BILINEAR, NULL, NULL, NULL);
+        if(aScaleCtx == NULL) {
+            aFrame.reset();
+            break;
+        }
+
+        const size_t aRow = size_t(aThumbIter / COLUMNS_NB) * size_t(aThumbSizeY);
+        const size_t aCol = size_t(aThumbIter % COLUMNS_NB) * size_t(THUMB_SIZE_X);
+        uint8_t* aDstData[4] = { anAtlas->changeData(aRow, aCol), NULL, NULL, NULL };
+        const int aDstLinesize[4] = { int(anAtlas->getSizeRowBytes()), 0, 0, 0 };
+        sws_scale(aScaleCtx,
+                  aFrame.Frame->data, aFrame.Frame->linesize,
+                  0, aFrameSizeY,
+                  aDstData, aDstLinesize);
+        aFrame.reset();
+        ++aNbDone;
+    }
+
+    sws_freeContext(aScaleCtx);
+    avcodec_free_context(&aCodecCtx);
+    avformat_close_input(&aFormatCtx);
+    if(myToAbort
+    || aNbDone == 0) {
+        return;
+    }
+
+    myThumbSizeY = aThumbSizeY;
+    myMutex.lock();
+    myAtlas = anAtlas;
+    myMutex.unlock();
+    (*myOnReady)();
+    if(!save(aFileSize, *anAtlas)) {
+        ST_DEBUG_LOG("StVideoThumbnails, unable to save atlas '" + myCachePath + "'");
+    }
+    ST_DEBUG_LOG("StVideoThumbnails, " + aNbDone + " thumbnails have been generated for '" + myFilePath + "'");
+}
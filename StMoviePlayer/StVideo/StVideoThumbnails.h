@@ -0,0 +1,121 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StMoviePlayer program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StMoviePlayer program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __StVideoThumbnails_h_
+#define __StVideoThumbnails_h_
+
+#include <StImage/StImagePlane.h>
+#include <StStrings/StString.h>
+#include <StSlots/StSignal.h>
+#include <StThreads/StMutex.h>
+#include <StThreads/StThread.h>
+
+/**
+ * Atlas of preview thumbnails evenly spread over video duration.
+ * Thumbnails are generated in background thread by dedicated demuxer and decoder
+ * (only key frames are decoded), so that playback decoders and packet queues are not touched.
+ * The atlas is persisted in cache folder to be reused when the same file is opened next time.
+ *
+ * Thumbnail with index i corresponds to the position (i + 0.5) / getNbThumbs() within video duration;
+ * thumbnails are packed into RGB atlas image in rows of COLUMNS_NB items.
+ */
+class StVideoThumbnails {
+
+        public:
+
+    enum {
+        THUMBS_NB    = 64,  //!< number of thumbnails
+        COLUMNS_NB   = 8,   //!< number of thumbnails within atlas row
+        THUMB_SIZE_X = 128, //!< thumbnail width
+    };
+
+        public:
+
+    /**
+     * Start generating (or loading) thumbnails in background.
+     * @param theFilePath    local file path
+     * @param theStreamId    video stream index
+     * @param theCacheFolder folder to store atlas files
+     * @param theOnReady     signal emitted from generation thread when atlas becomes available (should outlive this object)
+     */
+    ST_LOCAL StVideoThumbnails(const StString&          theFilePath,
+                               const int                theStreamId,
+                               const StString&          theCacheFolder,
+                               const StSignal<void ()>& theOnReady);
+
+    /**
+     * Destructor, aborts thumbnails generation.
+     */
+    ST_LOCAL ~StVideoThumbnails();
+
+    /**
+     * @return atlas image or NULL if thumbnails are not yet ready
+     */
+    ST_LOCAL StHandle<StImagePlane> getAtlas() const {
+        StMutexAuto aLock(&myMutex);
+        return myAtlas;
+    }
+
+    /**
+     * @return number of thumbnails within atlas
+     */
+    ST_LOCAL int getNbThumbs() const { return THUMBS_NB; }
+
+    /**
+     * @return thumbnail width
+     */
+    ST_LOCAL int getThumbSizeX() const { return THUMB_SIZE_X; }
+
+    /**
+     * @return thumbnail height, defined by video aspect ratio; valid only when atlas is ready
+     */
+    ST_LOCAL int getThumbSizeY() const { return myThumbSizeY; }
+
+    /**
+     * Thread function generating the thumbnails.
+     */
+    ST_LOCAL void buildLoop();
+
+        private:
+
+    /**
+     * Read atlas from cache file.
+     */
+    ST_LOCAL bool load(const int64_t theFileSize);
+
+    /**
+     * Write atlas into cache file.
+     */
+    ST_LOCAL bool save(const int64_t       theFileSize,
+                       const StImagePlane& theAtlas) const;
+
+        private:
+
+    StString                 myFilePath;   //!< video file path
+    StString                 myCachePath;  //!< atlas file path
+    int                      myStreamId;   //!< video stream index
+    const StSignal<void ()>* myOnReady;    //!< signal emitted when atlas becomes available
+    StHandle<StImagePlane>   myAtlas;      //!< generated atlas
+    mutable StMutex          myMutex;      //!< lock for myAtlas
+    StHandle<StThread>       myThread;     //!< generation thread
+    volatile int             myThumbSizeY; //!< thumbnail height
+    volatile bool            myToAbort;    //!< abort generation
+
+};
+
+#endif // __StVideoThumbnails_h_
@@ -14,6 +14,7 @@
 #include <StSettings/StTranslations.h>
 #include <StSettings/StEnumParam.h>
 #include <StVersion.h>
+#include <StThreads/StProfiler.h>
 
 namespace {
     // shaders data
@@ -311,6 +312,7 @@ void StOutAnaglyph::processEvents() {
 }
 
 void StOutAnaglyph::stglDraw() {
+    ST_PROFILER_ZONE("StOutAnaglyph::stglDraw");
     if(!StWindow::stglMakeCurrent(ST_WIN_MASTER)) {
         StWindow::signals.onRedraw(ST_DRAW_MONO);
         StThread::sleep(10);
@@ -353,8 +355,8 @@ void StOutAnaglyph::stglDraw() {
     myContext->stglResizeViewport(aVPort);
     myContext->core20fwd->glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-    myContext->core20fwd->glDisable(GL_DEPTH_TEST);
-    myContext->core20fwd->glDisable(GL_BLEND);
+    myContext->stglSetDepthTest(false);
+    myContext->stglSetBlend(false);
     myFrBuffer->bindMultiTexture(*myContext);
     myFrBuffer->drawQuad(*myContext, myStereoProgram);
     myFrBuffer->unbindMultiTexture(*myContext);
@@ -24,6 +24,7 @@
 #include <StCore/StSearchMonitors.h>
 #include <StVersion.h>
 #include <StAV/StAVImage.h>
+#include <StThreads/StProfiler.h>
 
 #ifdef ST_HAVE_OPENVR
     #include <openvr.h>
@@ -685,7 +686,7 @@ void StOutDistorted::stglDrawCursor(const StPointD_t&  theCursorPos,
     myCurVertsBuf.init(*myContext, aVerts);
 
     myContext->core20fwd->glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    myContext->core20fwd->glEnable(GL_BLEND);
+    myContext->stglSetBlend(true);
 
     myCursor->bind(*myContext);
     myProgramFlat->use(*myContext);
@@ -699,7 +700,7 @@ void StOutDistorted::stglDrawCursor(const StPointD_t&  theCursorPos,
     myProgramFlat->unuse(*myContext);
     myCursor->unbind(*myContext);
 
-    myContext->core20fwd->glDisable(GL_BLEND);
+    myContext->stglSetBlend(false);
 }
 
 bool StOutDistorted::hasOrientationSensor() const {
@@ -879,6 +880,7 @@ void StOutDistorted::stglDrawVR() {
         myFrBuffer->unbindBuffer(*myContext);
     }
     glFinish();
+    myContext->resetStateCache(); // compositor might modify OpenGL state
 
     {
         const vr::EVRCompositorError aVRError = vr::VRCompositor()->WaitGetPoses(myVrTrackedPoses, vr::k_unMaxTrackedDeviceCount, NULL, 0 );
@@ -953,6 +955,7 @@ void StOutDistorted::stglDrawVR() {
 }
 
 void StOutDistorted::stglDraw() {
+    ST_PROFILER_ZONE("StOutDistorted::stglDraw");
     myFPSControl.setTargetFPS(StWindow::getTargetFps());
 
     const bool isStereoSource = StWindow::isStereoSource()
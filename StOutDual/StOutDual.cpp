@@ -1,6 +1,6 @@
 /**
  * StOutDual, class providing stereoscopic output for Dual Input hardware using StCore toolkit.
- * Copyright © 2007-2016 Kirill Gavrilov <kirill@sview.ru>
+ * Copyright © 2007-2026 Kirill Gavrilov <kirill@sview.ru>
  *
  * This code is licensed under MIT license (see docs/license-mit.txt for details).
  */
@@ -12,11 +12,13 @@
 #include <StGL/StGLProgram.h>
 #include <StGL/StGLFrameBuffer.h>
 #include <StGLCore/StGLCore20.h>
+#include <StGLCore/StGLCore32.h>
 #include <StSettings/StSettings.h>
 #include <StSettings/StTranslations.h>
 #include <StSettings/StEnumParam.h>
 #include <StCore/StSearchMonitors.h>
 #include <StVersion.h>
+#include <StThreads/StProfiler.h>
 
 namespace {
 
@@ -33,8 +35,9 @@ namespace {
         STTR_MIRROR_DESC = 1003,
 
         // parameters
-        STTR_PARAMETER_SLAVE_ID  = 1102,
-        STTR_PARAMETER_MONOCLONE = 1103,
+        STTR_PARAMETER_SLAVE_ID     = 1102,
+        STTR_PARAMETER_MONOCLONE    = 1103,
+        STTR_PARAMETER_SLAVE_THREAD = 1104,
 
         // about info
         STTR_PLUGIN_TITLE       = 2000,
@@ -42,6 +45,33 @@ namespace {
         STTR_PLUGIN_DESCRIPTION = 2002,
     };
 
+    // vertices to draw simple textured quad
+    static const GLfloat QUAD_VERTICES[4 * 4] = {
+         1.0f, -1.0f, 0.0f, 1.0f, // top-right
+         1.0f,  1.0f, 0.0f, 1.0f, // bottom-right
+        -1.0f, -1.0f, 0.0f, 1.0f, // top-left
+        -1.0f,  1.0f, 0.0f, 1.0f  // bottom-left
+    };
+    static const GLfloat QUAD_VERTICES_XMIR[4 * 4] = {
+        -1.0f, -1.0f, 0.0f, 1.0f, // top-right
+        -1.0f,  1.0f, 0.0f, 1.0f, // bottom-right
+         1.0f, -1.0f, 0.0f, 1.0f, // top-left
+         1.0f,  1.0f, 0.0f, 1.0f  // bottom-left
+    };
+    static const GLfloat QUAD_VERTICES_YMIR[4 * 4] = {
+         1.0f,  1.0f, 0.0f, 1.0f, // top-right
+         1.0f, -1.0f, 0.0f, 1.0f, // bottom-right
+        -1.0f,  1.0f, 0.0f, 1.0f, // top-left
+        -1.0f, -1.0f, 0.0f, 1.0f  // bottom-left
+    };
+
+    static const GLfloat QUAD_TEXCOORD[2 * 4] = {
+        1.0f, 0.0f,
+        1.0f, 1.0f,
+        0.0f, 0.0f,
+        0.0f, 1.0f
+    };
+
 }
 
 /**
@@ -163,6 +193,7 @@ void StOutDual::getDevices(StOutDevicesList& theList) const {
 void StOutDual::getOptions(StParamsList& theList) const {
     theList.add(params.SlaveMonId);
     theList.add(params.MonoClone);
+    theList.add(params.SlaveThread);
 }
 
 void StOutDual::updateStrings() {
@@ -175,6 +206,7 @@ void StOutDual::updateStrings() {
 
     params.SlaveMonId->setName(aLangMap.changeValueId(STTR_PARAMETER_SLAVE_ID,  "Slave Monitor"));
     params.MonoClone ->setName(aLangMap.changeValueId(STTR_PARAMETER_MONOCLONE, "Show Mono in Stereo"));
+    params.SlaveThread->setName(aLangMap.changeValueId(STTR_PARAMETER_SLAVE_THREAD, "Render Slave Window in Dedicated Thread"));
 
     // about string
     StString& aTitle     = aLangMap.changeValueId(STTR_PLUGIN_TITLE,   "sView - Dual Output module");
@@ -190,10 +222,16 @@ StOutDual::StOutDual(const StHandle<StResourceManager>& theResMgr,
 : StWindow(theResMgr, theParentWindow),
   mySettings(new StSettings(theResMgr, ST_OUT_PLUGIN_NAME)),
   myFrBuffer(new StGLFrameBuffer()),
+  myFrBufferR(new StGLFrameBuffer()),
   myProgram(new StProgramMM()),
   myDevice(DEVICE_AUTO),
   myToCompressMem(myInstancesNb.increment() > 1),
-  myIsBroken(false) {
+  myIsBroken(false),
+  myEvSlaveFrame(false),
+  myEvSlaveDone(false),
+  myEvSlaveSwap(false),
+  mySlaveFailed(false) {
+    stMemZero(&mySlaveFrame, sizeof(mySlaveFrame));
     const StSearchMonitors& aMonitors = StWindow::getMonitors();
 
     // detect connected displays
@@ -238,10 +276,12 @@ StOutDual::StOutDual(const StHandle<StResourceManager>& theResMgr,
     }
     params.SlaveMonId->signals.onChanged.connect(this, &StOutDual::doSlaveMon);
 
-    params.MonoClone = new StBoolParamNamed(false, stCString("monoClone"), stCString("monoClone"));
+    params.MonoClone   = new StBoolParamNamed(false, stCString("monoClone"),   stCString("monoClone"));
+    params.SlaveThread = new StBoolParamNamed(false, stCString("slaveThread"), stCString("slaveThread"));
     updateStrings();
 
     mySettings->loadParam(params.MonoClone);
+    mySettings->loadParam(params.SlaveThread);
 
     // load window position
     if(isMovable()) {
@@ -271,6 +311,7 @@ StOutDual::StOutDual(const StHandle<StResourceManager>& theResMgr,
 }
 
 void StOutDual::releaseResources() {
+    stopSlaveThread();
     if(!myContext.isNull()) {
         myProgram->release(*myContext);
         myVertFlatBuf.release(*myContext);
@@ -278,6 +319,7 @@ void StOutDual::releaseResources() {
         myVertYMirBuf.release(*myContext);
         myTexCoordBuf.release(*myContext);
         myFrBuffer->release(*myContext);
+        myFrBufferR->release(*myContext);
     }
     myContext.nullify();
 
@@ -294,6 +336,7 @@ void StOutDual::beforeClose() {
     }
     mySettings->saveParam(params.SlaveMonId);
     mySettings->saveParam(params.MonoClone);
+    mySettings->saveParam(params.SlaveThread);
     mySettings->saveInt32(ST_SETTING_DEVICE_ID, myDevice);
     mySettings->flush();
 }
@@ -335,32 +378,6 @@ bool StOutDual::create() {
         return true;
     }
     // create vertices buffers to draw simple textured quad
-    const GLfloat QUAD_VERTICES[4 * 4] = {
-         1.0f, -1.0f, 0.0f, 1.0f, // top-right
-         1.0f,  1.0f, 0.0f, 1.0f, // bottom-right
-        -1.0f, -1.0f, 0.0f, 1.0f, // top-left
-        -1.0f,  1.0f, 0.0f, 1.0f  // bottom-left
-    };
-    const GLfloat QUAD_VERTICES_XMIR[4 * 4] = {
-        -1.0f, -1.0f, 0.0f, 1.0f, // top-right
-        -1.0f,  1.0f, 0.0f, 1.0f, // bottom-right
-         1.0f, -1.0f, 0.0f, 1.0f, // top-left
-         1.0f,  1.0f, 0.0f, 1.0f  // bottom-left
-    };
-    const GLfloat QUAD_VERTICES_YMIR[4 * 4] = {
-         1.0f,  1.0f, 0.0f, 1.0f, // top-right
-         1.0f, -1.0f, 0.0f, 1.0f, // bottom-right
-        -1.0f,  1.0f, 0.0f, 1.0f, // top-left
-        -1.0f, -1.0f, 0.0f, 1.0f  // bottom-left
-    };
-
-    const GLfloat QUAD_TEXCOORD[2 * 4] = {
-        1.0f, 0.0f,
-        1.0f, 1.0f,
-        0.0f, 0.0f,
-        0.0f, 1.0f
-    };
-
     myVertFlatBuf.init(*myContext, 4, 4, QUAD_VERTICES);
     myVertXMirBuf.init(*myContext, 4, 4, QUAD_VERTICES_XMIR);
     myVertYMirBuf.init(*myContext, 4, 4, QUAD_VERTICES_YMIR);
@@ -385,6 +402,7 @@ void StOutDual::processEvents() {
 }
 
 void StOutDual::stglDraw() {
+    ST_PROFILER_ZONE("StOutDual::stglDraw");
     if(!StWindow::stglMakeCurrent(ST_WIN_MASTER)) {
         StWindow::signals.onRedraw(ST_DRAW_MONO);
         StThread::sleep(10);
@@ -397,6 +415,16 @@ void StOutDual::stglDraw() {
     const StGLBoxPx aVPSlave  = StWindow::stglViewport(ST_WIN_SLAVE);
     const bool toShowStereo = (StWindow::isStereoSource() || params.MonoClone->getValue()) && !myIsBroken;
     myIsForcedStereo = toShowStereo && params.MonoClone->getValue();
+    if(isThreadedSlave()) {
+        if(mySlaveThread.isNull()) {
+            startSlaveThread();
+        }
+        stglDrawThreaded(aVPMaster, aVPSlave, toShowStereo);
+        return;
+    } else if(!mySlaveThread.isNull()) {
+        stopSlaveThread();
+    }
+
     if(!toShowStereo) {
         if(myToCompressMem) {
             myFrBuffer->release(*myContext);
@@ -532,3 +560,213 @@ void StOutDual::doSwitchVSync(const int32_t theValue) {
 void StOutDual::doSlaveMon(const int32_t theValue) {
     StWindow::setAttribute(StWinAttr_SlaveMon, theValue);
 }
+
+void StOutDual::stglDrawThreaded(const StGLBoxPx& theVPMaster,
+                                 const StGLBoxPx& theVPSlave,
+                                 const bool       theToShowStereo) {
+    SlaveFrame aFrame;
+    aFrame.Viewport  = theVPSlave;
+    aFrame.TexSizeX  = 1.0f;
+    aFrame.TexSizeY  = 1.0f;
+    aFrame.Fence     = NULL;
+    aFrame.Device    = myDevice;
+    aFrame.VSyncMode = StWindow::params.VSyncMode->getValue();
+    aFrame.ToClear   = !theToShowStereo;
+    aFrame.ToQuit    = false;
+    if(theToShowStereo) {
+        // draw Right View into virtual frame buffer shared with slave render thread
+        if(!myFrBufferR->initLazy(*myContext,
+                                  myContext->isDeepColorWindow() ? GL_RGB10_A2 : GL_RGBA8,
+                                  theVPSlave.width(), theVPSlave.height(), StWindow::hasDepthBuffer())) {
+            myMsgQueue->pushError(stCString("Dual output - critical error:\nFrame Buffer Object resize failed!"));
+            myIsBroken = true;
+            aFrame.ToClear = true;
+        } else {
+            aFrame.TexSizeX = GLfloat(myFrBufferR->getVPSizeX()) / GLfloat(myFrBufferR->getSizeX());
+            aFrame.TexSizeY = GLfloat(myFrBufferR->getVPSizeY()) / GLfloat(myFrBufferR->getSizeY());
+
+            myFrBufferR->setupViewPort(*myContext); // we set TEXTURE sizes here
+            myFrBufferR->bindBuffer(*myContext);
+                StWindow::signals.onRedraw(ST_DRAW_RIGHT);
+            myFrBufferR->unbindBuffer(*myContext);
+
+            // slave thread should wait for rendering results
+        #if !defined(GL_ES_VERSION_2_0)
+            if(myContext->core32 != NULL) {
+                aFrame.Fence = myContext->core32->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+                myContext->core20fwd->glFlush();
+            } else
+        #endif
+            {
+                myContext->core20fwd->glFinish();
+            }
+        }
+    } else if(myToCompressMem) {
+        myFrBuffer ->release(*myContext);
+        myFrBufferR->release(*myContext);
+    }
+
+    // slave window is drawn in parallel with the left view
+    pushSlaveFrame(aFrame);
+
+    myContext->stglResizeViewport(theVPMaster);
+    myContext->stglSetScissorRect(theVPMaster, false);
+    StWindow::signals.onRedraw(ST_DRAW_LEFT);
+    myContext->stglResetScissorRect();
+
+    myFPSControl.sleepToTarget(); // decrease FPS to target by thread sleeps
+    waitSlaveFrame();
+#if !defined(GL_ES_VERSION_2_0)
+    if(aFrame.Fence != NULL) {
+        myContext->core32->glDeleteSync((GLsync )aFrame.Fence);
+    }
+#endif
+    StWindow::stglSwap(ST_WIN_MASTER);
+    ++myFPSControl;
+}
+
+void StOutDual::startSlaveThread() {
+    myEvSlaveFrame.reset();
+    myEvSlaveDone .reset();
+    myEvSlaveSwap .reset();
+    mySlaveFrame.ToQuit = false;
+    mySlaveThread = new StThread(slaveThreadFunction, (void* )this, "StOutDualSlave");
+}
+
+void StOutDual::stopSlaveThread() {
+    if(mySlaveThread.isNull()) {
+        return;
+    }
+
+    // thread is idle between frames - just wake it up
+    mySlaveFrame.ToQuit = true;
+    myEvSlaveFrame.set();
+    mySlaveThread->wait();
+    mySlaveThread.nullify();
+}
+
+void StOutDual::pushSlaveFrame(const SlaveFrame& theFrame) {
+    mySlaveFrame = theFrame;
+    myEvSlaveFrame.set();
+}
+
+void StOutDual::waitSlaveFrame() {
+    ST_PROFILER_ZONE("StOutDual::waitSlaveFrame");
+    myEvSlaveDone.wait();
+    myEvSlaveDone.reset();
+    myEvSlaveSwap.set();
+}
+
+SV_THREAD_FUNCTION StOutDual::slaveThreadFunction(void* theOutDual) {
+    ((StOutDual* )theOutDual)->slaveThreadLoop();
+    return SV_THREAD_RETURN 0;
+}
+
+void StOutDual::slaveThreadLoop() {
+    StProfilerThread aProfilerThread("StOutDualSlave");
+
+    // GL context sharing resources with master one is bound to slave window in this thread for its lifetime,
+    // StGLContext instance (with its state cache) is not shared with the main thread
+    StHandle<StGLContext> aCtx;
+    if(StWindow::stglMakeCurrentDetached(ST_WIN_SLAVE)) {
+        aCtx = new StGLContext(getResourceManager());
+        if(!aCtx->stglInit()) {
+            aCtx.nullify();
+        }
+    }
+
+    StProgramMM      aProgram;
+    StGLVertexBuffer aVertFlatBuf, aVertXMirBuf, aVertYMirBuf, aTexCoordBuf;
+    if(aCtx.isNull()
+    || !aProgram.init(*aCtx)) {
+        ST_ERROR_LOG("Dual output, slave render thread has failed to initialize OpenGL context");
+        if(!aCtx.isNull()) {
+            aProgram.release(*aCtx);
+        }
+        StWindow::stglReleaseCurrent();
+        mySlaveFailed = true;
+        myEvSlaveDone.set();
+        return;
+    }
+
+    aVertFlatBuf.init(*aCtx, 4, 4, QUAD_VERTICES);
+    aVertXMirBuf.init(*aCtx, 4, 4, QUAD_VERTICES_XMIR);
+    aVertYMirBuf.init(*aCtx, 4, 4, QUAD_VERTICES_YMIR);
+    aTexCoordBuf.init(*aCtx, 2, 4, QUAD_TEXCOORD);
+
+    int32_t aVSyncMode = -1;
+    for(;;) {
+        myEvSlaveFrame.wait();
+        myEvSlaveFrame.reset();
+        const SlaveFrame aFrame = mySlaveFrame;
+        if(aFrame.ToQuit) {
+            break;
+        }
+
+        if(aFrame.VSyncMode != aVSyncMode) {
+            aVSyncMode = aFrame.VSyncMode;
+            aCtx->stglSetVSync((StGLContext::VSync_Mode )aVSyncMode);
+        }
+
+        StGLVertexBuffer& aVertBuf = aFrame.Device == DUALMODE_XMIRROW ? aVertXMirBuf
+                                   : (aFrame.Device == DUALMODE_YMIRROW ? aVertYMirBuf : aVertFlatBuf);
+        stglDrawSlave(*aCtx, aProgram, aVertBuf, aTexCoordBuf, aFrame);
+        aCtx->core20fwd->glFinish();
+
+        // barrier before swap - both windows should be swapped at once
+        myEvSlaveDone.set();
+        myEvSlaveSwap.wait();
+        myEvSlaveSwap.reset();
+        StWindow::stglSwap(ST_WIN_SLAVE);
+    }
+
+    aProgram.release(*aCtx);
+    aVertFlatBuf.release(*aCtx);
+    aVertXMirBuf.release(*aCtx);
+    aVertYMirBuf.release(*aCtx);
+    aTexCoordBuf.release(*aCtx);
+    StWindow::stglReleaseCurrent();
+}
+
+void StOutDual::stglDrawSlave(StGLContext&      theCtx,
+                              StProgramMM&      theProgram,
+                              StGLVertexBuffer& theVertBuf,
+                              StGLVertexBuffer& theTexCoordBuf,
+                              const SlaveFrame& theFrame) {
+    ST_PROFILER_ZONE("StOutDual::stglDrawSlave");
+    theCtx.stglResizeViewport(theFrame.Viewport);
+    theCtx.stglSetScissorRect(theFrame.Viewport, false);
+    theCtx.core20fwd->glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    if(theFrame.ToClear) {
+        theCtx.stglResetScissorRect();
+        return;
+    }
+
+#if !defined(GL_ES_VERSION_2_0)
+    if(theFrame.Fence != NULL
+    && theCtx.core32 != NULL) {
+        theCtx.core32->glWaitSync((GLsync )theFrame.Fence, 0, GL_TIMEOUT_IGNORED);
+    }
+#endif
+
+    // reduce viewport to avoid additional aliasing of narrow lines
+    StArray<StGLVec2> aTCoords(4);
+    aTCoords[0] = StGLVec2(theFrame.TexSizeX, 0.0f);
+    aTCoords[1] = StGLVec2(theFrame.TexSizeX, theFrame.TexSizeY);
+    aTCoords[2] = StGLVec2(0.0f, 0.0f);
+    aTCoords[3] = StGLVec2(0.0f, theFrame.TexSizeY);
+    theTexCoordBuf.init(theCtx, aTCoords);
+
+    myFrBufferR->bindTexture(theCtx);
+    theProgram.use(theCtx);
+        theVertBuf    .bindVertexAttrib(theCtx, theProgram.getVVertexLoc());
+        theTexCoordBuf.bindVertexAttrib(theCtx, theProgram.getVTexCoordLoc());
+
+        theCtx.core20fwd->glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+
+        theTexCoordBuf.unBindVertexAttrib(theCtx, theProgram.getVTexCoordLoc());
+        theVertBuf    .unBindVertexAttrib(theCtx, theProgram.getVVertexLoc());
+    theProgram.unuse(theCtx);
+    myFrBufferR->unbindTexture(theCtx);
+    theCtx.stglResetScissorRect();
+}
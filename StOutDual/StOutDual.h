@@ -10,7 +10,9 @@
 
 #include <StCore/StWindow.h>
 #include <StGL/StGLVertexBuffer.h>
+#include <StThreads/StCondition.h>
 #include <StThreads/StFPSControl.h>
+#include <StThreads/StThread.h>
 
 class StSettings;
 class StProgramMM;
@@ -129,6 +131,79 @@ class StOutDual : public StWindow {
      */
     ST_LOCAL void doSlaveMon(const int32_t theValue);
 
+        private: //! @name dedicated render thread for slave window
+
+    /**
+     * Frame passed from the main thread to the slave render thread.
+     */
+    struct SlaveFrame {
+        StGLBoxPx  Viewport;  //!< slave window viewport
+        GLfloat    TexSizeX;  //!< visible part of the right view texture
+        GLfloat    TexSizeY;  //!< visible part of the right view texture
+        void*      Fence;     //!< GLsync fence after rendering the right view (or NULL if glFinish() has been used)
+        DeviceEnum Device;    //!< mirroring mode
+        int32_t    VSyncMode; //!< VSync mode for slave window
+        bool       ToClear;   //!< just clear the slave window (mono output)
+        bool       ToQuit;    //!< stop the thread
+    };
+
+    /**
+     * @return true if slave window should be rendered by dedicated thread
+     */
+    ST_LOCAL bool isThreadedSlave() const {
+        return params.SlaveThread->getValue()
+            && StWindow::hasSlaveGlContext()
+            && !mySlaveFailed;
+    }
+
+    /**
+     * Stereo renderer with slave window drawn by dedicated thread.
+     * The right view is rendered into FBO by the main thread (from the same frame as the left view),
+     * and slave render thread shows it within its own GL context.
+     */
+    ST_LOCAL void stglDrawThreaded(const StGLBoxPx& theVPMaster,
+                                   const StGLBoxPx& theVPSlave,
+                                   const bool       theToShowStereo);
+
+    /**
+     * Start slave render thread.
+     */
+    ST_LOCAL void startSlaveThread();
+
+    /**
+     * Stop slave render thread and wait for its termination.
+     */
+    ST_LOCAL void stopSlaveThread();
+
+    /**
+     * Pass the frame to the slave render thread.
+     */
+    ST_LOCAL void pushSlaveFrame(const SlaveFrame& theFrame);
+
+    /**
+     * Wait until slave render thread finishes the frame (barrier before swap).
+     */
+    ST_LOCAL void waitSlaveFrame();
+
+    /**
+     * Slave render thread loop.
+     */
+    ST_LOCAL void slaveThreadLoop();
+
+    /**
+     * Draw the frame within slave render thread.
+     */
+    ST_LOCAL void stglDrawSlave(StGLContext&      theCtx,
+                                StProgramMM&      theProgram,
+                                StGLVertexBuffer& theVertBuf,
+                                StGLVertexBuffer& theTexCoordBuf,
+                                const SlaveFrame& theFrame);
+
+    /**
+     * Thread function.
+     */
+    ST_LOCAL static SV_THREAD_FUNCTION slaveThreadFunction(void* theOutDual);
+
         private:
 
     static StAtomic<int32_t> myInstancesNb; //!< shared counter for all instances
@@ -139,6 +214,7 @@ class StOutDual : public StWindow {
 
         StHandle<StEnumParam>       SlaveMonId; //!< slave window position
         StHandle<StBoolParamNamed>  MonoClone;  //!< display mono in stereo
+        StHandle<StBoolParamNamed>  SlaveThread;//!< render slave window within dedicated thread
 
     } params;
 
@@ -150,6 +226,7 @@ class StOutDual : public StWindow {
 
     StHandle<StGLContext>     myContext;
     StHandle<StGLFrameBuffer> myFrBuffer;        //!< OpenGL frame buffer object
+    StHandle<StGLFrameBuffer> myFrBufferR;       //!< frame buffer object for the right view shown by slave render thread
     StHandle<StProgramMM>     myProgram;
     StFPSControl              myFPSControl;
     StGLVertexBuffer          myVertFlatBuf;     //!< buffers to draw simple fullsreen quad
@@ -161,6 +238,13 @@ class StOutDual : public StWindow {
     bool                      myToCompressMem;   //!< reduce memory usage
     bool                      myIsBroken;        //!< special flag for broke state - when FBO can not be allocated
 
+    StHandle<StThread>        mySlaveThread;     //!< dedicated render thread for slave window
+    SlaveFrame                mySlaveFrame;      //!< frame to be drawn by slave render thread
+    StCondition               myEvSlaveFrame;    //!< new frame has been passed to slave render thread
+    StCondition               myEvSlaveDone;     //!< slave render thread has drawn the frame and waits for swap
+    StCondition               myEvSlaveSwap;     //!< both windows are ready for swap
+    volatile bool             mySlaveFailed;     //!< slave render thread has failed to initialize
+
 };
 
 #endif //__StOutDual_h_
@@ -18,6 +18,7 @@
 #include <StSettings/StEnumParam.h>
 #include <StCore/StSearchMonitors.h>
 #include <StVersion.h>
+#include <StThreads/StProfiler.h>
 
 namespace {
 
@@ -298,6 +299,7 @@ void StOutIZ3D::processEvents() {
 }
 
 void StOutIZ3D::stglDraw() {
+    ST_PROFILER_ZONE("StOutIZ3D::stglDraw");
     if(!StWindow::stglMakeCurrent(ST_WIN_MASTER)) {
         StWindow::signals.onRedraw(ST_DRAW_MONO);
         StThread::sleep(10);
@@ -354,8 +356,8 @@ void StOutIZ3D::stglDraw() {
     myContext->stglSetScissorRect(aVPMaster, false);
     myContext->core20fwd->glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-    myContext->core20fwd->glDisable(GL_DEPTH_TEST);
-    myContext->core20fwd->glDisable(GL_BLEND);
+    myContext->stglSetDepthTest(false);
+    myContext->stglSetBlend(false);
 
     StGLTexture& stTexTable = (myShaders.getMode() == StOutIZ3DShaders::IZ3D_TABLE_NEW) ? myTexTableNew : myTexTableOld;
 
@@ -17,6 +17,7 @@
 #include <StCore/StSearchMonitors.h>
 #include <StImage/StImagePlane.h>
 #include <StVersion.h>
+#include <StThreads/StProfiler.h>
 
 #if defined(__ANDROID__)
 #include <fstream>
@@ -920,7 +921,7 @@ void StOutInterlace::stglDrawEDCodes() {
         myContext->core20fwd->glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     }
     myContext->core20fwd->glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    myContext->core20fwd->glEnable(GL_BLEND);
+    myContext->stglSetBlend(true);
     if(myIsEDactive) {
         myEDIntelaceOn->use(*myContext);
         if(myVpSizeYOnLoc != -1) {
@@ -945,13 +946,14 @@ void StOutInterlace::stglDrawEDCodes() {
     myContext->core11->glEnd();
 #endif
     myEDIntelaceOn->unuse(*myContext); // this is global unuse
-    myContext->core20fwd->glDisable(GL_BLEND);
+    myContext->stglSetBlend(false);
     if(!StWindow::isFullScreen()) {
         StWindow::stglSwap(ST_WIN_SLAVE);
     }
 }
 
 void StOutInterlace::stglDraw() {
+    ST_PROFILER_ZONE("StOutInterlace::stglDraw");
     if(!StWindow::stglMakeCurrent(ST_WIN_MASTER)) {
         StWindow::signals.onRedraw(ST_DRAW_MONO);
         StThread::sleep(10);
@@ -1108,8 +1110,8 @@ void StOutInterlace::stglDraw() {
             StWindow::signals.onRedraw(anEye);
         myFrmBuffer->unbindBuffer(*myContext);
 
-        myContext->core20fwd->glDisable(GL_DEPTH_TEST);
-        myContext->core20fwd->glDisable(GL_BLEND);
+        myContext->stglSetDepthTest(false);
+        myContext->stglSetBlend(false);
 
         myContext->stglResizeViewport(aVPort);
         myFrmBuffer->bindTexture(*myContext);
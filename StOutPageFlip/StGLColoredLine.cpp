@@ -139,13 +139,13 @@ void StGLColoredLine::stglDraw(StGLContext& theCtx,
     theCtx.core20fwd->glScissor(0, 0, aLineLen, 1);
 
     theCtx.core20fwd->glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    theCtx.core20fwd->glEnable(GL_BLEND);
+    theCtx.stglSetBlend(true);
     myProgram->use(theCtx, myLineColor, aLineLen);
         myVertexBuf.bindVertexAttrib(theCtx, myProgram->getVVertexLoc());
         theCtx.core20fwd->glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
         myVertexBuf.unBindVertexAttrib(theCtx, myProgram->getVVertexLoc());
     myProgram->unuse(theCtx);
-    theCtx.core20fwd->glDisable(GL_BLEND);
+    theCtx.stglSetBlend(false);
 
     theCtx.core20fwd->glDisable(GL_SCISSOR_TEST);
 }
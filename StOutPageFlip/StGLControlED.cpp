@@ -199,13 +199,13 @@ void StGLControlED::stglDraw(StGLContext& theCtx,
     theCtx.core20fwd->glScissor(0, theWinHeight - 10, theWinWidth, 10);
 
     theCtx.core20fwd->glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    theCtx.core20fwd->glEnable(GL_BLEND);
+    theCtx.stglSetBlend(true);
     aProgram->use(theCtx, theWinHeight);
     myVertexBuf.bindVertexAttrib(theCtx, aProgram->getVVertexLoc());
     theCtx.core20fwd->glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
     myVertexBuf.unBindVertexAttrib(theCtx, aProgram->getVVertexLoc());
     aProgram->unuse(theCtx);
-    theCtx.core20fwd->glDisable(GL_BLEND);
+    theCtx.stglSetBlend(false);
 
     theCtx.core20fwd->glDisable(GL_SCISSOR_TEST);
 }
@@ -24,6 +24,7 @@
 #include <StThreads/StCondition.h>
 #include <StAV/StAVImage.h>
 #include <StSys/StSys.h>
+#include <StThreads/StProfiler.h>
 #include <stAssert.h>
 
 namespace {
@@ -232,9 +233,11 @@ class StOutPageFlip::StGLDXFrameBuffer {
     void releaseSurfaces(StGLContext& theCtx) {
         if(theCtx.core11fwd->glIsTexture(myGlSurfL)) {
             theCtx.core11fwd->glDeleteTextures(1, &myGlSurfL);
+            theCtx.stglOnDeleteTexture(myGlSurfL);
         }
         if(theCtx.core11fwd->glIsTexture(myGlSurfR)) {
             theCtx.core11fwd->glDeleteTextures(1, &myGlSurfR);
+            theCtx.stglOnDeleteTexture(myGlSurfR);
         }
 
         myGlSurfL = 0;
@@ -1020,6 +1023,7 @@ bool StOutPageFlip::isStereoFullscreenOnly() const {
 }
 
 void StOutPageFlip::stglDraw() {
+    ST_PROFILER_ZONE("StOutPageFlip::stglDraw");
     myFPSControl.setTargetFPS(StWindow::getTargetFps());
 
     if(!StWindow::stglMakeCurrent(ST_WIN_MASTER)) {
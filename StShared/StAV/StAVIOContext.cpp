@@ -47,11 +47,10 @@ namespace {
 
 }
 
-StAVIOContext::StAVIOContext()
+StAVIOContext::StAVIOContext(const int theBufferSize)
 : myAvioCtx(NULL) {
-    const int aBufferSize = 32768;
-    unsigned char* aBufferIO = (unsigned char* )av_malloc(aBufferSize + AV_INPUT_BUFFER_PADDING_SIZE);
-    myAvioCtx = avio_alloc_context(aBufferIO, aBufferSize, 0, this, readCallback, writeCallback, seekCallback);
+    unsigned char* aBufferIO = (unsigned char* )av_malloc(theBufferSize + AV_INPUT_BUFFER_PADDING_SIZE);
+    myAvioCtx = avio_alloc_context(aBufferIO, theBufferSize, 0, this, readCallback, writeCallback, seekCallback);
 }
 
 StAVIOContext::~StAVIOContext() {
@@ -36,6 +36,18 @@ bool StAVIOFileContext::openFromDescriptor(int theFD, const char* theMode) {
     return myFile != NULL;
 }
 
+bool StAVIOFileContext::open(const StCString& thePath) {
+    close();
+#ifdef _WIN32
+    StStringUtfWide aPathWide;
+    aPathWide.fromUnicode(thePath);
+    myFile = ::_wfopen(aPathWide.toCString(), L"rb");
+#else
+    myFile =    ::fopen(thePath.toCString(), "rb");
+#endif
+    return myFile != NULL;
+}
+
 int StAVIOFileContext::read(uint8_t* theBuf,
                             int      theBufSize) {
 
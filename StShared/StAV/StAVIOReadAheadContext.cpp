@@ -0,0 +1,301 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * This code is licensed under MIT license (see docs/license-mit.txt for details).
+ */
+
+#include <StAV/StAVIOReadAheadContext.h>
+
+#include <StThreads/StTimer.h>
+
+extern "C" {
+    #include <libavutil/error.h>
+};
+
+namespace {
+
+    /**
+     * Thread function just call readLoop() function.
+     */
+    static SV_THREAD_FUNCTION readThread(void* theCtx) {
+        StAVIOReadAheadContext* aCtx = (StAVIOReadAheadContext* )theCtx;
+        aCtx->readLoop();
+        return SV_THREAD_RETURN 0;
+    }
+
+    /**
+     * Maximum amount of data read from source at once.
+     */
+    static const size_t THE_READ_CHUNK = 256 * 1024;
+
+    /**
+     * Initial read-ahead window.
+     */
+    static const size_t THE_WINDOW_MIN = 1024 * 1024;
+
+    /**
+     * AVIO buffer size (demuxer reads the context by chunks of this size).
+     */
+    static const int THE_AVIO_BUFFER = 256 * 1024;
+
+}
+
+StAVIOReadAheadContext::StAVIOReadAheadContext(const StHandle<StAVIOContext>& theSource,
+                                               const size_t                   theWindowBytes)
+: StAVIOContext(THE_AVIO_BUFFER),
+  mySource(theSource),
+  myHasData(false),
+  myHasSpace(true),
+  myRing(NULL),
+  myRingSize(stMax(theWindowBytes, THE_WINDOW_MIN)),
+  myWindow(THE_WINDOW_MIN),
+  myHead(0),
+  myFilled(0),
+  myBackBytes(0),
+  myPosition(0),
+  myFileSize(-1),
+  mySeekTarget(-1),
+  myGeneration(0),
+  myError(0),
+  myToQuit(false) {
+    stMemZero(&myStats, sizeof(myStats));
+    myRing = (uint8_t* )stMemAllocAligned(myRingSize);
+
+    // source context might be already read (e.g. probed), so remember current position
+    const int64_t aPosition = mySource->seek(0, SEEK_CUR);
+    myFileSize = mySource->seek(0, SEEK_END);
+    myPosition = aPosition >= 0 ? aPosition : 0;
+    if(mySource->seek(myPosition, SEEK_SET) < 0) {
+        myError = AVERROR(EIO);
+    }
+    myThread = new StThread(readThread, (void* )this, "StAVIOReadAhead");
+}
+
+StAVIOReadAheadContext::~StAVIOReadAheadContext() {
+    {
+        // updateEvents() from I/O thread should not reset the event after quit request
+        StMutexAuto aLock(&myMutex);
+        myToQuit = true;
+        updateEvents();
+    }
+    myThread->wait();
+    myThread.nullify();
+    stMemFreeAligned(myRing);
+}
+
+size_t StAVIOReadAheadContext::getFreeBytes() const {
+    if(myFilled >= myWindow) {
+        return 0;
+    }
+    return stMin(myWindow - myFilled, myRingSize - myFilled - myBackBytes);
+}
+
+void StAVIOReadAheadContext::updateEvents() {
+    if(myFilled > 0
+    || (myError != 0 && mySeekTarget < 0)) {
+        myHasData.set();
+    } else {
+        myHasData.reset();
+    }
+
+    // consumed data is dropped by I/O thread only when it keeps too much of it
+    if(myToQuit
+    || mySeekTarget >= 0
+    || (myError == 0
+     && myWindow > myFilled
+     && (getFreeBytes() > 0 || myBackBytes > myRingSize / 8))) {
+        myHasSpace.set();
+    } else {
+        myHasSpace.reset();
+    }
+}
+
+void StAVIOReadAheadContext::readLoop() {
+    for(;;) {
+        myHasSpace.wait();
+        if(myToQuit) {
+            break;
+        }
+
+        int64_t aSeekTarget = -1;
+        size_t  aTail  = 0;
+        size_t  aChunk = 0;
+        int     aGeneration = 0;
+        {
+            StMutexAuto aLock(&myMutex);
+            aGeneration = myGeneration;
+            if(mySeekTarget >= 0) {
+                aSeekTarget  = mySeekTarget;
+                mySeekTarget = -1;
+            } else {
+                if(myError == 0
+                && getFreeBytes() < stMin(THE_READ_CHUNK, myWindow - stMin(myWindow, myFilled))
+                && myBackBytes > myRingSize / 8) {
+                    // drop consumed data, but keep a small part for seeking back
+                    myBackBytes = stMin(myBackBytes, myRingSize / 8);
+                }
+                aChunk = myError == 0 ? getFreeBytes() : 0;
+                if(aChunk == 0) {
+                    updateEvents();
+                    continue;
+                }
+                aTail  = (myHead + myFilled) % myRingSize;
+                aChunk = stMin(stMin(aChunk, myRingSize - aTail), THE_READ_CHUNK);
+            }
+        }
+
+        if(aSeekTarget >= 0) {
+            const int64_t aResult = mySource->seek(aSeekTarget, SEEK_SET);
+            StMutexAuto aLock(&myMutex);
+            if(aResult < 0
+            && aGeneration == myGeneration) {
+                myError = AVERROR(EIO);
+            }
+            updateEvents();
+            continue;
+        }
+
+        // ring region behind the filled data is not accessed by demuxer, so read it without lock
+        StTimer aTimer(true);
+        const int aNbRead = mySource->read(myRing + aTail, (int )aChunk);
+        const double aReadSec = aTimer.getElapsedTimeInSec();
+
+        StMutexAuto aLock(&myMutex);
+        myStats.ReadSec += aReadSec;
+        if(aGeneration != myGeneration) {
+            // buffer has been discarded by seeking while reading
+            updateEvents();
+            continue;
+        }
+
+        if(aNbRead > 0) {
+            myFilled += size_t(aNbRead);
+            myStats.BytesRead += aNbRead;
+        } else {
+            myError = aNbRead == 0 ? AVERROR_EOF : aNbRead;
+        }
+        updateEvents();
+    }
+}
+
+int StAVIOReadAheadContext::read(uint8_t* theBuf,
+                                 int      theBufSize) {
+    if(theBufSize <= 0) {
+        return 0;
+    }
+
+    bool isStalled = false;
+    for(;;) {
+        {
+            StMutexAuto aLock(&myMutex);
+            if(myFilled > 0) {
+                const size_t aNbRead  = stMin(myFilled, size_t(theBufSize));
+                const size_t aNbFirst = stMin(aNbRead, myRingSize - myHead);
+                stMemCpy(theBuf, myRing + myHead, aNbFirst);
+                if(aNbFirst < aNbRead) {
+                    stMemCpy(theBuf + aNbFirst, myRing, aNbRead - aNbFirst);
+                }
+                myHead       = (myHead + aNbRead) % myRingSize;
+                myFilled    -= aNbRead;
+                myBackBytes += aNbRead;
+                myPosition  += int64_t(aNbRead);
+                updateEvents();
+                return int(aNbRead);
+            } else if(myError != 0
+                   && mySeekTarget < 0) {
+                return myError;
+            }
+
+            if(!isStalled) {
+                // source is too slow - enlarge the window
+                isStalled = true;
+                ++myStats.NbStalls;
+                myWindow = stMin(myWindow * 2, myRingSize);
+                updateEvents();
+            }
+        }
+
+        StTimer aStallTimer(true);
+        myHasData.wait();
+
+        StMutexAuto aLock(&myMutex);
+        myStats.StallSec += aStallTimer.getElapsedTimeInSec();
+    }
+}
+
+int StAVIOReadAheadContext::write(const uint8_t* ,
+                                  const int      ) {
+    return -1;
+}
+
+int64_t StAVIOReadAheadContext::seek(int64_t theOffset,
+                                     int     theWhence) {
+    if(theWhence == AVSEEK_SIZE) {
+        return myFileSize;
+    }
+
+    StMutexAuto aLock(&myMutex);
+    int64_t aTarget = -1;
+    switch(theWhence & ~AVSEEK_FORCE) {
+        case SEEK_SET: aTarget = theOffset; break;
+        case SEEK_CUR: aTarget = myPosition + theOffset; break;
+        case SEEK_END: aTarget = myFileSize >= 0 ? myFileSize + theOffset : -1; break;
+        default: return -1;
+    }
+    if(aTarget < 0) {
+        return -1;
+    }
+
+    if(aTarget >= myPosition - int64_t(myBackBytes)
+    && aTarget <= myPosition + int64_t(myFilled)) {
+        // relocate within buffered data
+        const int64_t aDelta = aTarget - myPosition;
+        if(aDelta >= 0) {
+            myFilled    -= size_t(aDelta);
+            myBackBytes += size_t(aDelta);
+            myHead       = (myHead + size_t(aDelta)) % myRingSize;
+        } else {
+            myFilled    += size_t(-aDelta);
+            myBackBytes -= size_t(-aDelta);
+            myHead       = (myHead + myRingSize - size_t(-aDelta)) % myRingSize;
+        }
+        if(aDelta != 0) {
+            ++myStats.NbSeeks;
+        }
+    } else {
+        // discard the buffer and relocate source
+        ++myGeneration;
+        ++myStats.NbSeeksFar;
+        mySeekTarget = aTarget;
+        myHead       = 0;
+        myFilled     = 0;
+        myBackBytes  = 0;
+        myError      = 0;
+    }
+    myPosition = aTarget;
+    updateEvents();
+    return aTarget;
+}
+
+StAVIOReadAheadContext::Stats StAVIOReadAheadContext::getStats() const {
+    StMutexAuto aLock(&myMutex);
+    Stats aStats = myStats;
+    aStats.WindowBytes = myWindow;
+    aStats.FilledBytes = myFilled;
+    return aStats;
+}
+
+StString StAVIOReadAheadContext::formatStats() const {
+    const Stats aStats = getStats();
+    if(aStats.BytesRead == 0) {
+        return StString();
+    }
+
+    char aBuffer[256];
+    stsprintf(aBuffer, sizeof(aBuffer),
+              "[ReadAhead] window %.1f MiB, read %.1f MiB at %.1f MiB/s; stalls %d (%.2f s); seeks %d/%d (buffered/discarded)",
+              double(aStats.WindowBytes) / (1024.0 * 1024.0), double(aStats.BytesRead) / (1024.0 * 1024.0),
+              aStats.getThroughputMiBs(), aStats.NbStalls, aStats.StallSec,
+              aStats.NbSeeks, aStats.NbSeeksFar);
+    return aBuffer;
+}
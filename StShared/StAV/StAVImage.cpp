@@ -20,7 +20,8 @@ bool StAVImage::init() {
 StAVImage::StAVImage()
 : myFormatCtx(NULL),
   myCodecCtx(NULL),
-  myCodec(NULL) {
+  myCodec(NULL),
+  myLowRes(0) {
     StAVImage::init();
 }
 
@@ -393,6 +394,10 @@ bool StAVImage::loadExtra(const StString& theFilePath,
         return false;
     }
 
+    if(myLowRes > 0) {
+        myCodecCtx->lowres = stMin(myLowRes, (int )myCodec->max_lowres);
+    }
+
     // open VIDEO codec
     if(avcodec_open2(myCodecCtx, myCodec, NULL) < 0) {
         setState("AVCodec library, could not open video codec");
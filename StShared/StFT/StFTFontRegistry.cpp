@@ -8,7 +8,10 @@
 
 #include <StFile/StFolder.h>
 #include <StStrings/StLogger.h>
+#include <StThreads/StMutex.h>
 #include <StThreads/StProcess.h>
+#include <StThreads/StStartupTimeline.h>
+#include <StThreads/StThread.h>
 #include <stAssert.h>
 
 #if !defined(_WIN32) && !defined(__ANDROID__) && !defined(__APPLE__) && !defined(__EMSCRIPTEN__)
@@ -18,6 +21,58 @@
 
 namespace {
     static const StFTFontFamily THE_NO_FAMILY;
+
+    /**
+     * Registry shared between font managers.
+     */
+    struct StFTFontRegistryShared {
+        StMutex                    Mutex;    //!< lock for shared registry creation
+        StHandle<StFTFontRegistry> Registry; //!< shared registry
+        StHandle<StThread>         Thread;   //!< background initialization thread
+
+        ~StFTFontRegistryShared() {
+            if(!Thread.isNull()) {
+                Thread->wait();
+            }
+        }
+    };
+
+    static StFTFontRegistryShared& getSharedRegistry() {
+        static StFTFontRegistryShared THE_SHARED_REGISTRY;
+        return THE_SHARED_REGISTRY;
+    }
+
+    static SV_THREAD_FUNCTION prefetchThread(void* theRegistry) {
+        ST_STARTUP_PHASE("StFTFontRegistry::init");
+        ((StFTFontRegistry* )theRegistry)->init(false);
+        return SV_THREAD_RETURN 0;
+    }
+}
+
+void StFTFontRegistry::PrefetchDefault() {
+    StFTFontRegistryShared& aShared = getSharedRegistry();
+    StMutexAuto aLock(aShared.Mutex);
+    if(!aShared.Registry.isNull()) {
+        return;
+    }
+
+    aShared.Registry = new StFTFontRegistry();
+    aShared.Thread   = new StThread(prefetchThread, (void* )aShared.Registry.access(), "StFTFontRegistry");
+}
+
+StHandle<StFTFontRegistry> StFTFontRegistry::GetDefault() {
+    StFTFontRegistryShared& aShared = getSharedRegistry();
+    StMutexAuto aLock(aShared.Mutex);
+    if(!aShared.Thread.isNull()) {
+        ST_STARTUP_PHASE("StFTFontRegistry, wait prefetch");
+        aShared.Thread->wait();
+        aShared.Thread.nullify();
+    } else if(aShared.Registry.isNull()) {
+        ST_STARTUP_PHASE("StFTFontRegistry::init");
+        aShared.Registry = new StFTFontRegistry();
+        aShared.Registry->init(false);
+    }
+    return aShared.Registry;
 }
 
 StFTFontRegistry::StFTFontRegistry() {
@@ -39,6 +39,9 @@
     #endif
 #endif
 
+//! Value of cached state which is not known
+static const GLuint THE_STATE_UNKNOWN = GLuint(-1);
+
 StGLContext::StGLContext(const StHandle<StResourceManager>& theResMgr)
 : core11(NULL),
   core11fwd(NULL),
@@ -88,6 +91,9 @@ StGLContext::StGLContext(const StHandle<StResourceManager>& theResMgr)
     stMemZero(&myViewport,   sizeof(StGLBoxPx));
     stMemZero(&myWindowBits, sizeof(BufferBits));
     stMemZero(&myFBOBits,    sizeof(BufferBits));
+    stMemZero(&myStateCnt,      sizeof(StateCounters));
+    stMemZero(&myStateCntFrame, sizeof(StateCounters));
+    resetStateCache();
 #ifdef __APPLE__
     mySysLib.loadSimple("/System/Library/Frameworks/OpenGL.framework/Versions/Current/OpenGL");
 #endif
@@ -147,6 +153,9 @@ StGLContext::StGLContext(const bool theToInitialize)
     stMemZero(&myViewport,   sizeof(StGLBoxPx));
     stMemZero(&myWindowBits, sizeof(BufferBits));
     stMemZero(&myFBOBits,    sizeof(BufferBits));
+    stMemZero(&myStateCnt,      sizeof(StateCounters));
+    stMemZero(&myStateCntFrame, sizeof(StateCounters));
+    resetStateCache();
 #ifdef __APPLE__
     mySysLib.loadSimple("/System/Library/Frameworks/OpenGL.framework/Versions/Current/OpenGL");
 #endif
@@ -641,6 +650,171 @@ void StGLContext::stglBindFramebuffer(const GLuint theFramebuffer) {
     arbFbo->glBindFramebuffer(GL_FRAMEBUFFER, theFramebuffer);
 }
 
+void StGLContext::resetStateCache() {
+    myStateProgram       = THE_STATE_UNKNOWN;
+    myStateActiveTexture = 0;
+    for(size_t aUnitIter = 0; aUnitIter < STATE_TEXTURE_UNITS_MAX; ++aUnitIter) {
+        myStateTextures[aUnitIter].Target = 0;
+        myStateTextures[aUnitIter].Id     = 0;
+    }
+    myStateArrayBuffer   = THE_STATE_UNKNOWN;
+    myStateElementBuffer = THE_STATE_UNKNOWN;
+    myStateAttribsKnown  = 0;
+    myStateAttribsOn     = 0;
+    myStateBlend         = -1;
+    myStateDepthTest     = -1;
+    myStateCullFace      = -1;
+}
+
+void StGLContext::resetStateCounters() {
+    myStateCntFrame = myStateCnt;
+    myStateCnt.NbIssued  = 0;
+    myStateCnt.NbSkipped = 0;
+}
+
+void StGLContext::stglUseProgram(const GLuint theProgram) {
+    if(myStateProgram == theProgram) {
+        ++myStateCnt.NbSkipped;
+        return;
+    }
+
+    ++myStateCnt.NbIssued;
+    myStateProgram = theProgram;
+    core20fwd->glUseProgram(theProgram);
+}
+
+void StGLContext::stglActiveTexture(const GLenum theTextureUnit) {
+    if(myStateActiveTexture == theTextureUnit) {
+        ++myStateCnt.NbSkipped;
+        return;
+    }
+
+    ++myStateCnt.NbIssued;
+    myStateActiveTexture = theTextureUnit;
+    core20fwd->glActiveTexture(theTextureUnit);
+}
+
+void StGLContext::stglBindTexture(const GLenum theTextureUnit,
+                                  const GLenum theTarget,
+                                  const GLuint theTexture) {
+    stglActiveTexture(theTextureUnit);
+
+    // only one target per unit is tracked - binding to another target just replaces cached value
+    const size_t anIndex = size_t(theTextureUnit - GL_TEXTURE0);
+    if(anIndex < STATE_TEXTURE_UNITS_MAX) {
+        TextureBinding& aBinding = myStateTextures[anIndex];
+        if(aBinding.Target == theTarget
+        && aBinding.Id     == theTexture) {
+            ++myStateCnt.NbSkipped;
+            return;
+        }
+        aBinding.Target = theTarget;
+        aBinding.Id     = theTexture;
+    }
+
+    ++myStateCnt.NbIssued;
+    core20fwd->glBindTexture(theTarget, theTexture);
+}
+
+void StGLContext::stglBindBuffer(const GLenum theTarget,
+                                 const GLuint theBuffer) {
+    GLuint* aState = NULL;
+    switch(theTarget) {
+        case GL_ARRAY_BUFFER:         aState = &myStateArrayBuffer;   break;
+        case GL_ELEMENT_ARRAY_BUFFER: aState = &myStateElementBuffer; break;
+        default: break;
+    }
+    if(aState != NULL) {
+        if(*aState == theBuffer) {
+            ++myStateCnt.NbSkipped;
+            return;
+        }
+        *aState = theBuffer;
+    }
+
+    ++myStateCnt.NbIssued;
+    core20fwd->glBindBuffer(theTarget, theBuffer);
+}
+
+void StGLContext::stglSetVertexAttribArray(const GLuint theLocation,
+                                           const bool   theToEnable) {
+    if(theLocation < STATE_VERTEX_ATTRIBS_MAX) {
+        const uint32_t aBit = uint32_t(1) << theLocation;
+        if((myStateAttribsKnown & aBit) != 0
+        && ((myStateAttribsOn & aBit) != 0) == theToEnable) {
+            ++myStateCnt.NbSkipped;
+            return;
+        }
+        myStateAttribsKnown |= aBit;
+        if(theToEnable) {
+            myStateAttribsOn |= aBit;
+        } else {
+            myStateAttribsOn &= ~aBit;
+        }
+    }
+
+    ++myStateCnt.NbIssued;
+    if(theToEnable) {
+        core20fwd->glEnableVertexAttribArray(theLocation);
+    } else {
+        core20fwd->glDisableVertexAttribArray(theLocation);
+    }
+}
+
+void StGLContext::stglSetCapability(const GLenum theCap,
+                                    GLint&       theState,
+                                    const bool   theToEnable) {
+    const GLint aState = theToEnable ? 1 : 0;
+    if(theState == aState) {
+        ++myStateCnt.NbSkipped;
+        return;
+    }
+
+    ++myStateCnt.NbIssued;
+    theState = aState;
+    if(theToEnable) {
+        core11fwd->glEnable(theCap);
+    } else {
+        core11fwd->glDisable(theCap);
+    }
+}
+
+void StGLContext::stglSetBlend(const bool theToEnable) {
+    stglSetCapability(GL_BLEND, myStateBlend, theToEnable);
+}
+
+void StGLContext::stglSetDepthTest(const bool theToEnable) {
+    stglSetCapability(GL_DEPTH_TEST, myStateDepthTest, theToEnable);
+}
+
+void StGLContext::stglSetCullFace(const bool theToEnable) {
+    stglSetCapability(GL_CULL_FACE, myStateCullFace, theToEnable);
+}
+
+void StGLContext::stglOnDeleteTexture(const GLuint theTexture) {
+    // deleted texture is unbound from all units
+    for(size_t aUnitIter = 0; aUnitIter < STATE_TEXTURE_UNITS_MAX; ++aUnitIter) {
+        if(myStateTextures[aUnitIter].Id == theTexture) {
+            myStateTextures[aUnitIter].Target = 0;
+        }
+    }
+}
+
+void StGLContext::stglOnDeleteBuffer(const GLuint theBuffer) {
+    if(myStateArrayBuffer == theBuffer) {
+        myStateArrayBuffer = THE_STATE_UNKNOWN;
+    }
+    if(myStateElementBuffer == theBuffer) {
+        myStateElementBuffer = THE_STATE_UNKNOWN;
+    }
+}
+
+void StGLContext::stglOnDeleteProgram(const GLuint theProgram) {
+    if(myStateProgram == theProgram) {
+        myStateProgram = THE_STATE_UNKNOWN;
+    }
+}
+
 bool StGLContext::stglSetVSync(const VSync_Mode theVSyncMode) {
     GLint aSyncInt = 0;
     switch(theVSyncMode) {
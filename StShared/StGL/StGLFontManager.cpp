@@ -18,9 +18,9 @@ namespace {
 
 StGLFontManager::StGLFontManager(const unsigned int theResolution)
 : myFTLib(new StFTLibrary()),
+  myRegistry(StFTFontRegistry::GetDefault()),
   myResolution(theResolution) {
-    myRegistry = new StFTFontRegistry();
-    myRegistry->init(false);
+    //
 }
 
 StGLFontManager::~StGLFontManager() {
@@ -29,6 +29,7 @@ const StString& StGLProgram::getTitle() const {
 void StGLProgram::release(StGLContext& theCtx) {
     if(isValid()) {
         theCtx.core20fwd->glDeleteProgram(myProgramId);
+        theCtx.stglOnDeleteProgram(myProgramId);
         myProgramId = NO_PROGRAM;
     }
 }
@@ -124,7 +125,7 @@ StGLProgram& StGLProgram::bindAttribLocation(StGLContext&    theCtx,
 
 void StGLProgram::use(StGLContext& theCtx) const {
     if(isValid()) {
-        theCtx.core20fwd->glUseProgram(myProgramId); // use our shader
+        theCtx.stglUseProgram(myProgramId); // use our shader
     }
 }
 
@@ -134,7 +135,7 @@ void StGLProgram::unuse(StGLContext& theCtx) const {
 
 void StGLProgram::unuseGlobal(StGLContext& theCtx) {
     if(theCtx.core20fwd != NULL) {
-        theCtx.core20fwd->glUseProgram(NO_PROGRAM); // use fixed instructions
+        theCtx.stglUseProgram(NO_PROGRAM); // use fixed instructions
     }
 }
 
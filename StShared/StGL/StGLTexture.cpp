@@ -432,6 +432,7 @@ StGLTexture::~StGLTexture() {
 void StGLTexture::release(StGLContext& theCtx) {
     if(isValid()) {
         theCtx.core20fwd->glDeleteTextures(1, &myTextureId);
+        theCtx.stglOnDeleteTexture(myTextureId);
         myTextureId = NO_TEXTURE;
     }
     mySizeX = mySizeY = 0;
@@ -440,13 +441,11 @@ void StGLTexture::release(StGLContext& theCtx) {
 void StGLTexture::bind(StGLContext& theCtx,
                        const GLenum theTextureUnit) {
     myTextureUnit = theTextureUnit;
-    theCtx.core20fwd->glActiveTexture(theTextureUnit);
-    theCtx.core20fwd->glBindTexture(myTarget, myTextureId);
+    theCtx.stglBindTexture(theTextureUnit, myTarget, myTextureId);
 }
 
 void StGLTexture::unbind(StGLContext& theCtx) {
-    theCtx.core20fwd->glActiveTexture(myTextureUnit);
-    theCtx.core20fwd->glBindTexture(myTarget, NO_TEXTURE);
+    theCtx.stglBindTexture(myTextureUnit, myTarget, NO_TEXTURE);
 }
 
 bool StGLTexture::init(StGLContext&   theCtx,
@@ -665,11 +664,22 @@ bool StGLTexture::fillPatch(StGLContext&        theCtx,
     return fillPatch(theCtx, theData, theTarget, theRowFrom, theRowTo, aBatchRows);
 }
 
+bool StGLTexture::fillPatch(StGLContext&        theCtx,
+                            const StImagePlane& theData,
+                            const GLenum        theTarget,
+                            const GLsizei       theRowFrom,
+                            const GLsizei       theRowTo,
+                            const GLsizei       theBatchRows) {
+    return fillPatch(theCtx, theData, theTarget, theRowFrom, theRowTo, 0, 0, theBatchRows);
+}
+
 bool StGLTexture::fillPatch(StGLContext&        theCtx,
                             const StImagePlane& theData,
                             GLenum              theTarget,
                             const GLsizei       theRowFrom,
                             const GLsizei       theRowTo,
+                            const GLsizei       theColFrom,
+                            const GLsizei       theColTo,
                             const GLsizei       theBatchRows) {
     if(theTarget == 0) {
         theTarget = myTarget;
@@ -688,10 +698,18 @@ bool StGLTexture::fillPatch(StGLContext&        theCtx,
         aRowTo = stMin(theRowTo, aRowTo);
     }
 
-    if(theRowFrom >= aRowTo) {
+    GLsizei aColTo = GLsizei(stMin(theData.getSizeX(), size_t(getSizeX())));
+    if(theColTo > 0) {
+        aColTo = stMin(theColTo, aColTo);
+    }
+
+    if(theRowFrom >= aRowTo
+    || theColFrom >= aColTo) {
         // out of range
         return false;
     }
+    const bool isFullRow = theColFrom == 0
+                        && aColTo == GLsizei(theData.getSizeX());
 
     myHasMipMaps = 0;
     bind(theCtx);
@@ -706,7 +724,8 @@ bool StGLTexture::fillPatch(StGLContext&        theCtx,
     size_t anExtraBytes       = theData.getRowExtraBytes();
     size_t aPixelsWidth       = theData.getSizeRowBytes() / theData.getSizePixelBytes();
     size_t aSizeRowBytesEstim = getAligned(theData.getSizePixelBytes() * aPixelsWidth, anAligment);
-    if(anExtraBytes < anAligment) {
+    if(anExtraBytes < anAligment
+    && isFullRow) {
         aPixelsWidth = 0;
     } else if(aSizeRowBytesEstim != theData.getSizeRowBytes()) {
         aPixelsWidth = 0;
@@ -714,7 +733,7 @@ bool StGLTexture::fillPatch(StGLContext&        theCtx,
     }
 
     if(!theCtx.getDeviceCaps().hasUnpack
-    && anExtraBytes >= anAligment) {
+    && (anExtraBytes >= anAligment || !isFullRow)) {
         toBatchCopy = false;
     }
 
@@ -724,7 +743,7 @@ bool StGLTexture::fillPatch(StGLContext&        theCtx,
         }
 
         // do batch copy (more effective)
-        GLsizei aPatchWidth = GLsizei(theData.getSizeX());
+        GLsizei aPatchWidth = isFullRow ? GLsizei(theData.getSizeX()) : (aColTo - theColFrom);
         GLsizei aBatchRows  = theBatchRows >= 1 ? theBatchRows : (aRowTo - theRowFrom);
         GLsizei aNbRows     = aBatchRows;
         for(GLsizei aRow(theRowFrom), aRowsRemain(aRowTo); aRow < aRowTo; aRow += aBatchRows) {
@@ -734,11 +753,11 @@ bool StGLTexture::fillPatch(StGLContext&        theCtx,
             }
 
             theCtx.core20fwd->glTexSubImage2D(theTarget, 0,     // 0 = LOD number
-                                              0, aRow,          // a texel offset in the (x, y) direction
+                                              theColFrom, aRow, // a texel offset in the (x, y) direction
                                               aPatchWidth, aNbRows,
                                               aPixelFormat,     // format of the pixel data
                                               aDataType,        // data type of the pixel data
-                                              theData.getData(aRow, 0));
+                                              theData.getData(aRow, theColFrom));
         }
 
         if(theCtx.getDeviceCaps().hasUnpack) {
@@ -750,14 +769,14 @@ bool StGLTexture::fillPatch(StGLContext&        theCtx,
             theCtx.core20fwd->glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
         }
 
-        GLsizei aPatchWidth = stMin(GLsizei(theData.getSizeX()), getSizeX());
+        GLsizei aPatchWidth = aColTo - theColFrom;
         for(GLsizei aRow = theRowFrom; aRow < aRowTo; ++aRow) {
             theCtx.core20fwd->glTexSubImage2D(theTarget, 0,     // 0 = LOD number
-                                              0, aRow,          // a texel offset in the (x, y) direction
+                                              theColFrom, aRow, // a texel offset in the (x, y) direction
                                               aPatchWidth, 1,   // the (width, height) of the texture sub-image
                                               aPixelFormat,     // format of the pixel data
                                               aDataType,        // data type of the pixel data
-                                              theData.getData(aRow, 0));
+                                              theData.getData(aRow, theColFrom));
         }
     }
 
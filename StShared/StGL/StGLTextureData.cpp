@@ -1,5 +1,5 @@
 /**
- * Copyright © 2009-2020 Kirill Gavrilov <kirill@sview.ru>
+ * Copyright © 2009-2026 Kirill Gavrilov <kirill@sview.ru>
  *
  * This code is licensed under MIT license (see docs/license-mit.txt for details).
  */
@@ -11,6 +11,9 @@
 #include <StGL/StGLContext.h>
 
 #include <StAV/StAVImage.h>
+#include <StImage/StFrameBufferPool.h>
+#include <StImage/StImageKernels.h>
+#include <StImage/StMemoryBudget.h>
 
 StGLTextureData::StGLTextureData(const StHandle<StGLTextureUploadParams>& theUploadParams)
 : myPrev(NULL),
@@ -23,7 +26,8 @@ StGLTextureData::StGLTextureData(const StHandle<StGLTextureUploadParams>& theUpl
   myCubemapFormat(StCubemap_OFF),
   myUploadParams(theUploadParams),
   myFillFromRow(0),
-  myFillRows(0) {
+  myFillRows(0),
+  myToCullView(false) {
     //
 }
 
@@ -36,7 +40,9 @@ void StGLTextureData::reset() {
     myDataL.nullify();
     myDataR.nullify();
     if(myDataPtr != NULL) {
-        stMemFreeAligned(myDataPtr);
+        // budget is charged by actual block size
+        StMemoryBudget::GetDefault().release(StMemoryBudget::Subsystem_Textures, StFrameBufferPool::getBlockSize(myDataPtr));
+        StFrameBufferPool::GetDefault().release(myDataPtr);
         myDataPtr = NULL;
     }
     myDataSizeBytes = 0;
@@ -44,22 +50,55 @@ void StGLTextureData::reset() {
 }
 
 bool StGLTextureData::reAllocate(const size_t theSizeBytes) {
-    // reallocate only if summary data is not same
+    // reallocate only if the buffer is too small or too large;
     // this allows to smoothly switch to different stereo source formats
     // over/under -> sideBySide -> mono
-    // because the summary buffer needed for both views will be same
-    if(myDataSizeBytes != theSizeBytes) {
-        reset();
+    // because the summary buffer needed for both views will be same,
+    // as well as between frames of slightly different geometry
+    // (size class of the pool block might be larger than requested)
+    const size_t aCapacity = StFrameBufferPool::getBlockSize(myDataPtr);
+    if(myDataPtr != NULL
+    && theSizeBytes <= aCapacity
+    && theSizeBytes >  aCapacity / 2) {
         myDataSizeBytes = theSizeBytes;
-        myDataPtr       = stMemAllocAligned<GLubyte*>(myDataSizeBytes);
+        return false;
+    }
 
-        // reset the buffer (make black)
-        /// this is probably useless and wrong in case of non RGB image data
-        stMemZero(myDataPtr, myDataSizeBytes);
-        ST_DEBUG_LOG("StGLTextureData (re)allocated to " + myDataSizeBytes + " bytes");
-        return true;
+    reset();
+    myDataPtr = (GLubyte* )StFrameBufferPool::GetDefault().allocate(theSizeBytes);
+    if(myDataPtr == NULL) {
+        return false;
+    }
+
+    myDataSizeBytes = theSizeBytes;
+    StMemoryBudget::GetDefault().allocate(StMemoryBudget::Subsystem_Textures, StFrameBufferPool::getBlockSize(myDataPtr));
+
+    // reset the buffer (make black)
+    /// this is probably useless and wrong in case of non RGB image data
+    stMemZero(myDataPtr, myDataSizeBytes);
+    ST_DEBUG_LOG("StGLTextureData (re)allocated to " + myDataSizeBytes + " bytes");
+    return true;
+}
+
+/**
+ * Copy rows from source plane to destination plane.
+ * @param theSrcRowStep source rows step, negative to iterate bottom-up source data
+ */
+inline void copyPlaneRows(StImagePlane&       theDst,
+                          const size_t        theDstRow,
+                          const size_t        theDstCol,
+                          const StImagePlane& theSrc,
+                          const size_t        theSrcRow,
+                          const size_t        theSrcCol,
+                          const ptrdiff_t     theSrcRowStep,
+                          const size_t        theRowBytes,
+                          const size_t        theNbRows) {
+    if(theNbRows == 0) {
+        return;
     }
-    return false;
+    StImageKernels::copyRows(theDst.changeData(theDstRow, theDstCol), ptrdiff_t(theDst.getSizeRowBytes()),
+                             theSrc.getData(theSrcRow, theSrcCol),    ptrdiff_t(theSrc.getSizeRowBytes()) * theSrcRowStep,
+                             theRowBytes, theNbRows);
 }
 
 static GLubyte* readFromParallel(const StImagePlane& theSrc,
@@ -82,17 +121,11 @@ static GLubyte* readFromParallel(const StImagePlane& theSrc,
     const size_t aCopyRows      = stMin(theDataL.getSizeY(), theSrc.getSizeY());
     const size_t aCopyRowBytes  = stMin(theDataL.getSizeX(), srcDataSizeXHalf) * theDataL.getSizePixelBytes();
 
-    // copy row by row
-    size_t aRowInc = theSrc.isTopDown() ? 1 : size_t(-1);
-    size_t aRowTo  = theSrc.isTopDown() ? 0 : (aCopyRows - 1);
-    for(size_t aRowFrom = 0; aRowFrom < aCopyRows; ++aRowFrom, aRowTo += aRowInc) {
-        stMemCpy(theDataL.changeData(aRowTo, 0),
-                 theSrc.getData(aRowFrom, 0),
-                 aCopyRowBytes);
-        stMemCpy(theDataR.changeData(aRowTo, 0),
-                 theSrc.getData(aRowFrom, srcDataSizeXHalf),
-                 aCopyRowBytes);
-    }
+    // flip bottom-up data
+    const size_t    aRowFrom = theSrc.isTopDown() ? 0 : (aCopyRows - 1);
+    const ptrdiff_t aRowInc  = theSrc.isTopDown() ? 1 : -1;
+    copyPlaneRows(theDataL, 0, 0, theSrc, aRowFrom, 0,                aRowInc, aCopyRowBytes, aCopyRows);
+    copyPlaneRows(theDataR, 0, 0, theSrc, aRowFrom, srcDataSizeXHalf, aRowInc, aCopyRowBytes, aCopyRows);
     return &theDataPtr[2 * theDataL.getSizeBytes()];
 }
 
@@ -116,34 +149,15 @@ static GLubyte* readFromOverUnderLR(const StImagePlane& theSrc,
     const size_t aCopyRows      = stMin(theDataL.getSizeY(), srcDataSizeYHalf);
     const size_t aCopyRowBytes  = stMin(theDataL.getSizeX(), theSrc.getSizeX()) * theDataL.getSizePixelBytes();
 
-    if(theDataL.getSizeRowBytes() == theSrc.getSizeRowBytes() && theSrc.isTopDown()) {
-        // perform fat copy
-        stMemCpy(theDataL.changeData(),
-                 theSrc.getData(0, 0),
-                 aCopyRows * aCopyRowBytes);
-        stMemCpy(theDataR.changeData(),
-                 theSrc.getData(srcDataSizeYHalf, 0),
-                 aCopyRows * aCopyRowBytes);
-    } else {
-        // check if data is upside-down
-        const size_t aRowTop    = theSrc.isTopDown() ? 0 : srcDataSizeYHalf;
-        const size_t aRowBottom = theSrc.isTopDown() ? srcDataSizeYHalf : 0;
-
-        // copy row by row
-        const size_t aRowInc = theSrc.isTopDown() ? 1 : size_t(-1);
-        size_t       aRowTo  = theSrc.isTopDown() ? 0 : (aCopyRows - 1);
-        for(size_t aRow = 0; aRow < aCopyRows; ++aRow, aRowTo += aRowInc) {
-            stMemCpy(theDataL.changeData(aRowTo, 0),
-                     theSrc.getData(aRowTop + aRow, 0),
-                     aCopyRowBytes);
-        }
-        aRowTo = theSrc.isTopDown() ? 0 : (aCopyRows - 1);
-        for(size_t aRow = 0; aRow < aCopyRows; ++aRow, aRowTo += aRowInc) {
-            stMemCpy(theDataR.changeData(aRowTo, 0),
-                     theSrc.getData(aRowBottom + aRow, 0),
-                     aCopyRowBytes);
-        }
-    }
+    // check if data is upside-down
+    const size_t aRowTop    = theSrc.isTopDown() ? 0 : srcDataSizeYHalf;
+    const size_t aRowBottom = theSrc.isTopDown() ? srcDataSizeYHalf : 0;
+
+    // equal strides are copied as continuous block
+    const size_t    aRowFrom = theSrc.isTopDown() ? 0 : (aCopyRows - 1);
+    const ptrdiff_t aRowInc  = theSrc.isTopDown() ? 1 : -1;
+    copyPlaneRows(theDataL, 0, 0, theSrc, aRowTop    + aRowFrom, 0, aRowInc, aCopyRowBytes, aCopyRows);
+    copyPlaneRows(theDataR, 0, 0, theSrc, aRowBottom + aRowFrom, 0, aRowInc, aCopyRowBytes, aCopyRows);
     return &theDataPtr[2 * theDataL.getSizeBytes()];
 }
 
@@ -172,18 +186,41 @@ static GLubyte* readFromRowInterlace(const StImagePlane& theSrc,
     const size_t aSrcRowRight  = theSrc.isTopDown() ? 1 : 0;
 
     // prepare iterator for bottom-up source data
-    const size_t aRowInc = theSrc.isTopDown() ? 1 : size_t(-1);
-    size_t       aRowTo  = theSrc.isTopDown() ? 0 : (aCopyRows - 1);
-
-    // copy row by row
-    for(size_t aRowFrom = 0; aRowFrom < aCopyRows; ++aRowFrom, aRowTo += aRowInc) {
-        stMemCpy(theDataR.changeData(aRowTo, 0),
-                 theSrc.getData(2 * aRowFrom + aSrcRowRight, 0),
-                 aCopyRowBytes);
-        stMemCpy(theDataL.changeData(aRowTo, 0),
-                 theSrc.getData(2 * aRowFrom + aSrcRowLeft, 0),
-                 aCopyRowBytes);
+    const size_t    aRowFrom = theSrc.isTopDown() ? 0 : 2 * (aCopyRows - 1);
+    const ptrdiff_t aRowInc  = theSrc.isTopDown() ? 2 : -2;
+    copyPlaneRows(theDataR, 0, 0, theSrc, aRowFrom + aSrcRowRight, 0, aRowInc, aCopyRowBytes, aCopyRows);
+    copyPlaneRows(theDataL, 0, 0, theSrc, aRowFrom + aSrcRowLeft,  0, aRowInc, aCopyRowBytes, aCopyRows);
+    return &theDataPtr[2 * theDataL.getSizeBytes()];
+}
+
+static GLubyte* readFromColumnInterlace(const StImagePlane& theSrc,
+                                        GLubyte*            theDataPtr,
+                                        StImagePlane&       theDataL,
+                                        StImagePlane&       theDataR) {
+    if(theSrc.isNull()) {
+        return theDataPtr;
     }
+
+    const size_t srcDataSizeXHalf = theSrc.getSizeX() / 2;
+    const size_t anOutRowBytes    = getEvenNumber(srcDataSizeXHalf * theSrc.getSizePixelBytes());
+    theDataL.initWrapper(theSrc.getFormat(), theDataPtr,
+                         srcDataSizeXHalf, theSrc.getSizeY(),
+                         anOutRowBytes);
+    theDataR.initWrapper(theSrc.getFormat(), &theDataPtr[theDataL.getSizeBytes()],
+                         theDataL.getSizeX(), theDataL.getSizeY(),
+                         anOutRowBytes);
+
+    const size_t aCopyRows = stMin(theDataL.getSizeY(), theSrc.getSizeY());
+    if(aCopyRows == 0) {
+        return &theDataPtr[2 * theDataL.getSizeBytes()];
+    }
+
+    // flip bottom-up data
+    const size_t    aRowFrom = theSrc.isTopDown() ? 0 : (aCopyRows - 1);
+    const ptrdiff_t aRowInc  = theSrc.isTopDown() ? 1 : -1;
+    StImageKernels::splitColumns(theDataL.changeData(), theDataR.changeData(), ptrdiff_t(anOutRowBytes),
+                                 theSrc.getData(aRowFrom, 0), ptrdiff_t(theSrc.getSizeRowBytes()) * aRowInc,
+                                 srcDataSizeXHalf, theSrc.getSizePixelBytes(), aCopyRows);
     return &theDataPtr[2 * theDataL.getSizeBytes()];
 }
 
@@ -212,47 +249,22 @@ static GLubyte* readFromTiled4X(const StImagePlane& theDataSrc,
 
     // check if data is upside-down
     size_t aRowSrcTop = theDataSrc.isTopDown() ? 0 : (theDataSrc.getSizeY() - 1);
+    const ptrdiff_t aRowInc = theDataSrc.isTopDown() ? 1 : -1;
 
     // copy Left view (1 big tile at top-left corner)
-    const size_t aRowInc = theDataSrc.isTopDown() ? 1 : size_t(-1);
-    size_t aRowTo  = 0;
-    size_t aRowSrc = aRowSrcTop;
-    for(; aRowTo < aCopyRows; ++aRowTo, aRowSrc += aRowInc) {
-        stMemCpy(theDataOutL.changeData(aRowTo, 0),
-                 theDataSrc.getData(aRowSrc, 0),
-                 aCopyRowBytes);
-    }
+    copyPlaneRows(theDataOutL, 0, 0, theDataSrc, aRowSrcTop, 0, aRowInc, aCopyRowBytes, aCopyRows);
 
     // copy Right view (first half-width tile at top-right
     aCopyRowBytes = (aDataSizeX / 2) * theDataOutL.getSizePixelBytes();
-    aRowTo  = 0;
-    aRowSrc = aRowSrcTop;
-    for(; aRowTo < aCopyRows; ++aRowTo, aRowSrc += aRowInc) {
-        stMemCpy(theDataOutR.changeData(aRowTo, 0),
-                 theDataSrc.getData(aRowSrc, aDataSizeX),
-                 aCopyRowBytes);
-    }
+    copyPlaneRows(theDataOutR, 0, 0, theDataSrc, aRowSrcTop, aDataSizeX, aRowInc, aCopyRowBytes, aCopyRows);
 
     // copy Right view (first 0.25 tile at bottom-left)
     aCopyRows = aDataSizeY / 2;
     aRowSrcTop = theDataSrc.isTopDown() ? aDataSizeY : (theDataSrc.getSizeY() - aDataSizeY);
-    aRowTo  = 0;
-    aRowSrc = aRowSrcTop;
-    for(; aRowTo < aCopyRows; ++aRowTo, aRowSrc += aRowInc) {
-        stMemCpy(theDataOutR.changeData(aRowTo, aDataSizeXHalf),
-                 theDataSrc.getData(aRowSrc, 0),
-                 aCopyRowBytes);
-    }
+    copyPlaneRows(theDataOutR, 0, aDataSizeXHalf, theDataSrc, aRowSrcTop, 0, aRowInc, aCopyRowBytes, aCopyRows);
 
     // copy Right view (second 0.25 tile at bottom)
-    aRowTo  = aCopyRows;
-    aRowSrc = aRowSrcTop;
-    aCopyRows += aCopyRows;
-    for(; aRowTo < aCopyRows; ++aRowTo, aRowSrc += aRowInc) {
-        stMemCpy(theDataOutR.changeData(aRowTo, aDataSizeXHalf),
-                 theDataSrc.getData(aRowSrc, aDataSizeXHalf),
-                 aCopyRowBytes);
-    }
+    copyPlaneRows(theDataOutR, aCopyRows, aDataSizeXHalf, theDataSrc, aRowSrcTop, aDataSizeXHalf, aRowInc, aCopyRowBytes, aCopyRows);
 
     return &theDataOutPtr[2 * theDataOutL.getSizeBytes()];
 }
@@ -269,19 +281,14 @@ static GLubyte* readFromMono(const StImagePlane& theSrc,
                         theSrc.getSizeX(), theSrc.getSizeY(),
                         anOutRowBytes);
 
-    if(theData.getSizeRowBytes() == theSrc.getSizeRowBytes() && theSrc.isTopDown()) {
-        // perform fat copy
-        stMemCpy(theData.changeData(), theSrc.getData(),
-                 stMin(theData.getSizeBytes(), theSrc.getSizeBytes()));
-    } else {
-        const size_t aCopyRows     = stMin(theData.getSizeY(), theSrc.getSizeY());
-        const size_t aCopyRowBytes = stMin(theData.getSizeX(), theSrc.getSizeX()) * theData.getSizePixelBytes();
-        const size_t aRowInc       = theSrc.isTopDown() ? 1 : size_t(-1);
-        size_t       aRowTo        = theSrc.isTopDown() ? 0 : (aCopyRows - 1);
-        for(size_t aRowFrom = 0; aRowFrom < aCopyRows; ++aRowFrom, aRowTo += aRowInc) {
-            stMemCpy(theData.changeData(aRowTo, 0), theSrc.getData(aRowFrom, 0), aCopyRowBytes);
-        }
-    }
+    // equal strides are copied as continuous block
+    const size_t    aCopyRows     = stMin(theData.getSizeY(), theSrc.getSizeY());
+    const size_t    aCopyRowBytes = theData.getSizeRowBytes() == theSrc.getSizeRowBytes() && theSrc.isTopDown()
+                                  ? theData.getSizeRowBytes()
+                                  : stMin(theData.getSizeX(), theSrc.getSizeX()) * theData.getSizePixelBytes();
+    const size_t    aRowFrom      = theSrc.isTopDown() ? 0 : (aCopyRows - 1);
+    const ptrdiff_t aRowInc       = theSrc.isTopDown() ? 1 : -1;
+    copyPlaneRows(theData, 0, 0, theSrc, aRowFrom, 0, aRowInc, aCopyRowBytes, aCopyRows);
     return &theDataPtr[theData.getSizeBytes()];
 }
 
@@ -561,6 +568,19 @@ void StGLTextureData::updateData(const StGLDeviceCaps&           theDeviceCaps,
             }
             break;
         }
+        case StFormat_Columns: {
+            myDataL.setPixelRatio(theDataL.getPixelRatio() * 2.0f);
+            myDataR.setPixelRatio(theDataL.getPixelRatio() * 2.0f);
+            GLubyte* aDataDispl = myDataPtr;
+            // each plane is split on its own columns, so for horizontally subsampled chroma (yuv422p, yuv420p)
+            // every chroma sample is shared by one left and one right column and views get blended colors;
+            // column-interlaced sources are expected to be stored without chroma subsampling
+            for(size_t aPlaneId = 0; aPlaneId < 4; ++aPlaneId) {
+                aDataDispl = readFromColumnInterlace(theDataL.getPlane(aPlaneId), aDataDispl,
+                                                     myDataL.changePlane(aPlaneId), myDataR.changePlane(aPlaneId));
+            }
+            break;
+        }
         case StFormat_FrameSequence:
         case StFormat_SeparateFrames: {
             myDataR.setColorModel(theDataR.getColorModel());
@@ -585,7 +605,6 @@ void StGLTextureData::updateData(const StGLDeviceCaps&           theDeviceCaps,
         case StFormat_AnaglyphRedCyan:
         case StFormat_AnaglyphGreenMagenta:
         case StFormat_AnaglyphYellowBlue:
-        case StFormat_Columns: // not supported
         case StFormat_Mono:
         default: {
             GLubyte* aDataDispl = myDataPtr;
@@ -882,15 +901,84 @@ static void prepareTextures(StGLContext&       theCtx,
     }
 }
 
+void StGLTextureData::fillTextureView(StGLContext&     theCtx,
+                                      StGLQuadTexture& theQTexture) {
+    StGLTextureUploadParams& aParams = *myUploadParams;
+    const unsigned aFrame  = aParams.ViewFrameCounter++;
+    const unsigned aPeriod = unsigned(aParams.ViewRefreshPeriod) | 1; // odd period to refresh both front and back textures
+    for(int aBandIter = 0; aBandIter < StGLTextureUploadParams::VIEW_TILES_Y; ++aBandIter) {
+        uint32_t aMask = aParams.ViewTiles[aBandIter];
+        if((aFrame + unsigned(aBandIter)) % aPeriod == 0) {
+            aMask = 0xFFFFFFFF; // refresh the whole band out of view
+        }
+
+        for(int aTileFrom = 0; aTileFrom < StGLTextureUploadParams::VIEW_TILES_X;) {
+            if((aMask & (uint32_t(1) << aTileFrom)) == 0) {
+                ++aTileFrom;
+                continue;
+            }
+
+            // upload a run of neighboring tiles at once
+            int aTileTo = aTileFrom + 1;
+            for(; aTileTo < StGLTextureUploadParams::VIEW_TILES_X && (aMask & (uint32_t(1) << aTileTo)) != 0; ++aTileTo) {}
+            for(size_t aViewIter = 0; aViewIter < 2; ++aViewIter) {
+                StGLFrameTextures& aTextures = theQTexture.getBack(aViewIter == 0 ? StGLQuadTexture::LEFT_TEXTURE : StGLQuadTexture::RIGHT_TEXTURE);
+                const StImage&     anImage   = aViewIter == 0 ? myDataL : myDataR;
+                if(!aTextures.isValid()) {
+                    continue;
+                }
+
+                for(size_t aPlaneId = 0; aPlaneId < 4; ++aPlaneId) {
+                    const StImagePlane& aPlane   = anImage.getPlane(aPlaneId);
+                    StGLFrameTexture&   aTexture = aTextures.getPlane(aPlaneId);
+                    if(aPlane.isNull() || !aTexture.isValid()) {
+                        continue;
+                    }
+
+                    const GLsizei aSizeX = GLsizei(aPlane.getSizeX());
+                    const GLsizei aSizeY = GLsizei(aPlane.getSizeY());
+                    aTexture.fillPatch(theCtx, aPlane, GL_TEXTURE_2D,
+                                       aSizeY *  aBandIter      / StGLTextureUploadParams::VIEW_TILES_Y,
+                                       aSizeY * (aBandIter + 1) / StGLTextureUploadParams::VIEW_TILES_Y,
+                                       aSizeX * aTileFrom / StGLTextureUploadParams::VIEW_TILES_X,
+                                       aSizeX * aTileTo   / StGLTextureUploadParams::VIEW_TILES_X,
+                                       0);
+                }
+            }
+            aTileFrom = aTileTo;
+        }
+    }
+}
+
 bool StGLTextureData::fillTexture(StGLContext&     theCtx,
                                   StGLQuadTexture& theQTexture) {
 
     // setup rows count to be filled per fillTexture()
     if(myFillRows == 0 || myFillFromRow == 0) {
         // prepare textures for new data
+        StGLTexture& aTexL = theQTexture.getBack(StGLQuadTexture::LEFT_TEXTURE ).getPlane(0);
+        StGLTexture& aTexR = theQTexture.getBack(StGLQuadTexture::RIGHT_TEXTURE).getPlane(0);
+        const GLuint  aTexIdsOld[2]   = { aTexL.getTextureId(), aTexR.getTextureId() };
+        const GLsizei aTexSizesOld[2] = { aTexL.getSizeX() * aTexL.getSizeY(), aTexR.getSizeX() * aTexR.getSizeY() };
         prepareTextures(theCtx, myDataL, myCubemapFormat, theQTexture.getBack(StGLQuadTexture::LEFT_TEXTURE));
         prepareTextures(theCtx, myDataR, myCubemapFormat, theQTexture.getBack(StGLQuadTexture::RIGHT_TEXTURE));
 
+        // view-dependent uploading is possible only into texture holding previous frame of the same size
+        StGLTextureUploadParams& aParams = *myUploadParams;
+        if(aTexIdsOld[0]   != aTexL.getTextureId()
+        || aTexIdsOld[1]   != aTexR.getTextureId()
+        || aTexSizesOld[0] != aTexL.getSizeX() * aTexL.getSizeY()
+        || aTexSizesOld[1] != aTexR.getSizeX() * aTexR.getSizeY()
+        || myCubemapFormat != StCubemap_OFF
+        || !aParams.HasViewTiles
+        ||  aParams.ViewRefreshPeriod <= 0) {
+            aParams.invalidateView();
+        }
+        myToCullView = aParams.ViewFullUploads <= 0;
+        if(!myToCullView) {
+            --aParams.ViewFullUploads;
+        }
+
         // remove links to old stereo parameters
         theQTexture.getBack(StGLQuadTexture::LEFT_TEXTURE).setSource(StHandle<StStereoParams>());
         theQTexture.getBack(StGLQuadTexture::RIGHT_TEXTURE).setSource(StHandle<StStereoParams>());
@@ -926,6 +1014,8 @@ bool StGLTextureData::fillTexture(StGLContext&     theCtx,
         myFillRows = (aNbIters > 0) ? (aNbMaxRows / aNbIters) : aNbMaxRows;
         if(myCubemapFormat == StCubemap_Packed || myCubemapFormat == StCubemap_PackedEAC) {
             myFillRows = INT_MAX; /// TODO handle cube maps incremental updates specificall
+        } else if(myToCullView) {
+            myFillRows = INT_MAX; // visible tiles are uploaded at once
         }
         myFillFromRow = 0;
     }
@@ -935,18 +1025,22 @@ bool StGLTextureData::fillTexture(StGLContext&     theCtx,
         return true;
     }
 
-    if(theQTexture.getBack(StGLQuadTexture::LEFT_TEXTURE).isValid()) {
-        for(size_t aPlaneId = 0; aPlaneId < 4; ++aPlaneId) {
-            fillTexture(theCtx,
-                        theQTexture.getBack(StGLQuadTexture::LEFT_TEXTURE).getPlane(aPlaneId),
-                        myDataL.getPlane(aPlaneId));
+    if(myToCullView) {
+        fillTextureView(theCtx, theQTexture);
+    } else {
+        if(theQTexture.getBack(StGLQuadTexture::LEFT_TEXTURE).isValid()) {
+            for(size_t aPlaneId = 0; aPlaneId < 4; ++aPlaneId) {
+                fillTexture(theCtx,
+                            theQTexture.getBack(StGLQuadTexture::LEFT_TEXTURE).getPlane(aPlaneId),
+                            myDataL.getPlane(aPlaneId));
+            }
         }
-    }
-    if(theQTexture.getBack(StGLQuadTexture::RIGHT_TEXTURE).isValid()) {
-        for(size_t aPlaneId = 0; aPlaneId < 4; ++aPlaneId) {
-            fillTexture(theCtx,
-                        theQTexture.getBack(StGLQuadTexture::RIGHT_TEXTURE).getPlane(aPlaneId),
-                        myDataR.getPlane(aPlaneId));
+        if(theQTexture.getBack(StGLQuadTexture::RIGHT_TEXTURE).isValid()) {
+            for(size_t aPlaneId = 0; aPlaneId < 4; ++aPlaneId) {
+                fillTexture(theCtx,
+                            theQTexture.getBack(StGLQuadTexture::RIGHT_TEXTURE).getPlane(aPlaneId),
+                            myDataR.getPlane(aPlaneId));
+            }
         }
     }
     theQTexture.getBack(StGLQuadTexture::LEFT_TEXTURE).unbind(theCtx);
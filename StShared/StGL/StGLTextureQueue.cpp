@@ -1,5 +1,5 @@
 /**
- * Copyright © 2009-2016 Kirill Gavrilov <kirill@sview.ru>
+ * Copyright © 2009-2026 Kirill Gavrilov <kirill@sview.ru>
  *
  * This code is licensed under MIT license (see docs/license-mit.txt for details).
  */
@@ -7,6 +7,7 @@
 #include <StGLStereo/StGLTextureQueue.h>
 
 #include <StGL/StGLContext.h>
+#include <StThreads/StProfiler.h>
 
 StGLTextureQueue::StGLTextureQueue(const size_t theQueueSizeMax)
 : myDataFront(NULL),
@@ -21,6 +22,7 @@ StGLTextureQueue::StGLTextureQueue(const size_t theQueueSizeMax)
   myIsInUpdTexture(false),
   myIsReadyToSwap(false),
   myToCompress(false),
+  myToReclaim(false),
   myHasStream(false),
   myUploadParams(new StGLTextureUploadParams()) {
     ST_ASSERT(myQueueSizeMax >= 2, "StGLTextureQueue() - queue size limit should be >= 2");
@@ -41,9 +43,13 @@ StGLTextureQueue::StGLTextureQueue(const size_t theQueueSizeMax)
     }
     iter->setNext(myDataFront); // data in loop
     myDataBack = myDataFront;
+
+    // texture buffers are the first candidates for releasing
+    StMemoryBudget::GetDefault().addReclaimer(this, 0);
 }
 
 StGLTextureQueue::~StGLTextureQueue() {
+    StMemoryBudget::GetDefault().removeReclaimer(this);
     for(size_t anIter = 0; anIter < myQueueSizeMax; ++anIter) {
         StGLTextureData* aRemItem = myDataFront;
         myDataFront = myDataFront->getNext();
@@ -55,6 +61,26 @@ void StGLTextureQueue::setCompressMemory(const bool theToCompress) {
     myToCompress = theToCompress;
 }
 
+size_t StGLTextureQueue::reclaimMemory(const size_t ) {
+    // might be called from push() within locked context - just schedule releasing
+    myToReclaim = true;
+    return 0;
+}
+
+void StGLTextureQueue::releaseIdle() {
+    myMutexSize.lock();
+    StGLTextureData* aData = myDataFront;
+    for(size_t anIter = 0; anIter < myQueueSizeMax; ++anIter, aData = aData->getNext()) {
+        if(anIter >= myQueueSize
+        && aData != myDataSnap
+        && aData->hasData()) {
+            aData->reset();
+        }
+    }
+    myToReclaim = false;
+    myMutexSize.unlock();
+}
+
 // this function called ONLY from image thread
 bool StGLTextureQueue::push(const StImage&     theSrcDataLeft,
                             const StImage&     theSrcDataRight,
@@ -99,7 +125,7 @@ int StGLTextureQueue::swapFBOnReady(StGLContext& theCtx) {
         mySwapFBMutex.unlock();
 
         myQTexture.swapFB();
-        if(myToCompress) {
+        if(toCompressMemory()) {
             myQTexture.getBack(StGLQuadTexture::LEFT_TEXTURE ).release(theCtx);
             myQTexture.getBack(StGLQuadTexture::RIGHT_TEXTURE).release(theCtx);
         }
@@ -116,6 +142,7 @@ int StGLTextureQueue::swapFBOnReady(StGLContext& theCtx) {
 
 // this function called ONLY from plugin thread
 bool StGLTextureQueue::stglUpdateStTextures(StGLContext& theCtx) {
+    ST_PROFILER_ZONE("StGLTextureQueue::stglUpdateStTextures");
     int aSwapState = swapFBOnReady(theCtx);
     if(aSwapState == SWAPONREADY_WAITLIM) {
         return false;
@@ -125,6 +152,13 @@ bool StGLTextureQueue::stglUpdateStTextures(StGLContext& theCtx) {
         return aSwapState == SWAPONREADY_SWAPPED;
     }
 
+    // release memory requested by budget, unless push is in progress
+    if(myToReclaim
+    && myMutexPush.tryLock()) {
+        releaseIdle();
+        myMutexPush.unlock();
+    }
+
     // do we already in update cycle?
     if(!myIsInUpdTexture) {
         // check event from video thread
@@ -148,7 +182,7 @@ bool StGLTextureQueue::stglUpdateStTextures(StGLContext& theCtx) {
         myMutexSize.lock();
             myCurrPts   = myDataFront->getPTS();
             myDataSnap  = myDataFront; myNewShotEvent.set();
-            if(myToCompress) {
+            if(toCompressMemory()) {
                 myDataFront->reset();
             }
             myDataFront = myDataFront->getNext();
@@ -186,6 +220,8 @@ void StGLTextureQueue::clear() {
         myIsReadyToSwap = false; // invalidate currently uploaded image in back buffer
         // empty texture update sequence
         myIsInUpdTexture = false;
+        // textures should not keep panorama tiles out of view from the previous position
+        myUploadParams->invalidateView();
     mySwapFBMutex.unlock();
     myMutexSize.unlock();
     myMutexPush.unlock();
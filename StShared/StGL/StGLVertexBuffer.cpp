@@ -27,6 +27,7 @@ StGLVertexBuffer::~StGLVertexBuffer() {
 void StGLVertexBuffer::release(StGLContext& theCtx) {
     if(isValid()) {
         theCtx.core20fwd->glDeleteBuffers(1, &myBufferId);
+        theCtx.stglOnDeleteBuffer(myBufferId);
         myBufferId = 0;
         myElemSize = 0;
     }
@@ -93,13 +94,13 @@ bool StGLVertexBuffer::init(StGLContext& theCtx) {
 
 void StGLVertexBuffer::bind(StGLContext& theCtx) const {
     if(isValid()) {
-        theCtx.core20fwd->glBindBuffer(getTarget(), myBufferId);
+        theCtx.stglBindBuffer(getTarget(), myBufferId);
     }
 }
 
 void StGLVertexBuffer::unbind(StGLContext& theCtx) const {
     if(isValid()) {
-        theCtx.core20fwd->glBindBuffer(getTarget(), 0);
+        theCtx.stglBindBuffer(getTarget(), 0);
     }
 }
 
@@ -173,7 +174,7 @@ void StGLVertexBuffer::bindVertexAttrib(StGLContext&    theCtx,
                                         StGLVarLocation theAttribLoc) const {
     if(isValid() && theAttribLoc.isValid()) {
         bind(theCtx);
-        theCtx.core20fwd->glEnableVertexAttribArray(theAttribLoc);
+        theCtx.stglSetVertexAttribArray(theAttribLoc, true);
         theCtx.core20fwd->glVertexAttribPointer(theAttribLoc, GLint(getElemSize()), getDataType(), GL_FALSE, 0, NULL);
     }
 }
@@ -181,7 +182,7 @@ void StGLVertexBuffer::bindVertexAttrib(StGLContext&    theCtx,
 void StGLVertexBuffer::unBindVertexAttrib(StGLContext&    theCtx,
                                           StGLVarLocation theAttribLoc) const {
     if(isValid() && theAttribLoc.isValid()) {
-        theCtx.core20fwd->glDisableVertexAttribArray(theAttribLoc);
+        theCtx.stglSetVertexAttribArray(theAttribLoc, false);
         unbind(theCtx);
     }
 }
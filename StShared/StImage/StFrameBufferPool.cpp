@@ -0,0 +1,274 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * This code is licensed under MIT license (see docs/license-mit.txt for details).
+ */
+
+#include <StImage/StFrameBufferPool.h>
+
+#include <StTemplates/StTemplates.h>
+
+#if defined(__linux__)
+    #include <sys/mman.h>
+#endif
+
+const size_t StFrameBufferPool::THE_ALIGNMENT;
+const size_t StFrameBufferPool::THE_MIN_POOLED_SIZE;
+const size_t StFrameBufferPool::THE_HUGE_PAGE_SIZE;
+
+namespace {
+
+    static const size_t THE_MIB = 1024 * 1024;
+
+    /**
+     * Block header preceding the data, occupies THE_ALIGNMENT bytes to keep data aligned.
+     */
+    struct BlockHeader {
+        size_t Size; //!< usable size of the block (size class)
+    };
+
+    /**
+     * Return the header of the block.
+     */
+    inline BlockHeader* blockHeader(const void* thePtr) {
+        return (BlockHeader* )((uint8_t* )thePtr - StFrameBufferPool::THE_ALIGNMENT);
+    }
+
+    /**
+     * Allocate new block from the heap.
+     * Large blocks start at huge page boundary, so that the data (following the header) occupies the minimal number of huge pages.
+     * @param theIsHuge set to TRUE if huge pages have been requested
+     */
+    static void* allocateBlock(const size_t theSize,
+                               bool&        theIsHuge) {
+        const size_t aRawSize = theSize + StFrameBufferPool::THE_ALIGNMENT;
+        size_t anAlign = StFrameBufferPool::THE_ALIGNMENT;
+        theIsHuge = false;
+    #if defined(__linux__)
+        // other systems either do not provide transparent huge pages
+        // or would waste alignment padding on each block (_aligned_malloc)
+        if(aRawSize >= StFrameBufferPool::THE_HUGE_PAGE_SIZE) {
+            anAlign   = StFrameBufferPool::THE_HUGE_PAGE_SIZE;
+            theIsHuge = true;
+        }
+    #endif
+
+        uint8_t* aRaw = stMemAllocAligned<uint8_t*>(aRawSize, anAlign);
+        if(aRaw == NULL) {
+            return NULL;
+        }
+    #if defined(__linux__) && defined(MADV_HUGEPAGE)
+        if(theIsHuge) {
+            // hint applies only to complete huge pages within the block
+            const size_t aHugeSize = aRawSize / StFrameBufferPool::THE_HUGE_PAGE_SIZE * StFrameBufferPool::THE_HUGE_PAGE_SIZE;
+            ::madvise(aRaw, aHugeSize, MADV_HUGEPAGE);
+        }
+    #endif
+
+        ((BlockHeader* )aRaw)->Size = theSize;
+        return aRaw + StFrameBufferPool::THE_ALIGNMENT;
+    }
+
+    /**
+     * Return the block to the heap.
+     */
+    inline void freeBlock(void* thePtr) {
+        stMemFreeAligned(blockHeader(thePtr));
+    }
+
+}
+
+StFrameBufferPool& StFrameBufferPool::GetDefault() {
+    // intentionally never destroyed - image planes within static objects might be released after exit()
+    static StFrameBufferPool* THE_DEFAULT_POOL = new StFrameBufferPool(stMax(StMemoryBudget::GetDefault().getLimit() / 8, 64 * THE_MIB));
+    return *THE_DEFAULT_POOL;
+}
+
+size_t StFrameBufferPool::getSizeClass(const size_t theNbBytes) {
+    if(theNbBytes < THE_MIN_POOLED_SIZE) {
+        return getAligned(stMax(theNbBytes, size_t(1)), THE_ALIGNMENT);
+    }
+
+    // 8 classes per power of two
+    size_t aPow2 = THE_MIN_POOLED_SIZE;
+    while(aPow2 <= theNbBytes / 2) {
+        aPow2 *= 2;
+    }
+    const size_t aStep = aPow2 / 8;
+    return (theNbBytes + aStep - 1) / aStep * aStep;
+}
+
+size_t StFrameBufferPool::getBlockSize(const void* thePtr) {
+    return thePtr != NULL ? blockHeader(thePtr)->Size : 0;
+}
+
+StFrameBufferPool::StFrameBufferPool(const size_t theMaxPooledBytes)
+: myMaxPooledBytes(theMaxPooledBytes) {
+    // retained blocks are released after unused texture buffers
+    StMemoryBudget::GetDefault().addReclaimer(this, 1);
+}
+
+StFrameBufferPool::~StFrameBufferPool() {
+    StMemoryBudget::GetDefault().removeReclaimer(this);
+    trim();
+}
+
+void* StFrameBufferPool::allocate(const size_t theNbBytes) {
+    if(theNbBytes == 0) {
+        return NULL;
+    }
+
+    const size_t aSize = getSizeClass(theNbBytes);
+    void* aPtr = NULL;
+    bool isReused = false;
+    bool isHuge   = false;
+    myMutex.lock();
+    ++myStats.NbRequests;
+    if(aSize >= THE_MIN_POOLED_SIZE) {
+        std::map< size_t, std::vector<void*> >::iterator aBucket = myPooled.find(aSize);
+        if(aBucket != myPooled.end()
+        && !aBucket->second.empty()) {
+            aPtr = aBucket->second.back();
+            aBucket->second.pop_back();
+            myStats.BytesPooled -= aSize;
+            ++myStats.NbReused;
+            isReused = true;
+        }
+    }
+    myMutex.unlock();
+
+    if(isReused) {
+        StMemoryBudget::GetDefault().release(StMemoryBudget::Subsystem_Pool, aSize);
+    } else {
+        aPtr = allocateBlock(aSize, isHuge);
+        if(aPtr == NULL) {
+            return NULL;
+        }
+    }
+
+    myMutex.lock();
+    if(!isReused) {
+        ++myStats.NbAllocated;
+        if(isHuge) {
+            ++myStats.NbHuge;
+        }
+    }
+    myStats.BytesInUse += aSize;
+    myStats.BytesPeak   = stMax(myStats.BytesPeak, myStats.BytesInUse);
+    myMutex.unlock();
+    return aPtr;
+}
+
+void StFrameBufferPool::release(void* thePtr) {
+    if(thePtr == NULL) {
+        return;
+    }
+
+    const size_t aSize = getBlockSize(thePtr);
+    myMutex.lock();
+    myStats.BytesInUse -= stMin(myStats.BytesInUse, aSize);
+    bool toRetain = aSize >= THE_MIN_POOLED_SIZE
+                 && myStats.BytesPooled + aSize <= myMaxPooledBytes;
+    myMutex.unlock();
+
+    if(toRetain) {
+        // charge the budget before the block becomes visible to allocate();
+        // might call reclaimMemory() - should be done without lock
+        StMemoryBudget& aBudget = StMemoryBudget::GetDefault();
+        toRetain = aBudget.allocate(StMemoryBudget::Subsystem_Pool, aSize);
+        if(toRetain) {
+            myMutex.lock();
+            toRetain = myStats.BytesPooled + aSize <= myMaxPooledBytes;
+            if(toRetain) {
+                myPooled[aSize].push_back(thePtr);
+                myStats.BytesPooled += aSize;
+            }
+            myMutex.unlock();
+        }
+        if(!toRetain) {
+            // roll back - limit is exceeded even after reclaiming
+            aBudget.release(StMemoryBudget::Subsystem_Pool, aSize);
+        }
+    }
+    if(toRetain) {
+        return;
+    }
+
+    myMutex.lock();
+    ++myStats.NbFreed;
+    myMutex.unlock();
+    freeBlock(thePtr);
+}
+
+size_t StFrameBufferPool::detachPooled(const size_t         theBytes,
+                                       std::vector<void*>& theBlocks) {
+    size_t aDetached = 0;
+    for(std::map< size_t, std::vector<void*> >::reverse_iterator aBucket = myPooled.rbegin();
+        aBucket != myPooled.rend() && aDetached < theBytes; ++aBucket) {
+        while(!aBucket->second.empty() && aDetached < theBytes) {
+            theBlocks.push_back(aBucket->second.back());
+            aBucket->second.pop_back();
+            aDetached += aBucket->first;
+        }
+    }
+    myStats.BytesPooled -= stMin(myStats.BytesPooled, aDetached);
+    myStats.NbFreed     += theBlocks.size();
+    return aDetached;
+}
+
+void StFrameBufferPool::freeBlocks(const std::vector<void*>& theBlocks,
+                                   const size_t              theSizeBytes) {
+    for(std::vector<void*>::const_iterator aBlockIter = theBlocks.begin(); aBlockIter != theBlocks.end(); ++aBlockIter) {
+        freeBlock(*aBlockIter);
+    }
+    StMemoryBudget::GetDefault().release(StMemoryBudget::Subsystem_Pool, theSizeBytes);
+}
+
+void StFrameBufferPool::trim() {
+    std::vector<void*> aBlocks;
+    myMutex.lock();
+    const size_t aSize = detachPooled(size_t(-1), aBlocks);
+    myPooled.clear();
+    myMutex.unlock();
+    freeBlocks(aBlocks, aSize);
+}
+
+void StFrameBufferPool::setMaxPooledBytes(const size_t theMaxPooledBytes) {
+    std::vector<void*> aBlocks;
+    myMutex.lock();
+    myMaxPooledBytes = theMaxPooledBytes;
+    const size_t aSize = myStats.BytesPooled > myMaxPooledBytes
+                       ? detachPooled(myStats.BytesPooled - myMaxPooledBytes, aBlocks)
+                       : 0;
+    myMutex.unlock();
+    freeBlocks(aBlocks, aSize);
+}
+
+size_t StFrameBufferPool::reclaimMemory(const size_t theBytes) {
+    std::vector<void*> aBlocks;
+    myMutex.lock();
+    const size_t aSize = detachPooled(theBytes, aBlocks);
+    myMutex.unlock();
+    freeBlocks(aBlocks, aSize);
+    return aSize;
+}
+
+StFrameBufferPool::Stats StFrameBufferPool::getStats() const {
+    myMutex.lock();
+    const Stats aStats = myStats;
+    myMutex.unlock();
+    return aStats;
+}
+
+StString StFrameBufferPool::formatStats() const {
+    const Stats aStats = getStats();
+    char aBuff[256];
+    stsprintf(aBuff, sizeof(aBuff),
+              "%.1f MiB in use (peak %.1f MiB), %.1f of %.1f MiB retained\n"
+              "%u requests, %u reused, %u allocated (%u with huge pages), %u freed",
+              double(aStats.BytesInUse)  / double(THE_MIB), double(aStats.BytesPeak)  / double(THE_MIB),
+              double(aStats.BytesPooled) / double(THE_MIB), double(myMaxPooledBytes)  / double(THE_MIB),
+              (unsigned int )aStats.NbRequests, (unsigned int )aStats.NbReused,
+              (unsigned int )aStats.NbAllocated, (unsigned int )aStats.NbHuge, (unsigned int )aStats.NbFreed);
+    return StString(aBuff);
+}
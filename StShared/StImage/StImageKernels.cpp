@@ -0,0 +1,826 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * This code is licensed under MIT license (see docs/license-mit.txt for details).
+ */
+
+#include <StImage/StImageKernels.h>
+
+#include <StThreads/StThreadPool.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define ST_HAVE_SSE2
+    #include <emmintrin.h>
+    #if defined(_MSC_VER)
+        #define ST_HAVE_AVX2
+        #define ST_ATTR_AVX2
+        #include <intrin.h>
+        #include <immintrin.h>
+    #elif (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))) || defined(__clang__)
+        #define ST_HAVE_AVX2
+        #define ST_ATTR_AVX2 __attribute__((target("avx2")))
+        #include <immintrin.h>
+    #endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #define ST_HAVE_NEON
+    #include <arm_neon.h>
+#endif
+
+namespace {
+
+    /**
+     * Frames smaller than this size are processed by calling thread only.
+     */
+    static const size_t THE_PARALLEL_BYTES = 2 * 1024 * 1024;
+
+    /**
+     * Minimal amount of data processed by one thread at once.
+     */
+    static const size_t THE_CHUNK_BYTES = 256 * 1024;
+
+    /**
+     * Transposition block size in bytes (per row), so that block of source and destination fits into L1 cache.
+     */
+    static const size_t THE_TRANSPOSE_BLOCK_BYTES = 64;
+
+    static volatile int  THE_SIMD_LEVEL     = -1;
+    static volatile bool THE_TO_USE_THREADS = true;
+
+    /**
+     * Detect instruction set supported by CPU.
+     */
+    static StImageKernels::SimdLevel detectSimdLevel() {
+    #if defined(ST_HAVE_AVX2) && defined(_MSC_VER)
+        int aRegs[4] = { 0, 0, 0, 0 };
+        __cpuid(aRegs, 0);
+        if(aRegs[0] >= 7) {
+            __cpuid(aRegs, 1);
+            const bool hasOsXSave = (aRegs[2] & (1 << 27)) != 0;
+            const bool hasAvx     = (aRegs[2] & (1 << 28)) != 0;
+            __cpuidex(aRegs, 7, 0);
+            const bool hasAvx2    = (aRegs[1] & (1 <<  5)) != 0;
+            if(hasOsXSave && hasAvx && hasAvx2
+            && (_xgetbv(0) & 0x6) == 0x6) {
+                return StImageKernels::SimdLevel_AVX2;
+            }
+        }
+        return StImageKernels::SimdLevel_SSE2;
+    #elif defined(ST_HAVE_AVX2)
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") ? StImageKernels::SimdLevel_AVX2 : StImageKernels::SimdLevel_SSE2;
+    #elif defined(ST_HAVE_SSE2)
+        return StImageKernels::SimdLevel_SSE2;
+    #elif defined(ST_HAVE_NEON)
+        return StImageKernels::SimdLevel_NEON;
+    #else
+        return StImageKernels::SimdLevel_Scalar;
+    #endif
+    }
+
+    /**
+     * Return current instruction set.
+     */
+    inline StImageKernels::SimdLevel simdLevel() {
+        if(THE_SIMD_LEVEL < 0) {
+            THE_SIMD_LEVEL = StImageKernels::getSimdLevelMax();
+        }
+        return (StImageKernels::SimdLevel )THE_SIMD_LEVEL;
+    }
+
+    /**
+     * Split job between threads of default pool for large frames.
+     */
+    static void performRows(StThreadPool::JobFunction theFunction,
+                            void*                     theJob,
+                            const size_t              theNbRows,
+                            const size_t              theRowBytes) {
+        if(!THE_TO_USE_THREADS
+        || theNbRows * theRowBytes < THE_PARALLEL_BYTES) {
+            theFunction(theJob, 0, theNbRows);
+            return;
+        }
+
+        const size_t aMinRows = stMax(THE_CHUNK_BYTES / stMax(theRowBytes, size_t(1)), size_t(1));
+        StThreadPool::GetDefault().perform(theFunction, theJob, theNbRows, aMinRows);
+    }
+
+    /**
+     * Pixel of fixed size.
+     */
+    template<size_t N> struct StPixelBytes {
+        uint8_t Bytes[N];
+    };
+
+    /**
+     * Generic column split.
+     */
+    template<size_t N>
+    inline void splitColumnsRowT(uint8_t*       theDstEven,
+                                 uint8_t*       theDstOdd,
+                                 const uint8_t* theSrc,
+                                 const size_t   theNbPairs) {
+        typedef StPixelBytes<N> Pixel;
+        const Pixel* aSrc  = (const Pixel* )theSrc;
+        Pixel*       aEven = (Pixel* )theDstEven;
+        Pixel*       aOdd  = (Pixel* )theDstOdd;
+        for(size_t aPairIter = 0; aPairIter < theNbPairs; ++aPairIter) {
+            aEven[aPairIter] = aSrc[aPairIter * 2];
+            aOdd [aPairIter] = aSrc[aPairIter * 2 + 1];
+        }
+    }
+
+    inline void splitColumnsRowAny(uint8_t*       theDstEven,
+                                   uint8_t*       theDstOdd,
+                                   const uint8_t* theSrc,
+                                   const size_t   theNbPairs,
+                                   const size_t   thePixelSize) {
+        for(size_t aPairIter = 0; aPairIter < theNbPairs; ++aPairIter) {
+            stMemCpy(theDstEven + aPairIter * thePixelSize, theSrc + (aPairIter * 2)     * thePixelSize, thePixelSize);
+            stMemCpy(theDstOdd  + aPairIter * thePixelSize, theSrc + (aPairIter * 2 + 1) * thePixelSize, thePixelSize);
+        }
+    }
+
+#if defined(ST_HAVE_SSE2)
+    static size_t splitColumnsRow8SSE2(uint8_t*       theDstEven,
+                                       uint8_t*       theDstOdd,
+                                       const uint8_t* theSrc,
+                                       const size_t   theNbPairs) {
+        const __m128i aMask = _mm_set1_epi16(0x00FF);
+        size_t aPairIter = 0;
+        for(; aPairIter + 16 <= theNbPairs; aPairIter += 16) {
+            const __m128i aSrc0 = _mm_loadu_si128((const __m128i* )(theSrc + aPairIter * 2));
+            const __m128i aSrc1 = _mm_loadu_si128((const __m128i* )(theSrc + aPairIter * 2 + 16));
+            _mm_storeu_si128((__m128i* )(theDstEven + aPairIter),
+                             _mm_packus_epi16(_mm_and_si128(aSrc0, aMask), _mm_and_si128(aSrc1, aMask)));
+            _mm_storeu_si128((__m128i* )(theDstOdd  + aPairIter),
+                             _mm_packus_epi16(_mm_srli_epi16(aSrc0, 8), _mm_srli_epi16(aSrc1, 8)));
+        }
+        return aPairIter;
+    }
+
+    static size_t splitColumnsRow16SSE2(uint8_t*       theDstEven,
+                                        uint8_t*       theDstOdd,
+                                        const uint8_t* theSrc,
+                                        const size_t   theNbPairs) {
+        size_t aPairIter = 0;
+        for(; aPairIter + 8 <= theNbPairs; aPairIter += 8) {
+            __m128i aSrc0 = _mm_loadu_si128((const __m128i* )(theSrc + aPairIter * 4));
+            __m128i aSrc1 = _mm_loadu_si128((const __m128i* )(theSrc + aPairIter * 4 + 16));
+            // [v0 v1 v2 v3 v4 v5 v6 v7] -> [v0 v2 v4 v6 v1 v3 v5 v7]
+            aSrc0 = _mm_shuffle_epi32(_mm_shufflehi_epi16(_mm_shufflelo_epi16(aSrc0, _MM_SHUFFLE(3, 1, 2, 0)), _MM_SHUFFLE(3, 1, 2, 0)), _MM_SHUFFLE(3, 1, 2, 0));
+            aSrc1 = _mm_shuffle_epi32(_mm_shufflehi_epi16(_mm_shufflelo_epi16(aSrc1, _MM_SHUFFLE(3, 1, 2, 0)), _MM_SHUFFLE(3, 1, 2, 0)), _MM_SHUFFLE(3, 1, 2, 0));
+            _mm_storeu_si128((__m128i* )(theDstEven + aPairIter * 2), _mm_unpacklo_epi64(aSrc0, aSrc1));
+            _mm_storeu_si128((__m128i* )(theDstOdd  + aPairIter * 2), _mm_unpackhi_epi64(aSrc0, aSrc1));
+        }
+        return aPairIter;
+    }
+
+    static size_t splitColumnsRow32SSE2(uint8_t*       theDstEven,
+                                        uint8_t*       theDstOdd,
+                                        const uint8_t* theSrc,
+                                        const size_t   theNbPairs) {
+        size_t aPairIter = 0;
+        for(; aPairIter + 4 <= theNbPairs; aPairIter += 4) {
+            const __m128i aSrc0 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i* )(theSrc + aPairIter * 8)),      _MM_SHUFFLE(3, 1, 2, 0));
+            const __m128i aSrc1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i* )(theSrc + aPairIter * 8 + 16)), _MM_SHUFFLE(3, 1, 2, 0));
+            _mm_storeu_si128((__m128i* )(theDstEven + aPairIter * 4), _mm_unpacklo_epi64(aSrc0, aSrc1));
+            _mm_storeu_si128((__m128i* )(theDstOdd  + aPairIter * 4), _mm_unpackhi_epi64(aSrc0, aSrc1));
+        }
+        return aPairIter;
+    }
+
+    /**
+     * Transpose 4x4 block of 32-bit pixels.
+     */
+    inline void transpose4x4SSE2(uint8_t*        theDst,
+                                 const ptrdiff_t theDstStride,
+                                 const uint8_t*  theSrc,
+                                 const ptrdiff_t theSrcStride) {
+        const __m128i aRow0 = _mm_loadu_si128((const __m128i* )(theSrc));
+        const __m128i aRow1 = _mm_loadu_si128((const __m128i* )(theSrc + theSrcStride));
+        const __m128i aRow2 = _mm_loadu_si128((const __m128i* )(theSrc + theSrcStride * 2));
+        const __m128i aRow3 = _mm_loadu_si128((const __m128i* )(theSrc + theSrcStride * 3));
+        const __m128i aTmp0 = _mm_unpacklo_epi32(aRow0, aRow1); // 00 10 01 11
+        const __m128i aTmp1 = _mm_unpacklo_epi32(aRow2, aRow3); // 20 30 21 31
+        const __m128i aTmp2 = _mm_unpackhi_epi32(aRow0, aRow1); // 02 12 03 13
+        const __m128i aTmp3 = _mm_unpackhi_epi32(aRow2, aRow3); // 22 32 23 33
+        _mm_storeu_si128((__m128i* )(theDst),                    _mm_unpacklo_epi64(aTmp0, aTmp1));
+        _mm_storeu_si128((__m128i* )(theDst + theDstStride),     _mm_unpackhi_epi64(aTmp0, aTmp1));
+        _mm_storeu_si128((__m128i* )(theDst + theDstStride * 2), _mm_unpacklo_epi64(aTmp2, aTmp3));
+        _mm_storeu_si128((__m128i* )(theDst + theDstStride * 3), _mm_unpackhi_epi64(aTmp2, aTmp3));
+    }
+
+    static size_t expand8to16SSE2(uint16_t*      theDst,
+                                  const uint8_t* theSrc,
+                                  const size_t   theNbValues) {
+        size_t anIter = 0;
+        for(; anIter + 16 <= theNbValues; anIter += 16) {
+            const __m128i aSrc = _mm_loadu_si128((const __m128i* )(theSrc + anIter));
+            _mm_storeu_si128((__m128i* )(theDst + anIter),     _mm_unpacklo_epi8(aSrc, aSrc));
+            _mm_storeu_si128((__m128i* )(theDst + anIter + 8), _mm_unpackhi_epi8(aSrc, aSrc));
+        }
+        return anIter;
+    }
+
+    static size_t reduce16to8SSE2(uint8_t*        theDst,
+                                  const uint16_t* theSrc,
+                                  const size_t    theNbValues) {
+        size_t anIter = 0;
+        for(; anIter + 16 <= theNbValues; anIter += 16) {
+            const __m128i aSrc0 = _mm_srli_epi16(_mm_loadu_si128((const __m128i* )(theSrc + anIter)),     8);
+            const __m128i aSrc1 = _mm_srli_epi16(_mm_loadu_si128((const __m128i* )(theSrc + anIter + 8)), 8);
+            _mm_storeu_si128((__m128i* )(theDst + anIter), _mm_packus_epi16(aSrc0, aSrc1));
+        }
+        return anIter;
+    }
+#endif
+
+#if defined(ST_HAVE_AVX2)
+    ST_ATTR_AVX2 static size_t splitColumnsRow8AVX2(uint8_t*       theDstEven,
+                                                    uint8_t*       theDstOdd,
+                                                    const uint8_t* theSrc,
+                                                    const size_t   theNbPairs) {
+        const __m256i aMask = _mm256_set1_epi16(0x00FF);
+        size_t aPairIter = 0;
+        for(; aPairIter + 32 <= theNbPairs; aPairIter += 32) {
+            const __m256i aSrc0 = _mm256_loadu_si256((const __m256i* )(theSrc + aPairIter * 2));
+            const __m256i aSrc1 = _mm256_loadu_si256((const __m256i* )(theSrc + aPairIter * 2 + 32));
+            // packing works within 128-bit lanes, so that 64-bit quarters should be reordered
+            const __m256i anEven = _mm256_packus_epi16(_mm256_and_si256(aSrc0, aMask), _mm256_and_si256(aSrc1, aMask));
+            const __m256i anOdd  = _mm256_packus_epi16(_mm256_srli_epi16(aSrc0, 8), _mm256_srli_epi16(aSrc1, 8));
+            _mm256_storeu_si256((__m256i* )(theDstEven + aPairIter), _mm256_permute4x64_epi64(anEven, 0xD8));
+            _mm256_storeu_si256((__m256i* )(theDstOdd  + aPairIter), _mm256_permute4x64_epi64(anOdd,  0xD8));
+        }
+        return aPairIter;
+    }
+
+    ST_ATTR_AVX2 static size_t splitColumnsRow32AVX2(uint8_t*       theDstEven,
+                                                     uint8_t*       theDstOdd,
+                                                     const uint8_t* theSrc,
+                                                     const size_t   theNbPairs) {
+        const __m256i anIndices = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+        size_t aPairIter = 0;
+        for(; aPairIter + 8 <= theNbPairs; aPairIter += 8) {
+            const __m256i aSrc0 = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((const __m256i* )(theSrc + aPairIter * 8)),      anIndices);
+            const __m256i aSrc1 = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((const __m256i* )(theSrc + aPairIter * 8 + 32)), anIndices);
+            _mm256_storeu_si256((__m256i* )(theDstEven + aPairIter * 4), _mm256_permute2x128_si256(aSrc0, aSrc1, 0x20));
+            _mm256_storeu_si256((__m256i* )(theDstOdd  + aPairIter * 4), _mm256_permute2x128_si256(aSrc0, aSrc1, 0x31));
+        }
+        return aPairIter;
+    }
+
+    ST_ATTR_AVX2 static size_t expand8to16AVX2(uint16_t*      theDst,
+                                               const uint8_t* theSrc,
+                                               const size_t   theNbValues) {
+        size_t anIter = 0;
+        for(; anIter + 16 <= theNbValues; anIter += 16) {
+            const __m256i aVal = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i* )(theSrc + anIter)));
+            _mm256_storeu_si256((__m256i* )(theDst + anIter), _mm256_or_si256(aVal, _mm256_slli_epi16(aVal, 8)));
+        }
+        return anIter;
+    }
+
+    ST_ATTR_AVX2 static size_t reduce16to8AVX2(uint8_t*        theDst,
+                                               const uint16_t* theSrc,
+                                               const size_t    theNbValues) {
+        size_t anIter = 0;
+        for(; anIter + 32 <= theNbValues; anIter += 32) {
+            const __m256i aSrc0 = _mm256_srli_epi16(_mm256_loadu_si256((const __m256i* )(theSrc + anIter)),      8);
+            const __m256i aSrc1 = _mm256_srli_epi16(_mm256_loadu_si256((const __m256i* )(theSrc + anIter + 16)), 8);
+            _mm256_storeu_si256((__m256i* )(theDst + anIter), _mm256_permute4x64_epi64(_mm256_packus_epi16(aSrc0, aSrc1), 0xD8));
+        }
+        return anIter;
+    }
+#endif
+
+#if defined(ST_HAVE_NEON)
+    static size_t splitColumnsRow8NEON(uint8_t*       theDstEven,
+                                       uint8_t*       theDstOdd,
+                                       const uint8_t* theSrc,
+                                       const size_t   theNbPairs) {
+        size_t aPairIter = 0;
+        for(; aPairIter + 16 <= theNbPairs; aPairIter += 16) {
+            const uint8x16x2_t aSrc = vld2q_u8(theSrc + aPairIter * 2);
+            vst1q_u8(theDstEven + aPairIter, aSrc.val[0]);
+            vst1q_u8(theDstOdd  + aPairIter, aSrc.val[1]);
+        }
+        return aPairIter;
+    }
+
+    static size_t splitColumnsRow16NEON(uint8_t*       theDstEven,
+                                        uint8_t*       theDstOdd,
+                                        const uint8_t* theSrc,
+                                        const size_t   theNbPairs) {
+        size_t aPairIter = 0;
+        for(; aPairIter + 8 <= theNbPairs; aPairIter += 8) {
+            const uint16x8x2_t aSrc = vld2q_u16((const uint16_t* )(theSrc + aPairIter * 4));
+            vst1q_u16((uint16_t* )(theDstEven + aPairIter * 2), aSrc.val[0]);
+            vst1q_u16((uint16_t* )(theDstOdd  + aPairIter * 2), aSrc.val[1]);
+        }
+        return aPairIter;
+    }
+
+    static size_t splitColumnsRow32NEON(uint8_t*       theDstEven,
+                                        uint8_t*       theDstOdd,
+                                        const uint8_t* theSrc,
+                                        const size_t   theNbPairs) {
+        size_t aPairIter = 0;
+        for(; aPairIter + 4 <= theNbPairs; aPairIter += 4) {
+            const uint32x4x2_t aSrc = vld2q_u32((const uint32_t* )(theSrc + aPairIter * 8));
+            vst1q_u32((uint32_t* )(theDstEven + aPairIter * 4), aSrc.val[0]);
+            vst1q_u32((uint32_t* )(theDstOdd  + aPairIter * 4), aSrc.val[1]);
+        }
+        return aPairIter;
+    }
+
+    /**
+     * Transpose 4x4 block of 32-bit pixels.
+     */
+    inline void transpose4x4NEON(uint8_t*        theDst,
+                                 const ptrdiff_t theDstStride,
+                                 const uint8_t*  theSrc,
+                                 const ptrdiff_t theSrcStride) {
+        const uint32x4_t aRow0 = vld1q_u32((const uint32_t* )(theSrc));
+        const uint32x4_t aRow1 = vld1q_u32((const uint32_t* )(theSrc + theSrcStride));
+        const uint32x4_t aRow2 = vld1q_u32((const uint32_t* )(theSrc + theSrcStride * 2));
+        const uint32x4_t aRow3 = vld1q_u32((const uint32_t* )(theSrc + theSrcStride * 3));
+        const uint32x4x2_t aTmp01 = vtrnq_u32(aRow0, aRow1); // [00 10 02 12] [01 11 03 13]
+        const uint32x4x2_t aTmp23 = vtrnq_u32(aRow2, aRow3); // [20 30 22 32] [21 31 23 33]
+        vst1q_u32((uint32_t* )(theDst),                    vcombine_u32(vget_low_u32 (aTmp01.val[0]), vget_low_u32 (aTmp23.val[0])));
+        vst1q_u32((uint32_t* )(theDst + theDstStride),     vcombine_u32(vget_low_u32 (aTmp01.val[1]), vget_low_u32 (aTmp23.val[1])));
+        vst1q_u32((uint32_t* )(theDst + theDstStride * 2), vcombine_u32(vget_high_u32(aTmp01.val[0]), vget_high_u32(aTmp23.val[0])));
+        vst1q_u32((uint32_t* )(theDst + theDstStride * 3), vcombine_u32(vget_high_u32(aTmp01.val[1]), vget_high_u32(aTmp23.val[1])));
+    }
+
+    static size_t expand8to16NEON(uint16_t*      theDst,
+                                  const uint8_t* theSrc,
+                                  const size_t   theNbValues) {
+        size_t anIter = 0;
+        for(; anIter + 8 <= theNbValues; anIter += 8) {
+            const uint16x8_t aVal = vmovl_u8(vld1_u8(theSrc + anIter));
+            vst1q_u16(theDst + anIter, vorrq_u16(aVal, vshlq_n_u16(aVal, 8)));
+        }
+        return anIter;
+    }
+
+    static size_t reduce16to8NEON(uint8_t*        theDst,
+                                  const uint16_t* theSrc,
+                                  const size_t    theNbValues) {
+        size_t anIter = 0;
+        for(; anIter + 8 <= theNbValues; anIter += 8) {
+            vst1_u8(theDst + anIter, vshrn_n_u16(vld1q_u16(theSrc + anIter), 8));
+        }
+        return anIter;
+    }
+#endif
+
+    /**
+     * Split one row of column-interlaced image.
+     */
+    static void splitColumnsRow(const StImageKernels::SimdLevel theLevel,
+                                uint8_t*       theDstEven,
+                                uint8_t*       theDstOdd,
+                                const uint8_t* theSrc,
+                                const size_t   theNbPairs,
+                                const size_t   thePixelSize) {
+        size_t aDone = 0;
+        switch(theLevel) {
+        #if defined(ST_HAVE_AVX2)
+            case StImageKernels::SimdLevel_AVX2: {
+                if(thePixelSize == 1) {
+                    aDone = splitColumnsRow8AVX2 (theDstEven, theDstOdd, theSrc, theNbPairs);
+                } else if(thePixelSize == 2) {
+                    aDone = splitColumnsRow16SSE2(theDstEven, theDstOdd, theSrc, theNbPairs);
+                } else if(thePixelSize == 4) {
+                    aDone = splitColumnsRow32AVX2(theDstEven, theDstOdd, theSrc, theNbPairs);
+                }
+                break;
+            }
+        #endif
+        #if defined(ST_HAVE_SSE2)
+            case StImageKernels::SimdLevel_SSE2: {
+                if(thePixelSize == 1) {
+                    aDone = splitColumnsRow8SSE2 (theDstEven, theDstOdd, theSrc, theNbPairs);
+                } else if(thePixelSize == 2) {
+                    aDone = splitColumnsRow16SSE2(theDstEven, theDstOdd, theSrc, theNbPairs);
+                } else if(thePixelSize == 4) {
+                    aDone = splitColumnsRow32SSE2(theDstEven, theDstOdd, theSrc, theNbPairs);
+                }
+                break;
+            }
+        #endif
+        #if defined(ST_HAVE_NEON)
+            case StImageKernels::SimdLevel_NEON: {
+                if(thePixelSize == 1) {
+                    aDone = splitColumnsRow8NEON (theDstEven, theDstOdd, theSrc, theNbPairs);
+                } else if(thePixelSize == 2) {
+                    aDone = splitColumnsRow16NEON(theDstEven, theDstOdd, theSrc, theNbPairs);
+                } else if(thePixelSize == 4) {
+                    aDone = splitColumnsRow32NEON(theDstEven, theDstOdd, theSrc, theNbPairs);
+                }
+                break;
+            }
+        #endif
+            default: break;
+        }
+        if(aDone == theNbPairs) {
+            return;
+        }
+
+        // scalar tail
+        uint8_t*       aDstEven = theDstEven + aDone * thePixelSize;
+        uint8_t*       aDstOdd  = theDstOdd  + aDone * thePixelSize;
+        const uint8_t* aSrc     = theSrc     + aDone * thePixelSize * 2;
+        const size_t   aNbPairs = theNbPairs - aDone;
+        switch(thePixelSize) {
+            case 1:  splitColumnsRowT<1>(aDstEven, aDstOdd, aSrc, aNbPairs); return;
+            case 2:  splitColumnsRowT<2>(aDstEven, aDstOdd, aSrc, aNbPairs); return;
+            case 3:  splitColumnsRowT<3>(aDstEven, aDstOdd, aSrc, aNbPairs); return;
+            case 4:  splitColumnsRowT<4>(aDstEven, aDstOdd, aSrc, aNbPairs); return;
+            case 6:  splitColumnsRowT<6>(aDstEven, aDstOdd, aSrc, aNbPairs); return;
+            case 8:  splitColumnsRowT<8>(aDstEven, aDstOdd, aSrc, aNbPairs); return;
+            default: splitColumnsRowAny (aDstEven, aDstOdd, aSrc, aNbPairs, thePixelSize); return;
+        }
+    }
+
+    /**
+     * Generic transposition of the block.
+     */
+    template<size_t N>
+    inline void transposeBlockT(uint8_t*        theDst,
+                                const ptrdiff_t theDstStride,
+                                const uint8_t*  theSrc,
+                                const ptrdiff_t theSrcStride,
+                                const size_t    theSizeX,
+                                const size_t    theSizeY) {
+        typedef StPixelBytes<N> Pixel;
+        for(size_t aSrcCol = 0; aSrcCol < theSizeX; ++aSrcCol) {
+            Pixel*       aDst = (Pixel* )(theDst + ptrdiff_t(aSrcCol) * theDstStride);
+            const Pixel* aSrc = (const Pixel* )theSrc + aSrcCol;
+            for(size_t aSrcRow = 0; aSrcRow < theSizeY; ++aSrcRow) {
+                aDst[aSrcRow] = *(const Pixel* )((const uint8_t* )aSrc + ptrdiff_t(aSrcRow) * theSrcStride);
+            }
+        }
+    }
+
+    inline void transposeBlockAny(uint8_t*        theDst,
+                                  const ptrdiff_t theDstStride,
+                                  const uint8_t*  theSrc,
+                                  const ptrdiff_t theSrcStride,
+                                  const size_t    theSizeX,
+                                  const size_t    theSizeY,
+                                  const size_t    thePixelSize) {
+        for(size_t aSrcCol = 0; aSrcCol < theSizeX; ++aSrcCol) {
+            for(size_t aSrcRow = 0; aSrcRow < theSizeY; ++aSrcRow) {
+                stMemCpy(theDst + ptrdiff_t(aSrcCol) * theDstStride + aSrcRow * thePixelSize,
+                         theSrc + ptrdiff_t(aSrcRow) * theSrcStride + aSrcCol * thePixelSize,
+                         thePixelSize);
+            }
+        }
+    }
+
+    /**
+     * Transpose the block (fitting into cache).
+     */
+    static void transposeBlock(const StImageKernels::SimdLevel theLevel,
+                               uint8_t*        theDst,
+                               const ptrdiff_t theDstStride,
+                               const uint8_t*  theSrc,
+                               const ptrdiff_t theSrcStride,
+                               const size_t    theSizeX,
+                               const size_t    theSizeY,
+                               const size_t    thePixelSize) {
+        if(thePixelSize == 4
+        && theLevel != StImageKernels::SimdLevel_Scalar) {
+            const size_t aSizeX4 = theSizeX & ~size_t(3);
+            const size_t aSizeY4 = theSizeY & ~size_t(3);
+            for(size_t aSrcRow = 0; aSrcRow < aSizeY4; aSrcRow += 4) {
+                for(size_t aSrcCol = 0; aSrcCol < aSizeX4; aSrcCol += 4) {
+                    uint8_t*       aDst = theDst + ptrdiff_t(aSrcCol) * theDstStride + aSrcRow * 4;
+                    const uint8_t* aSrc = theSrc + ptrdiff_t(aSrcRow) * theSrcStride + aSrcCol * 4;
+                #if defined(ST_HAVE_SSE2)
+                    transpose4x4SSE2(aDst, theDstStride, aSrc, theSrcStride);
+                #elif defined(ST_HAVE_NEON)
+                    transpose4x4NEON(aDst, theDstStride, aSrc, theSrcStride);
+                #else
+                    transposeBlockT<4>(aDst, theDstStride, aSrc, theSrcStride, 4, 4);
+                #endif
+                }
+            }
+            // remaining columns and rows
+            if(aSizeX4 < theSizeX) {
+                transposeBlockT<4>(theDst + ptrdiff_t(aSizeX4) * theDstStride, theDstStride,
+                                   theSrc + aSizeX4 * 4, theSrcStride, theSizeX - aSizeX4, theSizeY);
+            }
+            if(aSizeY4 < theSizeY) {
+                transposeBlockT<4>(theDst + aSizeY4 * 4, theDstStride,
+                                   theSrc + ptrdiff_t(aSizeY4) * theSrcStride, theSrcStride, aSizeX4, theSizeY - aSizeY4);
+            }
+            return;
+        }
+
+        switch(thePixelSize) {
+            case 1:  transposeBlockT<1>(theDst, theDstStride, theSrc, theSrcStride, theSizeX, theSizeY); return;
+            case 2:  transposeBlockT<2>(theDst, theDstStride, theSrc, theSrcStride, theSizeX, theSizeY); return;
+            case 3:  transposeBlockT<3>(theDst, theDstStride, theSrc, theSrcStride, theSizeX, theSizeY); return;
+            case 4:  transposeBlockT<4>(theDst, theDstStride, theSrc, theSrcStride, theSizeX, theSizeY); return;
+            case 6:  transposeBlockT<6>(theDst, theDstStride, theSrc, theSrcStride, theSizeX, theSizeY); return;
+            case 8:  transposeBlockT<8>(theDst, theDstStride, theSrc, theSrcStride, theSizeX, theSizeY); return;
+            default: transposeBlockAny (theDst, theDstStride, theSrc, theSrcStride, theSizeX, theSizeY, thePixelSize); return;
+        }
+    }
+
+    /**
+     * Arguments of copyRows() job.
+     */
+    struct StCopyRowsJob {
+        uint8_t*       Dst;
+        ptrdiff_t      DstStride;
+        const uint8_t* Src;
+        ptrdiff_t      SrcStride;
+        size_t         RowBytes;
+
+        static void perform(void* theJob, const size_t theFrom, const size_t theTo) {
+            const StCopyRowsJob& aJob = *(const StCopyRowsJob* )theJob;
+            for(size_t aRow = theFrom; aRow < theTo; ++aRow) {
+                stMemCpy(aJob.Dst + ptrdiff_t(aRow) * aJob.DstStride,
+                         aJob.Src + ptrdiff_t(aRow) * aJob.SrcStride,
+                         aJob.RowBytes);
+            }
+        }
+    };
+
+    /**
+     * Arguments of splitColumns() job.
+     */
+    struct StSplitColumnsJob {
+        uint8_t*       DstEven;
+        uint8_t*       DstOdd;
+        ptrdiff_t      DstStride;
+        const uint8_t* Src;
+        ptrdiff_t      SrcStride;
+        size_t         NbPairs;
+        size_t         PixelSize;
+        StImageKernels::SimdLevel Level;
+
+        static void perform(void* theJob, const size_t theFrom, const size_t theTo) {
+            const StSplitColumnsJob& aJob = *(const StSplitColumnsJob* )theJob;
+            for(size_t aRow = theFrom; aRow < theTo; ++aRow) {
+                splitColumnsRow(aJob.Level,
+                                aJob.DstEven + ptrdiff_t(aRow) * aJob.DstStride,
+                                aJob.DstOdd  + ptrdiff_t(aRow) * aJob.DstStride,
+                                aJob.Src     + ptrdiff_t(aRow) * aJob.SrcStride,
+                                aJob.NbPairs, aJob.PixelSize);
+            }
+        }
+    };
+
+    /**
+     * Arguments of transpose() job, items are stripes of source columns.
+     */
+    struct StTransposeJob {
+        uint8_t*       Dst;
+        ptrdiff_t      DstStride;
+        const uint8_t* Src;
+        ptrdiff_t      SrcStride;
+        size_t         SrcSizeX;
+        size_t         SrcSizeY;
+        size_t         PixelSize;
+        size_t         BlockSize;
+        StImageKernels::SimdLevel Level;
+
+        static void perform(void* theJob, const size_t theFrom, const size_t theTo) {
+            const StTransposeJob& aJob = *(const StTransposeJob* )theJob;
+            for(size_t aStripe = theFrom; aStripe < theTo; ++aStripe) {
+                const size_t aSrcCol   = aStripe * aJob.BlockSize;
+                const size_t aNbCols   = stMin(aJob.BlockSize, aJob.SrcSizeX - aSrcCol);
+                for(size_t aSrcRow = 0; aSrcRow < aJob.SrcSizeY; aSrcRow += aJob.BlockSize) {
+                    const size_t aNbRows = stMin(aJob.BlockSize, aJob.SrcSizeY - aSrcRow);
+                    transposeBlock(aJob.Level,
+                                   aJob.Dst + ptrdiff_t(aSrcCol) * aJob.DstStride + aSrcRow * aJob.PixelSize, aJob.DstStride,
+                                   aJob.Src + ptrdiff_t(aSrcRow) * aJob.SrcStride + aSrcCol * aJob.PixelSize, aJob.SrcStride,
+                                   aNbCols, aNbRows, aJob.PixelSize);
+                }
+            }
+        }
+    };
+
+    /**
+     * Arguments of expand8to16() job.
+     */
+    struct StExpandJob {
+        uint16_t*      Dst;
+        const uint8_t* Src;
+        StImageKernels::SimdLevel Level;
+
+        static void perform(void* theJob, const size_t theFrom, const size_t theTo) {
+            const StExpandJob& aJob = *(const StExpandJob* )theJob;
+            uint16_t*      aDst = aJob.Dst + theFrom;
+            const uint8_t* aSrc = aJob.Src + theFrom;
+            const size_t   aNb  = theTo - theFrom;
+            size_t aDone = 0;
+            switch(aJob.Level) {
+            #if defined(ST_HAVE_AVX2)
+                case StImageKernels::SimdLevel_AVX2: aDone = expand8to16AVX2(aDst, aSrc, aNb); break;
+            #endif
+            #if defined(ST_HAVE_SSE2)
+                case StImageKernels::SimdLevel_SSE2: aDone = expand8to16SSE2(aDst, aSrc, aNb); break;
+            #endif
+            #if defined(ST_HAVE_NEON)
+                case StImageKernels::SimdLevel_NEON: aDone = expand8to16NEON(aDst, aSrc, aNb); break;
+            #endif
+                default: break;
+            }
+            for(; aDone < aNb; ++aDone) {
+                aDst[aDone] = uint16_t(aSrc[aDone]) * 257;
+            }
+        }
+    };
+
+    /**
+     * Arguments of reduce16to8() job.
+     */
+    struct StReduceJob {
+        uint8_t*        Dst;
+        const uint16_t* Src;
+        StImageKernels::SimdLevel Level;
+
+        static void perform(void* theJob, const size_t theFrom, const size_t theTo) {
+            const StReduceJob& aJob = *(const StReduceJob* )theJob;
+            uint8_t*        aDst = aJob.Dst + theFrom;
+            const uint16_t* aSrc = aJob.Src + theFrom;
+            const size_t    aNb  = theTo - theFrom;
+            size_t aDone = 0;
+            switch(aJob.Level) {
+            #if defined(ST_HAVE_AVX2)
+                case StImageKernels::SimdLevel_AVX2: aDone = reduce16to8AVX2(aDst, aSrc, aNb); break;
+            #endif
+            #if defined(ST_HAVE_SSE2)
+                case StImageKernels::SimdLevel_SSE2: aDone = reduce16to8SSE2(aDst, aSrc, aNb); break;
+            #endif
+            #if defined(ST_HAVE_NEON)
+                case StImageKernels::SimdLevel_NEON: aDone = reduce16to8NEON(aDst, aSrc, aNb); break;
+            #endif
+                default: break;
+            }
+            for(; aDone < aNb; ++aDone) {
+                aDst[aDone] = uint8_t(aSrc[aDone] >> 8);
+            }
+        }
+    };
+
+}
+
+const char* StImageKernels::getSimdLevelName(const SimdLevel theLevel) {
+    switch(theLevel) {
+        case SimdLevel_Scalar: return "Scalar";
+        case SimdLevel_SSE2:   return "SSE2";
+        case SimdLevel_AVX2:   return "AVX2";
+        case SimdLevel_NEON:   return "NEON";
+    }
+    return "UNKNOWN";
+}
+
+StImageKernels::SimdLevel StImageKernels::getSimdLevelMax() {
+    static const SimdLevel THE_LEVEL_MAX = detectSimdLevel();
+    return THE_LEVEL_MAX;
+}
+
+StImageKernels::SimdLevel StImageKernels::getSimdLevel() {
+    return simdLevel();
+}
+
+void StImageKernels::setSimdLevel(const SimdLevel theLevel) {
+    const SimdLevel aLevelMax = getSimdLevelMax();
+    if(theLevel == SimdLevel_Scalar
+    || theLevel == aLevelMax
+    || (theLevel == SimdLevel_SSE2 && aLevelMax == SimdLevel_AVX2)) {
+        THE_SIMD_LEVEL = theLevel;
+    }
+}
+
+bool StImageKernels::isMultiThreaded() {
+    return THE_TO_USE_THREADS;
+}
+
+void StImageKernels::setMultiThreaded(const bool theToUseThreads) {
+    THE_TO_USE_THREADS = theToUseThreads;
+}
+
+void StImageKernels::copyRows(uint8_t*        theDst,
+                              const ptrdiff_t theDstStride,
+                              const uint8_t*  theSrc,
+                              const ptrdiff_t theSrcStride,
+                              const size_t    theRowBytes,
+                              const size_t    theNbRows) {
+    if(theNbRows == 0
+    || theRowBytes == 0) {
+        return;
+    }
+
+    StCopyRowsJob aJob;
+    aJob.Dst       = theDst;
+    aJob.DstStride = theDstStride;
+    aJob.Src       = theSrc;
+    aJob.SrcStride = theSrcStride;
+    aJob.RowBytes  = theRowBytes;
+    if(theDstStride == theSrcStride
+    && theDstStride == ptrdiff_t(theRowBytes)) {
+        // continuous block
+        aJob.DstStride = aJob.SrcStride = ptrdiff_t(THE_CHUNK_BYTES);
+        aJob.RowBytes  = THE_CHUNK_BYTES;
+        const size_t aNbBytes  = theNbRows * theRowBytes;
+        const size_t aNbChunks = aNbBytes / THE_CHUNK_BYTES;
+        performRows(StCopyRowsJob::perform, &aJob, aNbChunks, THE_CHUNK_BYTES);
+        const size_t aTail = aNbChunks * THE_CHUNK_BYTES;
+        if(aTail < aNbBytes) {
+            stMemCpy(theDst + aTail, theSrc + aTail, aNbBytes - aTail);
+        }
+        return;
+    }
+
+    performRows(StCopyRowsJob::perform, &aJob, theNbRows, theRowBytes);
+}
+
+void StImageKernels::splitColumns(uint8_t*        theDstEven,
+                                  uint8_t*        theDstOdd,
+                                  const ptrdiff_t theDstStride,
+                                  const uint8_t*  theSrc,
+                                  const ptrdiff_t theSrcStride,
+                                  const size_t    theNbPairs,
+                                  const size_t    thePixelSize,
+                                  const size_t    theNbRows) {
+    if(theNbRows == 0
+    || theNbPairs == 0
+    || thePixelSize == 0) {
+        return;
+    }
+
+    StSplitColumnsJob aJob;
+    aJob.DstEven   = theDstEven;
+    aJob.DstOdd    = theDstOdd;
+    aJob.DstStride = theDstStride;
+    aJob.Src       = theSrc;
+    aJob.SrcStride = theSrcStride;
+    aJob.NbPairs   = theNbPairs;
+    aJob.PixelSize = thePixelSize;
+    aJob.Level     = simdLevel();
+    performRows(StSplitColumnsJob::perform, &aJob, theNbRows, theNbPairs * thePixelSize * 2);
+}
+
+void StImageKernels::transpose(uint8_t*        theDst,
+                               const ptrdiff_t theDstStride,
+                               const uint8_t*  theSrc,
+                               const ptrdiff_t theSrcStride,
+                               const size_t    theSrcSizeX,
+                               const size_t    theSrcSizeY,
+                               const size_t    thePixelSize) {
+    if(theSrcSizeX == 0
+    || theSrcSizeY == 0
+    || thePixelSize == 0) {
+        return;
+    }
+
+    StTransposeJob aJob;
+    aJob.Dst       = theDst;
+    aJob.DstStride = theDstStride;
+    aJob.Src       = theSrc;
+    aJob.SrcStride = theSrcStride;
+    aJob.SrcSizeX  = theSrcSizeX;
+    aJob.SrcSizeY  = theSrcSizeY;
+    aJob.PixelSize = thePixelSize;
+    aJob.BlockSize = stMax(THE_TRANSPOSE_BLOCK_BYTES / thePixelSize, size_t(4)) & ~size_t(3);
+    aJob.Level     = simdLevel();
+    const size_t aNbStripes = (theSrcSizeX + aJob.BlockSize - 1) / aJob.BlockSize;
+    performRows(StTransposeJob::perform, &aJob, aNbStripes, aJob.BlockSize * theSrcSizeY * thePixelSize);
+}
+
+void StImageKernels::expand8to16(uint16_t*      theDst,
+                                 const uint8_t* theSrc,
+                                 const size_t   theNbValues) {
+    StExpandJob aJob;
+    aJob.Dst   = theDst;
+    aJob.Src   = theSrc;
+    aJob.Level = simdLevel();
+    if(!THE_TO_USE_THREADS
+    || theNbValues < THE_PARALLEL_BYTES) {
+        StExpandJob::perform(&aJob, 0, theNbValues);
+        return;
+    }
+    StThreadPool::GetDefault().perform(StExpandJob::perform, &aJob, theNbValues, THE_CHUNK_BYTES);
+}
+
+void StImageKernels::reduce16to8(uint8_t*        theDst,
+                                 const uint16_t* theSrc,
+                                 const size_t    theNbValues) {
+    StReduceJob aJob;
+    aJob.Dst   = theDst;
+    aJob.Src   = theSrc;
+    aJob.Level = simdLevel();
+    if(!THE_TO_USE_THREADS
+    || theNbValues < THE_PARALLEL_BYTES) {
+        StReduceJob::perform(&aJob, 0, theNbValues);
+        return;
+    }
+    StThreadPool::GetDefault().perform(StReduceJob::perform, &aJob, theNbValues, THE_CHUNK_BYTES);
+}
@@ -1,11 +1,14 @@
 /**
- * Copyright © 2010-2020 Kirill Gavrilov <kirill@sview.ru>
+ * Copyright © 2010-2026 Kirill Gavrilov <kirill@sview.ru>
  *
  * This code is licensed under MIT license (see docs/license-mit.txt for details).
  */
 
 #include <StImage/StImagePlane.h>
 
+#include <StImage/StFrameBufferPool.h>
+#include <StImage/StImageKernels.h>
+
 StString StImagePlane::formatImgFormat(ImgFormat theImgFormat) {
     switch(theImgFormat) {
         case ImgGray:    return "ImgGray";
@@ -122,7 +125,7 @@ bool StImagePlane::initTrash(StImagePlane::ImgFormat thePixelFormat,
         // use argument only if it greater
         mySizeRowBytes = theSizeRowBytes;
     }
-    myDataPtr = stMemAllocAligned<GLubyte*>(getSizeBytes());
+    myDataPtr = (GLubyte* )StFrameBufferPool::GetDefault().allocate(getSizeBytes());
     myIsOwnPointer = true;
     return myDataPtr != NULL;
 }
@@ -145,15 +148,11 @@ bool StImagePlane::initCopy(const StImagePlane& theCopy,
         return false;
     }
 
-    if(mySizeRowBytes == theCopy.mySizeRowBytes) {
-        stMemCpy(changeData(), theCopy.getData(), theCopy.getSizeBytes());
-        return true;
-    }
-
+    // equal strides are copied as continuous block
     const size_t aCopyRowBytes = stMin(mySizeRowBytes, theCopy.mySizeRowBytes);
-    for(size_t aRow = 0; aRow < mySizeY; ++aRow) {
-        stMemCpy(changeData(aRow, 0), theCopy.getData(aRow, 0), aCopyRowBytes);
-    }
+    StImageKernels::copyRows(changeData(),      ptrdiff_t(mySizeRowBytes),
+                             theCopy.getData(), ptrdiff_t(theCopy.mySizeRowBytes),
+                             aCopyRowBytes, mySizeY);
     return true;
 }
 
@@ -167,15 +166,22 @@ bool StImagePlane::initTransposedCopy(const StImagePlane& theCopy,
         }
     }
 
-    const size_t aPixelSize = getSizePixelBytes();
-    const size_t aSrcColFrom =  theIsClockwise ? theCopy.mySizeX - 1 : 0;
-    const size_t aSrcRowFrom = !theIsClockwise ? theCopy.mySizeY - 1 : 0;
-    const size_t aSrcColIncr = aSrcColFrom == 0 ? 1 : size_t(-1);
-    const size_t aSrcRowIncr = aSrcRowFrom == 0 ? 1 : size_t(-1);
-    for(size_t aDstRow = 0, aSrcCol = aSrcColFrom; aDstRow < mySizeY; ++aDstRow, aSrcCol += aSrcColIncr) {
-        for(size_t aDstCol = 0, aSrcRow = aSrcRowFrom; aDstCol < mySizeX; ++aDstCol, aSrcRow += aSrcRowIncr) {
-            stMemCpy(changeData(aDstRow, aDstCol), theCopy.getData(aSrcRow, aSrcCol), aPixelSize);
-        }
+    if(mySizeX == 0
+    || mySizeY == 0) {
+        return true;
+    }
+
+    // clockwise rotation reverses destination rows, counterclockwise - source rows
+    const ptrdiff_t aDstStride = ptrdiff_t(mySizeRowBytes);
+    const ptrdiff_t aSrcStride = ptrdiff_t(theCopy.mySizeRowBytes);
+    if(theIsClockwise) {
+        StImageKernels::transpose(changeData(mySizeY - 1, 0), -aDstStride,
+                                  theCopy.getData(),             aSrcStride,
+                                  theCopy.mySizeX, theCopy.mySizeY, getSizePixelBytes());
+    } else {
+        StImageKernels::transpose(changeData(),                           aDstStride,
+                                  theCopy.getData(theCopy.mySizeY - 1, 0), -aSrcStride,
+                                  theCopy.mySizeX, theCopy.mySizeY, getSizePixelBytes());
     }
     return true;
 }
@@ -220,16 +226,12 @@ bool StImagePlane::initSideBySide(const StImagePlane& theImageL,
     }
 
     // save cross-eyed
-    for(size_t row = 0; row < theImageR.getSizeY(); ++row) {
-        stMemCpy(changeData(dyTopRPx + row, dxLeftRPx),
-                 theImageR.getData(row, 0),
-                 theImageR.getSizeRowBytes());
-    }
-    for(size_t row = 0; row < theImageR.getSizeY(); ++row) {
-        stMemCpy(changeData(dyTopLPx + row, theImageR.getSizeX() + dxLeftLPx + dxLeftRPx),
-                 theImageL.getData(row, 0),
-                 theImageL.getSizeRowBytes());
-    }
+    StImageKernels::copyRows(changeData(dyTopRPx, dxLeftRPx), ptrdiff_t(mySizeRowBytes),
+                             theImageR.getData(), ptrdiff_t(theImageR.getSizeRowBytes()),
+                             theImageR.getSizeRowBytes(), theImageR.getSizeY());
+    StImageKernels::copyRows(changeData(dyTopLPx, theImageR.getSizeX() + dxLeftLPx + dxLeftRPx), ptrdiff_t(mySizeRowBytes),
+                             theImageL.getData(), ptrdiff_t(theImageL.getSizeRowBytes()),
+                             theImageL.getSizeRowBytes(), theImageR.getSizeY());
     return true;
 }
 
@@ -242,17 +244,15 @@ bool StImagePlane::fill(const StImagePlane& theCopy,
     }
 
     const size_t aCopyRowBytes = stMin(mySizeRowBytes, theCopy.mySizeRowBytes);
-    for(size_t row = 0; row < theCopy.getSizeY(); ++row) {
-        stMemCpy(changeData(row, 0),
-                 theCopy.getData(row, 0),
-                 aCopyRowBytes);
-    }
+    StImageKernels::copyRows(changeData(),      ptrdiff_t(mySizeRowBytes),
+                             theCopy.getData(), ptrdiff_t(theCopy.mySizeRowBytes),
+                             aCopyRowBytes, theCopy.getSizeY());
     return true;
 }
 
 void StImagePlane::nullify(StImagePlane::ImgFormat thePixelFormat) {
     if(myIsOwnPointer && (myDataPtr != NULL)) {
-        stMemFreeAligned(myDataPtr);
+        StFrameBufferPool::GetDefault().release(myDataPtr);
     }
     myDataPtr = NULL;
     myIsOwnPointer = true;
@@ -0,0 +1,256 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * This code is licensed under MIT license (see docs/license-mit.txt for details).
+ */
+
+#include <StImage/StMemoryBudget.h>
+
+#include <StStrings/StStringBuilder.h>
+
+#if defined(_WIN32)
+    #include <windows.h>
+#elif defined(__APPLE__)
+    #include <sys/types.h>
+    #include <sys/sysctl.h>
+#else
+    #include <unistd.h>
+#endif
+
+namespace {
+
+    static const size_t THE_MIB = 1024 * 1024;
+
+    /**
+     * Default limit - half of physical memory.
+     */
+    static size_t defaultLimit() {
+        uint64_t aLimit = StMemoryBudget::getPhysicalMemory() / 2;
+        if(aLimit == 0) {
+            aLimit = uint64_t(sizeof(void*) == 4 ? 1024 : 4096) * THE_MIB;
+        }
+        if(sizeof(void*) == 4) {
+            // address space is the limit on 32-bit systems
+            aLimit = stMin(aLimit, uint64_t(1024) * THE_MIB);
+        }
+        return size_t(aLimit);
+    }
+
+}
+
+StMemoryBudget& StMemoryBudget::GetDefault() {
+    // intentionally never destroyed - buffers within static objects might be released after exit()
+    static StMemoryBudget* THE_DEFAULT_BUDGET = new StMemoryBudget(defaultLimit());
+    return *THE_DEFAULT_BUDGET;
+}
+
+uint64_t StMemoryBudget::getPhysicalMemory() {
+#if defined(_WIN32)
+    MEMORYSTATUSEX aStatus;
+    aStatus.dwLength = sizeof(aStatus);
+    return GlobalMemoryStatusEx(&aStatus) ? uint64_t(aStatus.ullTotalPhys) : 0;
+#elif defined(__APPLE__)
+    uint64_t aMemSize = 0;
+    size_t   aLen     = sizeof(aMemSize);
+    return sysctlbyname("hw.memsize", &aMemSize, &aLen, NULL, 0) == 0 ? aMemSize : 0;
+#else
+    const long aNbPages  = sysconf(_SC_PHYS_PAGES);
+    const long aPageSize = sysconf(_SC_PAGESIZE);
+    return (aNbPages > 0 && aPageSize > 0) ? uint64_t(aNbPages) * uint64_t(aPageSize) : 0;
+#endif
+}
+
+const char* StMemoryBudget::getSubsystemName(const Subsystem theSubsystem) {
+    switch(theSubsystem) {
+        case Subsystem_Textures: return "Texture buffers";
+        case Subsystem_Images:   return "Images";
+        case Subsystem_Frames:   return "Video frames";
+        case Subsystem_Packets:  return "Packets";
+        case Subsystem_Pool:     return "Retained buffers";
+        case Subsystem_NB:       break;
+    }
+    return "";
+}
+
+StMemoryBudget::StMemoryBudget(const size_t theLimit)
+: myLimit(theLimit),
+  myNbReclaims(0),
+  myIsReclaiming(false) {
+    for(int aSubIter = 0; aSubIter < Subsystem_NB; ++aSubIter) {
+        myUsage[aSubIter] = 0;
+        myPeak [aSubIter] = 0;
+    }
+}
+
+void StMemoryBudget::setLimit(const size_t theLimit) {
+    myMutex.lock();
+    myLimit = theLimit;
+    const bool isExceeded = computeUsage() > myLimit;
+    myMutex.unlock();
+    if(isExceeded) {
+        reclaim();
+    }
+}
+
+size_t StMemoryBudget::computeUsage() const {
+    size_t aUsage = 0;
+    for(int aSubIter = 0; aSubIter < Subsystem_NB; ++aSubIter) {
+        aUsage += myUsage[aSubIter];
+    }
+    return aUsage;
+}
+
+size_t StMemoryBudget::getUsage() const {
+    myMutex.lock();
+    const size_t aUsage = computeUsage();
+    myMutex.unlock();
+    return aUsage;
+}
+
+size_t StMemoryBudget::getUsage(const Subsystem theSubsystem) const {
+    myMutex.lock();
+    const size_t aUsage = myUsage[theSubsystem];
+    myMutex.unlock();
+    return aUsage;
+}
+
+bool StMemoryBudget::isUnderPressure() const {
+    // start reducing buffers a little bit before the limit
+    return getUsage() > myLimit / 10 * 9;
+}
+
+bool StMemoryBudget::allocate(const Subsystem theSubsystem,
+                              const size_t    theSizeBytes) {
+    if(theSizeBytes == 0) {
+        return true;
+    }
+
+    myMutex.lock();
+    myUsage[theSubsystem] += theSizeBytes;
+    myPeak [theSubsystem]  = stMax(myPeak[theSubsystem], myUsage[theSubsystem]);
+    const bool isExceeded = computeUsage() > myLimit;
+    myMutex.unlock();
+    if(!isExceeded) {
+        return true;
+    }
+
+    reclaim();
+    return getUsage() <= myLimit;
+}
+
+void StMemoryBudget::release(const Subsystem theSubsystem,
+                             const size_t    theSizeBytes) {
+    myMutex.lock();
+    myUsage[theSubsystem] -= stMin(myUsage[theSubsystem], theSizeBytes);
+    myMutex.unlock();
+}
+
+void StMemoryBudget::addReclaimer(Reclaimer* theReclaimer,
+                                  const int  thePriority) {
+    ReclaimerEntry anEntry;
+    anEntry.Object   = theReclaimer;
+    anEntry.Priority = thePriority;
+
+    myReclaimMutex.lock();
+    std::vector<ReclaimerEntry>::iterator anIter = myReclaimers.begin();
+    for(; anIter != myReclaimers.end() && anIter->Priority <= thePriority; ++anIter) {}
+    myReclaimers.insert(anIter, anEntry);
+    myReclaimMutex.unlock();
+}
+
+void StMemoryBudget::removeReclaimer(Reclaimer* theReclaimer) {
+    myReclaimMutex.lock();
+    for(std::vector<ReclaimerEntry>::iterator anIter = myReclaimers.begin(); anIter != myReclaimers.end(); ++anIter) {
+        if(anIter->Object == theReclaimer) {
+            myReclaimers.erase(anIter);
+            break;
+        }
+    }
+    myReclaimMutex.unlock();
+}
+
+void StMemoryBudget::reclaim() {
+    // reclaiming already in progress (by another thread or allocation within reclaimer)
+    if(!myReclaimMutex.tryLock()) {
+        return;
+    }
+    if(myIsReclaiming) {
+        myReclaimMutex.unlock();
+        return;
+    }
+
+    myIsReclaiming = true;
+    myMutex.lock();
+    ++myNbReclaims;
+    myMutex.unlock();
+    for(std::vector<ReclaimerEntry>::iterator anIter = myReclaimers.begin(); anIter != myReclaimers.end(); ++anIter) {
+        const size_t anUsage = getUsage();
+        if(anUsage <= myLimit) {
+            break;
+        }
+        anIter->Object->reclaimMemory(anUsage - myLimit);
+    }
+    myIsReclaiming = false;
+    myReclaimMutex.unlock();
+}
+
+StString StMemoryBudget::formatStats() const {
+    char aBuff[256];
+    StStringBuilder aStats;
+    myMutex.lock();
+    const size_t anUsage = computeUsage();
+    stsprintf(aBuff, sizeof(aBuff), "%.1f of %.1f MiB used, limit exceeded %u times",
+              double(anUsage) / double(THE_MIB), double(myLimit) / double(THE_MIB), (unsigned int )myNbReclaims);
+    aStats + aBuff;
+    for(int aSubIter = 0; aSubIter < Subsystem_NB; ++aSubIter) {
+        stsprintf(aBuff, sizeof(aBuff), "\n%s: %.1f MiB (peak %.1f MiB)",
+                  getSubsystemName(Subsystem(aSubIter)),
+                  double(myUsage[aSubIter]) / double(THE_MIB),
+                  double(myPeak [aSubIter]) / double(THE_MIB));
+        aStats + aBuff;
+    }
+    myMutex.unlock();
+    return aStats.toString();
+}
+
+StMemoryBudget::Allocation::Allocation(const Subsystem theSubsystem,
+                                       const size_t    theSizeBytes)
+: mySubsystem(theSubsystem),
+  mySizeBytes(theSizeBytes) {
+    StMemoryBudget::GetDefault().allocate(mySubsystem, mySizeBytes);
+}
+
+StMemoryBudget::Allocation::~Allocation() {
+    StMemoryBudget::GetDefault().release(mySubsystem, mySizeBytes);
+}
+
+StMemoryBudgetCounter::StMemoryBudgetCounter() {}
+
+StMemoryBudgetCounter::StMemoryBudgetCounter(const StHandle<StBufferCounter>& theBuffer,
+                                             const StMemoryBudget::Subsystem  theSubsystem,
+                                             const size_t                     theSizeBytes)
+: myBuffer(theBuffer),
+  myAllocation(new StMemoryBudget::Allocation(theSubsystem, theSizeBytes)) {}
+
+StMemoryBudgetCounter::~StMemoryBudgetCounter() {}
+
+void StMemoryBudgetCounter::createReference(StHandle<StBufferCounter>& theOther) const {
+    StHandle<StMemoryBudgetCounter> aBudgetRef = StHandle<StMemoryBudgetCounter>::downcast(theOther);
+    if(aBudgetRef.isNull()) {
+        aBudgetRef = new StMemoryBudgetCounter();
+        theOther = aBudgetRef;
+    }
+    if(!myBuffer.isNull()) {
+        myBuffer->createReference(aBudgetRef->myBuffer);
+    } else {
+        aBudgetRef->myBuffer.nullify();
+    }
+    aBudgetRef->myAllocation = myAllocation;
+}
+
+void StMemoryBudgetCounter::releaseReference() {
+    if(!myBuffer.isNull()) {
+        myBuffer->releaseReference();
+    }
+    myAllocation.nullify();
+}
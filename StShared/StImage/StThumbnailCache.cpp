@@ -0,0 +1,288 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * This code is licensed under MIT license (see docs/license-mit.txt for details).
+ */
+
+#include <StImage/StThumbnailCache.h>
+
+#include <StAV/StAVImage.h>
+#include <StFile/StFileNode.h>
+#include <StFile/StFolder.h>
+#include <StImage/StJpegParser.h>
+#include <StStrings/StLogger.h>
+
+#include <algorithm>
+
+namespace {
+
+    /**
+     * Thread function just call processLoop() function.
+     */
+    static SV_THREAD_FUNCTION threadFunction(void* theCache) {
+        StThumbnailCache* aCache = (StThumbnailCache* )theCache;
+        aCache->processLoop();
+        return SV_THREAD_RETURN 0;
+    }
+
+    /**
+     * Maximum number of queued requests; the oldest requests are discarded.
+     */
+    static const size_t THE_QUEUE_MAX = 1024;
+
+    /**
+     * Amount of data to read from JPEG file to find EXIF thumbnail (APP1 section is limited by 64 KiB).
+     */
+    static const size_t THE_EXIF_READ_MAX = 256 * 1024;
+
+    /**
+     * Reduced resolution level (1/8) used to decode full image.
+     */
+    static const int THE_LOWRES_LEVEL = 3;
+
+    /**
+     * FNV-1a hash of the string.
+     */
+    static uint64_t hashString(const StString& theString,
+                               uint64_t        theHash = 14695981039346656037ULL) {
+        const char* aData = theString.toCString();
+        for(size_t anIter = 0; anIter < theString.getSize(); ++anIter) {
+            theHash ^= (uint8_t )aData[anIter];
+            theHash *= 1099511628211ULL;
+        }
+        return theHash;
+    }
+
+    /**
+     * Convert image plane format into FFmpeg pixel format.
+     */
+    static AVPixelFormat getPixelFormat(const StImagePlane& thePlane) {
+        switch(thePlane.getFormat()) {
+            case StImagePlane::ImgRGB:  return stAV::PIX_FMT::RGB24;
+            case StImagePlane::ImgBGR:  return stAV::PIX_FMT::BGR24;
+            case StImagePlane::ImgRGBA: return stAV::PIX_FMT::RGBA32;
+            case StImagePlane::ImgBGRA: return stAV::PIX_FMT::BGRA32;
+            case StImagePlane::ImgGray: return stAV::PIX_FMT::GRAY8;
+            default:                    return stAV::PIX_FMT::NONE;
+        }
+    }
+
+}
+
+StThumbnailCache::StThumbnailCache(const StString& theCacheFolder,
+                                   const int       theSizeX,
+                                   const int       theSizeY,
+                                   const int       theNbWorkers)
+: myHasRequest(false),
+  mySizeX(stMax(theSizeX, 1)),
+  mySizeY(stMax(theSizeY, 1)),
+  myToQuit(false) {
+    if(!theCacheFolder.isEmpty()) {
+        myCacheFolder = theCacheFolder + "thumbs/";
+        StFolder::createFolder(myCacheFolder);
+    }
+
+    const int aNbWorkers = theNbWorkers > 0
+                         ? theNbWorkers
+                         : stClamp(StThread::countLogicalProcessors() / 2, 1, 4);
+    for(int aThreadIter = 0; aThreadIter < aNbWorkers; ++aThreadIter) {
+        myThreads.push_back(new StThread(threadFunction, (void* )this, "StThumbnailCache"));
+    }
+}
+
+StThumbnailCache::~StThumbnailCache() {
+    myToQuit = true;
+    myHasRequest.set();
+    for(size_t aThreadIter = 0; aThreadIter < myThreads.size(); ++aThreadIter) {
+        myThreads[aThreadIter]->wait();
+        myThreads[aThreadIter].nullify();
+    }
+}
+
+void StThumbnailCache::request(const StString& theFilePath) {
+    StMutexAuto aLock(&myMutex);
+    if(myRequested.find(theFilePath) != myRequested.end()) {
+        // move already queued request to the front
+        std::deque<StString>::iterator aQueued = std::find(myQueue.begin(), myQueue.end(), theFilePath);
+        if(aQueued != myQueue.end()
+        && aQueued != myQueue.begin()) {
+            myQueue.erase(aQueued);
+            myQueue.push_front(theFilePath);
+        }
+        return;
+    }
+
+    myRequested.insert(theFilePath);
+    myQueue.push_front(theFilePath);
+    if(myQueue.size() > THE_QUEUE_MAX) {
+        myRequested.erase(myQueue.back());
+        myQueue.pop_back();
+    }
+    myHasRequest.set();
+}
+
+void StThumbnailCache::cancelPending() {
+    StMutexAuto aLock(&myMutex);
+    for(std::deque<StString>::const_iterator aQueued = myQueue.begin(); aQueued != myQueue.end(); ++aQueued) {
+        myRequested.erase(*aQueued);
+    }
+    myQueue.clear();
+    myHasRequest.reset();
+}
+
+bool StThumbnailCache::popReady(StString&               theFilePath,
+                                StHandle<StImagePlane>& theThumb) {
+    StMutexAuto aLock(&myMutex);
+    if(myReady.empty()) {
+        return false;
+    }
+
+    theFilePath = myReady.front().FilePath;
+    theThumb    = myReady.front().Thumb;
+    myReady.pop_front();
+    return true;
+}
+
+void StThumbnailCache::processLoop() {
+    SwsContext* aScaler = NULL;
+    for(;;) {
+        myHasRequest.wait();
+        if(myToQuit) {
+            break;
+        }
+
+        StString aFilePath;
+        {
+            StMutexAuto aLock(&myMutex);
+            if(myQueue.empty()) {
+                myHasRequest.reset();
+                continue;
+            }
+            aFilePath = myQueue.front();
+            myQueue.pop_front();
+        }
+
+        Result aResult;
+        aResult.FilePath = aFilePath;
+        aResult.Thumb    = generate(aFilePath, aScaler);
+
+        StMutexAuto aLock(&myMutex);
+        myRequested.erase(aFilePath);
+        myReady.push_back(aResult);
+    }
+    sws_freeContext(aScaler);
+}
+
+StString StThumbnailCache::getCachePath(const StString& theFilePath,
+                                        const int64_t   theFileSize,
+                                        const int64_t   theModTime) const {
+    if(myCacheFolder.isEmpty()) {
+        return StString();
+    }
+
+    char aName[128];
+    stsprintf(aName, sizeof(aName), "%016llx-%llx-%llx-%dx%d.jpg",
+              (unsigned long long )hashString(theFilePath),
+              (unsigned long long )theFileSize, (unsigned long long )theModTime,
+              mySizeX, mySizeY);
+    return myCacheFolder + aName;
+}
+
+StHandle<StImagePlane> StThumbnailCache::scale(const StImagePlane& thePlane,
+                                               SwsContext*&        theScaler) {
+    const AVPixelFormat aFormat = getPixelFormat(thePlane);
+    if(thePlane.isNull()
+    || thePlane.getSizeX() < 1
+    || thePlane.getSizeY() < 1
+    || aFormat == stAV::PIX_FMT::NONE) {
+        return StHandle<StImagePlane>();
+    }
+
+    // fit into thumbnail box preserving aspect ratio
+    const double aRatio = stMin(stMin(double(mySizeX) / double(thePlane.getSizeX()),
+                                      double(mySizeY) / double(thePlane.getSizeY())), 1.0);
+    const int aSizeX = stMax(int(double(thePlane.getSizeX()) * aRatio + 0.5), 1);
+    const int aSizeY = stMax(int(double(thePlane.getSizeY()) * aRatio + 0.5), 1);
+
+    StHandle<StImagePlane> aThumb = new StImagePlane();
+    if(!aThumb->initTrash(StImagePlane::ImgRGB, aSizeX, aSizeY, aSizeX * 3)) {
+        return StHandle<StImagePlane>();
+    }
+
+    theScaler = sws_getCachedContext(theScaler,
+                                     (int )thePlane.getSizeX(), (int )thePlane.getSizeY(), aFormat,
+                                     aSizeX, aSizeY, stAV::PIX_FMT::RGB24,
+                                     SWS_BILINEAR, NULL, NULL, NULL);
+    if(theScaler == NULL) {
+        return StHandle<StImagePlane>();
+    }
+
+    uint8_t* aSrcData[4] = { (uint8_t* )thePlane.getData(), NULL, NULL, NULL };
+    int  aSrcLinesize[4] = { (int )thePlane.getSizeRowBytes(), 0, 0, 0 };
+    uint8_t* aDstData[4] = { aThumb->changeData(), NULL, NULL, NULL };
+    int  aDstLinesize[4] = { (int )aThumb->getSizeRowBytes(), 0, 0, 0 };
+    sws_scale(theScaler,
+              aSrcData, aSrcLinesize,
+              0, (int )thePlane.getSizeY(),
+              aDstData, aDstLinesize);
+    return aThumb;
+}
+
+StHandle<StImagePlane> StThumbnailCache::generate(const StString& theFilePath,
+                                                  SwsContext*&    theScaler) {
+    int64_t aFileSize = 0, aModTime = 0;
+    if(!StFileNode::getFileStats(theFilePath, aFileSize, aModTime)) {
+        return StHandle<StImagePlane>();
+    }
+
+    // previously generated thumbnail
+    StAVImage anImage;
+    const StString aCachePath = getCachePath(theFilePath, aFileSize, aModTime);
+    if(!aCachePath.isEmpty()
+    && StFileNode::isFileExists(aCachePath)
+    && anImage.loadExtra(aCachePath, StImageFile::ST_TYPE_JPEG, NULL, 0, true)) {
+        return scale(anImage.getPlane(0), theScaler);
+    }
+
+    // embedded EXIF thumbnail
+    StHandle<StImagePlane> aThumb;
+    const StImageFile::ImageType anImgType = StImageFile::guessImageType(theFilePath, StMIME());
+    if(anImgType == StImageFile::ST_TYPE_JPEG
+    || anImgType == StImageFile::ST_TYPE_MPO
+    || anImgType == StImageFile::ST_TYPE_JPS) {
+        StJpegParser aParser(theFilePath);
+        if(aParser.readFile(theFilePath, -1, THE_EXIF_READ_MAX)) {
+            StHandle<StJpegParser::Image> anImg = aParser.getImage(0);
+            if(!anImg.isNull()
+            && !anImg->Thumb.isNull()
+            &&  anImg->Thumb->Data != NULL
+            &&  anImage.loadExtra(theFilePath, StImageFile::ST_TYPE_JPEG,
+                                  anImg->Thumb->Data, (int )anImg->Thumb->Length, true)) {
+                aThumb = scale(anImage.getPlane(0), theScaler);
+            }
+        }
+    }
+
+    // decode the image itself
+    if(aThumb.isNull()) {
+        anImage.setLowResolution(THE_LOWRES_LEVEL);
+        if(anImage.loadExtra(theFilePath, anImgType, NULL, 0, true)) {
+            aThumb = scale(anImage.getPlane(0), theScaler);
+        }
+    }
+    anImage.close();
+    if(aThumb.isNull()
+    || aCachePath.isEmpty()) {
+        return aThumb;
+    }
+
+    StAVImage aCacheImage;
+    aCacheImage.setColorModel(StImage::ImgColor_RGB);
+    aCacheImage.changePlane(0).initWrapper(*aThumb);
+    StImageFile::SaveImageParams aParams;
+    aParams.SaveImageType = StImageFile::ST_TYPE_JPEG;
+    if(!aCacheImage.save(aCachePath, aParams)) {
+        ST_DEBUG_LOG("StThumbnailCache, unable to save thumbnail '" + aCachePath + "'");
+    }
+    return aThumb;
+}
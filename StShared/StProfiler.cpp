@@ -0,0 +1,202 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * This code is licensed under MIT license (see docs/license-mit.txt for details).
+ */
+
+#include <StThreads/StProfiler.h>
+
+#include <StThreads/StAtomicOp.h>
+#include <StThreads/StThread.h>
+#include <StFile/StRawFile.h>
+#include <StStrings/StLogger.h>
+
+namespace {
+
+    /**
+     * Number of oldest ring buffer elements skipped by reader,
+     * because they might be overwritten by writer at the same time.
+     */
+    static const uint32_t THE_READ_GUARD = 64;
+
+    static thread_local StProfiler* THE_SLOT_OWNER = NULL; //!< profiler owning the cached slot
+    static thread_local void*       THE_SLOT       = NULL; //!< cached slot of calling thread
+
+}
+
+StProfiler& StProfiler::GetDefault() {
+    static StProfiler THE_DEFAULT_PROFILER;
+    return THE_DEFAULT_PROFILER;
+}
+
+StProfiler::StProfiler()
+: myTimer(true),
+  myNbSlots(0),
+  myIsEnabled(false) {
+    stMemZero(mySlots, sizeof(mySlots));
+}
+
+StProfiler::~StProfiler() {
+    for(int aSlotIter = 0; aSlotIter < THREADS_MAX; ++aSlotIter) {
+        delete[] mySlots[aSlotIter].Zones;
+    }
+}
+
+void StProfiler::setEnabled(const bool theToEnable) {
+    myIsEnabled = theToEnable;
+}
+
+StProfiler::ThreadSlot* StProfiler::getThreadSlot() {
+    // slot can not be taken by another thread until released by the owner
+    if(THE_SLOT_OWNER == this) {
+        return (ThreadSlot* )THE_SLOT;
+    }
+
+    ThreadSlot* aSlot = registerThreadSlot();
+    if(aSlot != NULL) {
+        THE_SLOT_OWNER = this;
+        THE_SLOT       = aSlot;
+    }
+    return aSlot;
+}
+
+StProfiler::ThreadSlot* StProfiler::registerThreadSlot() {
+    const size_t aThreadId = StThread::getCurrentThreadId();
+    myMutex.lock();
+    const int aNbSlots = myNbSlots;
+    for(int aSlotIter = 0; aSlotIter < aNbSlots; ++aSlotIter) {
+        ThreadSlot& aSlot = mySlots[aSlotIter];
+        if(aSlot.ThreadId == aThreadId
+        && !aSlot.IsFree) {
+            myMutex.unlock();
+            return &aSlot;
+        }
+    }
+
+    for(int aSlotIter = 0; aSlotIter < aNbSlots; ++aSlotIter) {
+        ThreadSlot& aSlot = mySlots[aSlotIter];
+        if(aSlot.IsFree) {
+            // discard zones of exited thread; Head is kept growing so that concurrent readers remain consistent
+            aSlot.ThreadId = aThreadId;
+            aSlot.Name     = NULL;
+            aSlot.First    = aSlot.Head;
+            aSlot.IsFree   = false;
+            myMutex.unlock();
+            return &aSlot;
+        }
+    }
+
+    if(aNbSlots >= THREADS_MAX) {
+        myMutex.unlock();
+        return NULL;
+    }
+
+    ThreadSlot& aSlot = mySlots[aNbSlots];
+    aSlot.ThreadId = aThreadId;
+    aSlot.Name     = NULL;
+    aSlot.Head     = 0;
+    aSlot.First    = 0;
+    aSlot.IsFree   = false;
+    aSlot.Zones    = new Zone[ZONES_PER_THREAD];
+    StAtomicOp::Increment(myNbSlots);
+    myMutex.unlock();
+    return &aSlot;
+}
+
+void StProfiler::addZone(const char*  theName,
+                         const double theStartUSec,
+                         const double theEndUSec) {
+    ThreadSlot* aSlot = getThreadSlot();
+    if(aSlot == NULL) {
+        return;
+    }
+
+    Zone& aZone = aSlot->Zones[aSlot->Head & (ZONES_PER_THREAD - 1)];
+    aZone.Name       = theName;
+    aZone.StartUSec  = theStartUSec;
+    aZone.EndUSec    = theEndUSec;
+    aZone.ThreadSlot = int(aSlot - mySlots);
+    StAtomicOp::Increment(aSlot->Head);
+}
+
+void StProfiler::setThreadName(const char* theName) {
+    ThreadSlot* aSlot = getThreadSlot();
+    if(aSlot != NULL) {
+        aSlot->Name = theName;
+    }
+}
+
+void StProfiler::releaseThreadSlot() {
+    if(THE_SLOT_OWNER != this) {
+        return;
+    }
+
+    myMutex.lock();
+    ((ThreadSlot* )THE_SLOT)->IsFree = true;
+    myMutex.unlock();
+    THE_SLOT_OWNER = NULL;
+    THE_SLOT       = NULL;
+}
+
+const char* StProfiler::getThreadName(const int theSlot) const {
+    return theSlot >= 0 && theSlot < myNbSlots
+         ? mySlots[theSlot].Name
+         : NULL;
+}
+
+void StProfiler::getZones(const double       theFromUSec,
+                          std::vector<Zone>& theZones) const {
+    const int aNbSlots = myNbSlots;
+    for(int aSlotIter = 0; aSlotIter < aNbSlots; ++aSlotIter) {
+        const ThreadSlot& aSlot = mySlots[aSlotIter];
+        // read First before Head, so that First never exceeds Head
+        const uint32_t aFirst = aSlot.First;
+        const uint32_t aHead  = aSlot.Head;
+        const uint32_t aNbMax = ZONES_PER_THREAD - THE_READ_GUARD;
+        const uint32_t aNbAll = aHead - aFirst;
+        const uint32_t aNb    = aNbAll < aNbMax ? aNbAll : aNbMax;
+        // iterate from the newest zone to the oldest one
+        for(uint32_t anIter = 1; anIter <= aNb; ++anIter) {
+            const Zone& aZone = aSlot.Zones[(aHead - anIter) & (ZONES_PER_THREAD - 1)];
+            if(aZone.EndUSec < theFromUSec) {
+                break;
+            }
+            theZones.push_back(aZone);
+        }
+    }
+}
+
+bool StProfiler::exportChromeTrace(const StString& theFilePath) const {
+    std::vector<Zone> aZones;
+    getZones(0.0, aZones);
+
+    StRawFile aFile(theFilePath);
+    if(!aFile.openFile(StRawFile::WRITE)) {
+        ST_ERROR_LOG("StProfiler, unable to write trace into '" + theFilePath + "'");
+        return false;
+    }
+
+    aFile.write(stCString("{\"traceEvents\":[\n"));
+    bool isFirst = true;
+    const int aNbSlots = myNbSlots;
+    for(int aSlotIter = 0; aSlotIter < aNbSlots; ++aSlotIter) {
+        const char* aName = mySlots[aSlotIter].Name;
+        const StString aLine = StString(isFirst ? "" : ",\n")
+                             + "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + aSlotIter
+                             + ",\"args\":{\"name\":\"" + (aName != NULL ? StString(aName) : (StString("Thread ") + aSlotIter)) + "\"}}";
+        aFile.write(aLine);
+        isFirst = false;
+    }
+    for(size_t aZoneIter = 0; aZoneIter < aZones.size(); ++aZoneIter) {
+        const Zone& aZone = aZones[aZoneIter];
+        const StString aLine = StString(isFirst ? "" : ",\n")
+                             + "{\"name\":\"" + aZone.Name + "\",\"cat\":\"sView\",\"ph\":\"X\",\"pid\":1,\"tid\":" + aZone.ThreadSlot
+                             + ",\"ts\":" + aZone.StartUSec + ",\"dur\":" + (aZone.EndUSec - aZone.StartUSec) + "}";
+        aFile.write(aLine);
+        isFirst = false;
+    }
+    aFile.write(stCString("\n]}\n"));
+    aFile.closeFile();
+    ST_DEBUG_LOG("StProfiler, " + aZones.size() + " zones have been written into '" + theFilePath + "'");
+    return true;
+}
@@ -0,0 +1,84 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * This code is licensed under MIT license (see docs/license-mit.txt for details).
+ */
+
+#include <StThreads/StStartupTimeline.h>
+
+#include <StThreads/StThread.h>
+#include <StStrings/StStringBuilder.h>
+#include <StStrings/StLogger.h>
+
+#include <algorithm>
+
+namespace {
+
+    /**
+     * Sort phases by start time.
+     */
+    static bool phaseIsEarlier(const StStartupTimeline::Phase& thePhase1,
+                               const StStartupTimeline::Phase& thePhase2) {
+        return thePhase1.StartMSec < thePhase2.StartMSec;
+    }
+
+}
+
+StStartupTimeline& StStartupTimeline::GetDefault() {
+    static StStartupTimeline THE_DEFAULT_TIMELINE;
+    return THE_DEFAULT_TIMELINE;
+}
+
+StStartupTimeline::StStartupTimeline()
+: myTimer(true),
+  myMainThread(StThread::getCurrentThreadId()),
+  myIsFinished(false) {
+    myPhases.reserve(32);
+}
+
+void StStartupTimeline::addPhase(const char*  theName,
+                                 const double theStartMSec,
+                                 const double theEndMSec) {
+    Phase aPhase;
+    aPhase.Name      = theName;
+    aPhase.StartMSec = theStartMSec;
+    aPhase.EndMSec   = theEndMSec;
+    aPhase.IsMain    = StThread::getCurrentThreadId() == myMainThread;
+
+    myMutex.lock();
+    if(!myIsFinished) {
+        myPhases.push_back(aPhase);
+    }
+    myMutex.unlock();
+}
+
+void StStartupTimeline::finish() {
+    if(myIsFinished) {
+        return;
+    }
+
+    const double aFirstFrame = getTimeMilliSec();
+    myMutex.lock();
+    if(myIsFinished) {
+        myMutex.unlock();
+        return;
+    }
+    myIsFinished = true;
+    myMutex.unlock();
+
+    // phases list is not modified anymore
+    std::stable_sort(myPhases.begin(), myPhases.end(), phaseIsEarlier);
+
+    char aBuff[256];
+    stsprintf(aBuff, sizeof(aBuff), "%.1f", aFirstFrame);
+    StStringBuilder aLog;
+    aLog + "Startup timeline, first frame after " + aBuff + " ms:";
+    for(std::vector<Phase>::const_iterator aPhaseIter = myPhases.begin(); aPhaseIter != myPhases.end(); ++aPhaseIter) {
+        stsprintf(aBuff, sizeof(aBuff), "\n  %8.1f - %8.1f ms (%7.1f ms) %s %s",
+                  aPhaseIter->StartMSec, aPhaseIter->EndMSec, aPhaseIter->EndMSec - aPhaseIter->StartMSec,
+                  aPhaseIter->IsMain ? "[main]  " : "[worker]", aPhaseIter->Name);
+        aBuff[255] = '\0';
+        aLog + aBuff;
+    }
+    StLogger::GetDefault().write(aLog.toString(), StLogger::ST_INFO);
+}
@@ -1,5 +1,5 @@
 /**
- * Copyright © 2009-2017 Kirill Gavrilov <kirill@sview.ru>
+ * Copyright © 2009-2026 Kirill Gavrilov <kirill@sview.ru>
  *
  * This code is licensed under MIT license (see docs/license-mit.txt for details).
  */
@@ -21,6 +21,10 @@
     #endif
 #else
     #include <sys/types.h>
+    #include <sys/resource.h>
+    #if defined(__linux__)
+        #include <sys/syscall.h>
+    #endif
 
     #ifdef __sun
         #include <sys/processor.h>
@@ -194,6 +198,69 @@ void StThread::setCurrentThreadName(const char* theName) {
 #endif
 }
 
+bool StThread::setCurrentThreadPriority(const int thePriority) {
+    const int aPriority = stClamp(thePriority, -2, 2);
+#if defined(_WIN32)
+    static const int THE_WIN_PRIORITIES[5] = {
+        THREAD_PRIORITY_LOWEST, THREAD_PRIORITY_BELOW_NORMAL, THREAD_PRIORITY_NORMAL,
+        THREAD_PRIORITY_ABOVE_NORMAL, THREAD_PRIORITY_HIGHEST
+    };
+    return SetThreadPriority(GetCurrentThread(), THE_WIN_PRIORITIES[aPriority + 2]) != FALSE;
+#elif defined(__linux__)
+    // threads within SCHED_OTHER policy are distinguished only by per-thread nice value
+    return setpriority(PRIO_PROCESS, (id_t )syscall(SYS_gettid), -5 * aPriority) == 0;
+#else
+    int aPolicy = SCHED_OTHER;
+    sched_param aParams;
+    if(pthread_getschedparam(pthread_self(), &aPolicy, &aParams) != 0) {
+        return false;
+    }
+    const int aMin = sched_get_priority_min(aPolicy);
+    const int aMax = sched_get_priority_max(aPolicy);
+    if(aMin < 0 || aMax <= aMin) {
+        return false;
+    }
+    const int aMid = (aMin + aMax) / 2;
+    aParams.sched_priority = stClamp(aMid + aPriority * ((aMax - aMin) / 4), aMin, aMax);
+    return pthread_setschedparam(pthread_self(), aPolicy, &aParams) == 0;
+#endif
+}
+
+bool StThread::setCurrentThreadAffinity(const int theCpuIndex) {
+    if(theCpuIndex >= countLogicalProcessors()) {
+        return false;
+    }
+#if defined(_WIN32)
+    DWORD_PTR aProcessMask = 0, aSystemMask = 0;
+    if(!GetProcessAffinityMask(GetCurrentProcess(), &aProcessMask, &aSystemMask)) {
+        return false;
+    }
+    DWORD_PTR aMask = aProcessMask;
+    if(theCpuIndex >= 0) {
+        if(theCpuIndex >= int(sizeof(DWORD_PTR) * 8)) {
+            return false;
+        }
+        aMask = DWORD_PTR(1) << theCpuIndex;
+    }
+    return SetThreadAffinityMask(GetCurrentThread(), aMask) != 0;
+#elif defined(__linux__)
+    cpu_set_t aCpuSet;
+    CPU_ZERO(&aCpuSet);
+    if(theCpuIndex >= 0) {
+        CPU_SET(theCpuIndex, &aCpuSet);
+    } else {
+        const int aNbCpus = stMin(countLogicalProcessors(), int(CPU_SETSIZE));
+        for(int aCpuIter = 0; aCpuIter < aNbCpus; ++aCpuIter) {
+            CPU_SET(aCpuIter, &aCpuSet);
+        }
+    }
+    return sched_setaffinity(0, sizeof(aCpuSet), &aCpuSet) == 0; // 0 means calling thread
+#else
+    (void )theCpuIndex;
+    return false;
+#endif
+}
+
 bool StThread::wait() {
     if(!isValid()) {
         return false;
@@ -0,0 +1,185 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * This code is licensed under MIT license (see docs/license-mit.txt for details).
+ */
+
+#include <StThreads/StThreadBudget.h>
+
+#include <StThreads/StThread.h>
+#include <StStrings/StStringBuilder.h>
+#include <StStrings/StLogger.h>
+
+StThreadBudget& StThreadBudget::GetDefault() {
+    static StThreadBudget THE_DEFAULT_BUDGET(StThread::countLogicalProcessors());
+    return THE_DEFAULT_BUDGET;
+}
+
+StThreadBudget::StThreadBudget(const int theNbCpus)
+: myNbCpus(stMax(theNbCpus, 1)),
+  myNbReserved(1),
+  myLastId(0),
+  myToBoost(false) {
+    //
+}
+
+void StThreadBudget::setNbReserved(const int theNbReserved) {
+    myMutex.lock();
+    myNbReserved = stMax(theNbReserved, 0);
+    rebalance();
+    myMutex.unlock();
+}
+
+StThreadBudget::Consumer* StThreadBudget::findConsumer(const int theId) {
+    for(std::vector<Consumer>::iterator anIter = myConsumers.begin(); anIter != myConsumers.end(); ++anIter) {
+        if(anIter->Id == theId) {
+            return &(*anIter);
+        }
+    }
+    return NULL;
+}
+
+int StThreadBudget::addConsumer(const StString& theName,
+                                const double    theWeight,
+                                const int       theMaxThreads) {
+    Consumer aConsumer;
+    aConsumer.Name       = theName;
+    aConsumer.Weight     = stMax(theWeight, 0.0);
+    aConsumer.BusyMSec   = 0.0;
+    aConsumer.MaxThreads = stMax(theMaxThreads, 1);
+    aConsumer.NbThreads  = 1;
+    aConsumer.Timer.restart();
+
+    myMutex.lock();
+    aConsumer.Id = ++myLastId;
+    myConsumers.push_back(aConsumer);
+    rebalance();
+    myMutex.unlock();
+    return aConsumer.Id;
+}
+
+int StThreadBudget::changeConsumer(const int       theId,
+                                   const StString& theName,
+                                   const double    theWeight,
+                                   const int       theMaxThreads) {
+    myMutex.lock();
+    Consumer* aConsumer = findConsumer(theId);
+    if(aConsumer == NULL) {
+        myMutex.unlock();
+        return 1;
+    }
+
+    aConsumer->Name       = theName;
+    aConsumer->Weight     = stMax(theWeight, 0.0);
+    aConsumer->MaxThreads = stMax(theMaxThreads, 1);
+    aConsumer->BusyMSec   = 0.0;
+    aConsumer->Timer.restart();
+    rebalance();
+    const int aNbThreads = findConsumer(theId)->NbThreads;
+    myMutex.unlock();
+    return aNbThreads;
+}
+
+void StThreadBudget::removeConsumer(const int theId) {
+    myMutex.lock();
+    for(std::vector<Consumer>::iterator anIter = myConsumers.begin(); anIter != myConsumers.end(); ++anIter) {
+        if(anIter->Id == theId) {
+            myConsumers.erase(anIter);
+            rebalance();
+            break;
+        }
+    }
+    myMutex.unlock();
+}
+
+int StThreadBudget::getNbThreads(const int theId) const {
+    myMutex.lock();
+    int aNbThreads = 1;
+    for(std::vector<Consumer>::const_iterator anIter = myConsumers.begin(); anIter != myConsumers.end(); ++anIter) {
+        if(anIter->Id == theId) {
+            aNbThreads = anIter->NbThreads;
+            break;
+        }
+    }
+    myMutex.unlock();
+    return aNbThreads;
+}
+
+void StThreadBudget::addBusyTime(const int    theId,
+                                 const double theMSec) {
+    myMutex.lock();
+    if(Consumer* aConsumer = findConsumer(theId)) {
+        aConsumer->BusyMSec += theMSec;
+    }
+    myMutex.unlock();
+}
+
+void StThreadBudget::rebalance() {
+    // each consumer gets at least one thread, even when budget is exceeded
+    int aNbFree = stMax(myNbCpus - myNbReserved, 1);
+    for(std::vector<Consumer>::iterator anIter = myConsumers.begin(); anIter != myConsumers.end(); ++anIter) {
+        anIter->NbThreads = 1;
+        --aNbFree;
+    }
+
+    // distribute the rest one by one to the consumer with the highest weight per allocated thread
+    for(; aNbFree > 0; --aNbFree) {
+        Consumer* aBest = NULL;
+        double aBestRatio = 0.0;
+        for(std::vector<Consumer>::iterator anIter = myConsumers.begin(); anIter != myConsumers.end(); ++anIter) {
+            const double aRatio = anIter->Weight / double(anIter->NbThreads);
+            if(anIter->NbThreads < anIter->MaxThreads
+            && aRatio > aBestRatio) {
+                aBest = &(*anIter);
+                aBestRatio = aRatio;
+            }
+        }
+        if(aBest == NULL) {
+            break;
+        }
+        ++aBest->NbThreads;
+    }
+}
+
+StString StThreadBudget::formatStats() const {
+    char aBuff[256];
+    StStringBuilder aStats;
+    myMutex.lock();
+    int aNbUsed = 0;
+    for(std::vector<Consumer>::const_iterator anIter = myConsumers.begin(); anIter != myConsumers.end(); ++anIter) {
+        aNbUsed += anIter->NbThreads;
+    }
+    stsprintf(aBuff, sizeof(aBuff), "%d of %d threads (%d reserved)", aNbUsed, myNbCpus, myNbReserved);
+    aStats + aBuff;
+    for(std::vector<Consumer>::const_iterator anIter = myConsumers.begin(); anIter != myConsumers.end(); ++anIter) {
+        const double anElapsed = anIter->Timer.getElapsedTimeInMilliSec();
+        const double aBusy     = anElapsed > 0.0 ? (100.0 * anIter->BusyMSec / anElapsed) : 0.0;
+        stsprintf(aBuff, sizeof(aBuff), "\n%s: %d thread(s), weight %.2f, busy %.1f%%",
+                  anIter->Name.toCString(), anIter->NbThreads, anIter->Weight, aBusy);
+        aBuff[255] = '\0';
+        aStats + aBuff;
+    }
+    myMutex.unlock();
+    return aStats.toString();
+}
+
+bool StThreadBudget::applyThreadRole(const ThreadRole theRole) {
+    if(!myToBoost) {
+        StThread::setCurrentThreadPriority(0);
+        StThread::setCurrentThreadAffinity(-1);
+        return false;
+    }
+
+    const int aPriority = theRole == ThreadRole_Audio ? 2 : 1;
+    bool isDone = StThread::setCurrentThreadPriority(aPriority);
+
+    // dedicate processors only when there are enough of them
+    if(myNbCpus >= 4) {
+        const int aCpuIndex = theRole == ThreadRole_Audio ? (myNbCpus - 2) : (myNbCpus - 1);
+        isDone = StThread::setCurrentThreadAffinity(aCpuIndex) && isDone;
+    }
+    if(!isDone) {
+        ST_DEBUG_LOG(StString("StThreadBudget, unable to boost ") + (theRole == ThreadRole_Audio ? "audio" : "render") + " thread");
+    }
+    return isDone;
+}
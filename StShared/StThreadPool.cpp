@@ -0,0 +1,142 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * This code is licensed under MIT license (see docs/license-mit.txt for details).
+ */
+
+#include <StThreads/StThreadPool.h>
+
+#include <StThreads/StAtomicOp.h>
+
+namespace {
+
+    /**
+     * Maximum number of workers in default pool.
+     */
+    static const int THE_NB_WORKERS_MAX = 15;
+
+    /**
+     * Number of chunks per thread, greater than 1 to balance uneven load.
+     */
+    static const size_t THE_CHUNKS_PER_THREAD = 4;
+
+}
+
+SV_THREAD_FUNCTION StThreadPool::workerThread(void* theWorker) {
+    Worker* aWorker = (Worker* )theWorker;
+    aWorker->Pool->workerLoop(aWorker->Id);
+    return SV_THREAD_RETURN 0;
+}
+
+StThreadPool& StThreadPool::GetDefault() {
+    static StThreadPool THE_DEFAULT_POOL(stMin(StThread::countLogicalProcessors() - 1, THE_NB_WORKERS_MAX));
+    return THE_DEFAULT_POOL;
+}
+
+StThreadPool::StThreadPool(const int theNbWorkers)
+: myWorkers(NULL),
+  myNbWorkers(stMax(theNbWorkers, 0)),
+  myIsBusy(0),
+  myJobDone(false),
+  myFunction(NULL),
+  myUserData(NULL),
+  myNbItems(0),
+  myChunkSize(0),
+  myNbChunks(0),
+  myNextChunk(0),
+  myNbActive(0),
+  myToQuit(false) {
+    if(myNbWorkers == 0) {
+        return;
+    }
+
+    myWorkers = new Worker[myNbWorkers];
+    for(int aWorkerIter = 0; aWorkerIter < myNbWorkers; ++aWorkerIter) {
+        Worker& aWorker = myWorkers[aWorkerIter];
+        aWorker.Pool   = this;
+        aWorker.Id     = aWorkerIter;
+        aWorker.Thread = new StThread(workerThread, (void* )&aWorker, "StThreadPool");
+    }
+}
+
+StThreadPool::~StThreadPool() {
+    myToQuit = true;
+    for(int aWorkerIter = 0; aWorkerIter < myNbWorkers; ++aWorkerIter) {
+        myWorkers[aWorkerIter].Start.set();
+    }
+    for(int aWorkerIter = 0; aWorkerIter < myNbWorkers; ++aWorkerIter) {
+        myWorkers[aWorkerIter].Thread->wait();
+    }
+    delete[] myWorkers;
+}
+
+void StThreadPool::processChunks() {
+    for(;;) {
+        const int32_t aChunk = StAtomicOp::Increment(myNextChunk) - 1;
+        if(aChunk >= myNbChunks) {
+            return;
+        }
+
+        const size_t aFrom = size_t(aChunk) * myChunkSize;
+        const size_t aTo   = stMin(aFrom + myChunkSize, myNbItems);
+        myFunction(myUserData, aFrom, aTo);
+    }
+}
+
+void StThreadPool::workerLoop(const int theWorkerId) {
+    Worker& aWorker = myWorkers[theWorkerId];
+    for(;;) {
+        aWorker.Start.wait();
+        aWorker.Start.reset();
+        if(myToQuit) {
+            return;
+        }
+
+        processChunks();
+        if(StAtomicOp::Decrement(myNbActive) == 0) {
+            myJobDone.set();
+        }
+    }
+}
+
+void StThreadPool::perform(JobFunction  theFunction,
+                           void*        theUserData,
+                           const size_t theNbItems,
+                           const size_t theMinItems) {
+    if(theNbItems == 0) {
+        return;
+    }
+
+    // busy flag is not recursive (unlike StMutex),
+    // so that nested call from job function is also performed serially
+    const size_t aNbChunksMax = theNbItems / stMax(theMinItems, size_t(1));
+    if(myNbWorkers == 0
+    || aNbChunksMax < 2
+    || !StAtomicOp::CompareAndSwap(myIsBusy, 0, 1)) {
+        theFunction(theUserData, 0, theNbItems);
+        return;
+    }
+
+    const size_t aNbChunks = stMin(aNbChunksMax, size_t(myNbWorkers + 1) * THE_CHUNKS_PER_THREAD);
+    myFunction  = theFunction;
+    myUserData  = theUserData;
+    myNbItems   = theNbItems;
+    myChunkSize = (theNbItems + aNbChunks - 1) / aNbChunks;
+    myNbChunks  = int32_t((theNbItems + myChunkSize - 1) / myChunkSize);
+    myNextChunk = 0;
+
+    // wake up only workers which will get a chunk
+    const int aNbWorkers = stMin(myNbWorkers, int(myNbChunks) - 1);
+    myNbActive = aNbWorkers;
+    myJobDone.reset();
+    for(int aWorkerIter = 0; aWorkerIter < aNbWorkers; ++aWorkerIter) {
+        myWorkers[aWorkerIter].Start.set();
+    }
+
+    processChunks();
+    myJobDone.wait();
+
+    myFunction = NULL;
+    myUserData = NULL;
+    StAtomicOp::CompareAndSwap(myIsBusy, 1, 0);
+}
@@ -0,0 +1,158 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StTests program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StTests program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StTestAVIOReadAhead.h"
+
+#include <StAV/StAVIOFileContext.h>
+#include <StAV/StAVIOReadAheadContext.h>
+#include <StStrings/stConsole.h>
+#include <StThreads/StThread.h>
+
+#include <cstring>
+#include <vector>
+
+namespace {
+
+    /**
+     * File context emulating slow storage (network share, optical disc)
+     * by sleeping within each read proportionally to the amount of data.
+     */
+    class ST_LOCAL StAVIOThrottledFileContext : public StAVIOFileContext {
+
+            public:
+
+        StAVIOThrottledFileContext(const double theMiBs)
+        : myBytesPerMSec(theMiBs * 1024.0 * 1024.0 / 1000.0),
+          myDebt(0.0) {}
+
+        virtual int read(uint8_t* theBuf,
+                         int      theBufSize) ST_ATTR_OVERRIDE {
+            const int aNbRead = StAVIOFileContext::read(theBuf, theBufSize);
+            if(aNbRead > 0) {
+                myDebt += double(aNbRead) / myBytesPerMSec;
+                if(myDebt >= 1.0) {
+                    StThread::sleep(int(myDebt));
+                    myDebt -= double(int(myDebt));
+                }
+            }
+            return aNbRead;
+        }
+
+        virtual int64_t seek(int64_t theOffset,
+                             int     theWhence) ST_ATTR_OVERRIDE {
+            // emulate access latency
+            StThread::sleep(2);
+            return StAVIOFileContext::seek(theOffset, theWhence);
+        }
+
+            private:
+
+        double myBytesPerMSec;
+        double myDebt;
+
+    };
+
+    /**
+     * Read exactly the requested amount of data (AVIO callbacks might return less).
+     */
+    static int readFull(StAVIOContext& theCtx,
+                        uint8_t*       theBuf,
+                        int            theBufSize) {
+        int aNbRead = 0;
+        while(aNbRead < theBufSize) {
+            const int aRes = theCtx.read(theBuf + aNbRead, theBufSize - aNbRead);
+            if(aRes <= 0) {
+                break;
+            }
+            aNbRead += aRes;
+        }
+        return aNbRead;
+    }
+
+}
+
+StTestAVIOReadAhead::StTestAVIOReadAhead(const StString& theFile,
+                                         const double    theMiBs)
+: myFilePath(theFile),
+  mySpeedMiBs(theMiBs) {
+    //
+}
+
+void StTestAVIOReadAhead::perform() {
+    st::cout << stostream_text("Read-ahead AVIO context test\n");
+    st::cout << stostream_text("  file:   \t'") << myFilePath << stostream_text("'\n");
+
+    StAVIOFileContext aRefCtx;
+    StAVIOThrottledFileContext* aSlowCtx = new StAVIOThrottledFileContext(mySpeedMiBs);
+    StHandle<StAVIOContext> aSource = aSlowCtx;
+    if(!aRefCtx.open(myFilePath)
+    || !aSlowCtx->open(myFilePath)) {
+        st::cout << stostream_text("  file can not be opened.\n");
+        return;
+    }
+
+    const int64_t aFileSize = aRefCtx.seek(0, SEEK_END);
+    aRefCtx.seek(0, SEEK_SET);
+    if(aFileSize <= 0) {
+        st::cout << stostream_text("  file is empty.\n");
+        return;
+    }
+
+    StAVIOReadAheadContext aReadAhead(aSource, 32 * 1024 * 1024);
+
+    // consume the file like demuxer - fixed-size packets with small processing delay,
+    // seeking backward/forward from time to time
+    const int aPacketSize = 64 * 1024;
+    std::vector<uint8_t> aRefBuf(aPacketSize), aTestBuf(aPacketSize);
+    int64_t aPos = 0;
+    int aNbPackets = 0, aNbMismatches = 0;
+    srand(1);
+    myTimer.restart();
+    while(aPos < aFileSize) {
+        if(aNbPackets % 200 == 199) {
+            // near seek backward (within kept data) or far seek forward
+            const int64_t aTarget = (aNbPackets % 400 == 399)
+                                  ? stMin(aFileSize - 1, aPos + int64_t(rand() % 64) * 1024 * 1024)
+                                  : stMax(int64_t(0), aPos - int64_t(rand() % 1024) * 1024);
+            if(aRefCtx.seek(aTarget, SEEK_SET) != aTarget
+            || aReadAhead.seek(aTarget, SEEK_SET) != aTarget) {
+                st::cout << stostream_text("  seek failed!\n");
+                return;
+            }
+            aPos = aTarget;
+        }
+
+        const int aNbRef  = readFull(aRefCtx,    &aRefBuf[0],  aPacketSize);
+        const int aNbTest = readFull(aReadAhead, &aTestBuf[0], aPacketSize);
+        if(aNbRef != aNbTest
+        || std::memcmp(&aRefBuf[0], &aTestBuf[0], size_t(aNbRef)) != 0) {
+            ++aNbMismatches;
+        }
+        if(aNbRef <= 0) {
+            break;
+        }
+        aPos += aNbRef;
+        ++aNbPackets;
+        StThread::sleep(1);
+    }
+
+    st::cout << stostream_text("  read in:\t")    << myTimer.getElapsedTimeInMilliSec() << stostream_text(" msec\n");
+    st::cout << stostream_text("  packets:\t")    << aNbPackets << stostream_text("\n");
+    st::cout << stostream_text("  mismatches:\t") << aNbMismatches << stostream_text("\n");
+    st::cout << stostream_text("  ") << aReadAhead.formatStats() << stostream_text("\n");
+}
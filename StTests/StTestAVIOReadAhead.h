@@ -0,0 +1,51 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StTests program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StTests program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __StTestAVIOReadAhead_h_
+#define __StTestAVIOReadAhead_h_
+
+#include "StTest.h"
+#include <StStrings/StString.h>
+
+/**
+ * Tests read-ahead AVIO context over throttled file context:
+ * compares data with direct file reading (including random seeks)
+ * and measures time demuxer-like consumer waits for data.
+ */
+class ST_LOCAL StTestAVIOReadAhead : public StTest {
+
+        public:
+
+    /**
+     * Main constructor.
+     * @param theFile   file to read
+     * @param theMiBs   throttled source speed in MiB per second
+     */
+    StTestAVIOReadAhead(const StString& theFile,
+                        const double    theMiBs);
+
+    virtual void perform() ST_ATTR_OVERRIDE;
+
+        private:
+
+    StString myFilePath;
+    double   mySpeedMiBs;
+
+};
+
+#endif // __StTestAVIOReadAhead_h_
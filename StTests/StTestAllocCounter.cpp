@@ -0,0 +1,89 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StTests program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StTests program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StTestAllocCounter.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+    static thread_local int    THE_SCOPE_DEPTH = 0; //!< number of active scopes within the thread
+    static thread_local size_t THE_NB_ALLOCS   = 0; //!< number of counted allocations within the thread
+
+    static void* allocCounted(size_t theSize) {
+        StTestAllocCounter::onAlloc();
+        return std::malloc(theSize != 0 ? theSize : 1);
+    }
+
+}
+
+StTestAllocCounter::Scope::Scope() {
+    ++THE_SCOPE_DEPTH;
+}
+
+StTestAllocCounter::Scope::~Scope() {
+    --THE_SCOPE_DEPTH;
+}
+
+size_t StTestAllocCounter::getNbAllocs() {
+    return THE_NB_ALLOCS;
+}
+
+void StTestAllocCounter::onAlloc() {
+    if(THE_SCOPE_DEPTH > 0) {
+        ++THE_NB_ALLOCS;
+    }
+}
+
+// replaceable global allocation functions (all forms are replaced to keep them consistent)
+void* operator new(size_t theSize) {
+    void* aPtr = allocCounted(theSize);
+    if(aPtr == NULL) {
+        throw std::bad_alloc();
+    }
+    return aPtr;
+}
+
+void* operator new[](size_t theSize) {
+    return ::operator new(theSize);
+}
+
+void* operator new(size_t theSize, const std::nothrow_t& ) noexcept {
+    return allocCounted(theSize);
+}
+
+void* operator new[](size_t theSize, const std::nothrow_t& ) noexcept {
+    return allocCounted(theSize);
+}
+
+void operator delete(void* thePtr) noexcept {
+    std::free(thePtr);
+}
+
+void operator delete[](void* thePtr) noexcept {
+    std::free(thePtr);
+}
+
+void operator delete(void* thePtr, const std::nothrow_t& ) noexcept {
+    std::free(thePtr);
+}
+
+void operator delete[](void* thePtr, const std::nothrow_t& ) noexcept {
+    std::free(thePtr);
+}
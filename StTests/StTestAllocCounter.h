@@ -0,0 +1,66 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StTests program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StTests program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __StTestAllocCounter_h_
+#define __StTestAllocCounter_h_
+
+#include <stTypes.h>
+
+/**
+ * Counter of heap allocations done through global operator new (including StString buffers).
+ * Allocations are counted only within the calling thread and only while Scope object is alive,
+ * so that other tests are not affected.
+ * Allocations performed by C functions (malloc(), av_malloc()) are not included,
+ * as well as allocations within other modules on systems with DLL-local operator new (Windows).
+ */
+class ST_LOCAL StTestAllocCounter {
+
+        public:
+
+    /**
+     * Enables the counter for the current thread until destruction.
+     */
+    class Scope {
+
+            public:
+
+        Scope();
+        ~Scope();
+
+            private:
+
+        Scope(const Scope& );
+        Scope& operator=(const Scope& );
+
+    };
+
+        public:
+
+    /**
+     * Return the number of allocations counted within the current thread.
+     */
+    static size_t getNbAllocs();
+
+    /**
+     * Count allocation if the counter is enabled for the current thread.
+     */
+    static void onAlloc();
+
+};
+
+#endif // __StTestAllocCounter_h_
@@ -0,0 +1,322 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StTests program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StTests program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StTestImageKernels.h"
+
+#include <StImage/StImageKernels.h>
+#include <StStrings/stConsole.h>
+#include <StThreads/StThreadPool.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+    static const size_t THE_SIZE_X     = 3840;
+    static const size_t THE_SIZE_Y     = 2160;
+    static const size_t THE_ROW_EXTRA  = 64;
+    static const int    THE_NB_REPEATS = 10;
+
+    /**
+     * Tested operation.
+     */
+    enum Operation {
+        Operation_Copy,
+        Operation_Flip,
+        Operation_Split,
+        Operation_Transpose,
+        Operation_Expand,
+        Operation_Reduce,
+        Operation_NB
+    };
+
+    static const char* THE_OPERATION_NAMES[Operation_NB] = {
+        "copy     ",
+        "flip     ",
+        "split    ",
+        "transpose",
+        "8->16    ",
+        "16->8    ",
+    };
+
+    /**
+     * Buffers for one test pass.
+     */
+    struct StKernelsFrame {
+        size_t               PixelSize;
+        size_t               SrcStride;
+        size_t               DstStride;
+        std::vector<uint8_t> Src;
+        std::vector<uint8_t> Dst;
+
+        StKernelsFrame(const size_t thePixelSize)
+        : PixelSize(thePixelSize),
+          SrcStride(THE_SIZE_X * thePixelSize + THE_ROW_EXTRA),
+          DstStride(stMax(THE_SIZE_X, THE_SIZE_Y) * thePixelSize * 2),
+          Src(SrcStride * THE_SIZE_Y),
+          Dst(DstStride * stMax(THE_SIZE_X, THE_SIZE_Y)) {
+            uint32_t aSeed = 1;
+            for(size_t anIter = 0; anIter < Src.size(); ++anIter) {
+                aSeed = aSeed * 1664525u + 1013904223u;
+                Src[anIter] = uint8_t(aSeed >> 24);
+            }
+        }
+    };
+
+    /**
+     * Reference implementation - row and pixel loops as used before kernels.
+     */
+    static void performReference(const Operation theOper,
+                                 StKernelsFrame& theFrame) {
+        const size_t   aPixelSize = theFrame.PixelSize;
+        const size_t   aRowBytes  = THE_SIZE_X * aPixelSize;
+        const uint8_t* aSrc = &theFrame.Src[0];
+        uint8_t*       aDst = &theFrame.Dst[0];
+        switch(theOper) {
+            case Operation_Copy: {
+                for(size_t aRow = 0; aRow < THE_SIZE_Y; ++aRow) {
+                    stMemCpy(aDst + aRow * theFrame.DstStride, aSrc + aRow * theFrame.SrcStride, aRowBytes);
+                }
+                return;
+            }
+            case Operation_Flip: {
+                for(size_t aRow = 0; aRow < THE_SIZE_Y; ++aRow) {
+                    stMemCpy(aDst + (THE_SIZE_Y - 1 - aRow) * theFrame.DstStride, aSrc + aRow * theFrame.SrcStride, aRowBytes);
+                }
+                return;
+            }
+            case Operation_Split: {
+                const size_t aHalfBytes = aRowBytes / 2;
+                for(size_t aRow = 0; aRow < THE_SIZE_Y; ++aRow) {
+                    for(size_t aCol = 0; aCol < THE_SIZE_X / 2; ++aCol) {
+                        stMemCpy(aDst + aRow * theFrame.DstStride + aCol * aPixelSize,
+                                 aSrc + aRow * theFrame.SrcStride + (aCol * 2) * aPixelSize, aPixelSize);
+                        stMemCpy(aDst + aRow * theFrame.DstStride + aHalfBytes + aCol * aPixelSize,
+                                 aSrc + aRow * theFrame.SrcStride + (aCol * 2 + 1) * aPixelSize, aPixelSize);
+                    }
+                }
+                return;
+            }
+            case Operation_Transpose: {
+                // clockwise rotation
+                for(size_t aDstRow = 0; aDstRow < THE_SIZE_X; ++aDstRow) {
+                    const size_t aSrcCol = THE_SIZE_X - 1 - aDstRow;
+                    for(size_t aDstCol = 0; aDstCol < THE_SIZE_Y; ++aDstCol) {
+                        stMemCpy(aDst + aDstRow * theFrame.DstStride + aDstCol * aPixelSize,
+                                 aSrc + aDstCol * theFrame.SrcStride + aSrcCol * aPixelSize, aPixelSize);
+                    }
+                }
+                return;
+            }
+            case Operation_Expand: {
+                uint16_t* aDst16 = (uint16_t* )aDst;
+                for(size_t anIter = 0, aNb = theFrame.Src.size(); anIter < aNb; ++anIter) {
+                    aDst16[anIter] = uint16_t(aSrc[anIter]) * 257;
+                }
+                return;
+            }
+            case Operation_Reduce: {
+                const uint16_t* aSrc16 = (const uint16_t* )aSrc;
+                for(size_t anIter = 0, aNb = theFrame.Src.size() / 2; anIter < aNb; ++anIter) {
+                    aDst[anIter] = uint8_t(aSrc16[anIter] >> 8);
+                }
+                return;
+            }
+            case Operation_NB: return;
+        }
+    }
+
+    /**
+     * The same operations performed by kernels.
+     */
+    static void performKernels(const Operation theOper,
+                               StKernelsFrame& theFrame) {
+        const size_t   aPixelSize = theFrame.PixelSize;
+        const size_t   aRowBytes  = THE_SIZE_X * aPixelSize;
+        const uint8_t* aSrc = &theFrame.Src[0];
+        uint8_t*       aDst = &theFrame.Dst[0];
+        switch(theOper) {
+            case Operation_Copy: {
+                StImageKernels::copyRows(aDst, ptrdiff_t(theFrame.DstStride), aSrc, ptrdiff_t(theFrame.SrcStride), aRowBytes, THE_SIZE_Y);
+                return;
+            }
+            case Operation_Flip: {
+                StImageKernels::copyRows(aDst + (THE_SIZE_Y - 1) * theFrame.DstStride, -ptrdiff_t(theFrame.DstStride),
+                                         aSrc, ptrdiff_t(theFrame.SrcStride), aRowBytes, THE_SIZE_Y);
+                return;
+            }
+            case Operation_Split: {
+                StImageKernels::splitColumns(aDst, aDst + aRowBytes / 2, ptrdiff_t(theFrame.DstStride),
+                                             aSrc, ptrdiff_t(theFrame.SrcStride), THE_SIZE_X / 2, aPixelSize, THE_SIZE_Y);
+                return;
+            }
+            case Operation_Transpose: {
+                StImageKernels::transpose(aDst + (THE_SIZE_X - 1) * theFrame.DstStride, -ptrdiff_t(theFrame.DstStride),
+                                          aSrc, ptrdiff_t(theFrame.SrcStride), THE_SIZE_X, THE_SIZE_Y, aPixelSize);
+                return;
+            }
+            case Operation_Expand: {
+                StImageKernels::expand8to16((uint16_t* )aDst, aSrc, theFrame.Src.size());
+                return;
+            }
+            case Operation_Reduce: {
+                StImageKernels::reduce16to8(aDst, (const uint16_t* )aSrc, theFrame.Src.size() / 2);
+                return;
+            }
+            case Operation_NB: return;
+        }
+    }
+
+
+    static const size_t THE_NESTED_ROWS = 64;
+    static const size_t THE_NESTED_COLS = 4096;
+
+    /**
+     * Arguments of nested thread pool job.
+     */
+    struct StNestedJob {
+        uint32_t* Data; //!< THE_NESTED_ROWS x THE_NESTED_COLS values
+        size_t    Row;  //!< row processed by inner job
+    };
+
+    /**
+     * Inner job - fill columns of one row.
+     */
+    static void performNestedInner(void*        theUserData,
+                                   const size_t theFrom,
+                                   const size_t theTo) {
+        const StNestedJob* aJob = (const StNestedJob* )theUserData;
+        for(size_t aCol = theFrom; aCol < theTo; ++aCol) {
+            aJob->Data[aJob->Row * THE_NESTED_COLS + aCol] += uint32_t(aJob->Row * THE_NESTED_COLS + aCol);
+        }
+    }
+
+    /**
+     * Outer job - perform inner job for each row through the same pool.
+     */
+    static void performNestedOuter(void*        theUserData,
+                                   const size_t theFrom,
+                                   const size_t theTo) {
+        for(size_t aRow = theFrom; aRow < theTo; ++aRow) {
+            StNestedJob anInner;
+            anInner.Data = (uint32_t* )theUserData;
+            anInner.Row  = aRow;
+            StThreadPool::GetDefault().perform(performNestedInner, &anInner, THE_NESTED_COLS, 64);
+        }
+    }
+
+    /**
+     * Check that nested jobs do not interfere with outer job.
+     * @return number of wrong values
+     */
+    static size_t performNested() {
+        std::vector<uint32_t> aData(THE_NESTED_ROWS * THE_NESTED_COLS, 0);
+        StThreadPool::GetDefault().perform(performNestedOuter, &aData[0], THE_NESTED_ROWS, 1);
+        size_t aNbWrong = 0;
+        for(size_t anIter = 0; anIter < aData.size(); ++anIter) {
+            if(aData[anIter] != uint32_t(anIter)) {
+                ++aNbWrong;
+            }
+        }
+        return aNbWrong;
+    }
+
+}
+
+void StTestImageKernels::perform() {
+    const StImageKernels::SimdLevel aLevelMax = StImageKernels::getSimdLevelMax();
+    const StImageKernels::SimdLevel aLevelOld = StImageKernels::getSimdLevel();
+    const bool isMultiThreadedOld = StImageKernels::isMultiThreaded();
+    st::cout << stostream_text("Image kernels tests (") << THE_SIZE_X << stostream_text("x") << THE_SIZE_Y
+             << stostream_text(" frame, ") << THE_NB_REPEATS << stostream_text(" repeats, ")
+             << StThreadPool::GetDefault().getNbThreads() << stostream_text(" threads).\n");
+
+    std::vector<StImageKernels::SimdLevel> aLevels;
+    aLevels.push_back(StImageKernels::SimdLevel_Scalar);
+    if(aLevelMax == StImageKernels::SimdLevel_AVX2) {
+        aLevels.push_back(StImageKernels::SimdLevel_SSE2);
+    }
+    if(aLevelMax != StImageKernels::SimdLevel_Scalar) {
+        aLevels.push_back(aLevelMax);
+    }
+
+    static const size_t THE_PIXEL_SIZES[3] = { 1, 3, 4 };
+    size_t aNbFailed = 0;
+    for(size_t aSizeIter = 0; aSizeIter < 3; ++aSizeIter) {
+        const size_t aPixelSize = THE_PIXEL_SIZES[aSizeIter];
+        StKernelsFrame aFrame(aPixelSize);
+        std::vector<uint8_t> aRefDst;
+        st::cout << stostream_text("Pixel size ") << aPixelSize << stostream_text(" bytes:\n");
+        for(int anOperIter = 0; anOperIter < Operation_NB; ++anOperIter) {
+            const Operation anOper = (Operation )anOperIter;
+            if(aPixelSize != 1
+            && (anOper == Operation_Expand || anOper == Operation_Reduce)) {
+                continue;
+            }
+
+            std::fill(aFrame.Dst.begin(), aFrame.Dst.end(), 0);
+            myTimer.restart();
+            for(int aRepeatIter = 0; aRepeatIter < THE_NB_REPEATS; ++aRepeatIter) {
+                performReference(anOper, aFrame);
+            }
+            st::cout << stostream_text("  ") << THE_OPERATION_NAMES[anOper]
+                     << stostream_text(" reference:\t") << (myTimer.getElapsedTimeInMilliSec() / double(THE_NB_REPEATS))
+                     << stostream_text(" msec\n");
+            aRefDst = aFrame.Dst;
+
+            for(size_t aLevelIter = 0; aLevelIter < aLevels.size(); ++aLevelIter) {
+                StImageKernels::setSimdLevel(aLevels[aLevelIter]);
+                for(int aThreadsIter = 0; aThreadsIter < 2; ++aThreadsIter) {
+                    StImageKernels::setMultiThreaded(aThreadsIter == 1);
+                    std::fill(aFrame.Dst.begin(), aFrame.Dst.end(), 0);
+                    myTimer.restart();
+                    for(int aRepeatIter = 0; aRepeatIter < THE_NB_REPEATS; ++aRepeatIter) {
+                        performKernels(anOper, aFrame);
+                    }
+                    const double aTimeMSec = myTimer.getElapsedTimeInMilliSec() / double(THE_NB_REPEATS);
+                    const bool   isEqual   = std::memcmp(&aRefDst[0], &aFrame.Dst[0], aRefDst.size()) == 0;
+                    if(!isEqual) {
+                        ++aNbFailed;
+                    }
+                    st::cout << stostream_text("  ") << THE_OPERATION_NAMES[anOper]
+                             << stostream_text(" ") << StImageKernels::getSimdLevelName(aLevels[aLevelIter])
+                             << (aThreadsIter == 1 ? stostream_text(" MT") : stostream_text("   "))
+                             << stostream_text(":\t") << aTimeMSec << stostream_text(" msec")
+                             << (isEqual ? stostream_text("\n") : stostream_text(" MISMATCH!\n"));
+                }
+            }
+        }
+    }
+
+    StImageKernels::setSimdLevel(aLevelOld);
+    StImageKernels::setMultiThreaded(isMultiThreadedOld);
+
+    const size_t aNbNestedWrong = performNested();
+    st::cout << stostream_text("Nested thread pool job: ")
+             << (aNbNestedWrong == 0 ? stostream_text("OK\n") : stostream_text("MISMATCH!\n"));
+    if(aNbNestedWrong != 0) {
+        ++aNbFailed;
+    }
+
+    if(aNbFailed != 0) {
+        st::cout << st::COLOR_FOR_RED << aNbFailed << stostream_text(" test(s) FAILED!\n") << st::COLOR_FOR_WHITE;
+    } else {
+        st::cout << st::COLOR_FOR_GREEN << stostream_text("All results match reference.\n") << st::COLOR_FOR_WHITE;
+    }
+}
@@ -0,0 +1,38 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StTests program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StTests program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __StTestImageKernels_h_
+#define __StTestImageKernels_h_
+
+#include "StTest.h"
+
+/**
+ * Tests image plane kernels (StImageKernels):
+ * compares results with reference per-row and per-pixel routines
+ * and measures time for each instruction set with and without threads.
+ * Also checks nested StThreadPool jobs.
+ */
+class ST_LOCAL StTestImageKernels : public StTest {
+
+        public:
+
+    virtual void perform() ST_ATTR_OVERRIDE;
+
+};
+
+#endif // __StTestImageKernels_h_
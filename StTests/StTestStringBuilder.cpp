@@ -0,0 +1,139 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StTests program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StTests program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StTestStringBuilder.h"
+#include "StTestAllocCounter.h"
+
+#include <StStrings/StStringBuilder.h>
+#include <StStrings/StFormatTime.h>
+#include <StStrings/stConsole.h>
+
+namespace {
+
+    static const int THE_NB_REPEATS = 100000;
+
+    /**
+     * Tested pattern.
+     */
+    enum Pattern {
+        Pattern_Short, //!< short message fitting into inline storage
+        Pattern_Log,   //!< debug log message with numbers
+        Pattern_Time,  //!< time label "position / duration"
+        Pattern_Web,   //!< web UI response
+        Pattern_NB
+    };
+
+    static const char* THE_PATTERN_NAMES[Pattern_NB] = {
+        "short",
+        "log  ",
+        "time ",
+        "web  ",
+    };
+
+    static StString formatOperators(const Pattern theMode,
+                                    const int     theIter) {
+        const double aPos = double(theIter) * 0.04;
+        switch(theMode) {
+            case Pattern_Short: {
+                return StString("Frame #") + theIter;
+            }
+            case Pattern_Log: {
+                return StString("StVideoQueue, decoded frame #") + theIter + " pts= " + aPos
+                     + " queue size= " + (theIter % 16) + " dropped= " + (theIter / 1000);
+            }
+            case Pattern_Time: {
+                return StFormatTime::formatSeconds(aPos) + " / " + StFormatTime::formatSeconds(3600.0);
+            }
+            case Pattern_Web: {
+                return StString() + (theIter / 100) + ":" + (theIter % 100) + ":" + "Some Movie Title (2026).mkv"
+                     + ":" + int(aPos) + ":" + 7200 + ":" + int((theIter & 1) != 0);
+            }
+            case Pattern_NB: break;
+        }
+        return StString();
+    }
+
+    static StString formatBuilder(const Pattern theMode,
+                                  const int     theIter) {
+        const double aPos = double(theIter) * 0.04;
+        switch(theMode) {
+            case Pattern_Short: {
+                return (StStringBuilder() + "Frame #" + theIter).toString();
+            }
+            case Pattern_Log: {
+                return (StStringBuilder() + "StVideoQueue, decoded frame #" + theIter + " pts= " + aPos
+                      + " queue size= " + (theIter % 16) + " dropped= " + (theIter / 1000)).toString();
+            }
+            case Pattern_Time: {
+                return (StStringBuilder() + StFormatTime::formatSeconds(aPos) + " / " + StFormatTime::formatSeconds(3600.0)).toString();
+            }
+            case Pattern_Web: {
+                return (StStringBuilder() + (theIter / 100) + ":" + (theIter % 100) + ":" + "Some Movie Title (2026).mkv"
+                      + ":" + int(aPos) + ":" + 7200 + ":" + int((theIter & 1) != 0)).toString();
+            }
+            case Pattern_NB: break;
+        }
+        return StString();
+    }
+
+}
+
+void StTestStringBuilder::perform() {
+    st::cout << stostream_text("String concatenation tests (") << THE_NB_REPEATS << stostream_text(" repeats")
+             << stostream_text(", inline storage ") << int(StString::THE_INLINE_BYTES) << stostream_text(" bytes).\n");
+
+    size_t aNbFailed = 0;
+    for(int aModeIter = 0; aModeIter < Pattern_NB; ++aModeIter) {
+        const Pattern aMode = (Pattern )aModeIter;
+        for(int aRepeatIter = 0; aRepeatIter < THE_NB_REPEATS / 100; ++aRepeatIter) {
+            if(formatOperators(aMode, aRepeatIter) != formatBuilder(aMode, aRepeatIter)) {
+                ++aNbFailed;
+                break;
+            }
+        }
+
+        for(int aBuilderIter = 0; aBuilderIter < 2; ++aBuilderIter) {
+            size_t aSizeSumm = 0;
+            size_t aNbAllocs = 0;
+            myTimer.restart();
+            {
+                StTestAllocCounter::Scope anAllocScope;
+                const size_t aNbAllocsStart = StTestAllocCounter::getNbAllocs();
+                for(int aRepeatIter = 0; aRepeatIter < THE_NB_REPEATS; ++aRepeatIter) {
+                    const StString aStr = aBuilderIter == 0
+                                        ? formatOperators(aMode, aRepeatIter)
+                                        : formatBuilder  (aMode, aRepeatIter);
+                    aSizeSumm += aStr.getSize();
+                }
+                aNbAllocs = StTestAllocCounter::getNbAllocs() - aNbAllocsStart;
+            }
+            const double aTimeUSec = myTimer.getElapsedTimeInMicroSec() / double(THE_NB_REPEATS);
+            st::cout << stostream_text("  ") << THE_PATTERN_NAMES[aMode]
+                     << (aBuilderIter == 0 ? stostream_text(" operator+:") : stostream_text(" builder:  "))
+                     << stostream_text("\t") << aTimeUSec << stostream_text(" usec")
+                     << stostream_text(",\t") << (double(aNbAllocs) / double(THE_NB_REPEATS)) << stostream_text(" allocations");
+            st::cout << stostream_text(" (") << (aSizeSumm / size_t(THE_NB_REPEATS)) << stostream_text(" bytes)\n");
+        }
+    }
+
+    if(aNbFailed != 0) {
+        st::cout << st::COLOR_FOR_RED << aNbFailed << stostream_text(" test(s) FAILED!\n") << st::COLOR_FOR_WHITE;
+    } else {
+        st::cout << st::COLOR_FOR_GREEN << stostream_text("All results match.\n") << st::COLOR_FOR_WHITE;
+    }
+}
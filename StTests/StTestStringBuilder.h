@@ -0,0 +1,37 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StTests program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StTests program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __StTestStringBuilder_h_
+#define __StTestStringBuilder_h_
+
+#include "StTest.h"
+
+/**
+ * Compares string concatenation through chained StString::operator+
+ * with StStringBuilder on typical patterns (log message, time label, web response):
+ * checks that results are equal and measures time and number of heap allocations per string.
+ */
+class ST_LOCAL StTestStringBuilder : public StTest {
+
+        public:
+
+    virtual void perform() ST_ATTR_OVERRIDE;
+
+};
+
+#endif // __StTestStringBuilder_h_
@@ -0,0 +1,492 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StTests program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StTests program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StTestVideoBench.h"
+#include "StTestAllocCounter.h"
+
+#include <StAV/StAVImage.h>
+#include <StAV/StAVFrame.h>
+#include <StAV/StAVPacket.h>
+
+#include <StCore/StWindow.h>
+
+#include <StGL/StGLContext.h>
+#include <StGLCore/StGLCore20.h>
+#include <StGLStereo/StGLTextureData.h>
+#include <StGLStereo/StGLQuadTexture.h>
+#include <StGLStereo/StGLTextureUploadParams.h>
+
+#include <StFile/StRawFile.h>
+#include <StStrings/stConsole.h>
+#include <StThreads/StAtomicOp.h>
+#include <StThreads/StThread.h>
+
+#include <algorithm>
+
+namespace {
+
+    /**
+     * Upper bounds of latency histogram buckets, in microseconds.
+     */
+    static const double THE_HISTO_BOUNDS[] = {
+        100.0, 250.0, 500.0, 1000.0, 2500.0, 5000.0, 10000.0, 25000.0, 50000.0, 100000.0
+    };
+    static const size_t THE_HISTO_NB = sizeof(THE_HISTO_BOUNDS) / sizeof(THE_HISTO_BOUNDS[0]);
+
+    static const char* THE_STAGE_NAMES[StTestVideoBench::Stage_NB] = {
+        "demux", "decode", "prepare", "update", "upload"
+    };
+
+    /**
+     * Escape the string for JSON output.
+     */
+    static StString jsonEscape(const StString& theStr) {
+        return theStr.replace(stCString("\\"), stCString("\\\\"))
+                     .replace(stCString("\""),  stCString("\\\""));
+    }
+
+    /**
+     * Return percentile from sorted array.
+     */
+    static double getPercentile(const std::vector<double>& theSorted,
+                                const double               thePercent) {
+        if(theSorted.empty()) {
+            return 0.0;
+        }
+        const size_t anIndex = std::min(theSorted.size() - 1, size_t(thePercent * 0.01 * double(theSorted.size())));
+        return theSorted[anIndex];
+    }
+
+    /**
+     * Wrap decoded frame into StImage without copying when possible
+     * or convert it into RGB using software scaler, as done by StVideoQueue::prepareFrame().
+     * @return false if frame has unsupported format
+     */
+    static bool prepareFrame(AVCodecContext*                  theCodecCtx,
+                             StAVFrame&                       theFrame,
+                             const StGLDeviceCaps&            theDevCaps,
+                             StHandle<StAVFrameCounter>&      theFrameBufRef,
+                             StImage&                         theDataAdp,
+                             StImagePlane&                    theDataRGB,
+                             SwsContext*&                     theToRgbCtx,
+                             bool&                            theHasSwsConv) {
+        int           aFrameSizeX = 0;
+        int           aFrameSizeY = 0;
+        AVPixelFormat aPixFmt     = stAV::PIX_FMT::NONE;
+        stAV::dimYUV  aDimsYUV;
+        theFrame.getImageInfo(theCodecCtx, aFrameSizeX, aFrameSizeY, aPixFmt);
+        theDataAdp.nullify();
+        theDataAdp.setBufferCounter(NULL);
+        if(aPixFmt == stAV::PIX_FMT::RGB24
+        && theDevCaps.isSupportedFormat(StImagePlane::ImgRGB)) {
+            theDataAdp.setColorModel(StImage::ImgColor_RGB);
+            theDataAdp.setColorScale(StImage::ImgScale_Full);
+            theDataAdp.changePlane(0).initWrapper(StImagePlane::ImgRGB, theFrame.getPlane(0),
+                                                  size_t(aFrameSizeX), size_t(aFrameSizeY),
+                                                  theFrame.getLineSize(0));
+            return true;
+        } else if(aPixFmt == stAV::PIX_FMT::RGBA32
+               && theDevCaps.isSupportedFormat(StImagePlane::ImgRGBA)) {
+            theDataAdp.setColorModel(StImage::ImgColor_RGBA);
+            theDataAdp.setColorScale(StImage::ImgScale_Full);
+            theDataAdp.changePlane(0).initWrapper(StImagePlane::ImgRGBA, theFrame.getPlane(0),
+                                                  size_t(aFrameSizeX), size_t(aFrameSizeY),
+                                                  theFrame.getLineSize(0));
+            return true;
+        } else if(stAV::isFormatYUVPlanar(theFrame.Frame, aDimsYUV)) {
+            StImagePlane::ImgFormat aPlaneFrmt = StImagePlane::ImgGray;
+            if(theCodecCtx->color_range == AVCOL_RANGE_JPEG) {
+                aDimsYUV.isFullScale = true;
+            }
+            theDataAdp.setColorScale(aDimsYUV.isFullScale ? StImage::ImgScale_Full : StImage::ImgScale_Mpeg);
+            if(aDimsYUV.bitsPerComp == 9) {
+                aPlaneFrmt = StImagePlane::ImgGray16;
+                theDataAdp.setColorScale(aDimsYUV.isFullScale ? StImage::ImgScale_Jpeg9  : StImage::ImgScale_Mpeg9);
+            } else if(aDimsYUV.bitsPerComp == 10) {
+                aPlaneFrmt = StImagePlane::ImgGray16;
+                theDataAdp.setColorScale(aDimsYUV.isFullScale ? StImage::ImgScale_Jpeg10 : StImage::ImgScale_Mpeg10);
+            } else if(aDimsYUV.bitsPerComp == 16) {
+                aPlaneFrmt = StImagePlane::ImgGray16;
+            }
+
+            if(theDevCaps.isSupportedFormat(aPlaneFrmt)) {
+                theDataAdp.setColorModel(aDimsYUV.hasAlpha ? StImage::ImgColor_YUVA : StImage::ImgColor_YUV);
+                theDataAdp.changePlane(0).initWrapper(aPlaneFrmt, theFrame.getPlane(0),
+                                                      size_t(aDimsYUV.widthY), size_t(aDimsYUV.heightY), theFrame.getLineSize(0));
+                theDataAdp.changePlane(1).initWrapper(aPlaneFrmt, theFrame.getPlane(1),
+                                                      size_t(aDimsYUV.widthU), size_t(aDimsYUV.heightU), theFrame.getLineSize(1));
+                theDataAdp.changePlane(2).initWrapper(aPlaneFrmt, theFrame.getPlane(2),
+                                                      size_t(aDimsYUV.widthV), size_t(aDimsYUV.heightV), theFrame.getLineSize(2));
+                if(aDimsYUV.hasAlpha) {
+                    theDataAdp.changePlane(3).initWrapper(aPlaneFrmt, theFrame.getPlane(3),
+                                                          size_t(aDimsYUV.widthY), size_t(aDimsYUV.heightY), theFrame.getLineSize(3));
+                }
+                theFrameBufRef->moveReferenceFrom(theFrame.Frame);
+                theDataAdp.setBufferCounter(theFrameBufRef);
+                return true;
+            }
+        } else if(aPixFmt == stAV::PIX_FMT::NV12) {
+            const bool isFullScale = theCodecCtx->color_range == AVCOL_RANGE_JPEG;
+            theDataAdp.setColorScale(isFullScale ? StImage::ImgScale_NvFull : StImage::ImgScale_NvMpeg);
+            theDataAdp.setColorModel(StImage::ImgColor_YUV);
+            theDataAdp.changePlane(0).initWrapper(StImagePlane::ImgGray, theFrame.getPlane(0),
+                                                  size_t(aFrameSizeX), size_t(aFrameSizeY), theFrame.getLineSize(0));
+            theDataAdp.changePlane(1).initWrapper(StImagePlane::ImgUV, theFrame.getPlane(1),
+                                                  size_t(aFrameSizeX / 2), size_t(aFrameSizeY / 2), theFrame.getLineSize(1));
+            theFrameBufRef->moveReferenceFrom(theFrame.Frame);
+            theDataAdp.setBufferCounter(theFrameBufRef);
+            return true;
+        }
+
+        if(aFrameSizeX <= 0
+        || aFrameSizeY <= 0) {
+            return false;
+        }
+
+        theToRgbCtx = sws_getCachedContext(theToRgbCtx,
+                                           aFrameSizeX, aFrameSizeY, aPixFmt,              // source
+                                           aFrameSizeX, aFrameSizeY, stAV::PIX_FMT::RGB24, // destination
+                                           SWS_BICUBIC, NULL, NULL, NULL);
+        if(theToRgbCtx == NULL) {
+            return false;
+        }
+        if(size_t(aFrameSizeX) != theDataRGB.getSizeX()
+        || size_t(aFrameSizeY) != theDataRGB.getSizeY()) {
+            if(!theDataRGB.initTrash(StImagePlane::ImgRGB, size_t(aFrameSizeX), size_t(aFrameSizeY))) {
+                return false;
+            }
+        }
+
+        theHasSwsConv = true;
+        uint8_t* aDstData[4]     = { theDataRGB.changeData(), NULL, NULL, NULL };
+        int      aDstLineSize[4] = { (int )theDataRGB.getSizeRowBytes(), 0, 0, 0 };
+        sws_scale(theToRgbCtx,
+                  theFrame.Frame->data, theFrame.Frame->linesize,
+                  0, aFrameSizeY,
+                  aDstData, aDstLineSize);
+        theDataAdp.setColorModel(StImage::ImgColor_RGB);
+        theDataAdp.setColorScale(StImage::ImgScale_Full);
+        theDataAdp.changePlane(0).initWrapper(StImagePlane::ImgRGB, theDataRGB.changeData(),
+                                              size_t(aFrameSizeX), size_t(aFrameSizeY));
+        return true;
+    }
+
+}
+
+StTestVideoBench::StTestVideoBench(const StString& theFile,
+                                   const StString& theJsonFile,
+                                   const bool      theToUpload)
+: myFilePath(theFile),
+  myJsonPath(theJsonFile),
+  myToUpload(theToUpload),
+  myStageStartUSec(0.0),
+  myStageStartAllocs(0),
+  mySizeX(0),
+  mySizeY(0),
+  myNbThreads(0),
+  myNbFrames(0),
+  myNbPackets(0),
+  myBytesUploaded(0.0),
+  myTotalSec(0.0),
+  myHasSwsConv(false),
+  myNbFrameBuffers(0) {
+    //
+}
+
+int StTestVideoBench::getFrameBuffer(AVCodecContext* theCodecCtx,
+                                     AVFrame*        theFrame,
+                                     int             theFlags) {
+    StTestVideoBench* aBench = (StTestVideoBench* )theCodecCtx->opaque;
+    StAtomicOp::Increment(aBench->myNbFrameBuffers);
+    return avcodec_default_get_buffer2(theCodecCtx, theFrame, theFlags);
+}
+
+void StTestVideoBench::stageBegin() {
+    myStageStartAllocs = StTestAllocCounter::getNbAllocs();
+    myStageStartUSec   = myTimer.getElapsedTimeInMicroSec();
+}
+
+void StTestVideoBench::stageEnd(const Stage theStage,
+                                const bool  theToCommit) {
+    StageStats& aStage = myStages[theStage];
+    aStage.PendingUSec   += myTimer.getElapsedTimeInMicroSec() - myStageStartUSec;
+    aStage.PendingAllocs += StTestAllocCounter::getNbAllocs() - myStageStartAllocs;
+    if(!theToCommit) {
+        return;
+    }
+
+    aStage.Samples.push_back(aStage.PendingUSec);
+    aStage.Allocs += aStage.PendingAllocs;
+    aStage.PendingUSec   = 0.0;
+    aStage.PendingAllocs = 0;
+}
+
+StString StTestVideoBench::formatStageJson(const Stage theStage) const {
+    const StageStats& aStage = myStages[theStage];
+    std::vector<double> aSorted = aStage.Samples;
+    std::sort(aSorted.begin(), aSorted.end());
+
+    double aTotal = 0.0;
+    size_t aHisto[THE_HISTO_NB + 1];
+    stMemZero(aHisto, sizeof(aHisto));
+    for(std::vector<double>::const_iterator aSampleIter = aSorted.begin(); aSampleIter != aSorted.end(); ++aSampleIter) {
+        aTotal += *aSampleIter;
+        size_t aBucket = 0;
+        for(; aBucket < THE_HISTO_NB && *aSampleIter > THE_HISTO_BOUNDS[aBucket]; ++aBucket) {}
+        ++aHisto[aBucket];
+    }
+
+    const size_t aNbSamples = aSorted.size();
+    StString aJson = StString()
+        + "    \"" + THE_STAGE_NAMES[theStage] + "\": {\n"
+        + "      \"count\": "   + aNbSamples + ",\n"
+        + "      \"allocs\": "  + aStage.Allocs + ",\n"
+        + "      \"totalMs\": " + (aTotal * 0.001) + ",\n"
+        + "      \"avgUs\": "   + (aNbSamples != 0 ? aTotal / double(aNbSamples) : 0.0) + ",\n"
+        + "      \"minUs\": "   + (aNbSamples != 0 ? aSorted.front() : 0.0) + ",\n"
+        + "      \"p50Us\": "   + getPercentile(aSorted, 50.0) + ",\n"
+        + "      \"p95Us\": "   + getPercentile(aSorted, 95.0) + ",\n"
+        + "      \"p99Us\": "   + getPercentile(aSorted, 99.0) + ",\n"
+        + "      \"maxUs\": "   + (aNbSamples != 0 ? aSorted.back() : 0.0) + ",\n"
+        + "      \"histogram\": [";
+    for(size_t aBucket = 0; aBucket <= THE_HISTO_NB; ++aBucket) {
+        aJson += StString(aBucket != 0 ? ", " : "")
+               + "{\"le\": " + (aBucket < THE_HISTO_NB ? StString(THE_HISTO_BOUNDS[aBucket]) : StString("null"))
+               + ", \"count\": " + aHisto[aBucket] + "}";
+    }
+    aJson += "]\n    }";
+    return aJson;
+}
+
+StString StTestVideoBench::formatJson() const {
+    const double aTotalSec = myTotalSec > 0.0 ? myTotalSec : 1.0;
+    StString aJson = StString()
+        + "{\n"
+        + "  \"file\": \""   + jsonEscape(myFilePath) + "\",\n"
+        + "  \"codec\": \""  + jsonEscape(myCodecName) + "\",\n"
+        + "  \"pixFmt\": \"" + jsonEscape(myPixFmtName) + "\",\n"
+        + "  \"width\": "    + mySizeX + ",\n"
+        + "  \"height\": "   + mySizeY + ",\n"
+        + "  \"threads\": "  + myNbThreads + ",\n"
+        + "  \"upload\": "   + (myToUpload ? "true" : "false") + ",\n"
+        + "  \"swscale\": "  + (myHasSwsConv ? "true" : "false") + ",\n"
+        + "  \"packets\": "  + myNbPackets + ",\n"
+        + "  \"frames\": "   + myNbFrames + ",\n"
+        + "  \"totalSec\": " + myTotalSec + ",\n"
+        + "  \"fps\": "      + (double(myNbFrames) / aTotalSec) + ",\n"
+        + "  \"uploadMiBps\": " + (myBytesUploaded / aTotalSec / (1024.0 * 1024.0)) + ",\n"
+        + "  \"allocs\": {\n"
+        + "    \"heap\": "         + (myStages[Stage_Demux].Allocs  + myStages[Stage_Decode].Allocs
+                                    + myStages[Stage_Prepare].Allocs + myStages[Stage_Update].Allocs
+                                    + myStages[Stage_Upload].Allocs) + ",\n"
+        + "    \"frameBuffers\": " + int32_t(myNbFrameBuffers) + "\n"
+        + "  },\n"
+        + "  \"stages\": {\n";
+    for(int aStageIter = 0; aStageIter < Stage_NB; ++aStageIter) {
+        aJson += formatStageJson(Stage(aStageIter));
+        aJson += (aStageIter + 1 < Stage_NB) ? ",\n" : "\n";
+    }
+    aJson += "  }\n}\n";
+    return aJson;
+}
+
+void StTestVideoBench::perform() {
+    // count heap allocations of pipeline stages (executed within this thread)
+    StTestAllocCounter::Scope anAllocScope;
+    st::cout << stostream_text("Video pipeline benchmark\n");
+    st::cout << stostream_text("  file:   \t'") << myFilePath << stostream_text("'\n");
+    stAV::init();
+
+    AVFormatContext* aFormatCtx = NULL;
+    int anErr = avformat_open_input(&aFormatCtx, myFilePath.toCString(), NULL, NULL);
+    if(anErr != 0) {
+        st::cout << stostream_text("  Error! Couldn't open file: ") << stAV::getAVErrorDescription(anErr) << stostream_text("\n");
+        return;
+    }
+    if(avformat_find_stream_info(aFormatCtx, NULL) < 0) {
+        st::cout << stostream_text("  Error! Couldn't find stream information\n");
+        avformat_close_input(&aFormatCtx);
+        return;
+    }
+
+    const int aStreamId = av_find_best_stream(aFormatCtx, AVMEDIA_TYPE_VIDEO, -1, -1, NULL, 0);
+    if(aStreamId < 0) {
+        st::cout << stostream_text("  Error! Video stream not found\n");
+        avformat_close_input(&aFormatCtx);
+        return;
+    }
+
+    AVStream*       aStream   = aFormatCtx->streams[aStreamId];
+    const AVCodec*  aCodec    = avcodec_find_decoder(aStream->codecpar->codec_id);
+    AVCodecContext* aCodecCtx = avcodec_alloc_context3(NULL);
+    if(aCodec == NULL
+    || avcodec_parameters_to_context(aCodecCtx, aStream->codecpar) < 0) {
+        st::cout << stostream_text("  Error! Video codec not found\n");
+        avcodec_free_context(&aCodecCtx);
+        avformat_close_input(&aFormatCtx);
+        return;
+    }
+
+    // same threading settings as StVideoQueue::initCodec()
+    myNbThreads = stAV::isAttachedPicture(aStream) ? 1 : StThread::countLogicalProcessors();
+    aCodecCtx->thread_count = myNbThreads;
+    aCodecCtx->opaque       = this;
+    aCodecCtx->get_buffer2  = StTestVideoBench::getFrameBuffer;
+    if(avcodec_open2(aCodecCtx, aCodec, NULL) < 0) {
+        st::cout << stostream_text("  Error! Could not open video codec\n");
+        avcodec_free_context(&aCodecCtx);
+        avformat_close_input(&aFormatCtx);
+        return;
+    }
+    myCodecName = aCodec->name;
+
+    // create hidden window holding OpenGL context
+    StHandle<StWindow>    aWin;
+    StHandle<StGLContext> aCtx;
+    StGLDeviceCaps aDevCaps;
+    if(myToUpload) {
+        aWin = new StWindow();
+        aWin->setPlacement(StRectI_t(0, 256, 0, 256));
+        aWin->setTitle("sView - Tests");
+        aWin->create();
+        aWin->hide();
+        aWin->stglMakeCurrent();
+        aCtx = new StGLContext(true);
+        aDevCaps = aCtx->getDeviceCaps();
+    } else {
+        // emulate desktop OpenGL device supporting all image formats
+        for(int aFormatIter = 0; aFormatIter < StImagePlane::ImgNB; ++aFormatIter) {
+            aDevCaps.setSupportedFormat(StImagePlane::ImgFormat(aFormatIter), true);
+        }
+    }
+    // keep memory usage the same as within StMoviePlayer
+    aDevCaps.hasUnpack = true;
+
+    StHandle<StGLTextureUploadParams> anUploadParams = new StGLTextureUploadParams();
+    StHandle<StStereoParams>          aStParams      = new StStereoParams();
+    StHandle<StAVFrameCounter>        aFrameBufRef   = new StAVFrameCounter();
+    StGLTextureData aTextureData(anUploadParams);
+    StGLQuadTexture aQTexture;
+    StAVFrame       aFrame;
+    StImage         aDataAdp, anEmpty;
+    StImagePlane    aDataRGB;
+    SwsContext*     aToRgbCtx = NULL;
+    AVPacket*       aPacket   = av_packet_alloc();
+
+    myTimer.restart();
+    bool isEndOfFile = false;
+    while(!isEndOfFile) {
+        stageBegin();
+        const bool isRead = av_read_frame(aFormatCtx, aPacket) >= 0;
+        stageEnd(Stage_Demux);
+        if(!isRead) {
+            // flush decoder
+            isEndOfFile = true;
+        } else if(aPacket->stream_index != aStreamId) {
+            av_packet_unref(aPacket);
+            continue;
+        } else {
+            ++myNbPackets;
+        }
+
+        stageBegin();
+        avcodec_send_packet(aCodecCtx, isEndOfFile ? NULL : aPacket);
+        stageEnd(Stage_Decode, false);
+        av_packet_unref(aPacket);
+        for(;;) {
+            stageBegin();
+            const int aRes = avcodec_receive_frame(aCodecCtx, aFrame.Frame);
+            stageEnd(Stage_Decode, aRes >= 0);
+            if(aRes < 0) {
+                break;
+            }
+
+            ++myNbFrames;
+            const double aPts = double(aFrame.getBestEffortTimestamp()) * av_q2d(aStream->time_base);
+            if(myPixFmtName.isEmpty()) {
+                myPixFmtName = stAV::PIX_FMT::getString((AVPixelFormat )aFrame.Frame->format);
+                mySizeX = aFrame.Frame->width;
+                mySizeY = aFrame.Frame->height;
+            }
+
+            stageBegin();
+            const bool isPrepared = prepareFrame(aCodecCtx, aFrame, aDevCaps, aFrameBufRef,
+                                                 aDataAdp, aDataRGB, aToRgbCtx, myHasSwsConv);
+            stageEnd(Stage_Prepare);
+            if(!isPrepared) {
+                av_frame_unref(aFrame.Frame);
+                continue;
+            }
+
+            double aFrameBytes = 0.0;
+            for(size_t aPlaneIter = 0; aPlaneIter < 4; ++aPlaneIter) {
+                const StImagePlane& aPlane = aDataAdp.getPlane(aPlaneIter);
+                if(!aPlane.isNull()) {
+                    aFrameBytes += double(aPlane.getSizeX() * aPlane.getSizePixelBytes() * aPlane.getSizeY());
+                }
+            }
+
+            stageBegin();
+            aTextureData.updateData(aDevCaps, aDataAdp, anEmpty, aStParams,
+                                    StFormat_Mono, StCubemap_OFF, aPts);
+            stageEnd(Stage_Update);
+            aDataAdp.nullify();
+            av_frame_unref(aFrame.Frame);
+
+            if(!aCtx.isNull()) {
+                stageBegin();
+                while(!aTextureData.fillTexture(*aCtx, aQTexture)) {}
+                aCtx->core20fwd->glFinish();
+                stageEnd(Stage_Upload);
+                myBytesUploaded += aFrameBytes;
+            }
+        }
+    }
+    myTotalSec = myTimer.getElapsedTimeInSec();
+
+    st::cout << stostream_text("  codec:  \t") << myCodecName << stostream_text(" (") << myPixFmtName << stostream_text(")\n");
+    st::cout << stostream_text("  frames: \t") << myNbFrames << stostream_text(" in ") << myTotalSec << stostream_text(" sec\n");
+    st::cout << stostream_text("  FPS:    \t") << (myTotalSec > 0.0 ? double(myNbFrames) / myTotalSec : 0.0) << stostream_text("\n");
+
+    // release resources
+    av_packet_free(&aPacket);
+    sws_freeContext(aToRgbCtx);
+    aTextureData.reset();
+    if(!aCtx.isNull()) {
+        aQTexture.release(*aCtx);
+        aCtx.nullify();
+        aWin.nullify();
+    }
+    avcodec_free_context(&aCodecCtx);
+    avformat_close_input(&aFormatCtx);
+
+    const StString aJson = formatJson();
+    if(myJsonPath.isEmpty()) {
+        st::cout << aJson;
+        return;
+    }
+
+    StRawFile aFile(myJsonPath);
+    if(!aFile.openFile(StRawFile::WRITE)) {
+        st::cout << stostream_text("  Error! Couldn't write report into '") << myJsonPath << stostream_text("'\n");
+        return;
+    }
+    aFile.write(aJson.toCString(), aJson.getSize());
+    aFile.closeFile();
+    st::cout << stostream_text("  report: \t'") << myJsonPath << stostream_text("'\n");
+}
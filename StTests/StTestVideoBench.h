@@ -0,0 +1,141 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * StTests program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StTests program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public
+ * License along with this program.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __StTestVideoBench_h_
+#define __StTestVideoBench_h_
+
+#include "StTest.h"
+
+#include <StStrings/StString.h>
+
+#include <vector>
+
+struct AVCodecContext;
+struct AVFrame;
+
+/**
+ * Headless benchmark of the video playback pipeline:
+ * demux -> decode -> prepare frame -> StGLTextureData::updateData() -> texture upload.
+ * Each stage is executed as fast as possible (no A/V sync or frame dropping)
+ * and measured separately; the result is written in JSON format
+ * so that numbers of different builds can be compared by scripts.
+ *
+ * Texture upload is performed within OpenGL context of hidden window;
+ * use software OpenGL implementation (e.g. Mesa llvmpipe) on nodes without GPU
+ * or disable upload stage at all.
+ */
+class ST_LOCAL StTestVideoBench : public StTest {
+
+        public:
+
+    /**
+     * Pipeline stages measured by the test.
+     */
+    enum Stage {
+        Stage_Demux = 0, //!< av_read_frame()
+        Stage_Decode,    //!< avcodec_send_packet() + avcodec_receive_frame()
+        Stage_Prepare,   //!< wrapping decoded frame into StImage or software conversion into RGB
+        Stage_Update,    //!< StGLTextureData::updateData()
+        Stage_Upload,    //!< StGLTextureData::fillTexture() + glFinish()
+        Stage_NB
+    };
+
+        public:
+
+    /**
+     * Main constructor.
+     * @param theFile     video file to decode
+     * @param theJsonFile output file for JSON report (empty string means console output)
+     * @param theToUpload perform upload into OpenGL textures
+     */
+    StTestVideoBench(const StString& theFile,
+                     const StString& theJsonFile,
+                     const bool      theToUpload);
+
+    virtual void perform() ST_ATTR_OVERRIDE;
+
+        private:
+
+    /**
+     * Per-stage statistics.
+     */
+    struct StageStats {
+        std::vector<double> Samples;       //!< measured latencies in microseconds
+        size_t              Allocs;        //!< number of heap allocations performed within stage
+        double              PendingUSec;   //!< accumulated time of not yet committed sample
+        size_t              PendingAllocs; //!< accumulated allocations of not yet committed sample
+
+        StageStats() : Allocs(0), PendingUSec(0.0), PendingAllocs(0) {}
+    };
+
+    /**
+     * Wrapper over avcodec_default_get_buffer2() counting frame buffer requests.
+     */
+    static int getFrameBuffer(AVCodecContext* theCodecCtx,
+                              AVFrame*        theFrame,
+                              int             theFlags);
+
+    /**
+     * Start stage measurement.
+     */
+    void stageBegin();
+
+    /**
+     * Finish stage measurement.
+     * @param theStage    measured stage
+     * @param theToCommit when FALSE, the measured time will be accumulated and added to the next committed sample;
+     *                    this is used for decoder polling calls which do not return frame
+     */
+    void stageEnd(const Stage theStage,
+                  const bool  theToCommit = true);
+
+    /**
+     * Format report in JSON format.
+     */
+    StString formatJson() const;
+
+    /**
+     * Format statistics of single stage in JSON format.
+     */
+    StString formatStageJson(const Stage theStage) const;
+
+        private:
+
+    StString   myFilePath;
+    StString   myJsonPath;
+    bool       myToUpload;
+
+    StageStats myStages[Stage_NB];
+    double     myStageStartUSec;    //!< timestamp of currently measured stage
+    size_t     myStageStartAllocs;  //!< allocations counter at the beginning of currently measured stage
+
+    StString   myCodecName;
+    StString   myPixFmtName;
+    int        mySizeX;
+    int        mySizeY;
+    int        myNbThreads;
+    size_t     myNbFrames;
+    size_t     myNbPackets;
+    double     myBytesUploaded;
+    double     myTotalSec;
+    bool       myHasSwsConv;
+    volatile int32_t myNbFrameBuffers; //!< number of frame buffers requested by decoder (get_buffer2 calls)
+
+};
+
+#endif // __StTestVideoBench_h_
@@ -25,6 +25,10 @@
 #include "StTestEmbed.h"
 #include "StTestImageLib.h"
 #include "StTestGlStress.h"
+#include "StTestVideoBench.h"
+#include "StTestAVIOReadAhead.h"
+#include "StTestImageKernels.h"
+#include "StTestStringBuilder.h"
 
 #ifndef __APPLE__
 int main(int , char** ) { // force console output
@@ -55,8 +59,15 @@ int main(int , char** ) { // force console output
     const StString ST_TEST_GLHANG  = "glhang";
     const StString ST_TEST_EMBED   = "embed";
     const StString ST_TEST_IMAGE   = "image";
+    const StString ST_TEST_VIDEO   = "video";
+    const StString ST_TEST_VIDCPU  = "videocpu";
+    const StString ST_TEST_AVIO    = "avio";
+    const StString ST_TEST_KERNELS = "kernels";
+    const StString ST_TEST_STRINGS = "strings";
     const StString ST_TEST_ALL     = "all";
+    const StString ST_NO_PAUSE     = "nopause";
     size_t aFound = 0;
+    bool toPause = true;
     for(size_t anArgId = 0; anArgId < anArgs.size(); ++anArgId) {
         const StString& aParam = anArgs[anArgId];
         if(aParam == ST_TEST_MUTICES) {
@@ -89,6 +100,54 @@ int main(int , char** ) { // force console output
             StTestImageLib anImage(anArgs[anArgId]);
             anImage.perform();
             ++aFound;
+        } else if(aParam == ST_TEST_VIDEO
+               || aParam == ST_TEST_VIDCPU) {
+            // video decoding pipeline benchmark
+            if(++anArgId >= anArgs.size()) {
+                st::cout << stostream_text("Broken syntax - video file awaited!\n");
+                break;
+            }
+
+            const StString aVideoPath = anArgs[anArgId];
+            StString aJsonPath;
+            if(anArgId + 1 < anArgs.size()
+            && anArgs[anArgId + 1].isEndsWithIgnoreCase(stCString(".json"))) {
+                aJsonPath = anArgs[++anArgId];
+            }
+            StTestVideoBench aVideoBench(aVideoPath, aJsonPath, aParam == ST_TEST_VIDEO);
+            aVideoBench.perform();
+            ++aFound;
+        } else if(aParam == ST_TEST_AVIO) {
+            // read-ahead I/O over throttled file
+            if(++anArgId >= anArgs.size()) {
+                st::cout << stostream_text("Broken syntax - file awaited!\n");
+                break;
+            }
+
+            const StString aFilePath = anArgs[anArgId];
+            double aSpeedMiBs = 20.0;
+            if(anArgId + 1 < anArgs.size()) {
+                const double aSpeed = std::atof(anArgs[anArgId + 1].toCString());
+                if(aSpeed > 0.0) {
+                    aSpeedMiBs = aSpeed;
+                    ++anArgId;
+                }
+            }
+            StTestAVIOReadAhead aReadAhead(aFilePath, aSpeedMiBs);
+            aReadAhead.perform();
+            ++aFound;
+        } else if(aParam == ST_TEST_KERNELS) {
+            // image plane kernels
+            StTestImageKernels aKernels;
+            aKernels.perform();
+            ++aFound;
+        } else if(aParam == ST_TEST_STRINGS) {
+            // string concatenation
+            StTestStringBuilder aStrings;
+            aStrings.perform();
+            ++aFound;
+        } else if(aParam == ST_NO_PAUSE) {
+            toPause = false;
         } else if(aParam == ST_TEST_ALL) {
             // mutex speed test
             StTestMutex aMutices;
@@ -115,10 +174,18 @@ int main(int , char** ) { // force console output
                  << stostream_text("  glband - gl <-> cpu trasfer speed test\n")
                  << stostream_text("  glhang - gl stress test\n")
                  << stostream_text("  embed  - test window embedding\n")
-                 << stostream_text("  image fileName - test image libraries\n");
+                 << stostream_text("  image fileName - test image libraries\n")
+                 << stostream_text("  video fileName [report.json] - video decoding and texture upload benchmark\n")
+                 << stostream_text("  videocpu fileName [report.json] - video decoding benchmark without OpenGL\n")
+                 << stostream_text("  avio fileName [MiB/s] - read-ahead I/O over throttled file\n")
+                 << stostream_text("  kernels - image plane kernels test\n")
+                 << stostream_text("  strings - string concatenation and allocations test\n")
+                 << stostream_text("  nopause - do not wait for key press on exit\n");
     }
 
-    st::cout << stostream_text("Press any key to exit...") << st::SYS_PAUSE_EMPTY;
+    if(toPause) {
+        st::cout << stostream_text("Press any key to exit...") << st::SYS_PAUSE_EMPTY;
+    }
     return 0;
 }
 #endif
@@ -8,6 +8,7 @@
 #define __StAVIOFileContext_h_
 
 #include <StAV/StAVIOContext.h>
+#include <StStrings/StString.h>
 
 /**
  * Custom AVIO context for the file.
@@ -37,6 +38,11 @@ class StAVIOFileContext : public StAVIOContext {
      */
     ST_CPPEXPORT bool openFromDescriptor(int theFD, const char* theMode);
 
+    /**
+     * Open the file for reading.
+     */
+    ST_CPPEXPORT bool open(const StCString& thePath);
+
     /**
      * Read from the file.
      */
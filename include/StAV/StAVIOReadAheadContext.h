@@ -0,0 +1,138 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * This code is licensed under MIT license (see docs/license-mit.txt for details).
+ */
+
+#ifndef __StAVIOReadAheadContext_h_
+#define __StAVIOReadAheadContext_h_
+
+#include <StAV/StAVIOContext.h>
+#include <StStrings/StString.h>
+#include <StThreads/StCondition.h>
+#include <StThreads/StMutex.h>
+#include <StThreads/StThread.h>
+
+/**
+ * Custom AVIO context reading another (slow) context ahead of demuxer in a dedicated I/O thread.
+ * Data is stored in a ring buffer; the read-ahead window starts small and grows (up to the ring size)
+ * each time demuxer has to wait for data.
+ * Seeking within already read data (including small part of consumed data) just relocates the read position,
+ * while seeking outside of the buffer discards it and restarts reading from new position.
+ */
+class StAVIOReadAheadContext : public StAVIOContext {
+
+        public:
+
+    /**
+     * Read-ahead statistics.
+     */
+    struct Stats {
+        int     NbStalls;       //!< number of times demuxer waited for data
+        double  StallSec;       //!< overall time demuxer waited for data
+        int     NbSeeks;        //!< number of seeks within the buffer
+        int     NbSeeksFar;     //!< number of seeks discarding the buffer
+        int64_t BytesRead;      //!< overall number of bytes read from source
+        double  ReadSec;        //!< overall time spent in reading source
+        size_t  WindowBytes;    //!< current read-ahead window
+        size_t  FilledBytes;    //!< currently buffered bytes ahead of demuxer
+
+        /**
+         * @return source throughput in MiB per second
+         */
+        double getThroughputMiBs() const {
+            return ReadSec > 0.0 ? (double(BytesRead) / (1024.0 * 1024.0)) / ReadSec : 0.0;
+        }
+    };
+
+        public:
+
+    /**
+     * Main constructor.
+     * @param theSource      source context to read from (only read() and seek() methods are used)
+     * @param theWindowBytes maximum read-ahead window (ring buffer size)
+     */
+    ST_CPPEXPORT StAVIOReadAheadContext(const StHandle<StAVIOContext>& theSource,
+                                        const size_t                   theWindowBytes);
+
+    /**
+     * Destructor, stops I/O thread.
+     */
+    ST_CPPEXPORT virtual ~StAVIOReadAheadContext();
+
+    /**
+     * @return source context
+     */
+    ST_LOCAL const StHandle<StAVIOContext>& getSource() const { return mySource; }
+
+    /**
+     * Retrieve statistics.
+     */
+    ST_CPPEXPORT Stats getStats() const;
+
+    /**
+     * Format statistics into a string (empty if nothing has been read).
+     */
+    ST_CPPEXPORT StString formatStats() const;
+
+    /**
+     * Read buffered data, waits for I/O thread when buffer is empty.
+     */
+    ST_CPPEXPORT virtual int read(uint8_t* theBuf,
+                                  int      theBufSize) ST_ATTR_OVERRIDE;
+
+    /**
+     * Writing is not supported.
+     */
+    ST_CPPEXPORT virtual int write(const uint8_t* theBuf,
+                                   const int      theBufSize) ST_ATTR_OVERRIDE;
+
+    /**
+     * Seek within the buffer or request I/O thread to relocate source.
+     */
+    ST_CPPEXPORT virtual int64_t seek(int64_t theOffset,
+                                      int     theWhence) ST_ATTR_OVERRIDE;
+
+    /**
+     * I/O thread function.
+     */
+    ST_LOCAL void readLoop();
+
+        private:
+
+    /**
+     * Update events from current state (should be called under lock).
+     */
+    ST_LOCAL void updateEvents();
+
+    /**
+     * @return number of bytes which can be read from source into ring buffer (should be called under lock)
+     */
+    ST_LOCAL size_t getFreeBytes() const;
+
+        private:
+
+    StHandle<StAVIOContext> mySource;     //!< source context
+    StHandle<StThread>      myThread;     //!< I/O thread
+    mutable StMutex         myMutex;      //!< lock for buffer state
+    StCondition             myHasData;    //!< event indicating non-empty buffer (or end of stream)
+    StCondition             myHasSpace;   //!< event indicating job for I/O thread
+    uint8_t*                myRing;       //!< ring buffer
+    size_t                  myRingSize;   //!< ring buffer size
+    size_t                  myWindow;     //!< current read-ahead window
+    size_t                  myHead;       //!< ring index of demuxer position
+    size_t                  myFilled;     //!< number of buffered bytes ahead of demuxer position
+    size_t                  myBackBytes;  //!< number of already consumed bytes kept before demuxer position
+    int64_t                 myPosition;   //!< file offset of demuxer position
+    int64_t                 myFileSize;   //!< file size or -1 if unknown
+    int64_t                 mySeekTarget; //!< pending seek position for I/O thread, -1 if none
+    int                     myGeneration; //!< buffer generation increased by discarding seeks
+    int                     myError;      //!< read error or AVERROR_EOF at the end of buffered data
+    Stats                   myStats;      //!< statistics
+    volatile bool           myToQuit;     //!< flag to stop I/O thread
+
+};
+
+ST_DEFINE_HANDLE(StAVIOReadAheadContext, StAVIOContext);
+
+#endif // __StAVIOReadAheadContext_h_
@@ -64,6 +64,19 @@ class StAVImage : public StImageFile {
      */
     virtual StHandle<StImageFile> createEmpty() const ST_ATTR_OVERRIDE { return new StAVImage(); }
 
+    /**
+     * Return reduced resolution decoding level.
+     */
+    ST_LOCAL int getLowResolution() const { return myLowRes; }
+
+    /**
+     * Request decoding at reduced resolution (1/2 per level) for decoders supporting it (JPEG),
+     * which is much faster than decoding full image when only preview is needed.
+     * Decoded image size is reduced accordingly; other decoders ignore this option.
+     * @param theLevel reduction level, 0 means full resolution
+     */
+    ST_LOCAL void setLowResolution(const int theLevel) { myLowRes = theLevel; }
+
     /**
      * Close currently opened image context and release memory.
      */
@@ -99,6 +112,7 @@ class StAVImage : public StImageFile {
     AVCodecContext*  myCodecCtx;  //!< codec context
     const AVCodec*   myCodec;     //!< codec
     StAVFrame        myFrame;
+    int              myLowRes;    //!< reduced resolution decoding level
 
 };
 
@@ -582,6 +582,24 @@ class StWindow {
      */
     ST_CPPEXPORT void stglSwap(const int theWinEnum);
 
+    /**
+     * @return true if slave window has dedicated GL context (sharing resources with master one),
+     * which can be bound within another thread by stglMakeCurrentDetached()
+     */
+    ST_CPPEXPORT bool hasSlaveGlContext() const;
+
+    /**
+     * Make GL context for specified window active in current thread without modifying shared StGLContext.
+     * Intended for dedicated render thread managing its own StGLContext instance.
+     * @param theWinEnum subwindow to activate GL context
+     */
+    ST_CPPEXPORT bool stglMakeCurrentDetached(const int theWinEnum);
+
+    /**
+     * Release GL context active in current thread.
+     */
+    ST_CPPEXPORT void stglReleaseCurrent();
+
     /**
      * @return upload time in seconds
      */
@@ -21,6 +21,22 @@ class StFTFontRegistry {
 
         public:
 
+    /**
+     * Start initialization of the shared registry in background thread,
+     * so that scanning of system fonts overlaps with window creation and other startup steps.
+     * Does nothing if shared registry has been already created.
+     */
+    ST_CPPEXPORT static void PrefetchDefault();
+
+    /**
+     * Return the shared registry initialized with default search paths.
+     * Waits for initialization started by PrefetchDefault() or initializes the registry within calling thread.
+     * Shared registry should not be modified.
+     */
+    ST_CPPEXPORT static StHandle<StFTFontRegistry> GetDefault();
+
+        public:
+
     /**
      * Default constructor.
      */
@@ -213,6 +213,17 @@ class StFileNode : public StNode {
      */
     ST_CPPEXPORT static bool isFileExists(const StCString& thePath);
 
+    /**
+     * Retrieve file size and modification time.
+     * @param thePath     file path
+     * @param theSize     file size in bytes
+     * @param theModTime  modification time in seconds since epoch
+     * @return true if file exists
+     */
+    ST_CPPEXPORT static bool getFileStats(const StCString& thePath,
+                                          int64_t&         theSize,
+                                          int64_t&         theModTime);
+
     /**
      * @param thePath file path
      * @return true if file/folder has read-only flag
@@ -388,6 +388,102 @@ class StGLContext {
      */
     ST_CPPEXPORT void stglBindFramebuffer(const GLuint theFramebuffer);
 
+        public: //! @name state cache
+
+    /**
+     * Counters of state-changing calls passed through StGLContext.
+     */
+    struct StateCounters {
+        unsigned int NbIssued;  //!< number of calls passed to OpenGL
+        unsigned int NbSkipped; //!< number of redundant calls skipped
+    };
+
+    enum {
+        STATE_TEXTURE_UNITS_MAX  = 32, //!< number of texture units tracked by state cache
+        STATE_VERTEX_ATTRIBS_MAX = 32, //!< number of vertex attributes tracked by state cache
+    };
+
+    /**
+     * Invalidate the cache of OpenGL state, so that next calls will be passed to OpenGL.
+     * Should be called after OpenGL state has been modified bypassing StGLContext
+     * (by another context bound to the same window or by third-party library).
+     */
+    ST_CPPEXPORT void resetStateCache();
+
+    /**
+     * Return counters of state-changing calls for the last finished frame.
+     */
+    ST_LOCAL const StateCounters& getStateCounters() const { return myStateCntFrame; }
+
+    /**
+     * Finish counting of state-changing calls for the frame (should be called on buffers swap).
+     */
+    ST_CPPEXPORT void resetStateCounters();
+
+    /**
+     * Install program object (glUseProgram()), redundant call is skipped.
+     */
+    ST_CPPEXPORT void stglUseProgram(const GLuint theProgram);
+
+    /**
+     * Select active texture unit (glActiveTexture()), redundant call is skipped.
+     */
+    ST_CPPEXPORT void stglActiveTexture(const GLenum theTextureUnit);
+
+    /**
+     * Bind texture to specified texture unit and make this unit active (glActiveTexture() + glBindTexture()).
+     * Redundant calls are skipped.
+     */
+    ST_CPPEXPORT void stglBindTexture(const GLenum theTextureUnit,
+                                      const GLenum theTarget,
+                                      const GLuint theTexture);
+
+    /**
+     * Bind buffer object (glBindBuffer()).
+     * Redundant call is skipped for GL_ARRAY_BUFFER and GL_ELEMENT_ARRAY_BUFFER targets.
+     */
+    ST_CPPEXPORT void stglBindBuffer(const GLenum theTarget,
+                                     const GLuint theBuffer);
+
+    /**
+     * Enable or disable generic vertex attribute array (glEnableVertexAttribArray()/glDisableVertexAttribArray()),
+     * redundant call is skipped.
+     */
+    ST_CPPEXPORT void stglSetVertexAttribArray(const GLuint theLocation,
+                                               const bool   theToEnable);
+
+    /**
+     * Enable or disable blending (GL_BLEND), redundant call is skipped.
+     */
+    ST_CPPEXPORT void stglSetBlend(const bool theToEnable);
+
+    /**
+     * Enable or disable depth test (GL_DEPTH_TEST), redundant call is skipped.
+     */
+    ST_CPPEXPORT void stglSetDepthTest(const bool theToEnable);
+
+    /**
+     * Enable or disable face culling (GL_CULL_FACE), redundant call is skipped.
+     */
+    ST_CPPEXPORT void stglSetCullFace(const bool theToEnable);
+
+    /**
+     * Remove texture object from the state cache (should be called on texture deletion).
+     */
+    ST_CPPEXPORT void stglOnDeleteTexture(const GLuint theTexture);
+
+    /**
+     * Remove buffer object from the state cache (should be called on buffer deletion).
+     */
+    ST_CPPEXPORT void stglOnDeleteBuffer(const GLuint theBuffer);
+
+    /**
+     * Remove program object from the state cache (should be called on program deletion).
+     */
+    ST_CPPEXPORT void stglOnDeleteProgram(const GLuint theProgram);
+
+        public:
+
     /**
      * Fill bits information from currently bound FBO.
      */
@@ -486,6 +582,36 @@ class StGLContext {
     GLuint                  myFramebufferRead;    //!< bound read buffer
     bool                    myIsBound;            //!< flag indicating make current state
 
+        protected: //! @name state cache
+
+    /**
+     * Texture bound to the texture unit.
+     */
+    struct TextureBinding {
+        GLenum Target; //!< texture target, 0 if unknown
+        GLuint Id;     //!< texture object
+    };
+
+    /**
+     * Enable or disable capability with redundant call skipped.
+     */
+    ST_LOCAL void stglSetCapability(const GLenum theCap,
+                                    GLint&       theState,
+                                    const bool   theToEnable);
+
+    GLuint                  myStateProgram;       //!< current program
+    GLenum                  myStateActiveTexture; //!< active texture unit, 0 if unknown
+    TextureBinding          myStateTextures[STATE_TEXTURE_UNITS_MAX]; //!< textures bound to texture units
+    GLuint                  myStateArrayBuffer;   //!< buffer bound to GL_ARRAY_BUFFER
+    GLuint                  myStateElementBuffer; //!< buffer bound to GL_ELEMENT_ARRAY_BUFFER
+    uint32_t                myStateAttribsKnown;  //!< mask of vertex attribute arrays with known state
+    uint32_t                myStateAttribsOn;     //!< mask of enabled vertex attribute arrays
+    GLint                   myStateBlend;         //!< GL_BLEND state, -1 if unknown
+    GLint                   myStateDepthTest;     //!< GL_DEPTH_TEST state, -1 if unknown
+    GLint                   myStateCullFace;      //!< GL_CULL_FACE state, -1 if unknown
+    StateCounters           myStateCnt;           //!< counters of the current frame
+    StateCounters           myStateCntFrame;      //!< counters of the last finished frame
+
 };
 
 #endif // __StGLContext_h_
@@ -200,6 +200,28 @@ class StGLTexture : public StGLResource {
                                 const GLsizei       theRowTo,
                                 const GLsizei       theBatchRows);
 
+    /**
+     * Fill the rectangular region of the texture with the image plane.
+     * Partial rows are uploaded in batch only when GL_UNPACK_ROW_LENGTH is supported.
+     * @param theCtx       current context
+     * @param theData      the image plane to copy data from
+     * @param theTarget    texture target
+     * @param theRowFrom   fill data from row (for both - input image plane and the texture!)
+     * @param theRowTo     fill data up to the row (0 means all rows)
+     * @param theColFrom   fill data from column (for both - input image plane and the texture!)
+     * @param theColTo     fill data up to the column (0 means all columns)
+     * @param theBatchRows maximal step for GL function call, see fillPatch() above
+     * @return true on success
+     */
+    ST_CPPEXPORT bool fillPatch(StGLContext&        theCtx,
+                                const StImagePlane& theData,
+                                const GLenum        theTarget,
+                                const GLsizei       theRowFrom,
+                                const GLsizei       theRowTo,
+                                const GLsizei       theColFrom,
+                                const GLsizei       theColTo,
+                                const GLsizei       theBatchRows);
+
     /**
      * Fill the texture with the image plane.
      * @param theCtx       current context
@@ -27,9 +27,9 @@ class StGLTextureQuad : public StGLTexture {
         }
 
     #if !defined(GL_ES_VERSION_2_0)
-        theCtx.core20fwd->glDisable(GL_DEPTH_TEST);
+        theCtx.stglSetDepthTest(false);
         theCtx.core20fwd->glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-        theCtx.core20fwd->glEnable(GL_BLEND);
+        theCtx.stglSetBlend(true);
         theCtx.core11->glEnable(GL_TEXTURE_2D);
 
         StGLTexture::bind(theCtx);
@@ -69,7 +69,7 @@ class StGLTextureQuad : public StGLTexture {
 
         StGLTexture::unbind(theCtx);
         theCtx.core11->glDisable(GL_TEXTURE_2D);
-        theCtx.core20fwd->glDisable(GL_BLEND);
+        theCtx.stglSetBlend(false);
     #else
         (void)theCtx;
     #endif
@@ -1,5 +1,5 @@
 /**
- * Copyright © 2009-2020 Kirill Gavrilov <kirill@sview.ru>
+ * Copyright © 2009-2026 Kirill Gavrilov <kirill@sview.ru>
  *
  * This code is licensed under MIT license (see docs/license-mit.txt for details).
  */
@@ -153,6 +153,16 @@ class StGLTextureData {
      */
     ST_CPPEXPORT void reset();
 
+    /**
+     * @return TRUE if data holds own buffer or references to decoded images
+     */
+    ST_LOCAL bool hasData() const {
+        return myDataPtr != NULL
+           || !myDataPair.getBufferCounter().isNull()
+           || !myDataL.getBufferCounter().isNull()
+           || !myDataR.getBufferCounter().isNull();
+    }
+
         private:
 
     ST_LOCAL bool reAllocate(const size_t theSizeBytes);
@@ -172,6 +182,13 @@ class StGLTextureData {
                               StGLFrameTexture&   theFrameTexture,
                               const StImagePlane& theData);
 
+    /**
+     * Fill the textures only within tiles of panorama visible by renderer
+     * and tiles scheduled for refreshing (see StGLTextureUploadParams::ViewTiles).
+     */
+    ST_LOCAL void fillTextureView(StGLContext&     theCtx,
+                                  StGLQuadTexture& theQTexture);
+
     ST_LOCAL void setupAttributes(StGLFrameTextures& stFrameTextures, const StImage& theImage);
 
     ST_LOCAL void setupDataRectangle(const StImagePlane& theImagePlane,
@@ -184,7 +201,7 @@ class StGLTextureData {
     StGLTextureData*         myNext;          //!< pointer to next item
 
     GLubyte*                 myDataPtr;       //!< data for left and right views
-    size_t                   myDataSizeBytes; //!< allocated data size in bytes
+    size_t                   myDataSizeBytes; //!< requested data size in bytes (pool block might be larger)
     StImage                  myDataPair;
     StImage                  myDataL;
     StImage                  myDataR;
@@ -197,6 +214,7 @@ class StGLTextureData {
     StHandle<StGLTextureUploadParams> myUploadParams; //!< texture streaming parameters
     GLsizei                  myFillFromRow;
     GLsizei                  myFillRows;
+    bool                     myToCullView;    //!< upload only visible tiles of panorama
 
 };
 
@@ -1,5 +1,5 @@
 /**
- * Copyright © 2009-2016 Kirill Gavrilov <kirill@sview.ru>
+ * Copyright © 2009-2026 Kirill Gavrilov <kirill@sview.ru>
  *
  * This code is licensed under MIT license (see docs/license-mit.txt for details).
  */
@@ -12,6 +12,7 @@
 #include <StThreads/StMutex.h>
 
 #include <StGL/StGLDeviceCaps.h>
+#include <StImage/StMemoryBudget.h>
 
 #include "StGLQuadTexture.h"
 #include "StGLTextureData.h"
@@ -24,8 +25,9 @@
  * Method stglUpdateStTextures() should be called each rendering call from GL thread to update textures.
  * Method push() should be used to fill in queue with new frames and stglSwapFB() to pop frame from queue
  * to display.
+ * Queue is registered within StMemoryBudget and releases unused buffers when memory limit is exceeded.
  */
-class StGLTextureQueue {
+class StGLTextureQueue : public StMemoryBudget::Reclaimer {
 
         public:
 
@@ -37,7 +39,7 @@ class StGLTextureQueue {
     /**
      * Destructor.
      */
-    ST_CPPEXPORT ~StGLTextureQueue();
+    ST_CPPEXPORT virtual ~StGLTextureQueue();
 
     /**
      * Get device capabilities.
@@ -208,6 +210,13 @@ class StGLTextureQueue {
      */
     ST_CPPEXPORT void setCompressMemory(const bool theToCompress);
 
+    /**
+     * Schedule releasing of buffers of already uploaded frames;
+     * memory is released on the next stglUpdateStTextures() call.
+     * Queue also releases memory as fast as possible (like setCompressMemory()) while memory budget is under pressure.
+     */
+    ST_CPPEXPORT virtual size_t reclaimMemory(const size_t theBytes) ST_ATTR_OVERRIDE;
+
     /**
      * Function process TOTAL queue clean up.
      */
@@ -253,6 +262,18 @@ class StGLTextureQueue {
 
     ST_CPPEXPORT int swapFBOnReady(StGLContext& theCtx);
 
+    /**
+     * @return TRUE if unused memory should be released as fast as possible
+     */
+    ST_LOCAL bool toCompressMemory() const {
+        return myToCompress || StMemoryBudget::GetDefault().isUnderPressure();
+    }
+
+    /**
+     * Release buffers of frames out of queue (except snapshot), should be called under myMutexPop and myMutexPush locks.
+     */
+    ST_LOCAL void releaseIdle();
+
         private:
 
     StMutex          myMutexPop;
@@ -282,6 +303,7 @@ class StGLTextureQueue {
     bool             myIsInUpdTexture; //!< private bools for plugin thread
     bool             myIsReadyToSwap;
     bool             myToCompress;     //!< release unused memory as fast as possible
+    volatile bool    myToReclaim;      //!< release buffers of uploaded frames requested by memory budget
     volatile bool    myHasStream;      //!< flag indicates that some stream connected to this queue
 
     StGLDeviceCaps   myDeviceCaps;     //!< device capabilities
@@ -7,6 +7,8 @@
 #ifndef __StGLTextureUploadParams_h_
 #define __StGLTextureUploadParams_h_
 
+#include <stTypes.h>
+
 /**
  * Structure holding parameters for texture uploading.
  * Uploading big amounts of data onto GPU leads to frame-rate lags (specifically in case when uploading done within rendering thread);
@@ -26,11 +28,44 @@
  */
 struct StGLTextureUploadParams {
 
+    /**
+     * Equirectangular panorama is split into tiles for view-dependent uploading.
+     * Each of VIEW_TILES_Y bands (rows) is represented by a bit mask of VIEW_TILES_X tiles (columns).
+     */
+    enum {
+        VIEW_TILES_X = 32,
+        VIEW_TILES_Y = 16,
+    };
+
     int MaxUploadIterations; //!< maximum number of texture upload iterations (frames); 1 means texture should be uploaded immediately
     int MaxUploadChunkMiB;   //!< maximum number of data in MiB to be uploaded within single iteration; 0 means no limit;
                              //!  MaxUploadIterations is stronger limit
 
-    StGLTextureUploadParams() : MaxUploadIterations(1), MaxUploadChunkMiB(0) {}
+    /**
+     * Refresh period (in uploaded frames) of panorama tiles outside of the view; 0 disables view-dependent uploading.
+     * Tiles within the view (defined by ViewTiles) are uploaded for every frame,
+     * while other tiles are refreshed band-by-band in round-robin order.
+     */
+    int      ViewRefreshPeriod;
+    bool     HasViewTiles;               //!< ViewTiles mask is defined by renderer for the last drawn frame
+    uint32_t ViewTiles[VIEW_TILES_Y];    //!< visible tiles of equirectangular panorama (including margin)
+    int      ViewFullUploads;            //!< number of following frames to be uploaded entirely (e.g. after seeking)
+    unsigned ViewFrameCounter;           //!< counter of view-dependent uploads
+
+    StGLTextureUploadParams()
+    : MaxUploadIterations(1),
+      MaxUploadChunkMiB(0),
+      ViewRefreshPeriod(5),
+      HasViewTiles(false),
+      ViewFullUploads(2),
+      ViewFrameCounter(0) {
+        stMemZero(ViewTiles, sizeof(ViewTiles));
+    }
+
+    /**
+     * Request full frame uploads into both (front and back) textures.
+     */
+    void invalidateView() { ViewFullUploads = 2; }
 
 };
 
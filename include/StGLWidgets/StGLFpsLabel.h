@@ -11,9 +11,13 @@
 #include <StGLWidgets/StGLTextArea.h>
 #include <StGLWidgets/StGLMenuProgram.h>
 
+class StGLProfilerGraph;
+
 /**
  * Widget for displaying diagnostic information
  * (frame rate, buffers state, etc.).
+ * Frame time breakdown graph and counters of OpenGL state changes
+ * are displayed while StProfiler is enabled.
  */
 class StGLFpsLabel : public StGLTextArea {
 
@@ -48,11 +52,12 @@ class StGLFpsLabel : public StGLTextArea {
 
         private:
 
-    double       myPlayFps;      //!< video decoding FPS
-    int          myPlayQueued;   //!< queued frames
-    int          myPlayQueueLen; //!< queue length
-    StTimer      myTimer;        //!< FPS timer
-    unsigned int myCounter;      //!< frames counter
+    double             myPlayFps;       //!< video decoding FPS
+    int                myPlayQueued;    //!< queued frames
+    int                myPlayQueueLen;  //!< queue length
+    StTimer            myTimer;         //!< FPS timer
+    unsigned int       myCounter;       //!< frames counter
+    StGLProfilerGraph* myProfilerGraph; //!< frame time breakdown graph (child widget created while profiler is enabled)
 
 };
 
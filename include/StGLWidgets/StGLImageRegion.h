@@ -349,6 +349,12 @@ class StGLImageRegion : public StGLWidget {
                                const StPanorama thePano = StPanorama_OFF);
     ST_LOCAL void stglDrawView(unsigned int theView);
 
+    /**
+     * Mark tiles of equirectangular panorama visible with specified projection and model matrices
+     * (including margin) for view-dependent texture uploading.
+     */
+    ST_LOCAL void updateViewTiles(const StGLMatrix& theProjModelMat);
+
     ST_LOCAL bool resetParams();
 
         private: //! @name private fields
@@ -382,6 +388,8 @@ class StGLImageRegion : public StGLWidget {
     StVec2<int>                myFrameSize;      //!< frame dimensions
     float                      mySampleRatio;    //!< sample aspect ratio
     float                      myRotAngle;       //!< rotation angle gesture progress
+    uint32_t                   myViewTiles[StGLTextureUploadParams::VIEW_TILES_Y]; //!< panorama tiles visible within drawn frame
+    bool                       myHasViewTiles;   //!< myViewTiles has been filled within drawn frame
     bool                       myIsClickAborted;
     bool                       myToRightRotate;
     bool                       myIsInitialized;  //!< initialization state
@@ -130,6 +130,12 @@ class StGLMessageBox : public StGLWidget {
          */
         StSignal<void (const size_t )> onClickLeft;
         StSignal<void (const size_t )> onClickRight;
+
+        /**
+         * Emitted from destructor, so that external references to the dialog can be cleared.
+         * @param theDialog (StGLMessageBox* ) - the dialog being destroyed.
+         */
+        StSignal<void (StGLMessageBox* )> onDestroy;
     } signals;
 
         public:    //! @name callback Slots
@@ -13,12 +13,18 @@
 #include <StFile/StMIMEList.h>
 #include <StSettings/StParam.h>
 
+#include <map>
+
 class StGLMenu;
 class StGLMenuItem;
 class StGLMenuCheckbox;
+class StGLThumbnailGrid;
+struct StGLOpenFileLister;
 
 /**
  * Widget for file system navigation.
+ * Folder content is listed by background thread and displayed by fixed pool of rows
+ * bound to the visible window of the list, so that huge folders do not stall GUI.
  */
 class StGLOpenFile : public StGLMessageBox {
 
@@ -36,6 +42,17 @@ class StGLOpenFile : public StGLMessageBox {
      */
     ST_CPPEXPORT virtual ~StGLOpenFile();
 
+    /**
+     * Reset rows binding, since menu layout is recomputed.
+     */
+    ST_CPPEXPORT virtual bool stglInit() ST_ATTR_OVERRIDE;
+
+    /**
+     * Bind rows to folder content before processing children.
+     */
+    ST_CPPEXPORT virtual void stglUpdate(const StPointD_t& theCursorZo,
+                                         bool theIsPreciseInput) ST_ATTR_OVERRIDE;
+
     /**
      * Define file filter.
      */
@@ -90,6 +107,22 @@ class StGLOpenFile : public StGLMessageBox {
                                   const StGLVec4& theColor,
                                   const bool      theisFolder);
 
+    /**
+     * Create rows to cover visible area of the list.
+     */
+    ST_LOCAL void initListRows();
+
+    /**
+     * Bind rows to folder content at current scroll position.
+     */
+    ST_LOCAL void updateList();
+
+    /**
+     * Bind thumbnails grid to folder content at current scroll position.
+     */
+    ST_LOCAL void updateGrid(const int theNbRows,
+                             const int theGeneration);
+
     /**
      * Handle hot-item click event - just remember item id.
      */
@@ -101,7 +134,12 @@ class StGLOpenFile : public StGLMessageBox {
     ST_CPPEXPORT void doFilterCheck(const bool theIsChecked);
 
     /**
-     * Handle item click event - just remember item id.
+     * Switch between list and thumbnails grid.
+     */
+    ST_CPPEXPORT void doThumbnailsCheck(const bool theIsChecked);
+
+    /**
+     * Handle item click event - just remember path of the item at specified row.
      */
     ST_CPPEXPORT void doFileItemClick(const size_t theItemId);
 
@@ -129,16 +167,24 @@ class StGLOpenFile : public StGLMessageBox {
     StGLScrollArea*            myHotListContent;
     StGLMenu*                  myHotList;       //!< widget containing the list of predefined libraries
     StGLMenu*                  myList;          //!< widget containing the file list of currently opened folder
+    StGLThumbnailGrid*         myGrid;          //!< widget displaying thumbnails of currently opened folder
     StGLMenuCheckbox*          myMainFilterCheck;  //!< main  file filter checkbox
     StGLMenuCheckbox*          myExtraFilterCheck; //!< extra file filter checkbox
     StHandle<StBoolParam>      myToShowMainFilter;
     StHandle<StBoolParam>      myToShowExtraFilter;
+    StHandle<StBoolParam>      myToShowThumbs;  //!< display thumbnails grid instead of the list
     StArrayList<StString>      myHotPaths;      //!< array of hot-links
-    StHandle<StFolder>         myFolder;        //!< currently opened folder
+    StHandle<StGLOpenFileLister> myLister;      //!< content of currently opened folder
+    StString                   myFolderPath;    //!< currently opened folder
     StMIMEList                 myFilter;        //!< file filter
     StMIMEList                 myExtraFilter;   //!< extra file filter
     StArrayList<StString>      myExtensions;    //!< extensions filter
     StString                   myItemToLoad;    //!< new item to open
+    int                        myListFromRow;   //!< first row bound to the rows pool
+    int                        myListGeneration;//!< generation of folder content bound to the rows pool
+    int                        myGridFromItem;  //!< first item bound to the thumbnails grid
+    std::map<size_t, StString> myBoundPaths;    //!< paths of folder entries bound to the rows (or grid items)
+    bool                       myHasFolderUp;   //!< first row is a link to the parent folder
 
         protected: //! @name main file list settings
 
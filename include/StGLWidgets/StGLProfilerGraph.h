@@ -0,0 +1,97 @@
+/**
+ * StGLWidgets, small C++ toolkit for writing GUI using OpenGL.
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * This code is licensed under MIT license (see docs/license-mit.txt for details).
+ */
+
+#ifndef __StGLProfilerGraph_h_
+#define __StGLProfilerGraph_h_
+
+#include <StGLWidgets/StGLWidget.h>
+#include <StGL/StGLVertexBuffer.h>
+#include <StThreads/StProfiler.h>
+
+class StGLTextArea;
+
+/**
+ * Widget displaying frame time breakdown recorded by StProfiler.
+ * Each column represents one displayed frame and is split into bars of distinct threads
+ * (e.g. rendering and decoding), each bar shows stacked self-time of profiler zones of its thread
+ * (time of nested zones is subtracted from the parent),
+ * full widget height corresponds to two frame periods.
+ */
+class StGLProfilerGraph : public StGLWidget {
+
+        public:
+
+    enum {
+        HISTORY_LENGTH = 128, //!< number of displayed frames
+        ZONES_MAX      = 8,   //!< maximum number of distinct zones displayed by graph
+        THREADS_MAX    = 4,   //!< maximum number of distinct threads displayed by graph
+    };
+
+        public:
+
+    ST_CPPEXPORT StGLProfilerGraph(StGLWidget* theParent,
+                                   const int theLeft, const int theTop,
+                                   const StGLCorner theCorner);
+    ST_CPPEXPORT virtual ~StGLProfilerGraph();
+
+    ST_CPPEXPORT virtual bool stglInit() ST_ATTR_OVERRIDE;
+    ST_CPPEXPORT virtual void stglDraw(unsigned int theView) ST_ATTR_OVERRIDE;
+
+    /**
+     * Collect zones finished since previous call into new graph column.
+     * Should be called once per displayed frame.
+     * @param theTargetFps target frame rate defining graph scale
+     */
+    ST_CPPEXPORT void update(const double theTargetFps);
+
+        private:
+
+    /**
+     * Return graph bar for thread with specified name or register the new one.
+     * Threads are identified by name, so that zones of restarted thread are shown within the same bar.
+     * @return -1 if threads limit has been reached
+     */
+    ST_LOCAL int getThreadBar(const char* theThreadName);
+
+    /**
+     * Return graph slot for zone with specified name within specified thread bar or register the new one.
+     * @return -1 if slots limit has been reached
+     */
+    ST_LOCAL int getZoneSlot(const char* theName,
+                             const int   theThreadBar);
+
+    /**
+     * Update legend labels with average zone times.
+     */
+    ST_LOCAL void updateLegend();
+
+        private:
+
+    std::vector<StProfiler::Zone> myZones;                              //!< temporary list of zones
+    std::vector<double>           mySelfTimes;                          //!< temporary list of zones self-time
+    std::vector<size_t>           myStack;                              //!< temporary stack of parent zones
+    std::vector<StGLVec2>         myVertices;                           //!< temporary vertices array
+    StGLVertexBuffer              myVertBuf;                            //!< vertices buffer
+    const char*                   myThreadNames[THREADS_MAX];           //!< thread names of graph bars
+    const char*                   myNames[ZONES_MAX];                   //!< zone names of graph slots
+    int                           mySlotBars[ZONES_MAX];                //!< thread bar of each graph slot
+    StGLTextArea*                 myLegend[ZONES_MAX];                  //!< legend labels
+    GLint                         mySlotFirst[ZONES_MAX];               //!< first vertex of each zone within vertices buffer
+    GLsizei                       mySlotCount[ZONES_MAX];               //!< number of vertices of each zone within vertices buffer
+    float                         myHistory[HISTORY_LENGTH][ZONES_MAX]; //!< per-frame zones time in milliseconds
+    float                         myFrameMSec;                          //!< frame period defining graph scale
+    int                           myNbThreads;                          //!< number of registered thread names
+    int                           myNbNames;                            //!< number of registered zone names
+    int                           myHead;                               //!< index of the newest column
+    int                           myNbColumns;                          //!< number of filled columns
+    double                        myLastUSec;                           //!< time of last update
+    StTimer                       myLegendTimer;                        //!< timer for updating legend
+    bool                          myToRebuild;                          //!< flag to rebuild vertices buffer
+
+};
+
+#endif // __StGLProfilerGraph_h_
@@ -12,8 +12,11 @@
 #include <StGLWidgets/StGLWidget.h>
 #include <StGL/StGLFontManager.h>
 #include <StGL/StGLTexture.h>
+#include <StImage/StImageFile.h>
 #include <StThreads/StResourceManager.h>
 
+#include <map>
+
 template<> inline void StArray<StGLNamedTexture>::sort() {}
 typedef StArray<StGLNamedTexture> StGLTextureArray;
 class StGLMenuProgram;
@@ -396,6 +399,29 @@ class StGLRootWidget : public StGLWidget {
         return myGlFontMgr;
     }
 
+    /**
+     * Register icon to be decoded in advance.
+     * Icons registered before the first stglInit() of the root widget are decoded in parallel by StThreadPool,
+     * so that widgets only upload already decoded images into textures.
+     * @param theName icon resource name
+     */
+    ST_CPPEXPORT void prefetchIcon(const StString& theName);
+
+    /**
+     * Return icon decoded in advance or NULL if icon has not been prefetched.
+     * @param theName icon resource name
+     */
+    ST_CPPEXPORT StHandle<StImageFile> getPrefetchedIcon(const StString& theName) const;
+
+    /**
+     * Read and decode PNG icon from resources.
+     * @param theResMgr resources manager
+     * @param theName   icon resource name
+     * @return NULL on error
+     */
+    ST_CPPEXPORT static StHandle<StImageFile> loadIcon(const StHandle<StResourceManager>& theResMgr,
+                                                       const StString&                    theName);
+
     /**
      * Returns camera projection matrix within to-screen displacement
      * thus it can be used for vertices given in only 2D-coordinates.
@@ -491,6 +517,11 @@ class StGLRootWidget : public StGLWidget {
 
     ST_LOCAL void setupTextures();
 
+    /**
+     * Decode registered icons in parallel.
+     */
+    ST_LOCAL void decodePrefetchedIcons();
+
     /**
     * Computes scissor rectangle in OpenGL viewport.
     * @param theRect [in] Rectangle in window coordinates
@@ -522,6 +553,7 @@ class StGLRootWidget : public StGLWidget {
     StHandle<StGLMenuProgram>  myMenuProgram;
     StHandle<StGLTextProgram>  myTextProgram;
     StHandle<StGLTextBorderProgram> myTextBorderProgram;
+    std::map< StString, StHandle<StImageFile> > myIconsPrefetched; //!< icons decoded in advance
 
     bool                      myIsMobile;      //!< flag indicating mobile device
     StMarginsI                myMarginsPx;     //!< active area margins in pixels
@@ -540,6 +572,7 @@ class StGLRootWidget : public StGLWidget {
     StGLMessageBox*           myModalDialog;   //!< active dialog
 
     bool                      myIsMenuPressed; //!< global flag to perform navigation in menu after first item clicked
+    bool                      myToPrefetchIcons; //!< collect icons to be decoded in advance (until first initialization)
 
         protected:
 
@@ -9,7 +9,9 @@
 #define __StGLSeekBar_h_
 
 #include <StGLWidgets/StGLWidget.h>
+#include <StGL/StGLTexture.h>
 #include <StGL/StGLVertexBuffer.h>
+#include <StImage/StImagePlane.h>
 
 /**
  * Simple seeking bar widget.
@@ -42,6 +44,20 @@ class StGLSeekBar : public StGLWidget {
         myMoveTolerPx = theTolerPx;
     }
 
+    /**
+     * Set atlas of preview thumbnails shown while hovering the bar.
+     * Thumbnails should be evenly spread over the bar and packed into atlas rows from left to right;
+     * the atlas is uploaded into texture on next redraw when handle differs from the current one.
+     * @param theAtlas      RGB atlas image, NULL to disable preview
+     * @param theNbThumbs   number of thumbnails within atlas
+     * @param theThumbSizeX thumbnail width
+     * @param theThumbSizeY thumbnail height
+     */
+    ST_CPPEXPORT void setThumbnails(const StHandle<StImagePlane>& theAtlas,
+                                    const int theNbThumbs,
+                                    const int theThumbSizeX,
+                                    const int theThumbSizeY);
+
     ST_CPPEXPORT virtual void stglResize() ST_ATTR_OVERRIDE;
     ST_CPPEXPORT virtual bool stglInit() ST_ATTR_OVERRIDE;
     ST_CPPEXPORT virtual void stglUpdate(const StPointD_t& theCursor,
@@ -74,6 +90,7 @@ class StGLSeekBar : public StGLWidget {
         private: //! @name private methods
 
     ST_LOCAL void stglUpdateVertices();
+    ST_LOCAL void stglDrawThumbnail();
     ST_LOCAL double getPointInEx(const StPointD_t& thePointZo) const;
 
         private:
@@ -81,6 +98,9 @@ class StGLSeekBar : public StGLWidget {
     class StProgramSB;
     StHandle<StProgramSB> myProgram;    //!< GLSL program
 
+    class StProgramThumb;
+    StHandle<StProgramThumb> myThumbProgram; //!< GLSL program for thumbnail preview
+
     StGLVertexBuffer      myVertices;   //!< vertices VBO
     StGLVertexBuffer      myColors;     //!< colors   VBO
     GLfloat               myProgress;   //!< current progress 0..1
@@ -88,6 +108,18 @@ class StGLSeekBar : public StGLWidget {
     int                   myClickPos;
     int                   myMoveTolerPx;
 
+    StHandle<StImagePlane> myThumbAtlas;     //!< atlas of preview thumbnails
+    StGLTexture            myThumbTexture;   //!< texture with thumbnails atlas
+    StGLVertexBuffer       myThumbVerts;     //!< vertices VBO of thumbnail preview
+    StGLVertexBuffer       myThumbTCrds;     //!< texture coordinates VBO of thumbnail preview
+    int                    myThumbsNb;       //!< number of thumbnails within atlas
+    int                    myThumbSizeX;     //!< thumbnail width
+    int                    myThumbSizeY;     //!< thumbnail height
+    StRectI_t              myThumbRect;      //!< thumbnail preview rectangle within myThumbVerts
+    int                    myThumbId;        //!< thumbnail index within myThumbTCrds, or -1 if VBOs should be filled
+    double                 myHoverPos;       //!< hovered position 0..1, or negative if bar is not hovered
+    bool                   myToUpdateThumbs; //!< flag to upload atlas into texture
+
 };
 
 #endif // __StGLSeekBar_h_
@@ -1,6 +1,6 @@
 /**
  * StGLWidgets, small C++ toolkit for writing GUI using OpenGL.
- * Copyright © 2010-2025 Kirill Gavrilov <kirill@sview.ru>
+ * Copyright © 2010-2026 Kirill Gavrilov <kirill@sview.ru>
  *
  * This code is licensed under MIT license (see docs/license-mit.txt for details).
  */
@@ -35,9 +35,8 @@ class StGLSubtitles : public StGLTextArea {
 
             public:
 
-        StString     Text;  //!< active string representation
-        StImagePlane Image; //!< active image  representation
-        float        Scale; //!< image scale factor
+        StString            Text;      //!< active string representation
+        StHandle<StSubItem> ImageItem; //!< active item with image representation
 
             public:
 
@@ -58,6 +57,42 @@ class StGLSubtitles : public StGLTextArea {
          */
         ST_LOCAL void add(const StHandle<StSubItem>& theItem);
 
+        /**
+         * Predict active string representation after activation of specified item.
+         */
+        ST_LOCAL StString predictText(const StSubItem& theItem) const;
+
+    };
+
+    /**
+     * Textures of image-based subtitle item.
+     */
+    class StSubImage {
+
+            public:
+
+        StGLTexture         Texture; //!< image (palette indices for palettized image)
+        StGLTexture         Palette; //!< palette
+        StHandle<StSubItem> Item;    //!< uploaded subtitle item
+
+            public:
+
+        /**
+         * Upload image of subtitle item into textures.
+         */
+        ST_LOCAL bool init(StGLContext&               theCtx,
+                           const StHandle<StSubItem>& theItem);
+
+        /**
+         * Release GL resources.
+         */
+        ST_LOCAL void release(StGLContext& theCtx);
+
+        /**
+         * Return TRUE if image is palettized.
+         */
+        ST_LOCAL bool isPalettized() const { return Palette.isValid(); }
+
     };
 
         public:
@@ -90,6 +125,15 @@ class StGLSubtitles : public StGLTextArea {
      */
     ST_CPPEXPORT void setPTS(const double thePTS);
 
+        private:
+
+    /**
+     * Prepare the next queued subtitle item ahead of its presentation time:
+     * format the text to be shown and upload image into textures,
+     * so that item activation would not stall the frame.
+     */
+    ST_LOCAL void stglPrepareNext(StGLContext& theCtx);
+
         public: //! @name Properties
 
     struct {
@@ -106,7 +150,8 @@ class StGLSubtitles : public StGLTextArea {
 
         private:
 
-    StGLTexture              myTexture;   //!< texture for image-based subtitles
+    StHandle<StSubImage>     myImage;     //!< textures for active image-based subtitles
+    StHandle<StSubImage>     myImageNext; //!< textures for the next image-based subtitles uploaded ahead of time
     StGLVertexBuffer         myVertBuf;   //!< vertex buffer for image-based subtitles
     StGLVertexBuffer         myTCrdBuf;   //!< texture coordinates buffer for image-based subtitles
     StHandle<StSubQueue>     myQueue;     //!< thread-safe subtitles queue
@@ -114,7 +159,8 @@ class StGLSubtitles : public StGLTextArea {
     double                   myPTS;       //!< active PTS
 
     class StImgProgram;
-    StGLShare<StImgProgram>  myImgProgram;
+    StGLShare<StImgProgram>  myImgProgram; //!< program drawing RGBA image
+    StGLShare<StImgProgram>  myPalProgram; //!< program drawing palettized image
 
 };
 
@@ -218,8 +218,38 @@ class StGLTextArea : public StGLWidget {
 
         protected:
 
+    /**
+     * Format the text (if it has been changed) into VBOs.
+     * Results of prepareText() are taken instead, when they match the current text and layout.
+     */
     ST_CPPEXPORT void formatText(StGLContext& theCtx);
 
+    /**
+     * Format the text ahead of time into dedicated set of VBOs without changing currently displayed text.
+     * The result is picked up by formatText() if setText() will be called later with the same text,
+     * while text area width, height and font size remain the same.
+     * Renders missing glyphs, so should be called with bound GL context.
+     * @param theText text to format
+     */
+    ST_CPPEXPORT void prepareText(StGLContext&    theCtx,
+                                  const StString& theText);
+
+    /**
+     * Return TRUE if text has been already prepared by prepareText().
+     */
+    ST_LOCAL bool isPreparedText(const StString& theText) const {
+        return myPrepared.IsValid
+            && myPrepared.Text == theText;
+    }
+
+    /**
+     * Discard the result of prepareText(), e.g. when formatter settings have been changed.
+     * VBOs are kept for reuse.
+     */
+    ST_LOCAL void resetPreparedText() {
+        myPrepared.IsValid = false;
+    }
+
         private:
 
     ST_LOCAL void drawText(StGLContext& theCtx);
@@ -232,6 +262,25 @@ class StGLTextArea : public StGLWidget {
 
         private:
 
+    /**
+     * Text formatted ahead of time.
+     */
+    struct PreparedText {
+        StString                                  Text;       //!< formatted text
+        std::vector<GLuint>                       Textures;   //!< font textures
+        StArrayList< StHandle<StGLVertexBuffer> > VertBufs;   //!< vertices per texture
+        StArrayList< StHandle<StGLVertexBuffer> > TCrdBufs;   //!< texture coordinates per texture
+        StGLRect                                  BndBox;     //!< text boundary box
+        GLfloat                                   TextWidth;  //!< text width limit used for formatting
+        GLint                                     RectHeight; //!< text area height used for formatting
+        FontSize                                  Size;       //!< font size used for formatting
+        bool                                      IsValid;    //!< result is valid
+
+        PreparedText() : TextWidth(0.0f), RectHeight(0), Size(SIZE_NORMAL), IsValid(false) {}
+    };
+
+        private:
+
     std::vector<GLuint>                       myTexturesList;
     StArrayList< StHandle<StGLVertexBuffer> > myTextVertBuf;
     StArrayList< StHandle<StGLVertexBuffer> > myTextTCrdBuf;
@@ -239,6 +288,8 @@ class StGLTextArea : public StGLWidget {
     StGLVertexBuffer     myBorderIVertBuf;
     StGLVertexBuffer     myBorderOVertBuf;
 
+    PreparedText         myPrepared;      //!< text formatted ahead of time
+
         protected:
 
     StHandle<StGLFont>   myFont;          //!< used font
@@ -0,0 +1,161 @@
+/**
+ * StGLWidgets, small C++ toolkit for writing GUI using OpenGL.
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * This code is licensed under MIT license (see docs/license-mit.txt for details).
+ */
+
+#ifndef __StGLThumbnailGrid_h_
+#define __StGLThumbnailGrid_h_
+
+#include <StGLWidgets/StGLWidget.h>
+#include <StGL/StGLTexture.h>
+#include <StGL/StGLVertexBuffer.h>
+#include <StImage/StThumbnailCache.h>
+
+#include <map>
+#include <vector>
+
+class StGLTextArea;
+
+/**
+ * Scrollable grid of file thumbnails.
+ * The grid does not hold the list of items - it only defines the range of visible items
+ * (getFirstVisible() and getNbVisible()) which should be bound by the owner using setItem().
+ * Thumbnails are generated by StThumbnailCache in background
+ * and uploaded into slots of a single texture atlas (a few per frame, so that scrolling remains smooth);
+ * slots of items scrolled away are reused in least-recently-used order.
+ */
+class StGLThumbnailGrid : public StGLWidget {
+
+        public:
+
+    enum {
+        THUMB_SIZE   = 128,  //!< thumbnail size in pixels
+        ATLAS_SIZE   = 2048, //!< atlas texture size in pixels (256 slots)
+        UPLOADS_MAX  = 8,    //!< maximum number of thumbnails uploaded per frame
+    };
+
+        public:
+
+    /**
+     * Main constructor.
+     */
+    ST_CPPEXPORT StGLThumbnailGrid(StGLWidget*      theParent,
+                                   const int        theLeft,  const int theTop,
+                                   const StGLCorner theCorner,
+                                   const int        theWidth, const int theHeight);
+
+    /**
+     * Destructor.
+     */
+    ST_CPPEXPORT virtual ~StGLThumbnailGrid();
+
+    /**
+     * Define number of items and reset scrolling when list has been replaced.
+     */
+    ST_CPPEXPORT void setNbItems(const size_t theNbItems,
+                                 const bool   theToReset);
+
+    /**
+     * @return index of the first visible item
+     */
+    ST_LOCAL size_t getFirstVisible() const { return myFirstItem; }
+
+    /**
+     * @return maximum number of visible items
+     */
+    ST_LOCAL size_t getNbVisible() const { return myCells.size(); }
+
+    /**
+     * Bind visible item.
+     * @param theIndex    item index within [getFirstVisible(), getFirstVisible() + getNbVisible()) range
+     * @param theLabel    item label
+     * @param theFilePath path to the file to show thumbnail, empty for items without thumbnail (folders)
+     */
+    ST_CPPEXPORT void setItem(const size_t    theIndex,
+                              const StString& theLabel,
+                              const StString& theFilePath);
+
+    ST_CPPEXPORT virtual bool stglInit() ST_ATTR_OVERRIDE;
+    ST_CPPEXPORT virtual void stglResize() ST_ATTR_OVERRIDE;
+    ST_CPPEXPORT virtual void stglDraw(unsigned int theView) ST_ATTR_OVERRIDE;
+    ST_CPPEXPORT virtual bool doScroll(const StScrollEvent& theEvent) ST_ATTR_OVERRIDE;
+
+        public:  //! @name Signals
+
+    struct {
+        /**
+         * Emitted on item click.
+         * @param theIndex item index
+         */
+        StSignal<void (const size_t )> onItemClick;
+    } signals;
+
+        private:
+
+    /**
+     * Handle mouse unclick.
+     */
+    ST_LOCAL void doMouseUnclick(const int theBtnId);
+
+    /**
+     * Recompute grid layout and visible range.
+     */
+    ST_LOCAL void updateLayout();
+
+    /**
+     * Upload generated thumbnails into atlas.
+     */
+    ST_LOCAL void stglUploadThumbnails();
+
+    /**
+     * Find atlas slot for the new thumbnail.
+     */
+    ST_LOCAL int allocateSlot();
+
+        private:
+
+    /**
+     * Visible grid cell.
+     */
+    struct Cell {
+        StString      FilePath; //!< path to the file
+        StGLTextArea* Label;    //!< label widget
+        bool          IsBound;  //!< item has been bound
+    };
+
+    /**
+     * Atlas slot.
+     */
+    struct Slot {
+        StString FilePath; //!< path to the file
+        int      SizeX;    //!< thumbnail width
+        int      SizeY;    //!< thumbnail height
+        unsigned LastUse;  //!< frame number when thumbnail has been drawn last time
+    };
+
+    class StProgramGrid;
+
+        private:
+
+    StHandle<StProgramGrid>    myProgram;    //!< GLSL program
+    StHandle<StThumbnailCache> myCache;      //!< thumbnails generator
+    StGLTexture                myAtlas;      //!< texture atlas
+    StGLVertexBuffer           myVertBuf;    //!< vertices of visible thumbnails
+    StGLVertexBuffer           myTCrdBuf;    //!< texture coordinates of visible thumbnails
+    std::vector<Cell>          myCells;      //!< visible cells
+    std::vector<Slot>          mySlots;      //!< atlas slots
+    std::map<StString, int>    mySlotsMap;   //!< map file path -> atlas slot
+    size_t                     myNbItems;    //!< overall number of items
+    size_t                     myFirstItem;  //!< index of the first visible item
+    int                        myScrollY;    //!< scrolling offset in pixels
+    float                      myScrollYAccum;//!< accumulated scroll event value
+    int                        myCellSizeX;  //!< cell width
+    int                        myCellSizeY;  //!< cell height
+    int                        myNbColumns;  //!< number of columns
+    unsigned                   myFrame;      //!< frame counter
+
+};
+
+#endif // __StGLThumbnailGrid_h_
@@ -1,6 +1,6 @@
 /**
  * StGLWidgets, small C++ toolkit for writing GUI using OpenGL.
- * Copyright © 2010-2014 Kirill Gavrilov <kirill@sview.ru>
+ * Copyright © 2010-2026 Kirill Gavrilov <kirill@sview.ru>
  *
  * This code is licensed under MIT license (see docs/license-mit.txt for details).
  */
@@ -21,7 +21,8 @@ class StSubItem {
         public:
 
     StString     Text;      //!< subtitle textual representation
-    StImagePlane Image;     //!< subtitle image   representation
+    StImagePlane Image;     //!< subtitle image   representation, ImgGray palette indices when Palette is defined
+    StImagePlane Palette;   //!< optional palette of image subtitle, 256 ImgRGBA colors packed into 16x16 plane
     double       TimeStart; //!< PTS to show subtitle item
     double       TimeEnd;   //!< PTS to hide subtitle item
     float        Scale;     //!< image scale factor
@@ -73,6 +74,14 @@ class StSubQueue {
      */
     ST_CPPEXPORT StHandle<StSubItem> pop(const double thePTS);
 
+    /**
+     * Return the next subtitle item (to be shown at current or future presentation timestamp)
+     * without removing it from the queue.
+     * @param thePTS current presentation timestamp
+     * @return next subtitle item or NULL handle
+     */
+    ST_CPPEXPORT StHandle<StSubItem> peek(const double thePTS);
+
     /**
      * Append subtitle item to the queue.
      * @param theSubItem item to add
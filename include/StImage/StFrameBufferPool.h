@@ -0,0 +1,148 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * This code is licensed under MIT license (see docs/license-mit.txt for details).
+ */
+
+#ifndef __StFrameBufferPool_h_
+#define __StFrameBufferPool_h_
+
+#include <StImage/StMemoryBudget.h>
+#include <StThreads/StMutexSlim.h>
+
+#include <map>
+#include <vector>
+
+/**
+ * Pool of memory blocks for frame buffers (image planes, texture upload buffers).
+ * Requested sizes are rounded up to size classes (8 classes per power of two, 12.5% overhead at most),
+ * so that buffers released by one frame can be reused by the next frame of similar geometry
+ * instead of going to the general heap each time.
+ *
+ * All blocks are aligned to THE_ALIGNMENT (64 bytes, SIMD and cache line friendly).
+ * Large blocks are allocated at huge page boundary and marked as transparent huge pages candidates (Linux),
+ * reducing TLB misses on multi-megabyte frames;
+ * returned pointer itself is offset by THE_ALIGNMENT bytes of block header.
+ *
+ * Released blocks are retained up to the limit and registered within StMemoryBudget,
+ * which asks the pool to free retained blocks when memory limit is exceeded.
+ * Small blocks (below THE_MIN_POOLED_SIZE) are never retained.
+ */
+class StFrameBufferPool : public StMemoryBudget::Reclaimer {
+
+        public:
+
+    static const size_t THE_ALIGNMENT       = 64;               //!< alignment of returned blocks
+    static const size_t THE_MIN_POOLED_SIZE = 64 * 1024;        //!< smaller blocks are not retained
+    static const size_t THE_HUGE_PAGE_SIZE  = 2 * 1024 * 1024;  //!< huge page size, alignment of large blocks (including header)
+
+    /**
+     * Pool statistics.
+     */
+    struct Stats {
+        size_t NbRequests;   //!< number of allocation requests
+        size_t NbReused;     //!< number of requests served by retained blocks
+        size_t NbAllocated;  //!< number of blocks allocated from the heap
+        size_t NbHuge;       //!< number of blocks allocated with huge pages hint
+        size_t NbFreed;      //!< number of blocks returned to the heap
+        size_t BytesInUse;   //!< size of blocks in use
+        size_t BytesPeak;    //!< peak size of blocks in use
+        size_t BytesPooled;  //!< size of retained blocks
+
+        Stats() : NbRequests(0), NbReused(0), NbAllocated(0), NbHuge(0), NbFreed(0), BytesInUse(0), BytesPeak(0), BytesPooled(0) {}
+    };
+
+        public:
+
+    /**
+     * Return global pool.
+     */
+    ST_CPPEXPORT static StFrameBufferPool& GetDefault();
+
+    /**
+     * Return size class for requested size.
+     */
+    ST_CPPEXPORT static size_t getSizeClass(const size_t theNbBytes);
+
+    /**
+     * Return usable size of the block allocated by the pool.
+     */
+    ST_CPPEXPORT static size_t getBlockSize(const void* thePtr);
+
+    /**
+     * Main constructor.
+     * @param theMaxPooledBytes limit for retained blocks
+     */
+    ST_CPPEXPORT StFrameBufferPool(const size_t theMaxPooledBytes);
+
+    /**
+     * Destructor, releases retained blocks.
+     */
+    ST_CPPEXPORT virtual ~StFrameBufferPool();
+
+    /**
+     * Allocate the block of at least specified size.
+     * @return pointer aligned to THE_ALIGNMENT, or NULL on failure
+     */
+    ST_CPPEXPORT void* allocate(const size_t theNbBytes);
+
+    /**
+     * Return the block allocated by allocate() back to the pool.
+     */
+    ST_CPPEXPORT void release(void* thePtr);
+
+    /**
+     * Free all retained blocks.
+     */
+    ST_CPPEXPORT void trim();
+
+    /**
+     * @return limit for retained blocks
+     */
+    ST_LOCAL size_t getMaxPooledBytes() const { return myMaxPooledBytes; }
+
+    /**
+     * Set limit for retained blocks.
+     */
+    ST_CPPEXPORT void setMaxPooledBytes(const size_t theMaxPooledBytes);
+
+    /**
+     * @return pool statistics
+     */
+    ST_CPPEXPORT Stats getStats() const;
+
+    /**
+     * Format pool statistics.
+     */
+    ST_CPPEXPORT StString formatStats() const;
+
+    /**
+     * Free retained blocks, the largest ones first.
+     */
+    ST_CPPEXPORT virtual size_t reclaimMemory(const size_t theBytes) ST_ATTR_OVERRIDE;
+
+        private:
+
+    /**
+     * Detach retained blocks (the largest first) till specified amount, should be called under lock.
+     * @return detached size
+     */
+    ST_LOCAL size_t detachPooled(const size_t         theBytes,
+                                 std::vector<void*>& theBlocks);
+
+    /**
+     * Return detached blocks to the heap.
+     */
+    ST_LOCAL void freeBlocks(const std::vector<void*>& theBlocks,
+                             const size_t              theSizeBytes);
+
+        private:
+
+    mutable StMutexSlim                      myMutex;          //!< lock for pooled blocks and statistics
+    std::map< size_t, std::vector<void*> >  myPooled;         //!< retained blocks per size class
+    size_t                                   myMaxPooledBytes; //!< limit for retained blocks
+    Stats                                    myStats;          //!< statistics
+
+};
+
+#endif // __StFrameBufferPool_h_
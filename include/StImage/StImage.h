@@ -1,5 +1,5 @@
 /**
- * Copyright © 2010-2019 Kirill Gavrilov <kirill@sview.ru>
+ * Copyright © 2010-2026 Kirill Gavrilov <kirill@sview.ru>
  *
  * This code is licensed under MIT license (see docs/license-mit.txt for details).
  */
@@ -234,6 +234,14 @@ class StImage {
         return myPlanes[0].getSizeY();
     }
 
+    /**
+     * @return overall size of color planes data in bytes.
+     */
+    inline size_t getSizeBytes() const {
+        return myPlanes[0].getSizeBytes() + myPlanes[1].getSizeBytes()
+             + myPlanes[2].getSizeBytes() + myPlanes[3].getSizeBytes();
+    }
+
     /**
      * Access to the image plane by ID (from 0 to 3).
      */
@@ -0,0 +1,136 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * This code is licensed under MIT license (see docs/license-mit.txt for details).
+ */
+
+#ifndef __StImageKernels_h_
+#define __StImageKernels_h_
+
+#include <stTypes.h>
+
+/**
+ * Low-level routines reshaping image planes (copy with stride change, flip, split, transpose, bit depth change).
+ * Routines are vectorized (SSE2/AVX2 on x86 with runtime CPU detection, NEON on ARM)
+ * and split between threads of StThreadPool::GetDefault() for large frames.
+ *
+ * Strides are signed, so that negative stride (with pointer to the last row) flips the image upside-down.
+ */
+class StImageKernels {
+
+        public:
+
+    /**
+     * Instruction set used by kernels.
+     */
+    enum SimdLevel {
+        SimdLevel_Scalar = 0, //!< plain C++ code
+        SimdLevel_SSE2,       //!< x86 SSE2
+        SimdLevel_AVX2,       //!< x86 AVX2
+        SimdLevel_NEON,       //!< ARM NEON
+    };
+
+    /**
+     * @return instruction set name
+     */
+    ST_CPPEXPORT static const char* getSimdLevelName(const SimdLevel theLevel);
+
+    /**
+     * @return best instruction set supported by CPU
+     */
+    ST_CPPEXPORT static SimdLevel getSimdLevelMax();
+
+    /**
+     * @return instruction set currently used by kernels
+     */
+    ST_CPPEXPORT static SimdLevel getSimdLevel();
+
+    /**
+     * Override instruction set (should not exceed getSimdLevelMax()), intended for testing and benchmarks.
+     */
+    ST_CPPEXPORT static void setSimdLevel(const SimdLevel theLevel);
+
+    /**
+     * @return true if large frames are processed by multiple threads (TRUE by default)
+     */
+    ST_CPPEXPORT static bool isMultiThreaded();
+
+    /**
+     * Enable/disable splitting large frames between threads.
+     */
+    ST_CPPEXPORT static void setMultiThreaded(const bool theToUseThreads);
+
+        public: //! @name kernels
+
+    /**
+     * Copy rows with different strides.
+     * @param theDst       destination first row
+     * @param theDstStride destination stride in bytes
+     * @param theSrc       source first row
+     * @param theSrcStride source stride in bytes
+     * @param theRowBytes  number of bytes to copy per row
+     * @param theNbRows    number of rows
+     */
+    ST_CPPEXPORT static void copyRows(uint8_t*        theDst,
+                                      const ptrdiff_t theDstStride,
+                                      const uint8_t*  theSrc,
+                                      const ptrdiff_t theSrcStride,
+                                      const size_t    theRowBytes,
+                                      const size_t    theNbRows);
+
+    /**
+     * Split column-interlaced rows into two images (even columns into theDstEven, odd columns into theDstOdd).
+     * @param theDstEven   destination first row for even columns
+     * @param theDstOdd    destination first row for odd columns
+     * @param theDstStride destination stride in bytes
+     * @param theSrc       source first row
+     * @param theSrcStride source stride in bytes
+     * @param theNbPairs   number of column pairs within source row
+     * @param thePixelSize pixel size in bytes
+     * @param theNbRows    number of rows
+     */
+    ST_CPPEXPORT static void splitColumns(uint8_t*        theDstEven,
+                                          uint8_t*        theDstOdd,
+                                          const ptrdiff_t theDstStride,
+                                          const uint8_t*  theSrc,
+                                          const ptrdiff_t theSrcStride,
+                                          const size_t    theNbPairs,
+                                          const size_t    thePixelSize,
+                                          const size_t    theNbRows);
+
+    /**
+     * Transpose the image (destination row N is filled from source column N) using cache-friendly blocks.
+     * Rotation by 90 degrees can be achieved by negative destination (clockwise) or source (counterclockwise) stride.
+     * @param theDst       destination first row
+     * @param theDstStride destination stride in bytes
+     * @param theSrc       source first row
+     * @param theSrcStride source stride in bytes
+     * @param theSrcSizeX  source width  (destination height)
+     * @param theSrcSizeY  source height (destination width)
+     * @param thePixelSize pixel size in bytes
+     */
+    ST_CPPEXPORT static void transpose(uint8_t*        theDst,
+                                       const ptrdiff_t theDstStride,
+                                       const uint8_t*  theSrc,
+                                       const ptrdiff_t theSrcStride,
+                                       const size_t    theSrcSizeX,
+                                       const size_t    theSrcSizeY,
+                                       const size_t    thePixelSize);
+
+    /**
+     * Expand 8-bit values to 16-bit ones (0xFF is mapped to 0xFFFF).
+     */
+    ST_CPPEXPORT static void expand8to16(uint16_t*      theDst,
+                                         const uint8_t* theSrc,
+                                         const size_t   theNbValues);
+
+    /**
+     * Reduce 16-bit values to 8-bit ones (take most significant byte).
+     */
+    ST_CPPEXPORT static void reduce16to8(uint8_t*        theDst,
+                                         const uint16_t* theSrc,
+                                         const size_t    theNbValues);
+
+};
+
+#endif // __StImageKernels_h_
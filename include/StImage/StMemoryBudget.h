@@ -0,0 +1,259 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * This code is licensed under MIT license (see docs/license-mit.txt for details).
+ */
+
+#ifndef __StMemoryBudget_h_
+#define __StMemoryBudget_h_
+
+#include <StImage/StImage.h>
+#include <StStrings/StString.h>
+#include <StThreads/StMutex.h>
+
+#include <vector>
+
+// define StHandle template specialization
+class StMemoryBudgetCounter;
+ST_DEFINE_HANDLE(StMemoryBudgetCounter, StBufferCounter);
+
+/**
+ * Process-wide budget of memory occupied by large buffers (texture buffers, decoded images and frames, packet queues).
+ * Components report their allocations per subsystem;
+ * once the overall usage crosses the limit, registered reclaimers are asked to release memory
+ * in the order of their priority, while other components may check isUnderPressure()
+ * to reduce their buffering.
+ *
+ * The limit is half of physical memory by default.
+ */
+class StMemoryBudget {
+
+        public:
+
+    /**
+     * Subsystem owning the memory.
+     */
+    enum Subsystem {
+        Subsystem_Textures = 0, //!< StGLTextureData buffers of texture queues
+        Subsystem_Images,       //!< decoded images waiting for upload
+        Subsystem_Frames,       //!< frames cached by video decoders
+        Subsystem_Packets,      //!< demuxed packets queued for decoding
+        Subsystem_Pool,         //!< free blocks retained by StFrameBufferPool
+        Subsystem_NB
+    };
+
+    /**
+     * Interface of the component which is able to release memory on demand.
+     */
+    class Reclaimer {
+
+            public:
+
+        /**
+         * Destructor.
+         */
+        virtual ~Reclaimer() {}
+
+        /**
+         * Release memory (or schedule releasing).
+         * Might be called from arbitrary thread, which might hold locks of the component itself
+         * (e.g. when allocation is done by the component), so that implementation should not block.
+         * @param theBytes amount of memory exceeding the limit
+         * @return amount of memory released immediately
+         */
+        virtual size_t reclaimMemory(const size_t theBytes) = 0;
+
+    };
+
+    /**
+     * Memory block registered within the budget, released on destruction.
+     */
+    class Allocation {
+
+            public:
+
+        /**
+         * Register the block.
+         */
+        ST_CPPEXPORT Allocation(const Subsystem theSubsystem,
+                                const size_t    theSizeBytes);
+
+        /**
+         * Release the block.
+         */
+        ST_CPPEXPORT ~Allocation();
+
+        /**
+         * @return size of the block
+         */
+        ST_LOCAL size_t getSizeBytes() const { return mySizeBytes; }
+
+            private:
+
+        Subsystem mySubsystem;
+        size_t    mySizeBytes;
+
+    };
+
+        public:
+
+    /**
+     * Return global budget.
+     */
+    ST_CPPEXPORT static StMemoryBudget& GetDefault();
+
+    /**
+     * Return the amount of physical memory or 0 if unknown.
+     */
+    ST_CPPEXPORT static uint64_t getPhysicalMemory();
+
+    /**
+     * Return subsystem name.
+     */
+    ST_CPPEXPORT static const char* getSubsystemName(const Subsystem theSubsystem);
+
+    /**
+     * Main constructor.
+     * @param theLimit memory limit in bytes
+     */
+    ST_CPPEXPORT StMemoryBudget(const size_t theLimit);
+
+    /**
+     * @return memory limit in bytes
+     */
+    ST_LOCAL size_t getLimit() const { return myLimit; }
+
+    /**
+     * Set memory limit in bytes.
+     */
+    ST_CPPEXPORT void setLimit(const size_t theLimit);
+
+    /**
+     * @return overall memory usage
+     */
+    ST_CPPEXPORT size_t getUsage() const;
+
+    /**
+     * @return memory usage of specified subsystem
+     */
+    ST_CPPEXPORT size_t getUsage(const Subsystem theSubsystem) const;
+
+    /**
+     * @return TRUE if memory usage is close to the limit and components should reduce their buffers
+     */
+    ST_CPPEXPORT bool isUnderPressure() const;
+
+    /**
+     * Register allocated memory.
+     * Reclaimers are called when the limit is exceeded.
+     * @return FALSE if memory usage still exceeds the limit
+     */
+    ST_CPPEXPORT bool allocate(const Subsystem theSubsystem,
+                               const size_t    theSizeBytes);
+
+    /**
+     * Unregister released memory.
+     */
+    ST_CPPEXPORT void release(const Subsystem theSubsystem,
+                              const size_t    theSizeBytes);
+
+    /**
+     * Register reclaimer.
+     * @param theReclaimer reclaimer, should be unregistered before destruction
+     * @param thePriority  reclaimers with lower values are asked first
+     */
+    ST_CPPEXPORT void addReclaimer(Reclaimer* theReclaimer,
+                                   const int  thePriority);
+
+    /**
+     * Unregister reclaimer.
+     * Waits for reclaiming in progress, so that reclaimer can be safely destroyed afterwards.
+     */
+    ST_CPPEXPORT void removeReclaimer(Reclaimer* theReclaimer);
+
+    /**
+     * Format memory usage per subsystem.
+     */
+    ST_CPPEXPORT StString formatStats() const;
+
+        private:
+
+    /**
+     * Call reclaimers in priority order until usage fits the limit.
+     */
+    ST_LOCAL void reclaim();
+
+    /**
+     * Compute overall usage, should be called under lock.
+     */
+    ST_LOCAL size_t computeUsage() const;
+
+        private:
+
+    /**
+     * Registered reclaimer.
+     */
+    struct ReclaimerEntry {
+        Reclaimer* Object;   //!< reclaimer
+        int        Priority; //!< priority, lower values are called first
+    };
+
+        private:
+
+    mutable StMutex             myMutex;         //!< lock for usage counters
+    StMutex                     myReclaimMutex;  //!< lock for reclaimers list
+    std::vector<ReclaimerEntry> myReclaimers;    //!< reclaimers sorted by priority
+    size_t                      myLimit;         //!< memory limit in bytes
+    size_t                      myUsage[Subsystem_NB]; //!< usage per subsystem
+    size_t                      myPeak [Subsystem_NB]; //!< peak usage per subsystem
+    size_t                      myNbReclaims;    //!< number of times the limit has been exceeded
+    bool                        myIsReclaiming;  //!< flag to prevent recursive reclaiming
+
+};
+
+/**
+ * Reference-counted buffer registered within memory budget.
+ * Wraps another buffer counter, so that the budget is released together with the last reference to the buffer.
+ */
+class StMemoryBudgetCounter : public StBufferCounter {
+
+        public:
+
+    /**
+     * Empty constructor.
+     */
+    ST_CPPEXPORT StMemoryBudgetCounter();
+
+    /**
+     * Main constructor.
+     * @param theBuffer    wrapped buffer counter
+     * @param theSubsystem subsystem owning the buffer
+     * @param theSizeBytes buffer size
+     */
+    ST_CPPEXPORT StMemoryBudgetCounter(const StHandle<StBufferCounter>& theBuffer,
+                                       const StMemoryBudget::Subsystem  theSubsystem,
+                                       const size_t                     theSizeBytes);
+
+    /**
+     * Create the new reference (e.g. increment counter).
+     */
+    ST_CPPEXPORT virtual void createReference(StHandle<StBufferCounter>& theOther) const ST_ATTR_OVERRIDE;
+
+    /**
+     * Release current reference.
+     */
+    ST_CPPEXPORT virtual void releaseReference() ST_ATTR_OVERRIDE;
+
+    /**
+     * Release reference counter.
+     */
+    ST_CPPEXPORT virtual ~StMemoryBudgetCounter();
+
+        private:
+
+    StHandle<StBufferCounter>            myBuffer;     //!< wrapped buffer counter
+    StHandle<StMemoryBudget::Allocation> myAllocation; //!< shared budget record
+
+};
+
+#endif // __StMemoryBudget_h_
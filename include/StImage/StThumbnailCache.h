@@ -0,0 +1,135 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * This code is licensed under MIT license (see docs/license-mit.txt for details).
+ */
+
+#ifndef __StThumbnailCache_h_
+#define __StThumbnailCache_h_
+
+#include <StImage/StImagePlane.h>
+#include <StStrings/StString.h>
+#include <StThreads/StCondition.h>
+#include <StThreads/StMutex.h>
+#include <StThreads/StThread.h>
+
+#include <deque>
+#include <set>
+#include <vector>
+
+struct SwsContext;
+
+/**
+ * Generator of image file thumbnails working on a pool of background threads.
+ * The thumbnail is taken from embedded EXIF thumbnail (JPEG/MPO) when available,
+ * or decoded at reduced resolution (when supported by decoder) and scaled down otherwise.
+ * Generated thumbnails are stored within cache folder as small JPEG files
+ * keyed by file path, size and modification time, so that next request is served without decoding original image.
+ *
+ * Requests are processed in reverse order (the most recent first),
+ * so that items currently visible are processed before items scrolled away.
+ */
+class StThumbnailCache {
+
+        public:
+
+    /**
+     * Main constructor.
+     * @param theCacheFolder folder to store thumbnails, cache is disabled when empty
+     * @param theSizeX       maximum thumbnail width
+     * @param theSizeY       maximum thumbnail height
+     * @param theNbWorkers   number of working threads, 0 means auto
+     */
+    ST_CPPEXPORT StThumbnailCache(const StString& theCacheFolder,
+                                  const int       theSizeX,
+                                  const int       theSizeY,
+                                  const int       theNbWorkers = 0);
+
+    /**
+     * Destructor, waits for working threads.
+     */
+    ST_CPPEXPORT ~StThumbnailCache();
+
+    /**
+     * @return maximum thumbnail width
+     */
+    ST_LOCAL int getSizeX() const { return mySizeX; }
+
+    /**
+     * @return maximum thumbnail height
+     */
+    ST_LOCAL int getSizeY() const { return mySizeY; }
+
+    /**
+     * Put file into generation queue (ignored if it is already queued or being processed).
+     */
+    ST_CPPEXPORT void request(const StString& theFilePath);
+
+    /**
+     * Remove all queued requests (processed requests will be finished).
+     */
+    ST_CPPEXPORT void cancelPending();
+
+    /**
+     * Retrieve next generated thumbnail.
+     * @param theFilePath file path of generated thumbnail
+     * @param theThumb    RGB thumbnail fitting into getSizeX() x getSizeY() box, NULL if image cannot be read
+     * @return FALSE if there are no more generated thumbnails
+     */
+    ST_CPPEXPORT bool popReady(StString&               theFilePath,
+                               StHandle<StImagePlane>& theThumb);
+
+    /**
+     * Working thread function.
+     */
+    ST_LOCAL void processLoop();
+
+        private:
+
+    /**
+     * Generate thumbnail for specified file.
+     * @param theFilePath file path
+     * @param theScaler   scaler context cached by working thread
+     */
+    ST_LOCAL StHandle<StImagePlane> generate(const StString& theFilePath,
+                                             SwsContext*&    theScaler);
+
+    /**
+     * Scale decoded image plane to fit thumbnail box.
+     */
+    ST_LOCAL StHandle<StImagePlane> scale(const StImagePlane& thePlane,
+                                          SwsContext*&        theScaler);
+
+    /**
+     * @return path to the cache file for specified image, empty if cache is disabled
+     */
+    ST_LOCAL StString getCachePath(const StString& theFilePath,
+                                   const int64_t   theFileSize,
+                                   const int64_t   theModTime) const;
+
+        private:
+
+    /**
+     * Generated thumbnail.
+     */
+    struct Result {
+        StString               FilePath;
+        StHandle<StImagePlane> Thumb;
+    };
+
+        private:
+
+    std::vector< StHandle<StThread> > myThreads;  //!< working threads
+    std::deque<StString>   myQueue;      //!< queued requests, the most recent at front
+    std::set<StString>     myRequested;  //!< queued or being processed requests
+    std::deque<Result>     myReady;      //!< generated thumbnails
+    StMutex                myMutex;      //!< lock for queues
+    StCondition            myHasRequest; //!< event indicating non-empty queue
+    StString               myCacheFolder;//!< folder to store thumbnails
+    int                    mySizeX;      //!< maximum thumbnail width
+    int                    mySizeY;      //!< maximum thumbnail height
+    volatile bool          myToQuit;     //!< flag to stop working threads
+
+};
+
+#endif // __StThumbnailCache_h_
@@ -8,6 +8,7 @@
 #define __StLogger_h__
 
 #include "StString.h"
+#include "StStringBuilder.h"
 #include <StTemplates/StHandle.h>
 
 #include <typeinfo>
@@ -193,23 +194,23 @@ inline bool stQuestionConsole(const StString& theMsg) { return StMessageBox::Que
 /**
  * Debugging info output.
  */
-#define ST_ERROR_LOG(msg);        StLogger::GetDefault().write(StString() + msg, StLogger::ST_ERROR);
+#define ST_ERROR_LOG(msg);        StLogger::GetDefault().write((StStringBuilder() + msg).toString(), StLogger::ST_ERROR);
 
 #ifndef ST_DEBUG
     #define ST_DEBUG_VAR(theVariable)
     #define ST_DEBUG_LOG(msg);
     #define ST_DEBUG_LOG_CLASS(theMsg)
     #define ST_DEBUG_LOG_AT(msg);
-    #define ST_ERROR_LOG_AT(msg); StLogger::GetDefault().write(StString() + msg, StLogger::ST_ERROR);
+    #define ST_ERROR_LOG_AT(msg); StLogger::GetDefault().write((StStringBuilder() + msg).toString(), StLogger::ST_ERROR);
 #else
     #define ST_DEBUG_VAR(theVariable)  theVariable
-    #define ST_DEBUG_LOG(msg);         StLogger::GetDefault().write(StString() + msg, StLogger::ST_TRACE);
-    #define ST_DEBUG_LOG_CLASS(theMsg) StLogger::GetDefault().write(StString() + "[" + typeid(*this).name() + "]" + theMsg, StLogger::ST_TRACE);
+    #define ST_DEBUG_LOG(msg);         StLogger::GetDefault().write((StStringBuilder() + msg).toString(), StLogger::ST_TRACE);
+    #define ST_DEBUG_LOG_CLASS(theMsg) StLogger::GetDefault().write((StStringBuilder() + "[" + typeid(*this).name() + "]" + theMsg).toString(), StLogger::ST_TRACE);
     #define STRINGIFY(x) #x
     #define TOSTRING(x) STRINGIFY(x)
     #define __AT __FILE__ ":" TOSTRING(__LINE__)
-    #define ST_DEBUG_LOG_AT(msg); StLogger::GetDefault().write(StString() + __AT + " " + msg, StLogger::ST_TRACE);
-    #define ST_ERROR_LOG_AT(msg); StLogger::GetDefault().write(StString() + __AT + " " + msg, StLogger::ST_ERROR);
+    #define ST_DEBUG_LOG_AT(msg); StLogger::GetDefault().write((StStringBuilder() + __AT + " " + msg).toString(), StLogger::ST_TRACE);
+    #define ST_ERROR_LOG_AT(msg); StLogger::GetDefault().write((StStringBuilder() + __AT + " " + msg).toString(), StLogger::ST_ERROR);
 #endif
 
 #endif //__StLogger_h__
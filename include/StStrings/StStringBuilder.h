@@ -0,0 +1,311 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * This code is licensed under MIT license (see docs/license-mit.txt for details).
+ */
+
+#ifndef __StStringBuilder_h__
+#define __StStringBuilder_h__
+
+#include <StStrings/StString.h>
+
+/**
+ * Auxiliary class to concatenate multiple strings and numbers into StStringUnicode.
+ * Pieces are appended into single growing buffer (within object for short text),
+ * numbers are formatted in-place, so that the only allocation is done by final toString() (or none for short strings).
+ *
+ * The builder supports the same operator+ chain syntax as StStringUnicode:
+ * @code
+ *   const StString aText = (StStringBuilder() + "Position " + aPos + " from " + aDuration).toString();
+ * @endcode
+ */
+template<typename Type>
+class StStringBuilderUnicode {
+
+        public:
+
+    /**
+     * Empty constructor.
+     */
+    StStringBuilderUnicode()
+    : myBuffer(myStack),
+      myCapacity(sizeof(myStack)),
+      mySize(0),
+      myLength(0) {
+        myStack[0] = Type(0);
+    }
+
+    /**
+     * Destructor.
+     */
+    ~StStringBuilderUnicode() {
+        if(myBuffer != myStack) {
+            ::operator delete(myBuffer);
+        }
+    }
+
+    /**
+     * Returns the size of the buffer, excluding NULL-termination symbol
+     */
+    size_t getSize() const { return mySize; }
+
+    /**
+     * Returns the length of the string in Unicode symbols.
+     */
+    size_t getLength() const { return myLength; }
+
+    /**
+     * @return true if string is empty
+     */
+    bool isEmpty() const { return mySize == 0; }
+
+    /**
+     * Returns NULL-terminated Unicode string.
+     */
+    const Type* toCString() const { return myBuffer; }
+
+    /**
+     * Make the builder empty (allocated memory is preserved).
+     */
+    void clear() {
+        mySize   = 0;
+        myLength = 0;
+        myBuffer[0] = Type(0);
+    }
+
+    /**
+     * Create the string from accumulated content.
+     */
+    StStringUnicode<Type> toString() const {
+        return StStringUnicode<Type>(stStringExtConstr((const Type* )myBuffer, mySize, myLength));
+    }
+
+        public: //! @name append methods
+
+    /**
+     * Append string of the same type.
+     */
+    StStringBuilderUnicode& append(const StConstStringUnicode<Type>& theString) {
+        appendRaw(theString.String, theString.Size, theString.Length);
+        return *this;
+    }
+
+    /**
+     * Append NULL-terminated Unicode string.
+     */
+    template<typename TypeFrom>
+    StStringBuilderUnicode& append(const TypeFrom* theString) {
+        if(theString == NULL) {
+            return *this;
+        }
+
+        size_t aSize = 0;
+        StUtfIterator<TypeFrom> anIter(theString);
+        switch(sizeof(Type)) {
+            case sizeof(stUtf8_t):  for(; *anIter != 0; ++anIter) { aSize += anIter.getAdvanceBytesUtf8();  } break;
+            case sizeof(stUtf16_t): for(; *anIter != 0; ++anIter) { aSize += anIter.getAdvanceBytesUtf16(); } break;
+            case sizeof(stUtf32_t): for(; *anIter != 0; ++anIter) { aSize += anIter.getAdvanceBytesUtf32(); } break;
+            default: return *this;
+        }
+        const size_t aLength = anIter.getIndex();
+        if(sizeof(TypeFrom) == sizeof(Type)) {
+            appendRaw((const Type* )theString, aSize, aLength);
+            return *this;
+        }
+
+        reserve(aSize);
+        Type* anIterWrite = (Type* )((stUByte_t* )myBuffer + mySize);
+        for(anIter.init(theString); *anIter != 0; ++anIter) {
+            anIterWrite = anIter.getUtf(anIterWrite);
+        }
+        mySize   += aSize;
+        myLength += aLength;
+        myBuffer[mySize / sizeof(Type)] = Type(0);
+        return *this;
+    }
+
+    /**
+     * Append ASCII symbol.
+     */
+    StStringBuilderUnicode& append(const char theChar) {
+        if(theChar != '\0') {
+            appendAscii(&theChar, 1);
+        }
+        return *this;
+    }
+
+    /**
+     * Append integer number.
+     */
+    StStringBuilderUnicode& append(const int32_t theInt32) {
+        return appendInteger(uint64_t(theInt32 < 0 ? -int64_t(theInt32) : int64_t(theInt32)), theInt32 < 0);
+    }
+
+    /**
+     * Append integer number.
+     */
+    StStringBuilderUnicode& append(const uint32_t theUInt32) {
+        return appendInteger(uint64_t(theUInt32), false);
+    }
+
+    /**
+     * Append integer number.
+     */
+    StStringBuilderUnicode& append(const int64_t theInt64) {
+        // negate within unsigned type to handle INT64_MIN
+        return appendInteger(theInt64 < 0 ? (~uint64_t(theInt64) + 1) : uint64_t(theInt64), theInt64 < 0);
+    }
+
+    /**
+     * Append integer number.
+     */
+    StStringBuilderUnicode& append(const uint64_t theUInt64) {
+        return appendInteger(theUInt64, false);
+    }
+
+#ifdef ST_HAS_INT64_EXT
+    StStringBuilderUnicode& append(const stInt64ext_t  theInt64)  { return append(int64_t (theInt64)); }
+    StStringBuilderUnicode& append(const stUInt64ext_t theUInt64) { return append(uint64_t(theUInt64)); }
+#endif
+
+    /**
+     * Append floating point number (formatted in the same way as StStringUnicode constructor).
+     */
+    StStringBuilderUnicode& append(const double theFloat) {
+        char aBuff[256];
+        stsprintf(aBuff, 256, "%f", theFloat);
+        aBuff[255] = '\0';
+        appendAscii(aBuff, std::strlen(aBuff));
+        return *this;
+    }
+
+        public: //! @name concatenation operators
+
+    StStringBuilderUnicode& operator+(const StConstStringUnicode<Type>& theString) { return append(theString); }
+    StStringBuilderUnicode& operator+(const StStringUnicode<Type>& theString)      { return append(theString); }
+    StStringBuilderUnicode& operator+(const char*        theString) { return append(theString); }
+    StStringBuilderUnicode& operator+(const stUtf16_t*   theString) { return append(theString); }
+    StStringBuilderUnicode& operator+(const stUtf32_t*   theString) { return append(theString); }
+    StStringBuilderUnicode& operator+(const stUtfWide_t* theString) { return append(theString); }
+    StStringBuilderUnicode& operator+(const char     theChar)   { return append(theChar); }
+    StStringBuilderUnicode& operator+(const int32_t  theInt32)  { return append(theInt32); }
+    StStringBuilderUnicode& operator+(const uint32_t theUInt32) { return append(theUInt32); }
+    StStringBuilderUnicode& operator+(const int64_t  theInt64)  { return append(theInt64); }
+    StStringBuilderUnicode& operator+(const uint64_t theUInt64) { return append(theUInt64); }
+    StStringBuilderUnicode& operator+(const double   theFloat)  { return append(theFloat); }
+#ifdef ST_HAS_INT64_EXT
+    StStringBuilderUnicode& operator+(const stInt64ext_t  theInt64)  { return append(theInt64); }
+    StStringBuilderUnicode& operator+(const stUInt64ext_t theUInt64) { return append(theUInt64); }
+#endif
+
+    /**
+     * Append string in another Unicode encoding (converted in-place).
+     */
+    template<typename TypeFrom>
+    StStringBuilderUnicode& operator+(const StConstStringUnicode<TypeFrom>& theString) { return append(theString.String); }
+
+    template<typename TypeFrom>
+    StStringBuilderUnicode& operator+(const StStringUnicode<TypeFrom>& theString) { return append(theString.toCString()); }
+
+    /**
+     * Append any other value convertible to StStringUnicode (bool, float, enumerations and others).
+     */
+    template<typename TypeValue>
+    StStringBuilderUnicode& operator+(const TypeValue& theValue) {
+        return append(StStringUnicode<Type>(theValue));
+    }
+
+    StStringBuilderUnicode& operator+=(const StConstStringUnicode<Type>& theString) { return append(theString); }
+
+        private:
+
+    /**
+     * Ensure buffer has enough space for specified number of extra bytes.
+     */
+    void reserve(const size_t theExtraBytes) {
+        const size_t aSizeNeeded = mySize + theExtraBytes + sizeof(Type);
+        if(aSizeNeeded <= myCapacity) {
+            return;
+        }
+
+        size_t aCapacity = myCapacity * 2;
+        while(aCapacity < aSizeNeeded) {
+            aCapacity *= 2;
+        }
+        Type* aBuffer = (Type* )::operator new(aCapacity);
+        stMemCpy(aBuffer, myBuffer, mySize + sizeof(Type));
+        if(myBuffer != myStack) {
+            ::operator delete(myBuffer);
+        }
+        myBuffer   = aBuffer;
+        myCapacity = aCapacity;
+    }
+
+    /**
+     * Append data of the same type.
+     */
+    void appendRaw(const Type*  theData,
+                   const size_t theSize,
+                   const size_t theLength) {
+        reserve(theSize);
+        stMemCpy((stUByte_t* )myBuffer + mySize, theData, theSize);
+        mySize   += theSize;
+        myLength += theLength;
+        myBuffer[mySize / sizeof(Type)] = Type(0);
+    }
+
+    /**
+     * Append ASCII text.
+     */
+    void appendAscii(const char*  theText,
+                     const size_t theNbChars) {
+        reserve(theNbChars * sizeof(Type));
+        Type* aDst = (Type* )((stUByte_t* )myBuffer + mySize);
+        for(size_t aCharIter = 0; aCharIter < theNbChars; ++aCharIter) {
+            aDst[aCharIter] = Type(theText[aCharIter]);
+        }
+        mySize   += theNbChars * sizeof(Type);
+        myLength += theNbChars;
+        myBuffer[mySize / sizeof(Type)] = Type(0);
+    }
+
+    /**
+     * Format integer number.
+     */
+    StStringBuilderUnicode& appendInteger(uint64_t   theValue,
+                                          const bool theIsNegative) {
+        char  aBuff[24];
+        char* aDigit = aBuff + sizeof(aBuff);
+        do {
+            *--aDigit = char('0' + theValue % 10);
+            theValue /= 10;
+        } while(theValue != 0);
+        if(theIsNegative) {
+            *--aDigit = '-';
+        }
+        appendAscii(aDigit, size_t(aBuff + sizeof(aBuff) - aDigit));
+        return *this;
+    }
+
+        private:
+
+    StStringBuilderUnicode(const StStringBuilderUnicode& );
+    StStringBuilderUnicode& operator=(const StStringBuilderUnicode& );
+
+        private:
+
+    Type   myStack[256 / sizeof(Type)]; //!< buffer for short text
+    Type*  myBuffer;   //!< active buffer (myStack or heap)
+    size_t myCapacity; //!< active buffer capacity in bytes
+    size_t mySize;     //!< text size in bytes, excluding NULL-termination symbol
+    size_t myLength;   //!< text length in Unicode symbols
+
+};
+
+typedef StStringBuilderUnicode<stUtf8_t>    StStringBuilderUtf8;
+typedef StStringBuilderUnicode<stUtf16_t>   StStringBuilderUtf16;
+typedef StStringBuilderUnicode<stUtf32_t>   StStringBuilderUtf32;
+typedef StStringBuilderUnicode<stUtfWide_t> StStringBuilderUtfWide;
+typedef StStringBuilderUtf8                 StStringBuilder;
+
+#endif // __StStringBuilder_h__
@@ -11,6 +11,7 @@
 #include <StTemplates/StHandle.h>
 
 #include <iostream>
+#include <new>
 
 /**
  * This template of POD structure for constant UTF-* string.
@@ -150,6 +151,11 @@ inline const StConstStringUnicode<Type> stStringExtConstr(const Type*  theString
  * Notice that changing the string is not allowed
  * and any modifications should produce new string.
  * Class StText is more efficient for frequently modified string.
+ *
+ * Short strings (up to THE_INLINE_BYTES bytes including NULL-termination symbol)
+ * are stored within the object itself without heap allocation.
+ * Longer strings are allocated by global operator new, so that heap usage can be tracked by replacing it.
+ * Use StStringBuilderUnicode to concatenate multiple pieces without temporary strings.
  */
 template<typename Type>
 class StStringUnicode : public StConstStringUnicode<Type> {
@@ -180,6 +186,14 @@ class StStringUnicode : public StConstStringUnicode<Type> {
      */
     StStringUnicode(const StConstStringUnicode<Type>& theCopy);
 
+#ifdef ST_HAS_RVALUE_REFS
+    /**
+     * Move constructor.
+     * @param theMove string to move, becomes empty
+     */
+    StStringUnicode(StStringUnicode&& theMove);
+#endif
+
     /**
      * Copy constructor from NULL-terminated UTF-8 string.
      * @param theCopy   NULL-terminated UTF-8 string to copy
@@ -438,6 +452,13 @@ class StStringUnicode : public StConstStringUnicode<Type> {
      */
     const StStringUnicode& operator=(const stUtfWide_t* theStringUtfWide);
 
+#ifdef ST_HAS_RVALUE_REFS
+    /**
+     * Move from another string.
+     */
+    const StStringUnicode& operator=(StStringUnicode&& theOther);
+#endif
+
     /**
      * Join strings.
      */
@@ -449,10 +470,9 @@ class StStringUnicode : public StConstStringUnicode<Type> {
     friend StStringUnicode operator+(const StStringUnicode& theLeft,
                                      const StStringUnicode& theRight) {
         StStringUnicode aSumm;
-        stStrFree(aSumm.String);
         aSumm.Size   = theLeft.Size   + theRight.Size;
         aSumm.Length = theLeft.Length + theRight.Length;
-        aSumm.String = stStrAlloc(aSumm.Size);
+        aSumm.String = aSumm.strAllocHere(aSumm.Size);
 
         // copy bytes
         stStrCopy((stUByte_t* )aSumm.String,                (const stUByte_t* )theLeft.String,  theLeft.Size);
@@ -460,6 +480,13 @@ class StStringUnicode : public StConstStringUnicode<Type> {
         return aSumm;
     }
 
+    /**
+     * Return TRUE if string is stored within object (without heap allocation).
+     */
+    inline bool isInline() const {
+        return this->String == myInline;
+    }
+
     /**
      * Set all template concretizations as friends to access private methods.
      */
@@ -495,7 +522,7 @@ class StStringUnicode : public StConstStringUnicode<Type> {
      * Allocate NULL-terminated string buffer.
      */
     static inline Type* stStrAlloc(const size_t theSizeBytes) {
-        Type* aPtr = stMemAlloc<Type*>(theSizeBytes + sizeof(Type));
+        Type* aPtr = (Type* )::operator new(theSizeBytes + sizeof(Type), std::nothrow);
         if(aPtr != NULL) {
             // always NULL-terminate the string
             aPtr[theSizeBytes / sizeof(Type)] = Type(0);
@@ -503,11 +530,33 @@ class StStringUnicode : public StConstStringUnicode<Type> {
         return aPtr;
     }
 
+    /**
+     * Allocate NULL-terminated buffer for this string:
+     * within inline storage for short strings and on heap otherwise.
+     */
+    inline Type* strAllocHere(const size_t theSizeBytes) {
+        if(theSizeBytes + sizeof(Type) <= sizeof(myInline)) {
+            myInline[theSizeBytes / sizeof(Type)] = Type(0);
+            return myInline;
+        }
+        return stStrAlloc(theSizeBytes);
+    }
+
+    /**
+     * Release buffer allocated by strAllocHere() and nullify the pointer.
+     */
+    inline void strFreeHere(const Type*& thePtr) {
+        if(thePtr != myInline) {
+            ::operator delete((void* )thePtr);
+        }
+        thePtr = NULL;
+    }
+
     /**
      * Release string buffer and nullify the pointer.
      */
     static inline void stStrFree(const Type*& thePtr) {
-        stMemFree((void* )thePtr);
+        ::operator delete((void* )thePtr);
         thePtr = NULL;
     }
 
@@ -515,7 +564,7 @@ class StStringUnicode : public StConstStringUnicode<Type> {
      * Release string buffer and nullify the pointer.
      */
     static inline void stStrFree(Type*& thePtr) {
-        stMemFree(thePtr);
+        ::operator delete(thePtr);
         thePtr = NULL;
     }
 
@@ -543,6 +592,17 @@ class StStringUnicode : public StConstStringUnicode<Type> {
     static size_t urlDecode(const Type* theSrcUrl,
                             stUtf8_t*   theOut);
 
+        public:
+
+    /**
+     * Size of inline storage for short strings in bytes.
+     */
+    static const size_t THE_INLINE_BYTES = 32;
+
+        private:
+
+    Type myInline[THE_INLINE_BYTES / sizeof(Type)]; //!< inline storage for short strings
+
 };
 
 typedef StStringUnicode<stUtf8_t>    StStringUtf8;
@@ -70,22 +70,22 @@ const Type* StStringUnicode<Type>::getCharBuffer(const size_t theCharIndex) cons
 
 template<typename Type> inline
 void StStringUnicode<Type>::clear() {
-    stStrFree(this->String);
+    strFreeHere(this->String);
     this->Size   = 0;
     this->Length = 0;
-    this->String = stStrAlloc(this->Size);
+    this->String = strAllocHere(this->Size);
 }
 
 template<typename Type> inline
 StStringUnicode<Type>::StStringUnicode() {
-    this->String = stStrAlloc(0);
+    this->String = strAllocHere(0);
     this->Size   = 0;
     this->Length = 0;
 }
 
 template<typename Type> inline
 StStringUnicode<Type>::StStringUnicode(const StStringUnicode& theCopy) {
-    this->String = stStrAlloc(theCopy.Size);
+    this->String = strAllocHere(theCopy.Size);
     this->Size   = theCopy.Size;
     this->Length = theCopy.Length;
     stStrCopy((stUByte_t* )this->String, (const stUByte_t* )theCopy.String, this->Size);
@@ -93,12 +93,31 @@ StStringUnicode<Type>::StStringUnicode(const StStringUnicode& theCopy) {
 
 template<typename Type> inline
 StStringUnicode<Type>::StStringUnicode(const StConstStringUnicode<Type>& theCopy) {
-    this->String = stStrAlloc(theCopy.Size);
+    this->String = strAllocHere(theCopy.Size);
     this->Size   = theCopy.Size;
     this->Length = theCopy.Length;
     stStrCopy((stUByte_t* )this->String, (const stUByte_t* )theCopy.String, this->Size);
 }
 
+#ifdef ST_HAS_RVALUE_REFS
+template<typename Type> inline
+StStringUnicode<Type>::StStringUnicode(StStringUnicode&& theMove) {
+    this->Size   = theMove.Size;
+    this->Length = theMove.Length;
+    if(!theMove.isInline()) {
+        // take ownership over heap buffer
+        this->String = theMove.String;
+        theMove.String = theMove.strAllocHere(0);
+        theMove.Size   = 0;
+        theMove.Length = 0;
+        return;
+    }
+
+    this->String = strAllocHere(this->Size);
+    stStrCopy((stUByte_t* )this->String, (const stUByte_t* )theMove.String, this->Size);
+}
+#endif
+
 template<typename Type> inline
 StStringUnicode<Type>::StStringUnicode(const char*  theCopyUtf8,
                                        const size_t theLength) {
@@ -144,12 +163,12 @@ StStringUnicode<Type>::StStringUnicode(const char theChar) {
         // empty string
         this->Size   = 0;
         this->Length = 0;
-        this->String = stStrAlloc(this->Size);
+        this->String = strAllocHere(this->Size);
         return;
     }
     this->Size   = sizeof(Type);
     this->Length = 1;
-    this->String = stStrAlloc(this->Size);
+    this->String = strAllocHere(this->Size);
     ((Type* )this->String)[0] = Type(theChar);
 }
 
@@ -227,7 +246,7 @@ StStringUnicode<Type>::StStringUnicode(const double theFloat) {
 
 template<typename Type> inline
 StStringUnicode<Type>::~StStringUnicode() {
-    stStrFree(this->String);
+    strFreeHere(this->String);
 }
 
 template<typename Type> inline
@@ -235,14 +254,35 @@ const StStringUnicode<Type>& StStringUnicode<Type>::operator=(const StStringUnic
     if(this == &theOther) {
         return (*this);
     }
-    stStrFree(this->String);
+    strFreeHere(this->String);
     this->Size   = theOther.Size;
     this->Length = theOther.Length;
-    this->String = stStrAlloc(this->Size);
+    this->String = strAllocHere(this->Size);
     stStrCopy((stUByte_t* )this->String, (const stUByte_t* )theOther.String, this->Size);
     return (*this);
 }
 
+#ifdef ST_HAS_RVALUE_REFS
+template<typename Type> inline
+const StStringUnicode<Type>& StStringUnicode<Type>::operator=(StStringUnicode<Type>&& theOther) {
+    if(this == &theOther) {
+        return (*this);
+    } else if(theOther.isInline()) {
+        return operator=((const StStringUnicode<Type>& )theOther);
+    }
+
+    // take ownership over heap buffer
+    strFreeHere(this->String);
+    this->Size   = theOther.Size;
+    this->Length = theOther.Length;
+    this->String = theOther.String;
+    theOther.String = theOther.strAllocHere(0);
+    theOther.Size   = 0;
+    theOther.Length = 0;
+    return (*this);
+}
+#endif
+
 template<typename Type> template<typename TypeFrom>
 void StStringUnicode<Type>::fromUnicode(const StConstStringUnicode<TypeFrom>& theString) {
     fromUnicode(theString.toCString());
@@ -251,6 +291,16 @@ void StStringUnicode<Type>::fromUnicode(const StConstStringUnicode<TypeFrom>& th
 template<typename Type> template<typename TypeFrom>
 void StStringUnicode<Type>::fromUnicode(const TypeFrom* theStringUtf,
                                         const size_t    theLength) {
+    // copy source pointing into inline storage, which will be overwritten
+    stUByte_t aSrcCopy[sizeof(myInline)];
+    const stUByte_t* aSrcBytes = (const stUByte_t* )theStringUtf;
+    if(aSrcBytes >= (const stUByte_t* )myInline
+    && aSrcBytes <  (const stUByte_t* )myInline + sizeof(myInline)) {
+        const size_t anOffset = size_t(aSrcBytes - (const stUByte_t* )myInline);
+        stStrCopy(aSrcCopy, (const stUByte_t* )myInline, sizeof(myInline));
+        theStringUtf = (const TypeFrom* )(aSrcCopy + anOffset);
+    }
+
     const Type* anOldBuffer = this->String; // necessary in case of self-copying
     StUtfIterator<TypeFrom> anIterRead(theStringUtf);
     if(*anIterRead == 0) {
@@ -267,9 +317,9 @@ void StStringUnicode<Type>::fromUnicode(const TypeFrom* theStringUtf,
 
                 this->Size   = size_t((stUByte_t* )anIterRead.getBufferHere() - (stUByte_t* )theStringUtf);
                 this->Length = anIterRead.getIndex();
-                this->String = stStrAlloc(this->Size);
+                this->String = strAllocHere(this->Size);
                 stStrCopy((stUByte_t* )this->String, (const stUByte_t* )theStringUtf, this->Size);
-                stStrFree(anOldBuffer);
+                strFreeHere(anOldBuffer);
                 return;
             }
         }
@@ -277,14 +327,14 @@ void StStringUnicode<Type>::fromUnicode(const TypeFrom* theStringUtf,
     }
 
     strGetAdvance(theStringUtf, theLength, this->Size, this->Length);
-    this->String = stStrAlloc(this->Size);
+    this->String = strAllocHere(this->Size);
     // reset iterator
     anIterRead.init(theStringUtf);
     const Type* anIterWrite = this->String;
     for(; *anIterRead != 0 && anIterRead.getIndex() < theLength; ++anIterRead) {
         anIterWrite = anIterRead.getUtf(anIterWrite);
     }
-    stStrFree(anOldBuffer);
+    strFreeHere(anOldBuffer);
 }
 
 template<typename Type> inline
@@ -485,13 +535,23 @@ StStringUnicode<Type>& StStringUnicode<Type>::operator+=(const StStringUnicode<T
     if(theAppend.isEmpty()) {
         return (*this);
     }
-    // create new string
     const size_t aSize = this->Size + theAppend.Size;
+    if(isInline()
+    && aSize + sizeof(Type) <= sizeof(myInline)) {
+        // append in-place
+        stStrCopy((stUByte_t* )myInline + this->Size, (const stUByte_t* )theAppend.String, theAppend.Size);
+        myInline[aSize / sizeof(Type)] = Type(0);
+        this->Size    = aSize;
+        this->Length += theAppend.Length;
+        return (*this);
+    }
+
+    // create new string
     Type* aString = stStrAlloc(aSize);
     stStrCopy((stUByte_t* )aString,              (const stUByte_t* )this->String,     this->Size);
     stStrCopy((stUByte_t* )aString + this->Size, (const stUByte_t* )theAppend.String, theAppend.Size);
 
-    stStrFree(this->String);
+    strFreeHere(this->String);
     this->Size   = aSize;
     this->String = aString;
     this->Length += theAppend.Length;
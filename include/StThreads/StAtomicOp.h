@@ -1,5 +1,5 @@
 /**
- * Copyright © 2011-2014 Kirill Gavrilov <kirill@sview.ru>
+ * Copyright © 2011-2026 Kirill Gavrilov <kirill@sview.ru>
  *
  * This code is licensed under MIT license (see docs/license-mit.txt for details).
  */
@@ -91,6 +91,68 @@ class StAtomicOp {
         return (uint32_t )Decrement((volatile int32_t& )theValue);
     }
 
+    /**
+     * Add the value and return result (full memory barrier).
+     * Adding zero can be used for reading the value written by another thread.
+     * @param theValue (volatile int32_t& ) - input value;
+     * @param theAdd   value to add;
+     * @return summary value.
+     */
+    static inline int32_t Add(volatile int32_t& theValue,
+                              const int32_t     theAdd) {
+    #ifdef __GCC_HAVE_SYNC_COMPARE_AND_SWAP_4
+        // g++ compiler
+        return __sync_add_and_fetch(&theValue, theAdd);
+    #elif defined(_WIN32)
+        return InterlockedExchangeAdd((volatile LONG* )&theValue, theAdd) + theAdd;
+    #elif defined(__APPLE__)
+        return OSAtomicAdd32Barrier(theAdd, &theValue);
+    #elif defined(__GNUC__)
+        #error "Set -march=i486 or -march=armv7-a for gcc compiler"
+        return theValue += theAdd;
+    #else
+        #error "Atomic operation doesn't implemented for current platform!"
+        return theValue += theAdd;
+    #endif
+    }
+
+    /**
+     * Add the value and return result (full memory barrier).
+     * @param theValue (volatile uint32_t& ) - input value;
+     * @param theAdd   value to add;
+     * @return summary value.
+     */
+    static inline uint32_t Add(volatile uint32_t& theValue,
+                               const uint32_t     theAdd) {
+        return (uint32_t )Add((volatile int32_t& )theValue, (int32_t )theAdd);
+    }
+
+    /**
+     * Set the value to theNew if it is equal to theOld (full memory barrier).
+     * @param theValue (volatile int32_t& ) - input value;
+     * @param theOld   expected value;
+     * @param theNew   value to set;
+     * @return true if the value has been changed.
+     */
+    static inline bool CompareAndSwap(volatile int32_t& theValue,
+                                      const int32_t     theOld,
+                                      const int32_t     theNew) {
+    #ifdef __GCC_HAVE_SYNC_COMPARE_AND_SWAP_4
+        // g++ compiler
+        return __sync_bool_compare_and_swap(&theValue, theOld, theNew);
+    #elif defined(_WIN32)
+        return InterlockedCompareExchange((volatile LONG* )&theValue, theNew, theOld) == theOld;
+    #elif defined(__APPLE__)
+        return OSAtomicCompareAndSwap32Barrier(theOld, theNew, &theValue);
+    #elif defined(__GNUC__)
+        #error "Set -march=i486 or -march=armv7-a for gcc compiler"
+        return false;
+    #else
+        #error "Atomic operation doesn't implemented for current platform!"
+        return false;
+    #endif
+    }
+
     // int64_t, actually available on win32 too, but since WinNT 5.2 (Windows XP x64)
 #if (defined(_WIN64) || defined(__WIN64__))\
  || (defined(_LP64)  || defined(__LP64__))
@@ -0,0 +1,232 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * This code is licensed under MIT license (see docs/license-mit.txt for details).
+ */
+
+#ifndef __StProfiler_h_
+#define __StProfiler_h_
+
+#include <StStrings/StString.h>
+#include <StThreads/StMutexSlim.h>
+#include <StThreads/StTimer.h>
+
+#include <vector>
+
+/**
+ * Lightweight instrumentation of hot paths (decoding, texture upload, rendering).
+ * Completed zones are written into per-thread ring buffers without locks
+ * (each buffer has exactly one writer - the owning thread),
+ * while disabled profiler costs a single flag check per zone.
+ *
+ * Zone names should be static strings - only pointer is stored.
+ * Recorded zones can be displayed by StGLFpsLabel
+ * or exported into Chrome trace JSON format (chrome://tracing, Perfetto).
+ */
+class StProfiler {
+
+        public:
+
+    /**
+     * Completed zone.
+     */
+    struct Zone {
+        const char* Name;       //!< zone name (static string)
+        double      StartUSec;  //!< zone start in microseconds since profiler creation
+        double      EndUSec;    //!< zone end   in microseconds since profiler creation
+        int         ThreadSlot; //!< index of the thread slot
+    };
+
+    enum {
+        THREADS_MAX      = 64,   //!< maximum number of profiled threads
+        ZONES_PER_THREAD = 8192, //!< capacity of per-thread ring buffer, should be power of two
+    };
+
+        public:
+
+    /**
+     * Return global profiler instance.
+     */
+    ST_CPPEXPORT static StProfiler& GetDefault();
+
+    /**
+     * Empty constructor (profiler is disabled by default).
+     */
+    ST_CPPEXPORT StProfiler();
+
+    /**
+     * Destructor.
+     */
+    ST_CPPEXPORT ~StProfiler();
+
+    /**
+     * @return true if zones should be recorded
+     */
+    ST_LOCAL bool isEnabled() const { return myIsEnabled; }
+
+    /**
+     * Enable or disable recording of zones.
+     * Already recorded zones are preserved.
+     */
+    ST_CPPEXPORT void setEnabled(const bool theToEnable);
+
+    /**
+     * @return current time in microseconds since profiler creation
+     */
+    ST_LOCAL double getTimeMicroSec() const { return myTimer.getElapsedTimeInMicroSec(); }
+
+    /**
+     * Record completed zone within ring buffer of calling thread.
+     * @param theName      zone name (static string)
+     * @param theStartUSec zone start time
+     * @param theEndUSec   zone end   time
+     */
+    ST_CPPEXPORT void addZone(const char*  theName,
+                              const double theStartUSec,
+                              const double theEndUSec);
+
+    /**
+     * Assign the name to calling thread to be shown in exported trace.
+     * @param theName thread name (static string)
+     */
+    ST_CPPEXPORT void setThreadName(const char* theName);
+
+    /**
+     * Release the slot of calling thread, should be called before thread exit.
+     * The slot will be reused by the next registered thread (zones of exited thread are discarded).
+     */
+    ST_CPPEXPORT void releaseThreadSlot();
+
+    /**
+     * Return the name of the thread owning specified slot.
+     * @param theSlot thread slot index (Zone::ThreadSlot)
+     * @return thread name or NULL if not assigned
+     */
+    ST_CPPEXPORT const char* getThreadName(const int theSlot) const;
+
+    /**
+     * Copy zones from all threads finished after specified time.
+     * Zones are not sorted.
+     * @param theFromUSec time to start from
+     * @param theZones    output list of zones (appended)
+     */
+    ST_CPPEXPORT void getZones(const double       theFromUSec,
+                               std::vector<Zone>& theZones) const;
+
+    /**
+     * Save recorded zones into file in Chrome trace JSON format.
+     * @param theFilePath output file path
+     * @return true on success
+     */
+    ST_CPPEXPORT bool exportChromeTrace(const StString& theFilePath) const;
+
+        private:
+
+    /**
+     * Per-thread ring buffer.
+     */
+    struct ThreadSlot {
+        size_t            ThreadId; //!< owner thread
+        const char*       Name;     //!< thread name
+        Zone*             Zones;    //!< ring buffer
+        volatile uint32_t Head;     //!< number of zones written (wraps around)
+        volatile uint32_t First;    //!< index of the first zone written by current owner
+        volatile bool     IsFree;   //!< slot has been released by exited thread
+    };
+
+    /**
+     * Return ring buffer of calling thread (cached within thread-local pointer) or register the new one.
+     * @return NULL if slots limit has been reached
+     */
+    ST_LOCAL ThreadSlot* getThreadSlot();
+
+    /**
+     * Find ring buffer of calling thread or register the new one.
+     * @return NULL if slots limit has been reached
+     */
+    ST_LOCAL ThreadSlot* registerThreadSlot();
+
+        private:
+
+    StTimer              myTimer;              //!< global timer
+    mutable StMutexSlim  myMutex;              //!< mutex for registering new threads
+    ThreadSlot           mySlots[THREADS_MAX]; //!< per-thread buffers
+    volatile int32_t     myNbSlots;            //!< number of registered threads
+    volatile bool        myIsEnabled;          //!< recording state
+
+};
+
+/**
+ * Auxiliary class naming the thread within profiler and releasing its slot on scope exit.
+ * Should be put at the beginning of thread function.
+ */
+class StProfilerThread {
+
+        public:
+
+    /**
+     * Assign the name to calling thread.
+     * @param theName thread name (static string)
+     */
+    ST_LOCAL StProfilerThread(const char* theName) {
+        StProfiler::GetDefault().setThreadName(theName);
+    }
+
+    /**
+     * Release the slot of calling thread.
+     */
+    ST_LOCAL ~StProfilerThread() {
+        StProfiler::GetDefault().releaseThreadSlot();
+    }
+
+};
+
+/**
+ * Auxiliary class measuring the scope.
+ */
+class StProfilerZone {
+
+        public:
+
+    /**
+     * Start zone.
+     */
+    ST_LOCAL StProfilerZone(const char* theName)
+    : myProfiler(&StProfiler::GetDefault()),
+      myName(theName),
+      myStartUSec(-1.0) {
+        if(myProfiler->isEnabled()) {
+            myStartUSec = myProfiler->getTimeMicroSec();
+        }
+    }
+
+    /**
+     * Finish zone.
+     */
+    ST_LOCAL ~StProfilerZone() {
+        if(myStartUSec >= 0.0) {
+            myProfiler->addZone(myName, myStartUSec, myProfiler->getTimeMicroSec());
+        }
+    }
+
+        private:
+
+    StProfiler* myProfiler;
+    const char* myName;
+    double      myStartUSec;
+
+};
+
+#define ST_PROFILER_CONCAT_IMPL(theA, theB) theA##theB
+#define ST_PROFILER_CONCAT(theA, theB) ST_PROFILER_CONCAT_IMPL(theA, theB)
+
+#ifdef ST_NO_PROFILER
+    #define ST_PROFILER_ZONE(theName)
+#else
+    /**
+     * Measure the current scope as zone with specified name.
+     */
+    #define ST_PROFILER_ZONE(theName) StProfilerZone ST_PROFILER_CONCAT(aProfilerZone, __LINE__)(theName)
+#endif
+
+#endif // __StProfiler_h_
@@ -0,0 +1,130 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * This code is licensed under MIT license (see docs/license-mit.txt for details).
+ */
+
+#ifndef __StStartupTimeline_h_
+#define __StStartupTimeline_h_
+
+#include <StThreads/StMutexSlim.h>
+#include <StThreads/StProfiler.h>
+
+#include <vector>
+
+/**
+ * Timeline of application cold start - plugin loading, settings, translations, window creation,
+ * fonts, GUI textures, shaders and so on till the first drawn frame.
+ * Phases might be recorded from any thread (including background initialization jobs)
+ * and are written into the log once by finish().
+ *
+ * Phase names should be static strings - only pointer is stored.
+ */
+class StStartupTimeline {
+
+        public:
+
+    /**
+     * Completed phase.
+     */
+    struct Phase {
+        const char* Name;       //!< phase name (static string)
+        double      StartMSec;  //!< phase start in milliseconds since timeline creation
+        double      EndMSec;    //!< phase end   in milliseconds since timeline creation
+        bool        IsMain;     //!< phase has been recorded by the thread created the timeline
+    };
+
+        public:
+
+    /**
+     * Return global timeline instance.
+     * The first call defines the start of the timeline, so it should be done as early as possible.
+     */
+    ST_CPPEXPORT static StStartupTimeline& GetDefault();
+
+    /**
+     * Empty constructor, starts the timer.
+     */
+    ST_CPPEXPORT StStartupTimeline();
+
+    /**
+     * @return true if first frame has been reached and new phases are ignored
+     */
+    ST_LOCAL bool isFinished() const { return myIsFinished; }
+
+    /**
+     * @return current time in milliseconds since timeline creation
+     */
+    ST_LOCAL double getTimeMilliSec() const { return myTimer.getElapsedTimeInMilliSec(); }
+
+    /**
+     * Record completed phase.
+     * @param theName      phase name (static string)
+     * @param theStartMSec phase start time
+     * @param theEndMSec   phase end   time
+     */
+    ST_CPPEXPORT void addPhase(const char*  theName,
+                               const double theStartMSec,
+                               const double theEndMSec);
+
+    /**
+     * Mark the first frame and write the timeline into the log.
+     * Does nothing if timeline has been already finished.
+     */
+    ST_CPPEXPORT void finish();
+
+        private:
+
+    StTimer            myTimer;      //!< timer started at timeline creation
+    StMutexSlim        myMutex;      //!< lock for phases list
+    std::vector<Phase> myPhases;     //!< recorded phases
+    size_t             myMainThread; //!< id of the thread created the timeline
+    volatile bool      myIsFinished; //!< first frame has been drawn
+
+};
+
+/**
+ * Auxiliary class measuring the scope as startup phase.
+ * The scope is also recorded as profiler zone.
+ */
+class StStartupPhase {
+
+        public:
+
+    /**
+     * Start phase.
+     */
+    ST_LOCAL StStartupPhase(const char* theName)
+    : myZone(theName),
+      myName(theName),
+      myStartMSec(-1.0) {
+        const StStartupTimeline& aTimeline = StStartupTimeline::GetDefault();
+        if(!aTimeline.isFinished()) {
+            myStartMSec = aTimeline.getTimeMilliSec();
+        }
+    }
+
+    /**
+     * Finish phase.
+     */
+    ST_LOCAL ~StStartupPhase() {
+        if(myStartMSec >= 0.0) {
+            StStartupTimeline& aTimeline = StStartupTimeline::GetDefault();
+            aTimeline.addPhase(myName, myStartMSec, aTimeline.getTimeMilliSec());
+        }
+    }
+
+        private:
+
+    StProfilerZone myZone;
+    const char*    myName;
+    double         myStartMSec;
+
+};
+
+/**
+ * Measure the current scope as startup phase with specified name.
+ */
+#define ST_STARTUP_PHASE(theName) StStartupPhase ST_PROFILER_CONCAT(aStartupPhase, __LINE__)(theName)
+
+#endif // __StStartupTimeline_h_
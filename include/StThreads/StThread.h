@@ -1,7 +1,7 @@
 /**
  * This is a header for threads creating/manipulating.
  * (redefinition for WinAPI and POSIX threads)
- * Copyright © 2008-2017 Kirill Gavrilov <kirill@sview.ru>
+ * Copyright © 2008-2026 Kirill Gavrilov <kirill@sview.ru>
  *
  * This code is licensed under MIT license (see docs/license-mit.txt for details).
  */
@@ -63,6 +63,21 @@ class StThread {
      */
     ST_CPPEXPORT static void setCurrentThreadName(const char* theName);
 
+    /**
+     * Change priority of the active thread relative to normal priority.
+     * Raising priority might require extra permissions on some systems.
+     * @param thePriority relative priority within -2..2 range, 0 means normal priority
+     * @return FALSE if operation is unsupported or not permitted
+     */
+    ST_CPPEXPORT static bool setCurrentThreadPriority(const int thePriority);
+
+    /**
+     * Bind the active thread to specified logical processor.
+     * @param theCpuIndex logical processor index, or -1 to allow execution on any processor
+     * @return FALSE if operation is unsupported or failed
+     */
+    ST_CPPEXPORT static bool setCurrentThreadAffinity(const int theCpuIndex);
+
     /**
      * Returns the CPU architecture used to build the program (may not match the system).
      */
@@ -0,0 +1,163 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * This code is licensed under MIT license (see docs/license-mit.txt for details).
+ */
+
+#ifndef __StThreadBudget_h_
+#define __StThreadBudget_h_
+
+#include <StStrings/StString.h>
+#include <StThreads/StMutexSlim.h>
+#include <StThreads/StTimer.h>
+
+#include <vector>
+
+/**
+ * Process-wide budget of CPU threads shared between concurrent decoders.
+ * Each decoder registers itself as a consumer with a weight (estimated decoding cost)
+ * and a limit of useful threads; logical processors not reserved for other threads (rendering)
+ * are distributed between consumers proportionally to their weights.
+ * Allocation is recomputed each time consumer is registered, changed or unregistered;
+ * consumers may pick up new allocation at their convenient point (e.g. reopening decoder on seek).
+ *
+ * Budget also keeps per-consumer busy time for estimating decoders utilization.
+ */
+class StThreadBudget {
+
+        public:
+
+    /**
+     * Role of the thread for adjusting priority.
+     */
+    enum ThreadRole {
+        ThreadRole_Render, //!< rendering thread
+        ThreadRole_Audio,  //!< audio output thread
+    };
+
+        public:
+
+    /**
+     * Return global budget of all logical processors.
+     */
+    ST_CPPEXPORT static StThreadBudget& GetDefault();
+
+    /**
+     * Main constructor.
+     * @param theNbCpus number of logical processors to distribute
+     */
+    ST_CPPEXPORT StThreadBudget(const int theNbCpus);
+
+    /**
+     * @return overall number of logical processors
+     */
+    ST_LOCAL int getNbCpus() const { return myNbCpus; }
+
+    /**
+     * @return number of threads reserved for non-decoding work
+     */
+    ST_LOCAL int getNbReserved() const { return myNbReserved; }
+
+    /**
+     * Set the number of threads reserved for non-decoding work (rendering, 1 by default).
+     */
+    ST_CPPEXPORT void setNbReserved(const int theNbReserved);
+
+    /**
+     * Register new consumer.
+     * @param theName       consumer name for statistics
+     * @param theWeight     estimated decoding cost
+     * @param theMaxThreads maximum number of threads consumer can utilize
+     * @return consumer id (positive number)
+     */
+    ST_CPPEXPORT int addConsumer(const StString& theName,
+                                 const double    theWeight,
+                                 const int       theMaxThreads);
+
+    /**
+     * Modify consumer parameters and reset its statistics.
+     * @return new allocation for this consumer
+     */
+    ST_CPPEXPORT int changeConsumer(const int       theId,
+                                    const StString& theName,
+                                    const double    theWeight,
+                                    const int       theMaxThreads);
+
+    /**
+     * Unregister consumer and return its threads to the budget.
+     */
+    ST_CPPEXPORT void removeConsumer(const int theId);
+
+    /**
+     * @return number of threads allocated to consumer
+     */
+    ST_CPPEXPORT int getNbThreads(const int theId) const;
+
+    /**
+     * Accumulate time consumer has been busy with decoding.
+     */
+    ST_CPPEXPORT void addBusyTime(const int    theId,
+                                  const double theMSec);
+
+    /**
+     * Format allocation and utilization of registered consumers.
+     */
+    ST_CPPEXPORT StString formatStats() const;
+
+        public: //! @name priority of non-decoding threads
+
+    /**
+     * @return TRUE if rendering and audio threads should have higher priority and dedicated processors
+     */
+    ST_LOCAL bool toBoostThreads() const { return myToBoost; }
+
+    /**
+     * Enable or disable boosting of rendering and audio threads.
+     * Takes effect on the next call of applyThreadRole() from these threads.
+     */
+    ST_LOCAL void setBoostThreads(const bool theToBoost) { myToBoost = theToBoost; }
+
+    /**
+     * Apply (or reset) priority and affinity of the calling thread according to its role and toBoostThreads() flag.
+     * Processors are assigned from the end of the list - within the reserved part of budget when possible.
+     * @return TRUE if thread has been boosted
+     */
+    ST_CPPEXPORT bool applyThreadRole(const ThreadRole theRole);
+
+        private:
+
+    /**
+     * Consumer entry.
+     */
+    struct Consumer {
+        StString Name;       //!< consumer name
+        StTimer  Timer;      //!< timer since registration
+        double   Weight;     //!< estimated decoding cost
+        double   BusyMSec;   //!< accumulated busy time
+        int      Id;         //!< consumer id
+        int      MaxThreads; //!< maximum number of useful threads
+        int      NbThreads;  //!< allocated number of threads
+    };
+
+    /**
+     * Recompute allocation, should be called under lock.
+     */
+    ST_LOCAL void rebalance();
+
+    /**
+     * Find consumer by id, should be called under lock.
+     */
+    ST_LOCAL Consumer* findConsumer(const int theId);
+
+        private:
+
+    mutable StMutexSlim   myMutex;      //!< lock for consumers list
+    std::vector<Consumer> myConsumers;  //!< registered consumers
+    int                   myNbCpus;     //!< number of logical processors
+    int                   myNbReserved; //!< number of threads reserved for non-decoding work
+    int                   myLastId;     //!< last assigned consumer id
+    volatile bool         myToBoost;    //!< boost rendering and audio threads
+
+};
+
+#endif // __StThreadBudget_h_
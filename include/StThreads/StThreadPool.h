@@ -0,0 +1,119 @@
+/**
+ * Copyright © 2026 Kirill Gavrilov <kirill@sview.ru>
+ *
+ * This code is licensed under MIT license (see docs/license-mit.txt for details).
+ */
+
+#ifndef __StThreadPool_h_
+#define __StThreadPool_h_
+
+#include <StThreads/StCondition.h>
+#include <StThreads/StThread.h>
+#include <StTemplates/StHandle.h>
+
+/**
+ * Fixed pool of worker threads for splitting a range of independent items (e.g. image rows) between CPU cores.
+ * Calling thread participates in the job and returns when all items have been processed.
+ * The pool performs one job at a time - concurrent requests and nested requests
+ * (issued from within job function) are executed serially by calling thread.
+ */
+class StThreadPool {
+
+        public:
+
+    /**
+     * Job function processing items within [theFrom, theTo) range.
+     */
+    typedef void (*JobFunction)(void*        theUserData,
+                                const size_t theFrom,
+                                const size_t theTo);
+
+        public:
+
+    /**
+     * Return global pool with one worker per logical processor (excluding calling thread).
+     */
+    ST_CPPEXPORT static StThreadPool& GetDefault();
+
+    /**
+     * Main constructor.
+     * @param theNbWorkers number of worker threads (excluding calling thread)
+     */
+    ST_CPPEXPORT StThreadPool(const int theNbWorkers);
+
+    /**
+     * Destructor, stops worker threads.
+     */
+    ST_CPPEXPORT ~StThreadPool();
+
+    /**
+     * @return number of threads processing the job (including calling thread)
+     */
+    ST_LOCAL int getNbThreads() const { return myNbWorkers + 1; }
+
+    /**
+     * Process items in parallel.
+     * @param theFunction  job function
+     * @param theUserData  argument passed to job function
+     * @param theNbItems   overall number of items
+     * @param theMinItems  minimal number of items passed to job function at once
+     */
+    ST_CPPEXPORT void perform(JobFunction  theFunction,
+                              void*        theUserData,
+                              const size_t theNbItems,
+                              const size_t theMinItems = 1);
+
+        private:
+
+    /**
+     * Worker thread function.
+     */
+    ST_LOCAL static SV_THREAD_FUNCTION workerThread(void* theWorker);
+
+    /**
+     * Worker thread loop.
+     */
+    ST_LOCAL void workerLoop(const int theWorkerId);
+
+    /**
+     * Process chunks of current job until none left.
+     */
+    ST_LOCAL void processChunks();
+
+        private:
+
+    /**
+     * Worker thread.
+     */
+    struct Worker {
+        StThreadPool*      Pool;    //!< pointer to the pool
+        int                Id;      //!< worker index
+        StCondition        Start;   //!< event to start processing current job
+        StHandle<StThread> Thread;  //!< worker thread
+
+        Worker() : Pool(NULL), Id(0), Start(false) {}
+    };
+
+        private:
+
+    Worker*          myWorkers;     //!< array of workers
+    int              myNbWorkers;   //!< number of workers
+    volatile int32_t myIsBusy;      //!< non-recursive flag serializing jobs (1 when the job is in progress)
+    StCondition      myJobDone;     //!< event indicating that all workers finished current job
+    JobFunction      myFunction;    //!< current job function
+    void*            myUserData;    //!< current job argument
+    size_t           myNbItems;     //!< current job items number
+    size_t           myChunkSize;   //!< current job items per chunk
+    int32_t          myNbChunks;    //!< current job chunks number
+    volatile int32_t myNextChunk;   //!< counter of taken chunks
+    volatile int32_t myNbActive;    //!< number of workers still processing current job
+    volatile bool    myToQuit;      //!< flag to stop workers
+
+        private: //! @name no copies, please
+
+    StThreadPool(const StThreadPool& theCopy);
+    const StThreadPool& operator=(const StThreadPool& theCopy);
+
+};
+
+#endif // __StThreadPool_h_
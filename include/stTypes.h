@@ -72,6 +72,12 @@
     #define ST_ATTR_OVERRIDE
 #endif
 
+// rvalue references (move semantics)
+#if (defined(__cplusplus) && (__cplusplus >= 201100L)) \
+ || (defined(_MSC_VER) && (_MSC_VER >= 1800))
+    #define ST_HAS_RVALUE_REFS
+#endif
+
 // Attribute to suppress -Wimplicit-fallthrough compiler warnings on switch cases without break
 #if defined(__cplusplus) && (__cplusplus >= 201703L)
     // part of C++17 standard